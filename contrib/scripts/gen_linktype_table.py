@@ -31,21 +31,24 @@ def generate_enum(data, ranges):
 		if raw_idx == PRIV_USE_END:
 			print(f'\t{"PRIVATE_USE_END": <26} = 0x{raw_idx:04X}U, /*!< End of private use range */')
 	print('};')
+	print('')
+	print('/*! \\brief One past the largest assigned LINKTYPE below the private use range */')
+	print(f'constexpr inline std::size_t linktype_public_slots{{0x{max(value for _, value, _ in data) + 1:04X}U}};')
 
 
 def generate_strs(data):
-	print('const std::unordered_map<linktype_t, std::string_view> linktype_names{')
+	print('constexpr static linktype_table_t<linktype_info_t> linktype_infos{')
 	for name, _, comment in data:
 		# special case for the BSD Loopback
 		if name == 'NULL':
 			name = 'BSD_LOOPBACK'
 
-		print(f'\t{{ linktype_t::{name: <26}, "{comment}"sv }},')
+		print(f'\t{{ linktype_t::{name: <26}, {{ "{name}"sv, "{comment}"sv }} }},')
 
 	for raw_idx in range(PRIV_USE_BEG, PRIV_USE_END + 1):
 		priv_idx = raw_idx - PRIV_USE_BEG
 		name = f'PRIVATE_USE_{priv_idx:03d}'
-		print(f'\t{{ linktype_t::{name: <26}, "Reserved for private use #{priv_idx}"sv }},')
+		print(f'\t{{ linktype_t::{name: <26}, {{ "{name}"sv, "Reserved for private use #{priv_idx}"sv }} }},')
 
 	print('};')
 
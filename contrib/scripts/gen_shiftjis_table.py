@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: BSD-3-Clause
+
+# Generates `src/panko/internal/shiftjis_table.hh` from the Python Shift-JIS codec
+#
+# Usage: gen_shiftjis_table.py > src/panko/internal/shiftjis_table.hh
+
+LEAD_RANGES = ((0x81, 0x9F), (0xE0, 0xEF))
+TRAIL_BEG   = 0x40
+TRAIL_END   = 0xFC
+TRAIL_SKIP  = 0x7F
+PER_LINE    = 12
+
+
+def leads():
+	for beg, end in LEAD_RANGES:
+		yield from range(beg, end + 1)
+
+
+def trails():
+	for trail in range(TRAIL_BEG, TRAIL_END + 1):
+		if trail != TRAIL_SKIP:
+			yield trail
+
+
+def decode(lead: int, trail: int) -> int:
+	try:
+		char = bytes((lead, trail)).decode('shift_jis')
+	except UnicodeDecodeError:
+		return 0
+	if len(char) != 1:
+		return 0
+	return ord(char)
+
+
+def main() -> int:
+	table = [decode(lead, trail) for lead in leads() for trail in trails()]
+	rows  = len(list(leads()))
+	cols  = len(list(trails()))
+
+	print('// SPDX-License-Identifier: BSD-3-Clause')
+	print('/* shiftjis_table.hh - Shift-JIS double byte to Unicode table */')
+	print('/* Generated by contrib/scripts/gen_shiftjis_table.py, do not edit */')
+	print('#pragma once')
+	print('#if !defined(PANKO_INTERNAL_SHIFTJIS_TABLE_HH)')
+	print('#define PANKO_INTERNAL_SHIFTJIS_TABLE_HH')
+	print('')
+	print('#include <array>')
+	print('#include <cstddef>')
+	print('#include <cstdint>')
+	print('')
+	print('namespace Panko::internal::shiftjis {')
+	print(f'\tconstexpr std::size_t rows{{{rows}zu}};')
+	print(f'\tconstexpr std::size_t cols{{{cols}zu}};')
+	print('')
+	print('\t/*! \\brief JIS X 0208 code points indexed by `(row * cols) + col`, 0 if unmapped.')
+	print('')
+	print('\t\tThe row is the lead byte with 0x81-0x9F mapped to 0-30 and 0xE0-0xEF mapped to 31-46, the column')
+	print('\t\tis the trail byte with 0x40-0x7E mapped to 0-62 and 0x80-0xFC mapped to 63-187.')
+	print('\t*/')
+	print(f'\tconstexpr std::array<std::uint16_t, {rows * cols}> double_byte{{{{')
+	for idx in range(0, len(table), PER_LINE):
+		line = ', '.join(f'0x{cp:04X}U' for cp in table[idx:idx + PER_LINE])
+		print(f'\t\t{line},')
+	print('\t}};')
+	print('}')
+	print('')
+	print('#endif /* PANKO_INTERNAL_SHIFTJIS_TABLE_HH */')
+
+	return 0
+
+
+if __name__ == '__main__':
+	raise SystemExit(main())
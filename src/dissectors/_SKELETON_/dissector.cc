@@ -1,2 +1,43 @@
 // SPDX-License-Identifier: BSD-3-Clause
 /* dissector.cc - Panko Dissector module entry point */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "panko/support/so_loader.hh"
+
+using Panko::support::dissector_abi_version;
+using Panko::support::dissector_descriptor_t;
+using Panko::support::registration_kind_t;
+using Panko::support::registration_t;
+
+namespace {
+	constexpr static std::array<registration_t, 1> registrations{{
+		/* TODO: Register the dissector under the keys it decodes */
+		{ registration_kind_t::UdpPort, 0U },
+	}};
+
+	std::size_t dissect(const std::uint8_t* const data, const std::size_t len, void* const ctx) {
+		static_cast<void>(data);
+		static_cast<void>(ctx);
+		return len;
+	}
+
+	constexpr static dissector_descriptor_t descriptor{
+		.abi_version        = dissector_abi_version,
+		.size               = sizeof(dissector_descriptor_t),
+		.name               = "%DISSECTOR_NAME%",
+		.description        = nullptr,
+		.registrations      = registrations.data(),
+		.registration_count = registrations.size(),
+		.init               = nullptr,
+		.fini               = nullptr,
+		.dissect            = dissect,
+		.heuristic          = nullptr,
+	};
+}
+
+PANKO_DISSECTOR_EXPORT const dissector_descriptor_t* panko_dissector_entry() {
+	return &descriptor;
+}
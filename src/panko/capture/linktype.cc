@@ -2,7 +2,6 @@
 /* linktype.cc - LINKTYPE values */
 
 #include <string_view>
-#include <unordered_map>
 
 #include "panko/capture/linktype.hh"
 
@@ -10,757 +9,761 @@ namespace Panko::capture {
 	using namespace std::literals::string_view_literals;
 
 	/* NOTE(aki): This was generated using `contrib/scripts/gen_linktype_table.py` */
-	const std::unordered_map<linktype_t, std::string_view> linktype_names{
-		{ linktype_t::BSD_LOOPBACK              , "BSD loopback encapsulation"sv },
-		{ linktype_t::ETHERNET                  , "IEEE 802.3 Ethernet"sv },
-		{ linktype_t::EXP_ETHERNET              , "Xerox experimental 3Mb Ethernet"sv },
-		{ linktype_t::AX25                      , "AX.25 layer 2 packets"sv },
-		{ linktype_t::PRONET                    , "Reserved for Proteon PRONet Token Ring"sv },
-		{ linktype_t::CHAOS                     , "Reserved for MIT Chaosnet"sv },
-		{ linktype_t::IEEE802_5                 , "IEEE 802.5 Token Ring"sv },
-		{ linktype_t::ARCNET_BSD                , "Reserved for ARCNET Data Packets with BSD encapsulation"sv },
-		{ linktype_t::SLIP                      , "SLIP"sv },
-		{ linktype_t::PPP                       , "PPP"sv },
-		{ linktype_t::FDDI                      , "FDDI: per ANSI INCITS 239-1994"sv },
-		{ linktype_t::PPP_HDLC                  , "PPP in HDLC-like framing"sv },
-		{ linktype_t::PPP_ETHER                 , "PPPoE"sv },
-		{ linktype_t::SYMANTEC_FIREWALL         , "Reserved for Symantec Enterprise Firewall"sv },
-		{ linktype_t::ATM_RFC1483               , "LLC/SNAP-encapsulated ATM"sv },
-		{ linktype_t::RAW                       , "Raw IP; begins with an IPv4 or IPv6 header"sv },
-		{ linktype_t::SLIP_BSDOS                , "Reserved for BSD/OS SLIP BPF header"sv },
-		{ linktype_t::PPP_BSDOS                 , "Reserved for BSD/OS PPP BPF header"sv },
-		{ linktype_t::C_HDLC                    , "Cisco PPP with HDLC framing"sv },
-		{ linktype_t::IEEE802_11                , "IEEE 802.11 wireless LAN"sv },
-		{ linktype_t::ATM_CLIP                  , "ATM Classical IP, with no header preceding IP"sv },
-		{ linktype_t::FRELAY                    , "Frame Relay LAPF frames"sv },
-		{ linktype_t::LOOP                      , "OpenBSD loopback encapsulation"sv },
-		{ linktype_t::ENC                       , "Reserved for OpenBSD IPSEC encapsulation"sv },
-		{ linktype_t::LANE8023                  , "Reserved for ATM LANE + 802.3"sv },
-		{ linktype_t::HIPPI                     , "Reserved for NetBSD HIPPI"sv },
-		{ linktype_t::HDLC                      , "Reserved for NetBSD HDLC framing"sv },
-		{ linktype_t::LINUX_SLL                 , "Linux cooked capture encapsulation"sv },
-		{ linktype_t::LTALK                     , "Apple LocalTalk"sv },
-		{ linktype_t::ECONET                    , "Reserved for Acorn Econet"sv },
-		{ linktype_t::IPFILTER                  , "Reserved for OpenBSD ipfilter"sv },
-		{ linktype_t::PFLOG                     , "OpenBSD pflog; struct pfloghdr structure"sv },
-		{ linktype_t::CISCO_IOS                 , "Reserved for Cisco-internal use"sv },
-		{ linktype_t::IEEE802_11_PRISM          , "Prism monitor mode"sv },
-		{ linktype_t::IEEE802_11_AIRONET        , "Reserved for 802.11 + FreeFreeBSD Aironet radio metadata"sv },
-		{ linktype_t::HHDLC                     , "Reserved for Siemens HiPath HDLC"sv },
-		{ linktype_t::IP_OVER_FC                , "IP-over-Fibre Channel, starting with the Network_Header"sv },
-		{ linktype_t::SUNATM                    , "ATM traffic captured from a SunATM device"sv },
-		{ linktype_t::RIO                       , "Reserved for RapidIO"sv },
-		{ linktype_t::PCI_EXP                   , "Reserved for PCI Express"sv },
-		{ linktype_t::AURORA                    , "Reserved for Xilinx Aurora link layer"sv },
-		{ linktype_t::IEEE802_11_RADIOTAP       , "Radiotap header, followed by an 802.11 header"sv },
-		{ linktype_t::TZSP                      , "Reserved for Tazmen Sniffer Protocol"sv },
-		{ linktype_t::ARCNET_LINUX              , "Reserved for ARCNET Data Packets with Linux encapsulation"sv },
-		{ linktype_t::JUNIPER_MLPPP             , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_MLFR              , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_ES                , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_GGSN              , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_MFR               , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_ATM2              , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_SERVICES          , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_ATM1              , "Reserved for Juniper Networks"sv },
-		{ linktype_t::APPLE_IP_OVER_IEEE1394    , "Apple IP-over-IEEE 1394 cooked header"sv },
-		{ linktype_t::MTP2_WITH_PHDR            , "Signaling System 7 (SS7) Message Transfer Part Level"sv },
-		{ linktype_t::MTP2                      , "SS7 Level 2"sv },
-		{ linktype_t::MTP3                      , "SS7 Level 3, with no MTP2 header"sv },
-		{ linktype_t::SCCP                      , "SS7 Control Part, with no MTP3 or MTP2 header"sv },
-		{ linktype_t::DOCSIS                    , "DOCSIS MAC frames"sv },
-		{ linktype_t::LINUX_IRDA                , "Linux-IrDA packets"sv },
-		{ linktype_t::IBM_SP                    , "Reserved for IBM SP switch"sv },
-		{ linktype_t::IBM_SN                    , "Reserved for IBM Next Federation switch"sv },
-		{ linktype_t::RESERVED_01               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_02               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_03               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_04               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_05               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_06               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_07               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_08               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_09               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_10               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_11               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_12               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_13               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_14               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_15               , "For private use (deprecated)"sv },
-		{ linktype_t::RESERVED_16               , "For private use (deprecated)"sv },
-		{ linktype_t::IEEE802_11_AVS            , "AVS header, followed by an 802.11 header"sv },
-		{ linktype_t::JUNIPER_MONITOR           , "Reserved for Juniper Networks"sv },
-		{ linktype_t::BACNET_MS_TP              , "BACnet MS/TP frames"sv },
-		{ linktype_t::PPP_PPPD                  , "PPP in HDLC-like encapsulation, like LINKTYPE_PPP_HDLC, different stuffing"sv },
-		{ linktype_t::JUNIPER_PPPOE             , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_PPPOE_ATM         , "Reserved for Juniper Networks"sv },
-		{ linktype_t::GPRS_LLC                  , "General Packet Radio Service Logical Link Control, as per 3GPP TS 04.64"sv },
-		{ linktype_t::GPF_T                     , "Transparent-mapped generic framing procedure"sv },
-		{ linktype_t::GPF_F                     , "Frame-mapped generic framing procedure"sv },
-		{ linktype_t::GCOM_T1E1                 , "Reserved for Gcom T1/E1 line monitoring equipment"sv },
-		{ linktype_t::GCOM_SERIAL               , "Reserved for Gcom T1/E1 line monitoring equipment"sv },
-		{ linktype_t::JUNIPER_PIC_PEER          , "Reserved for Juniper Networks"sv },
-		{ linktype_t::ERF_ETH                   , "Endace ERF header followed by 802.3 Ethernet"sv },
-		{ linktype_t::ERF_POS                   , "Endace ERF header followed by Packet-over-SONET"sv },
-		{ linktype_t::LINUX_LAPD                , "Linux vISDN LAPD frames"sv },
-		{ linktype_t::JUNIPER_ETHER             , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_PPP               , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_FRELAY            , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_CHDLC             , "Reserved for Juniper Networks"sv },
-		{ linktype_t::MFR                       , "FRF.16.1 Multi-Link Frame Relay frames, beginning with an FRF.12 Interface fragmentation format fragmentation header"sv },
-		{ linktype_t::JUNIPER_VP                , "Reserved for Juniper Networks"sv },
-		{ linktype_t::A429                      , "Reserved for ARINC 429 frames"sv },
-		{ linktype_t::A653_ICM                  , "Reserved for Arinc 653 Interpartition Communication messages"sv },
-		{ linktype_t::USB_FREEBSD               , "USB packets, beginning with a FreeBSD USB header"sv },
-		{ linktype_t::BLUETOOTH_HCI_H4          , "Bluetooth HCI UART transport layer; the frame contains an HCI packet indicator octet, as specified by the UART Transport Layer portion of the most recent Bluetooth Core specification, followed by an HCI packet of the specified packet type, as specified by the Host Controller Interface Functional Specification portion of the most recent Bluetooth Core Specification"sv },
-		{ linktype_t::IEEE802_16_MAC_CPS        , "Reserved for IEEE 802.16 MAC Common Part Sublayer"sv },
-		{ linktype_t::USB_LINUX                 , "USB packets, beginning with a Linux USB header, as specified by the struct usbmon_packet in the Documentation/usb/usbmon.txt file in the Linux source tree. Only the first 48 octets of that header are present. All fields in the header are in host byte order. When performing a live capture, the host byte order is the byte order of the machine on which the packets are captured. When reading a PCAP file, the byte order is the byte order for the file, as specified by the file's magic number; when reading a PCAPNG file, the byte order is the byte order for the section of the PCAPNG file, as specified by the Section Header Block"sv },
-		{ linktype_t::CAN20B                    , "Reserved for Controller Area Network (CAN) v. 2.0B packets"sv },
-		{ linktype_t::IEEE802_15_4_LINUX        , "IEEE 802.15.4, with address fields padded, as is done by Linux drivers"sv },
-		{ linktype_t::PPI                       , "Per-Packet Information information, as specified by the Per-Packet Information Header Specification , followed by a packet with the LINKTYPE_ value specified by the pph_dlt field of that header"sv },
-		{ linktype_t::IEEE802_16_MAC_CPS_RADIO  , "Reserved for 802.16 MAC Common Part Sublayer plus radio header"sv },
-		{ linktype_t::JUNIPER_ISM               , "Reserved for Juniper Networks"sv },
-		{ linktype_t::IEEE802_15_4_WITHFCS      , "IEEE 802.15.4 Low-Rate Wireless Networks, with each packet having the FCS at the end of the frame"sv },
-		{ linktype_t::SITA                      , "Various link-layer types, with a pseudo-header"sv },
-		{ linktype_t::ERF                       , "Endace ERF records"sv },
-		{ linktype_t::RAIF1                     , "Reserved for Ethernet packets captured from a u10 Networks board"sv },
-		{ linktype_t::IPMB_KONTRON              , "Reserved for IPMB packet for IPMI, with a 2-octet header"sv },
-		{ linktype_t::JUNIPER_ST                , "Reserved for Juniper Networks"sv },
-		{ linktype_t::BLUETOOTH_HCI_H4_WITH_PHDR, "Bluetooth HCI UART transport layer; the frame contains a 4-octet direction field, in network byte order (big-endian), the low-order bit of which is set if the frame was sent from the host to the controller and clear if the frame was received by the host from the controller, followed by an HCI packet indicator octet, as specified by the UART Transport Layer portion of the most recent Bluetooth Core specification, followed by an HCI packet of the specified packet type, as specified by the Host Controller Interface Functional Specification portion of the most recent Bluetooth Core Specification"sv },
-		{ linktype_t::AX25_KISS                 , "AX.25 packet, with a KISS header"sv },
-		{ linktype_t::LAPD                      , "Link Access Procedures on the D Channel (LAPD) frames, starting with the address field, with no pseudo-header"sv },
-		{ linktype_t::PPP_WITH_DIR              , "PPP, as per RFC 1661 and RFC 1662 , preceded with a one-octet pseudo-header with a zero value meaning received by this host and a non-zero value meaning sent by this host; if the first 2 octets are 0xff and 0x03, it's PPP in HDLC-like framing, with the PPP header following those two octets, otherwise it's PPP without framing, and the packet begins with the PPP header. The data in the frame is not octet-stuffed or bit-stuffed"sv },
-		{ linktype_t::C_HDLC_WITH_DIR           , "Cisco PPP with HDLC framing, preceded with a one-octet pseudo-header with a zero value meaning received by this host and a non-zero value meaning sent by this host"sv },
-		{ linktype_t::FRELAY_WITH_DIR           , "Frame Relay LAPF frames, beginning with a one-octet pseudo-header with a zero value meaning received by this host (DCE->DTE) and a non-zero value meaning sent by this host (DTE->DCE), followed by an ITU-T Recommendation Q.922 LAPF header starting with the address field, and without an FCS at the end of the frame"sv },
-		{ linktype_t::LAPB_WITH_DIR             , "Link Access Procedure, Balanced (LAPB), as specified by ITU-T Recommendation X.25 , preceded with a one-octet pseudo-header with a zero value meaning received by this host (DCE->DTE) and a non-zero value meaning sent by this host (DTE->DCE)"sv },
-		{ linktype_t::Reserved                  , "Reserved for an unspecified link-layer type"sv },
-		{ linktype_t::I2C_LINUX                 , "Linux I2C packets"sv },
-		{ linktype_t::FLEXRAY                   , "FlexRay frames or symbols, with a pseudo-header"sv },
-		{ linktype_t::MOST                      , "Reserved for Media Oriented Systems Transport (MOST) bus"sv },
-		{ linktype_t::LIN                       , "Local Interconnect Network (LIN) automotive bus"sv },
-		{ linktype_t::X2E_SERIAL                , "Reserved for X2E serial line captures"sv },
-		{ linktype_t::X2E_XORAYA                , "Reserved for X2E Xoraya data loggers"sv },
-		{ linktype_t::IEEE802_15_4_NONASK_PHY   , "IEEE 802.15.4 Low-Rate Wireless Networks, with each packet having the FCS at the end of the frame, and with the PHY-level data for the O-QPSK, BPSK, GFSK, MSK, and RCC DSS BPSK PHYs (4 octets of 0 as preamble, one octet of SFD, one octet of frame length + reserved bit) preceding the MAC-layer data (starting with the frame control field)"sv },
-		{ linktype_t::LINUX_EVDEV               , "Reserved for Linux evdev messages"sv },
-		{ linktype_t::GSMTAP_UM                 , "Reserved for GSM Um interface, with gsmtap header"sv },
-		{ linktype_t::GSMTAP_ABIS               , "Reserved for GSM Abis interface, with gsmtap header"sv },
-		{ linktype_t::MPLS                      , "MPLS packets with MPLS label as the header"sv },
-		{ linktype_t::USB_LINUX_MMAPPED         , "USB packets, beginning with a Linux USB header, as specified by the struct usbmon_packet in the Documentation/usb/usbmon.txt file in the Linux source tree. All 64 octets of the header are present. All fields in the header are in host byte order. When performing a live capture, the host byte order is the byte order of the machine on which the packets are captured. When reading a PCAP file, the byte order is the byte order for the file, as specified by the file's magic number; when reading a PCAPNG file, the byte order is the byte order for the section of the PCAPNG file, as specified by the Section Header Block. For isochronous transfers, the ndesc field specifies the number of isochronous descriptors that follow"sv },
-		{ linktype_t::DECT                      , "Reserved for DECT packets, with a pseudo-header"sv },
-		{ linktype_t::AOS                       , "Reserved for OS Space Data Link Protocol"sv },
-		{ linktype_t::WIHART                    , "Reserved for Wireless HART (Highway Addressable Remote Transducer)"sv },
-		{ linktype_t::FC_2                      , "Fibre Channel FC-2 frames, beginning with a Frame_Header"sv },
-		{ linktype_t::FC_2_WITH_FRAME_DELIMS    , "Fibre Channel FC-2 frames, beginning an encoding of the SOF, followed by a Frame_Header, and ending with an encoding of the SOF. The encodings represent the frame delimiters as 4-octet sequences representing the corresponding ordered sets, with K28.5 represented as 0xBC, and the D symbols as the corresponding octet values; for example, SOFi2, which is K28.5 - D21.5 - D1.2 - D21.2, is represented as 0xBC 0xB5 0x55 0x55"sv },
-		{ linktype_t::IPNET                     , "Solaris ipnet"sv },
-		{ linktype_t::CAN_SOCKETCAN             , "Controller Area Network frames"sv },
-		{ linktype_t::IPV4                      , "Raw IPv4; the packet begins with an IPv4 header"sv },
-		{ linktype_t::IPV6                      , "Raw IPv6; the packet begins with an IPv6 header"sv },
-		{ linktype_t::IEEE802_15_4_NOFCS        , "IEEE 802.15.4 Low-Rate Wireless Network, without the FCS at the end of the frame"sv },
-		{ linktype_t::DBUS                      , "Raw D-Bus messages , starting with the endianness flag, followed by the message type, etc., but without the authentication handshake before the message sequence"sv },
-		{ linktype_t::JUNIPER_VS                , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_SRX_E2E           , "Reserved for Juniper Networks"sv },
-		{ linktype_t::JUNIPER_FIBRECHANNEL      , "Reserved for Juniper Networks"sv },
-		{ linktype_t::DVB_CI                    , "DVB-CI messages"sv },
-		{ linktype_t::MUX27010                  , "Variant of 3GPP TS 27.010 multiplexing protocol"sv },
-		{ linktype_t::STANAG_5066_D_PDU         , "D_PDUs as described by NATO standard STANAG 5066, starting with the synchronization sequence, and including both header and data CRCs. The current version of STANAG 5066 is backwards-compatible with the 1.0.2 version , although newer versions are classified"sv },
-		{ linktype_t::JUNIPER_ATM_CEMIC         , "Reserved for Juniper Networks"sv },
-		{ linktype_t::NFLOG                     , "Linux netlink NETLINK NFLOG socket log messages"sv },
-		{ linktype_t::NETANALYZER               , "Ethernet frames with netANALYZER pseudo-header"sv },
-		{ linktype_t::NETANALYZER_TRANSPARENT   , "Ethernet frames with netANALYZER pseudo-header, preamble, and SFD"sv },
-		{ linktype_t::IPOIB                     , "IP-over-InfiniBand"sv },
-		{ linktype_t::MPEG_2_TS                 , "MPEG-2 Transport Stream transport packets"sv },
-		{ linktype_t::NG40                      , "Frames from ng4T GmbH's ng40 protocol tester"sv },
-		{ linktype_t::NFC_LLCP                  , "NFC Logical Link Control Protocol frames, with a pseudo-header"sv },
-		{ linktype_t::PFSYNC                    , "Reserved for pfsync output"sv },
-		{ linktype_t::INFINIBAND                , "Raw InfiniBand frames, starting with the Local Routing Header, as specified in Chapter 5 Data packet format of InfiniBand™ Architectural Specification Release 1.2.1 Volume 1 - General Specifications"sv },
-		{ linktype_t::SCTP                      , "SCTP packets, as defined by RFC 4960 , with no lower-level protocols such as IPv4 or IPv6"sv },
-		{ linktype_t::USBPCAP                   , "USB packets, beginning with a USBPcap header"sv },
-		{ linktype_t::RTAC_SERIAL               , "Serial-line packet from the Schweitzer Engineering Laboratories RTAC product"sv },
-		{ linktype_t::BLUETOOTH_LE_LL           , "Bluetooth Low Energy air interface Link Layer packets, in the format described in Section 2.1 (PACKET FORMAT) of volume 6 of the Bluetooth Specification Version 4.0 (see PDF page 2200), but without the Preamble"sv },
-		{ linktype_t::WIRESHARK_UPPER_PDU       , "Reserved for Wireshark"sv },
-		{ linktype_t::NETLINK                   , "Linux Netlink capture encapsulation"sv },
-		{ linktype_t::BLUETOOTH_LINUX_MONITOR   , "Bluetooth Linux Monitor"sv },
-		{ linktype_t::BLUETOOTH_BREDR_BB        , "Bluetooth Basic Rate and Enhanced Data Rate baseband packets"sv },
-		{ linktype_t::BLUETOOTH_LE_LL_WITH_PHDR , "Bluetooth Low Energy link-layer packets"sv },
-		{ linktype_t::PROFIBUS_DL               , "PROFIBUS data link layer packets, as specified by IEC standard 61158-4-3, beginning with the start delimiter, ending with the end delimiter, and including all octets between them"sv },
-		{ linktype_t::PKTAP                     , "Apple PKTAP capture encapsulation"sv },
-		{ linktype_t::EPON                      , "Ethernet-over-passive-optical-network packets, starting with the last 6 octets of the modified preamble as specified by 65.1.3.2 Transmit in Clause 65 of Section 5 of IEEE 802.3, followed immediately by an Ethernet frame"sv },
-		{ linktype_t::IPMI_HPM_2                , "IPMI trace packets, as specified by Table 3-20 Trace Data Block Format in the PICMG HPM.2 specification The timestamps for packets in this format must match the timestamps in the Trace Data Blocks"sv },
-		{ linktype_t::ZWAVE_R1_R2               , "Z-Wave RF profile R1 and R2 packets"sv },
-		{ linktype_t::ZWAVE_R3                  , "Z-Wave RF profile R3 packets"sv },
-		{ linktype_t::WATTSTOPPER_DLM           , "WattStopper Digital Lighting Management (DLM) and Legrand Nitoo Open protocol packets"sv },
-		{ linktype_t::ISO_14443                 , "ISO 14443 contactless smartcard messages"sv },
-		{ linktype_t::RDS                       , "IEC 62106 Radio data system (RDS) groups"sv },
-		{ linktype_t::USB_DARWIN                , "USB packets captured on a Darwin-based operating system (macOS, etc.)"sv },
-		{ linktype_t::OPENFLOW                  , "Reserved for OpenBSD DLT_OPENFLOW"sv },
-		{ linktype_t::SDLC                      , "SDLC packets, as specified by Chapter 1, DLC Links, section Synchronous Data Link Control (SDLC) of Systems Network Architecture Formats, GA27-3136-20 , without the flag fields, zero-bit insertion, or Frame Check Sequence field, containing SNA path information units (PIUs) as the payload"sv },
-		{ linktype_t::TI_LLN_SNIFFER            , "Reserved for Texas Instruments protocol sniffer"sv },
-		{ linktype_t::LORATAP                   , "LoRaTap pseudo-header , followed by the payload, which is typically the PHYPayload from the LoRaWan specification"sv },
-		{ linktype_t::VSOCK                     , "Protocol for communication between host and guest machines in VMware and KVM hypervisors"sv },
-		{ linktype_t::NORDIC_BLE                , "Messages to and from a Nordic Semiconductor nRF Sniffer for Bluetooth LE packets"sv },
-		{ linktype_t::DOCSIS31_XRA31            , "DOCSIS packets and bursts, preceded by a pseudo-header"sv },
-		{ linktype_t::ETHERNET_MPACKET          , "mPackets, as specified by IEEE 802.3br Figure 99-4, starting with the preamble and always ending with a CRC field"sv },
-		{ linktype_t::DISPLAYPORT_AUX           , "DisplayPort AUX channel monitoring messages"sv },
-		{ linktype_t::LINUX_SLL2                , "Linux cooked capture encapsulation v2"sv },
-		{ linktype_t::SERCOS_MONITOR            , "Reserved for Sercos Monitor"sv },
-		{ linktype_t::OPENVIZSLA                , "OpenVizsla FPGA-based USB sniffer"sv },
-		{ linktype_t::EBHSCR                    , "Elektrobit High Speed Capture and Replay (EBHSCR) format"sv },
-		{ linktype_t::VPP_DISPATCH              , "fd.io VPP graph dispatcher trace records"sv },
-		{ linktype_t::DSA_TAG_BRCM              , "Ethernet frames, with a Broadcom switch tag inserted"sv },
-		{ linktype_t::DSA_TAG_BRCM_PREPEND      , "Ethernet frames, with a Broadcom switch tag prepended"sv },
-		{ linktype_t::IEEE802_15_4_TAP          , "IEEE 802.15.4 Low-Rate Wireless Networks, with a pseudo-header containing TLVs with metadata preceding the 802.15.4 header"sv },
-		{ linktype_t::DSA_TAG_DSA               , "Ethernet frames, with a Marvell DSA switch tag inserted"sv },
-		{ linktype_t::DSA_TAG_EDSA              , "Ethernet frames, with a Marvell EDSA switch tag inserted"sv },
-		{ linktype_t::ELEE                      , "Payload of lawful intercept packets using the ELEE protocol The packet begins with the ELEE header; it does not include any transport-layer or lower-layer headers for protocols used to transport ELEE packets"sv },
-		{ linktype_t::Z_WAVE_SERIAL             , "Serial frames transmitted between a host and a Z-Wave chip over an RS-232 or USB serial connection"sv },
-		{ linktype_t::USB_2_0                   , "USB 2.0, 1.1, or 1.0 packet, beginning with a PID, as described by Chapter 8 Protocol Layer of the the Universal Serial Bus Specification Revision 2.0"sv },
-		{ linktype_t::ATSC_ALP                  , "ATSC Link-Layer Protocol frames, as described in section 5 of the A/330 Link-Layer Protocol specification, found at https://www.atsc.org/atsc-documents/type/3-0-standards/, beginning with a Base Header"sv },
-		{ linktype_t::ETW                       , "Event Tracing for Windows messages"sv },
-		{ linktype_t::NETANALYZER_NG            , "Reserved for Hilscher Gesellschaft fuer Systemautomation mbH netANALYZER NG hardware and software"sv },
-		{ linktype_t::ZBOSS_NCP                 , "ZBOSS NCP Serial Protocol, with a pseudo-header"sv },
-		{ linktype_t::USB_2_0_LOW_SPEED         , "Low-Speed USB 2.0, 1.1, or 1.0 packet, beginning with a PID, as described by Chapter 8 Protocol Layer of the https://www.usb.org/document-library/usb-20-specification the Universal Serial Bus Specification Revision 2.0"sv },
-		{ linktype_t::USB_2_0_FULL_SPEED        , "Full-Speed USB 2.0, 1.1, or 1.0 packet, beginning with a PID, as described by Chapter 8 Protocol Layer of the https://www.usb.org/document-library/usb-20-specification the Universal Serial Bus Specification Revision 2.0"sv },
-		{ linktype_t::USB_2_0_HIGH_SPEED        , "High-Speed USB 2.0 packet, beginning with a PID, as described by Chapter 8 Protocol Layer of the https://www.usb.org/document-library/usb-20-specification the Universal Serial Bus Specification Revision 2.0"sv },
-		{ linktype_t::AUERSWALD_LOG             , "Auerswald Logger Protocol, as described in https://github.com/Auerswald-GmbH/auerlog/blob/master/auerlog.txt"sv },
-		{ linktype_t::ZWAVE_TAP                 , "Z-Wave packets, as specified by ITU-T Recommendation G.9959, with a https://gitlab.com/exegin/zwave-g9959-tap TAP meta-data header"sv },
-		{ linktype_t::SILABS_DEBUG_CHANNEL      , "Silicon Labs debug channel protocol, as described in https://github.com/SiliconLabs/java_packet_trace_library/blob/master/doc/debug-channel.md"sv },
-		{ linktype_t::FIRA_UCI                  , "Ultra-wideband (UWB) controller interface protocol (UCI)"sv },
-		{ linktype_t::MDB                       , "MDB (Multi-Drop Bus) protocol between a vending machine controller and peripherals inside the vending machine, with the message format specified by https://www.kaiser.cx/pcap-mdb.html the PCAP format for MDB specification"sv },
-		{ linktype_t::DECT_NR                   , "DECT-2020 New Radio (NR) MAC layer specified in https://www.etsi.org/committee/1394-dect ETSI TS 103 636-4. The Physical Header Field is always encoded using 80 bits (10 bytes). Broadcast transmissions using 40 bits (5 bytes) is padded with 40 zero bits (5 bytes). When padding is used the Receiver Identity value 0x0000 (reserved address) is used to detect broadcast transmissions"sv },
-		{ linktype_t::PRIVATE_USE_000           , "Reserved for private use #0"sv },
-		{ linktype_t::PRIVATE_USE_001           , "Reserved for private use #1"sv },
-		{ linktype_t::PRIVATE_USE_002           , "Reserved for private use #2"sv },
-		{ linktype_t::PRIVATE_USE_003           , "Reserved for private use #3"sv },
-		{ linktype_t::PRIVATE_USE_004           , "Reserved for private use #4"sv },
-		{ linktype_t::PRIVATE_USE_005           , "Reserved for private use #5"sv },
-		{ linktype_t::PRIVATE_USE_006           , "Reserved for private use #6"sv },
-		{ linktype_t::PRIVATE_USE_007           , "Reserved for private use #7"sv },
-		{ linktype_t::PRIVATE_USE_008           , "Reserved for private use #8"sv },
-		{ linktype_t::PRIVATE_USE_009           , "Reserved for private use #9"sv },
-		{ linktype_t::PRIVATE_USE_010           , "Reserved for private use #10"sv },
-		{ linktype_t::PRIVATE_USE_011           , "Reserved for private use #11"sv },
-		{ linktype_t::PRIVATE_USE_012           , "Reserved for private use #12"sv },
-		{ linktype_t::PRIVATE_USE_013           , "Reserved for private use #13"sv },
-		{ linktype_t::PRIVATE_USE_014           , "Reserved for private use #14"sv },
-		{ linktype_t::PRIVATE_USE_015           , "Reserved for private use #15"sv },
-		{ linktype_t::PRIVATE_USE_016           , "Reserved for private use #16"sv },
-		{ linktype_t::PRIVATE_USE_017           , "Reserved for private use #17"sv },
-		{ linktype_t::PRIVATE_USE_018           , "Reserved for private use #18"sv },
-		{ linktype_t::PRIVATE_USE_019           , "Reserved for private use #19"sv },
-		{ linktype_t::PRIVATE_USE_020           , "Reserved for private use #20"sv },
-		{ linktype_t::PRIVATE_USE_021           , "Reserved for private use #21"sv },
-		{ linktype_t::PRIVATE_USE_022           , "Reserved for private use #22"sv },
-		{ linktype_t::PRIVATE_USE_023           , "Reserved for private use #23"sv },
-		{ linktype_t::PRIVATE_USE_024           , "Reserved for private use #24"sv },
-		{ linktype_t::PRIVATE_USE_025           , "Reserved for private use #25"sv },
-		{ linktype_t::PRIVATE_USE_026           , "Reserved for private use #26"sv },
-		{ linktype_t::PRIVATE_USE_027           , "Reserved for private use #27"sv },
-		{ linktype_t::PRIVATE_USE_028           , "Reserved for private use #28"sv },
-		{ linktype_t::PRIVATE_USE_029           , "Reserved for private use #29"sv },
-		{ linktype_t::PRIVATE_USE_030           , "Reserved for private use #30"sv },
-		{ linktype_t::PRIVATE_USE_031           , "Reserved for private use #31"sv },
-		{ linktype_t::PRIVATE_USE_032           , "Reserved for private use #32"sv },
-		{ linktype_t::PRIVATE_USE_033           , "Reserved for private use #33"sv },
-		{ linktype_t::PRIVATE_USE_034           , "Reserved for private use #34"sv },
-		{ linktype_t::PRIVATE_USE_035           , "Reserved for private use #35"sv },
-		{ linktype_t::PRIVATE_USE_036           , "Reserved for private use #36"sv },
-		{ linktype_t::PRIVATE_USE_037           , "Reserved for private use #37"sv },
-		{ linktype_t::PRIVATE_USE_038           , "Reserved for private use #38"sv },
-		{ linktype_t::PRIVATE_USE_039           , "Reserved for private use #39"sv },
-		{ linktype_t::PRIVATE_USE_040           , "Reserved for private use #40"sv },
-		{ linktype_t::PRIVATE_USE_041           , "Reserved for private use #41"sv },
-		{ linktype_t::PRIVATE_USE_042           , "Reserved for private use #42"sv },
-		{ linktype_t::PRIVATE_USE_043           , "Reserved for private use #43"sv },
-		{ linktype_t::PRIVATE_USE_044           , "Reserved for private use #44"sv },
-		{ linktype_t::PRIVATE_USE_045           , "Reserved for private use #45"sv },
-		{ linktype_t::PRIVATE_USE_046           , "Reserved for private use #46"sv },
-		{ linktype_t::PRIVATE_USE_047           , "Reserved for private use #47"sv },
-		{ linktype_t::PRIVATE_USE_048           , "Reserved for private use #48"sv },
-		{ linktype_t::PRIVATE_USE_049           , "Reserved for private use #49"sv },
-		{ linktype_t::PRIVATE_USE_050           , "Reserved for private use #50"sv },
-		{ linktype_t::PRIVATE_USE_051           , "Reserved for private use #51"sv },
-		{ linktype_t::PRIVATE_USE_052           , "Reserved for private use #52"sv },
-		{ linktype_t::PRIVATE_USE_053           , "Reserved for private use #53"sv },
-		{ linktype_t::PRIVATE_USE_054           , "Reserved for private use #54"sv },
-		{ linktype_t::PRIVATE_USE_055           , "Reserved for private use #55"sv },
-		{ linktype_t::PRIVATE_USE_056           , "Reserved for private use #56"sv },
-		{ linktype_t::PRIVATE_USE_057           , "Reserved for private use #57"sv },
-		{ linktype_t::PRIVATE_USE_058           , "Reserved for private use #58"sv },
-		{ linktype_t::PRIVATE_USE_059           , "Reserved for private use #59"sv },
-		{ linktype_t::PRIVATE_USE_060           , "Reserved for private use #60"sv },
-		{ linktype_t::PRIVATE_USE_061           , "Reserved for private use #61"sv },
-		{ linktype_t::PRIVATE_USE_062           , "Reserved for private use #62"sv },
-		{ linktype_t::PRIVATE_USE_063           , "Reserved for private use #63"sv },
-		{ linktype_t::PRIVATE_USE_064           , "Reserved for private use #64"sv },
-		{ linktype_t::PRIVATE_USE_065           , "Reserved for private use #65"sv },
-		{ linktype_t::PRIVATE_USE_066           , "Reserved for private use #66"sv },
-		{ linktype_t::PRIVATE_USE_067           , "Reserved for private use #67"sv },
-		{ linktype_t::PRIVATE_USE_068           , "Reserved for private use #68"sv },
-		{ linktype_t::PRIVATE_USE_069           , "Reserved for private use #69"sv },
-		{ linktype_t::PRIVATE_USE_070           , "Reserved for private use #70"sv },
-		{ linktype_t::PRIVATE_USE_071           , "Reserved for private use #71"sv },
-		{ linktype_t::PRIVATE_USE_072           , "Reserved for private use #72"sv },
-		{ linktype_t::PRIVATE_USE_073           , "Reserved for private use #73"sv },
-		{ linktype_t::PRIVATE_USE_074           , "Reserved for private use #74"sv },
-		{ linktype_t::PRIVATE_USE_075           , "Reserved for private use #75"sv },
-		{ linktype_t::PRIVATE_USE_076           , "Reserved for private use #76"sv },
-		{ linktype_t::PRIVATE_USE_077           , "Reserved for private use #77"sv },
-		{ linktype_t::PRIVATE_USE_078           , "Reserved for private use #78"sv },
-		{ linktype_t::PRIVATE_USE_079           , "Reserved for private use #79"sv },
-		{ linktype_t::PRIVATE_USE_080           , "Reserved for private use #80"sv },
-		{ linktype_t::PRIVATE_USE_081           , "Reserved for private use #81"sv },
-		{ linktype_t::PRIVATE_USE_082           , "Reserved for private use #82"sv },
-		{ linktype_t::PRIVATE_USE_083           , "Reserved for private use #83"sv },
-		{ linktype_t::PRIVATE_USE_084           , "Reserved for private use #84"sv },
-		{ linktype_t::PRIVATE_USE_085           , "Reserved for private use #85"sv },
-		{ linktype_t::PRIVATE_USE_086           , "Reserved for private use #86"sv },
-		{ linktype_t::PRIVATE_USE_087           , "Reserved for private use #87"sv },
-		{ linktype_t::PRIVATE_USE_088           , "Reserved for private use #88"sv },
-		{ linktype_t::PRIVATE_USE_089           , "Reserved for private use #89"sv },
-		{ linktype_t::PRIVATE_USE_090           , "Reserved for private use #90"sv },
-		{ linktype_t::PRIVATE_USE_091           , "Reserved for private use #91"sv },
-		{ linktype_t::PRIVATE_USE_092           , "Reserved for private use #92"sv },
-		{ linktype_t::PRIVATE_USE_093           , "Reserved for private use #93"sv },
-		{ linktype_t::PRIVATE_USE_094           , "Reserved for private use #94"sv },
-		{ linktype_t::PRIVATE_USE_095           , "Reserved for private use #95"sv },
-		{ linktype_t::PRIVATE_USE_096           , "Reserved for private use #96"sv },
-		{ linktype_t::PRIVATE_USE_097           , "Reserved for private use #97"sv },
-		{ linktype_t::PRIVATE_USE_098           , "Reserved for private use #98"sv },
-		{ linktype_t::PRIVATE_USE_099           , "Reserved for private use #99"sv },
-		{ linktype_t::PRIVATE_USE_100           , "Reserved for private use #100"sv },
-		{ linktype_t::PRIVATE_USE_101           , "Reserved for private use #101"sv },
-		{ linktype_t::PRIVATE_USE_102           , "Reserved for private use #102"sv },
-		{ linktype_t::PRIVATE_USE_103           , "Reserved for private use #103"sv },
-		{ linktype_t::PRIVATE_USE_104           , "Reserved for private use #104"sv },
-		{ linktype_t::PRIVATE_USE_105           , "Reserved for private use #105"sv },
-		{ linktype_t::PRIVATE_USE_106           , "Reserved for private use #106"sv },
-		{ linktype_t::PRIVATE_USE_107           , "Reserved for private use #107"sv },
-		{ linktype_t::PRIVATE_USE_108           , "Reserved for private use #108"sv },
-		{ linktype_t::PRIVATE_USE_109           , "Reserved for private use #109"sv },
-		{ linktype_t::PRIVATE_USE_110           , "Reserved for private use #110"sv },
-		{ linktype_t::PRIVATE_USE_111           , "Reserved for private use #111"sv },
-		{ linktype_t::PRIVATE_USE_112           , "Reserved for private use #112"sv },
-		{ linktype_t::PRIVATE_USE_113           , "Reserved for private use #113"sv },
-		{ linktype_t::PRIVATE_USE_114           , "Reserved for private use #114"sv },
-		{ linktype_t::PRIVATE_USE_115           , "Reserved for private use #115"sv },
-		{ linktype_t::PRIVATE_USE_116           , "Reserved for private use #116"sv },
-		{ linktype_t::PRIVATE_USE_117           , "Reserved for private use #117"sv },
-		{ linktype_t::PRIVATE_USE_118           , "Reserved for private use #118"sv },
-		{ linktype_t::PRIVATE_USE_119           , "Reserved for private use #119"sv },
-		{ linktype_t::PRIVATE_USE_120           , "Reserved for private use #120"sv },
-		{ linktype_t::PRIVATE_USE_121           , "Reserved for private use #121"sv },
-		{ linktype_t::PRIVATE_USE_122           , "Reserved for private use #122"sv },
-		{ linktype_t::PRIVATE_USE_123           , "Reserved for private use #123"sv },
-		{ linktype_t::PRIVATE_USE_124           , "Reserved for private use #124"sv },
-		{ linktype_t::PRIVATE_USE_125           , "Reserved for private use #125"sv },
-		{ linktype_t::PRIVATE_USE_126           , "Reserved for private use #126"sv },
-		{ linktype_t::PRIVATE_USE_127           , "Reserved for private use #127"sv },
-		{ linktype_t::PRIVATE_USE_128           , "Reserved for private use #128"sv },
-		{ linktype_t::PRIVATE_USE_129           , "Reserved for private use #129"sv },
-		{ linktype_t::PRIVATE_USE_130           , "Reserved for private use #130"sv },
-		{ linktype_t::PRIVATE_USE_131           , "Reserved for private use #131"sv },
-		{ linktype_t::PRIVATE_USE_132           , "Reserved for private use #132"sv },
-		{ linktype_t::PRIVATE_USE_133           , "Reserved for private use #133"sv },
-		{ linktype_t::PRIVATE_USE_134           , "Reserved for private use #134"sv },
-		{ linktype_t::PRIVATE_USE_135           , "Reserved for private use #135"sv },
-		{ linktype_t::PRIVATE_USE_136           , "Reserved for private use #136"sv },
-		{ linktype_t::PRIVATE_USE_137           , "Reserved for private use #137"sv },
-		{ linktype_t::PRIVATE_USE_138           , "Reserved for private use #138"sv },
-		{ linktype_t::PRIVATE_USE_139           , "Reserved for private use #139"sv },
-		{ linktype_t::PRIVATE_USE_140           , "Reserved for private use #140"sv },
-		{ linktype_t::PRIVATE_USE_141           , "Reserved for private use #141"sv },
-		{ linktype_t::PRIVATE_USE_142           , "Reserved for private use #142"sv },
-		{ linktype_t::PRIVATE_USE_143           , "Reserved for private use #143"sv },
-		{ linktype_t::PRIVATE_USE_144           , "Reserved for private use #144"sv },
-		{ linktype_t::PRIVATE_USE_145           , "Reserved for private use #145"sv },
-		{ linktype_t::PRIVATE_USE_146           , "Reserved for private use #146"sv },
-		{ linktype_t::PRIVATE_USE_147           , "Reserved for private use #147"sv },
-		{ linktype_t::PRIVATE_USE_148           , "Reserved for private use #148"sv },
-		{ linktype_t::PRIVATE_USE_149           , "Reserved for private use #149"sv },
-		{ linktype_t::PRIVATE_USE_150           , "Reserved for private use #150"sv },
-		{ linktype_t::PRIVATE_USE_151           , "Reserved for private use #151"sv },
-		{ linktype_t::PRIVATE_USE_152           , "Reserved for private use #152"sv },
-		{ linktype_t::PRIVATE_USE_153           , "Reserved for private use #153"sv },
-		{ linktype_t::PRIVATE_USE_154           , "Reserved for private use #154"sv },
-		{ linktype_t::PRIVATE_USE_155           , "Reserved for private use #155"sv },
-		{ linktype_t::PRIVATE_USE_156           , "Reserved for private use #156"sv },
-		{ linktype_t::PRIVATE_USE_157           , "Reserved for private use #157"sv },
-		{ linktype_t::PRIVATE_USE_158           , "Reserved for private use #158"sv },
-		{ linktype_t::PRIVATE_USE_159           , "Reserved for private use #159"sv },
-		{ linktype_t::PRIVATE_USE_160           , "Reserved for private use #160"sv },
-		{ linktype_t::PRIVATE_USE_161           , "Reserved for private use #161"sv },
-		{ linktype_t::PRIVATE_USE_162           , "Reserved for private use #162"sv },
-		{ linktype_t::PRIVATE_USE_163           , "Reserved for private use #163"sv },
-		{ linktype_t::PRIVATE_USE_164           , "Reserved for private use #164"sv },
-		{ linktype_t::PRIVATE_USE_165           , "Reserved for private use #165"sv },
-		{ linktype_t::PRIVATE_USE_166           , "Reserved for private use #166"sv },
-		{ linktype_t::PRIVATE_USE_167           , "Reserved for private use #167"sv },
-		{ linktype_t::PRIVATE_USE_168           , "Reserved for private use #168"sv },
-		{ linktype_t::PRIVATE_USE_169           , "Reserved for private use #169"sv },
-		{ linktype_t::PRIVATE_USE_170           , "Reserved for private use #170"sv },
-		{ linktype_t::PRIVATE_USE_171           , "Reserved for private use #171"sv },
-		{ linktype_t::PRIVATE_USE_172           , "Reserved for private use #172"sv },
-		{ linktype_t::PRIVATE_USE_173           , "Reserved for private use #173"sv },
-		{ linktype_t::PRIVATE_USE_174           , "Reserved for private use #174"sv },
-		{ linktype_t::PRIVATE_USE_175           , "Reserved for private use #175"sv },
-		{ linktype_t::PRIVATE_USE_176           , "Reserved for private use #176"sv },
-		{ linktype_t::PRIVATE_USE_177           , "Reserved for private use #177"sv },
-		{ linktype_t::PRIVATE_USE_178           , "Reserved for private use #178"sv },
-		{ linktype_t::PRIVATE_USE_179           , "Reserved for private use #179"sv },
-		{ linktype_t::PRIVATE_USE_180           , "Reserved for private use #180"sv },
-		{ linktype_t::PRIVATE_USE_181           , "Reserved for private use #181"sv },
-		{ linktype_t::PRIVATE_USE_182           , "Reserved for private use #182"sv },
-		{ linktype_t::PRIVATE_USE_183           , "Reserved for private use #183"sv },
-		{ linktype_t::PRIVATE_USE_184           , "Reserved for private use #184"sv },
-		{ linktype_t::PRIVATE_USE_185           , "Reserved for private use #185"sv },
-		{ linktype_t::PRIVATE_USE_186           , "Reserved for private use #186"sv },
-		{ linktype_t::PRIVATE_USE_187           , "Reserved for private use #187"sv },
-		{ linktype_t::PRIVATE_USE_188           , "Reserved for private use #188"sv },
-		{ linktype_t::PRIVATE_USE_189           , "Reserved for private use #189"sv },
-		{ linktype_t::PRIVATE_USE_190           , "Reserved for private use #190"sv },
-		{ linktype_t::PRIVATE_USE_191           , "Reserved for private use #191"sv },
-		{ linktype_t::PRIVATE_USE_192           , "Reserved for private use #192"sv },
-		{ linktype_t::PRIVATE_USE_193           , "Reserved for private use #193"sv },
-		{ linktype_t::PRIVATE_USE_194           , "Reserved for private use #194"sv },
-		{ linktype_t::PRIVATE_USE_195           , "Reserved for private use #195"sv },
-		{ linktype_t::PRIVATE_USE_196           , "Reserved for private use #196"sv },
-		{ linktype_t::PRIVATE_USE_197           , "Reserved for private use #197"sv },
-		{ linktype_t::PRIVATE_USE_198           , "Reserved for private use #198"sv },
-		{ linktype_t::PRIVATE_USE_199           , "Reserved for private use #199"sv },
-		{ linktype_t::PRIVATE_USE_200           , "Reserved for private use #200"sv },
-		{ linktype_t::PRIVATE_USE_201           , "Reserved for private use #201"sv },
-		{ linktype_t::PRIVATE_USE_202           , "Reserved for private use #202"sv },
-		{ linktype_t::PRIVATE_USE_203           , "Reserved for private use #203"sv },
-		{ linktype_t::PRIVATE_USE_204           , "Reserved for private use #204"sv },
-		{ linktype_t::PRIVATE_USE_205           , "Reserved for private use #205"sv },
-		{ linktype_t::PRIVATE_USE_206           , "Reserved for private use #206"sv },
-		{ linktype_t::PRIVATE_USE_207           , "Reserved for private use #207"sv },
-		{ linktype_t::PRIVATE_USE_208           , "Reserved for private use #208"sv },
-		{ linktype_t::PRIVATE_USE_209           , "Reserved for private use #209"sv },
-		{ linktype_t::PRIVATE_USE_210           , "Reserved for private use #210"sv },
-		{ linktype_t::PRIVATE_USE_211           , "Reserved for private use #211"sv },
-		{ linktype_t::PRIVATE_USE_212           , "Reserved for private use #212"sv },
-		{ linktype_t::PRIVATE_USE_213           , "Reserved for private use #213"sv },
-		{ linktype_t::PRIVATE_USE_214           , "Reserved for private use #214"sv },
-		{ linktype_t::PRIVATE_USE_215           , "Reserved for private use #215"sv },
-		{ linktype_t::PRIVATE_USE_216           , "Reserved for private use #216"sv },
-		{ linktype_t::PRIVATE_USE_217           , "Reserved for private use #217"sv },
-		{ linktype_t::PRIVATE_USE_218           , "Reserved for private use #218"sv },
-		{ linktype_t::PRIVATE_USE_219           , "Reserved for private use #219"sv },
-		{ linktype_t::PRIVATE_USE_220           , "Reserved for private use #220"sv },
-		{ linktype_t::PRIVATE_USE_221           , "Reserved for private use #221"sv },
-		{ linktype_t::PRIVATE_USE_222           , "Reserved for private use #222"sv },
-		{ linktype_t::PRIVATE_USE_223           , "Reserved for private use #223"sv },
-		{ linktype_t::PRIVATE_USE_224           , "Reserved for private use #224"sv },
-		{ linktype_t::PRIVATE_USE_225           , "Reserved for private use #225"sv },
-		{ linktype_t::PRIVATE_USE_226           , "Reserved for private use #226"sv },
-		{ linktype_t::PRIVATE_USE_227           , "Reserved for private use #227"sv },
-		{ linktype_t::PRIVATE_USE_228           , "Reserved for private use #228"sv },
-		{ linktype_t::PRIVATE_USE_229           , "Reserved for private use #229"sv },
-		{ linktype_t::PRIVATE_USE_230           , "Reserved for private use #230"sv },
-		{ linktype_t::PRIVATE_USE_231           , "Reserved for private use #231"sv },
-		{ linktype_t::PRIVATE_USE_232           , "Reserved for private use #232"sv },
-		{ linktype_t::PRIVATE_USE_233           , "Reserved for private use #233"sv },
-		{ linktype_t::PRIVATE_USE_234           , "Reserved for private use #234"sv },
-		{ linktype_t::PRIVATE_USE_235           , "Reserved for private use #235"sv },
-		{ linktype_t::PRIVATE_USE_236           , "Reserved for private use #236"sv },
-		{ linktype_t::PRIVATE_USE_237           , "Reserved for private use #237"sv },
-		{ linktype_t::PRIVATE_USE_238           , "Reserved for private use #238"sv },
-		{ linktype_t::PRIVATE_USE_239           , "Reserved for private use #239"sv },
-		{ linktype_t::PRIVATE_USE_240           , "Reserved for private use #240"sv },
-		{ linktype_t::PRIVATE_USE_241           , "Reserved for private use #241"sv },
-		{ linktype_t::PRIVATE_USE_242           , "Reserved for private use #242"sv },
-		{ linktype_t::PRIVATE_USE_243           , "Reserved for private use #243"sv },
-		{ linktype_t::PRIVATE_USE_244           , "Reserved for private use #244"sv },
-		{ linktype_t::PRIVATE_USE_245           , "Reserved for private use #245"sv },
-		{ linktype_t::PRIVATE_USE_246           , "Reserved for private use #246"sv },
-		{ linktype_t::PRIVATE_USE_247           , "Reserved for private use #247"sv },
-		{ linktype_t::PRIVATE_USE_248           , "Reserved for private use #248"sv },
-		{ linktype_t::PRIVATE_USE_249           , "Reserved for private use #249"sv },
-		{ linktype_t::PRIVATE_USE_250           , "Reserved for private use #250"sv },
-		{ linktype_t::PRIVATE_USE_251           , "Reserved for private use #251"sv },
-		{ linktype_t::PRIVATE_USE_252           , "Reserved for private use #252"sv },
-		{ linktype_t::PRIVATE_USE_253           , "Reserved for private use #253"sv },
-		{ linktype_t::PRIVATE_USE_254           , "Reserved for private use #254"sv },
-		{ linktype_t::PRIVATE_USE_255           , "Reserved for private use #255"sv },
-		{ linktype_t::PRIVATE_USE_256           , "Reserved for private use #256"sv },
-		{ linktype_t::PRIVATE_USE_257           , "Reserved for private use #257"sv },
-		{ linktype_t::PRIVATE_USE_258           , "Reserved for private use #258"sv },
-		{ linktype_t::PRIVATE_USE_259           , "Reserved for private use #259"sv },
-		{ linktype_t::PRIVATE_USE_260           , "Reserved for private use #260"sv },
-		{ linktype_t::PRIVATE_USE_261           , "Reserved for private use #261"sv },
-		{ linktype_t::PRIVATE_USE_262           , "Reserved for private use #262"sv },
-		{ linktype_t::PRIVATE_USE_263           , "Reserved for private use #263"sv },
-		{ linktype_t::PRIVATE_USE_264           , "Reserved for private use #264"sv },
-		{ linktype_t::PRIVATE_USE_265           , "Reserved for private use #265"sv },
-		{ linktype_t::PRIVATE_USE_266           , "Reserved for private use #266"sv },
-		{ linktype_t::PRIVATE_USE_267           , "Reserved for private use #267"sv },
-		{ linktype_t::PRIVATE_USE_268           , "Reserved for private use #268"sv },
-		{ linktype_t::PRIVATE_USE_269           , "Reserved for private use #269"sv },
-		{ linktype_t::PRIVATE_USE_270           , "Reserved for private use #270"sv },
-		{ linktype_t::PRIVATE_USE_271           , "Reserved for private use #271"sv },
-		{ linktype_t::PRIVATE_USE_272           , "Reserved for private use #272"sv },
-		{ linktype_t::PRIVATE_USE_273           , "Reserved for private use #273"sv },
-		{ linktype_t::PRIVATE_USE_274           , "Reserved for private use #274"sv },
-		{ linktype_t::PRIVATE_USE_275           , "Reserved for private use #275"sv },
-		{ linktype_t::PRIVATE_USE_276           , "Reserved for private use #276"sv },
-		{ linktype_t::PRIVATE_USE_277           , "Reserved for private use #277"sv },
-		{ linktype_t::PRIVATE_USE_278           , "Reserved for private use #278"sv },
-		{ linktype_t::PRIVATE_USE_279           , "Reserved for private use #279"sv },
-		{ linktype_t::PRIVATE_USE_280           , "Reserved for private use #280"sv },
-		{ linktype_t::PRIVATE_USE_281           , "Reserved for private use #281"sv },
-		{ linktype_t::PRIVATE_USE_282           , "Reserved for private use #282"sv },
-		{ linktype_t::PRIVATE_USE_283           , "Reserved for private use #283"sv },
-		{ linktype_t::PRIVATE_USE_284           , "Reserved for private use #284"sv },
-		{ linktype_t::PRIVATE_USE_285           , "Reserved for private use #285"sv },
-		{ linktype_t::PRIVATE_USE_286           , "Reserved for private use #286"sv },
-		{ linktype_t::PRIVATE_USE_287           , "Reserved for private use #287"sv },
-		{ linktype_t::PRIVATE_USE_288           , "Reserved for private use #288"sv },
-		{ linktype_t::PRIVATE_USE_289           , "Reserved for private use #289"sv },
-		{ linktype_t::PRIVATE_USE_290           , "Reserved for private use #290"sv },
-		{ linktype_t::PRIVATE_USE_291           , "Reserved for private use #291"sv },
-		{ linktype_t::PRIVATE_USE_292           , "Reserved for private use #292"sv },
-		{ linktype_t::PRIVATE_USE_293           , "Reserved for private use #293"sv },
-		{ linktype_t::PRIVATE_USE_294           , "Reserved for private use #294"sv },
-		{ linktype_t::PRIVATE_USE_295           , "Reserved for private use #295"sv },
-		{ linktype_t::PRIVATE_USE_296           , "Reserved for private use #296"sv },
-		{ linktype_t::PRIVATE_USE_297           , "Reserved for private use #297"sv },
-		{ linktype_t::PRIVATE_USE_298           , "Reserved for private use #298"sv },
-		{ linktype_t::PRIVATE_USE_299           , "Reserved for private use #299"sv },
-		{ linktype_t::PRIVATE_USE_300           , "Reserved for private use #300"sv },
-		{ linktype_t::PRIVATE_USE_301           , "Reserved for private use #301"sv },
-		{ linktype_t::PRIVATE_USE_302           , "Reserved for private use #302"sv },
-		{ linktype_t::PRIVATE_USE_303           , "Reserved for private use #303"sv },
-		{ linktype_t::PRIVATE_USE_304           , "Reserved for private use #304"sv },
-		{ linktype_t::PRIVATE_USE_305           , "Reserved for private use #305"sv },
-		{ linktype_t::PRIVATE_USE_306           , "Reserved for private use #306"sv },
-		{ linktype_t::PRIVATE_USE_307           , "Reserved for private use #307"sv },
-		{ linktype_t::PRIVATE_USE_308           , "Reserved for private use #308"sv },
-		{ linktype_t::PRIVATE_USE_309           , "Reserved for private use #309"sv },
-		{ linktype_t::PRIVATE_USE_310           , "Reserved for private use #310"sv },
-		{ linktype_t::PRIVATE_USE_311           , "Reserved for private use #311"sv },
-		{ linktype_t::PRIVATE_USE_312           , "Reserved for private use #312"sv },
-		{ linktype_t::PRIVATE_USE_313           , "Reserved for private use #313"sv },
-		{ linktype_t::PRIVATE_USE_314           , "Reserved for private use #314"sv },
-		{ linktype_t::PRIVATE_USE_315           , "Reserved for private use #315"sv },
-		{ linktype_t::PRIVATE_USE_316           , "Reserved for private use #316"sv },
-		{ linktype_t::PRIVATE_USE_317           , "Reserved for private use #317"sv },
-		{ linktype_t::PRIVATE_USE_318           , "Reserved for private use #318"sv },
-		{ linktype_t::PRIVATE_USE_319           , "Reserved for private use #319"sv },
-		{ linktype_t::PRIVATE_USE_320           , "Reserved for private use #320"sv },
-		{ linktype_t::PRIVATE_USE_321           , "Reserved for private use #321"sv },
-		{ linktype_t::PRIVATE_USE_322           , "Reserved for private use #322"sv },
-		{ linktype_t::PRIVATE_USE_323           , "Reserved for private use #323"sv },
-		{ linktype_t::PRIVATE_USE_324           , "Reserved for private use #324"sv },
-		{ linktype_t::PRIVATE_USE_325           , "Reserved for private use #325"sv },
-		{ linktype_t::PRIVATE_USE_326           , "Reserved for private use #326"sv },
-		{ linktype_t::PRIVATE_USE_327           , "Reserved for private use #327"sv },
-		{ linktype_t::PRIVATE_USE_328           , "Reserved for private use #328"sv },
-		{ linktype_t::PRIVATE_USE_329           , "Reserved for private use #329"sv },
-		{ linktype_t::PRIVATE_USE_330           , "Reserved for private use #330"sv },
-		{ linktype_t::PRIVATE_USE_331           , "Reserved for private use #331"sv },
-		{ linktype_t::PRIVATE_USE_332           , "Reserved for private use #332"sv },
-		{ linktype_t::PRIVATE_USE_333           , "Reserved for private use #333"sv },
-		{ linktype_t::PRIVATE_USE_334           , "Reserved for private use #334"sv },
-		{ linktype_t::PRIVATE_USE_335           , "Reserved for private use #335"sv },
-		{ linktype_t::PRIVATE_USE_336           , "Reserved for private use #336"sv },
-		{ linktype_t::PRIVATE_USE_337           , "Reserved for private use #337"sv },
-		{ linktype_t::PRIVATE_USE_338           , "Reserved for private use #338"sv },
-		{ linktype_t::PRIVATE_USE_339           , "Reserved for private use #339"sv },
-		{ linktype_t::PRIVATE_USE_340           , "Reserved for private use #340"sv },
-		{ linktype_t::PRIVATE_USE_341           , "Reserved for private use #341"sv },
-		{ linktype_t::PRIVATE_USE_342           , "Reserved for private use #342"sv },
-		{ linktype_t::PRIVATE_USE_343           , "Reserved for private use #343"sv },
-		{ linktype_t::PRIVATE_USE_344           , "Reserved for private use #344"sv },
-		{ linktype_t::PRIVATE_USE_345           , "Reserved for private use #345"sv },
-		{ linktype_t::PRIVATE_USE_346           , "Reserved for private use #346"sv },
-		{ linktype_t::PRIVATE_USE_347           , "Reserved for private use #347"sv },
-		{ linktype_t::PRIVATE_USE_348           , "Reserved for private use #348"sv },
-		{ linktype_t::PRIVATE_USE_349           , "Reserved for private use #349"sv },
-		{ linktype_t::PRIVATE_USE_350           , "Reserved for private use #350"sv },
-		{ linktype_t::PRIVATE_USE_351           , "Reserved for private use #351"sv },
-		{ linktype_t::PRIVATE_USE_352           , "Reserved for private use #352"sv },
-		{ linktype_t::PRIVATE_USE_353           , "Reserved for private use #353"sv },
-		{ linktype_t::PRIVATE_USE_354           , "Reserved for private use #354"sv },
-		{ linktype_t::PRIVATE_USE_355           , "Reserved for private use #355"sv },
-		{ linktype_t::PRIVATE_USE_356           , "Reserved for private use #356"sv },
-		{ linktype_t::PRIVATE_USE_357           , "Reserved for private use #357"sv },
-		{ linktype_t::PRIVATE_USE_358           , "Reserved for private use #358"sv },
-		{ linktype_t::PRIVATE_USE_359           , "Reserved for private use #359"sv },
-		{ linktype_t::PRIVATE_USE_360           , "Reserved for private use #360"sv },
-		{ linktype_t::PRIVATE_USE_361           , "Reserved for private use #361"sv },
-		{ linktype_t::PRIVATE_USE_362           , "Reserved for private use #362"sv },
-		{ linktype_t::PRIVATE_USE_363           , "Reserved for private use #363"sv },
-		{ linktype_t::PRIVATE_USE_364           , "Reserved for private use #364"sv },
-		{ linktype_t::PRIVATE_USE_365           , "Reserved for private use #365"sv },
-		{ linktype_t::PRIVATE_USE_366           , "Reserved for private use #366"sv },
-		{ linktype_t::PRIVATE_USE_367           , "Reserved for private use #367"sv },
-		{ linktype_t::PRIVATE_USE_368           , "Reserved for private use #368"sv },
-		{ linktype_t::PRIVATE_USE_369           , "Reserved for private use #369"sv },
-		{ linktype_t::PRIVATE_USE_370           , "Reserved for private use #370"sv },
-		{ linktype_t::PRIVATE_USE_371           , "Reserved for private use #371"sv },
-		{ linktype_t::PRIVATE_USE_372           , "Reserved for private use #372"sv },
-		{ linktype_t::PRIVATE_USE_373           , "Reserved for private use #373"sv },
-		{ linktype_t::PRIVATE_USE_374           , "Reserved for private use #374"sv },
-		{ linktype_t::PRIVATE_USE_375           , "Reserved for private use #375"sv },
-		{ linktype_t::PRIVATE_USE_376           , "Reserved for private use #376"sv },
-		{ linktype_t::PRIVATE_USE_377           , "Reserved for private use #377"sv },
-		{ linktype_t::PRIVATE_USE_378           , "Reserved for private use #378"sv },
-		{ linktype_t::PRIVATE_USE_379           , "Reserved for private use #379"sv },
-		{ linktype_t::PRIVATE_USE_380           , "Reserved for private use #380"sv },
-		{ linktype_t::PRIVATE_USE_381           , "Reserved for private use #381"sv },
-		{ linktype_t::PRIVATE_USE_382           , "Reserved for private use #382"sv },
-		{ linktype_t::PRIVATE_USE_383           , "Reserved for private use #383"sv },
-		{ linktype_t::PRIVATE_USE_384           , "Reserved for private use #384"sv },
-		{ linktype_t::PRIVATE_USE_385           , "Reserved for private use #385"sv },
-		{ linktype_t::PRIVATE_USE_386           , "Reserved for private use #386"sv },
-		{ linktype_t::PRIVATE_USE_387           , "Reserved for private use #387"sv },
-		{ linktype_t::PRIVATE_USE_388           , "Reserved for private use #388"sv },
-		{ linktype_t::PRIVATE_USE_389           , "Reserved for private use #389"sv },
-		{ linktype_t::PRIVATE_USE_390           , "Reserved for private use #390"sv },
-		{ linktype_t::PRIVATE_USE_391           , "Reserved for private use #391"sv },
-		{ linktype_t::PRIVATE_USE_392           , "Reserved for private use #392"sv },
-		{ linktype_t::PRIVATE_USE_393           , "Reserved for private use #393"sv },
-		{ linktype_t::PRIVATE_USE_394           , "Reserved for private use #394"sv },
-		{ linktype_t::PRIVATE_USE_395           , "Reserved for private use #395"sv },
-		{ linktype_t::PRIVATE_USE_396           , "Reserved for private use #396"sv },
-		{ linktype_t::PRIVATE_USE_397           , "Reserved for private use #397"sv },
-		{ linktype_t::PRIVATE_USE_398           , "Reserved for private use #398"sv },
-		{ linktype_t::PRIVATE_USE_399           , "Reserved for private use #399"sv },
-		{ linktype_t::PRIVATE_USE_400           , "Reserved for private use #400"sv },
-		{ linktype_t::PRIVATE_USE_401           , "Reserved for private use #401"sv },
-		{ linktype_t::PRIVATE_USE_402           , "Reserved for private use #402"sv },
-		{ linktype_t::PRIVATE_USE_403           , "Reserved for private use #403"sv },
-		{ linktype_t::PRIVATE_USE_404           , "Reserved for private use #404"sv },
-		{ linktype_t::PRIVATE_USE_405           , "Reserved for private use #405"sv },
-		{ linktype_t::PRIVATE_USE_406           , "Reserved for private use #406"sv },
-		{ linktype_t::PRIVATE_USE_407           , "Reserved for private use #407"sv },
-		{ linktype_t::PRIVATE_USE_408           , "Reserved for private use #408"sv },
-		{ linktype_t::PRIVATE_USE_409           , "Reserved for private use #409"sv },
-		{ linktype_t::PRIVATE_USE_410           , "Reserved for private use #410"sv },
-		{ linktype_t::PRIVATE_USE_411           , "Reserved for private use #411"sv },
-		{ linktype_t::PRIVATE_USE_412           , "Reserved for private use #412"sv },
-		{ linktype_t::PRIVATE_USE_413           , "Reserved for private use #413"sv },
-		{ linktype_t::PRIVATE_USE_414           , "Reserved for private use #414"sv },
-		{ linktype_t::PRIVATE_USE_415           , "Reserved for private use #415"sv },
-		{ linktype_t::PRIVATE_USE_416           , "Reserved for private use #416"sv },
-		{ linktype_t::PRIVATE_USE_417           , "Reserved for private use #417"sv },
-		{ linktype_t::PRIVATE_USE_418           , "Reserved for private use #418"sv },
-		{ linktype_t::PRIVATE_USE_419           , "Reserved for private use #419"sv },
-		{ linktype_t::PRIVATE_USE_420           , "Reserved for private use #420"sv },
-		{ linktype_t::PRIVATE_USE_421           , "Reserved for private use #421"sv },
-		{ linktype_t::PRIVATE_USE_422           , "Reserved for private use #422"sv },
-		{ linktype_t::PRIVATE_USE_423           , "Reserved for private use #423"sv },
-		{ linktype_t::PRIVATE_USE_424           , "Reserved for private use #424"sv },
-		{ linktype_t::PRIVATE_USE_425           , "Reserved for private use #425"sv },
-		{ linktype_t::PRIVATE_USE_426           , "Reserved for private use #426"sv },
-		{ linktype_t::PRIVATE_USE_427           , "Reserved for private use #427"sv },
-		{ linktype_t::PRIVATE_USE_428           , "Reserved for private use #428"sv },
-		{ linktype_t::PRIVATE_USE_429           , "Reserved for private use #429"sv },
-		{ linktype_t::PRIVATE_USE_430           , "Reserved for private use #430"sv },
-		{ linktype_t::PRIVATE_USE_431           , "Reserved for private use #431"sv },
-		{ linktype_t::PRIVATE_USE_432           , "Reserved for private use #432"sv },
-		{ linktype_t::PRIVATE_USE_433           , "Reserved for private use #433"sv },
-		{ linktype_t::PRIVATE_USE_434           , "Reserved for private use #434"sv },
-		{ linktype_t::PRIVATE_USE_435           , "Reserved for private use #435"sv },
-		{ linktype_t::PRIVATE_USE_436           , "Reserved for private use #436"sv },
-		{ linktype_t::PRIVATE_USE_437           , "Reserved for private use #437"sv },
-		{ linktype_t::PRIVATE_USE_438           , "Reserved for private use #438"sv },
-		{ linktype_t::PRIVATE_USE_439           , "Reserved for private use #439"sv },
-		{ linktype_t::PRIVATE_USE_440           , "Reserved for private use #440"sv },
-		{ linktype_t::PRIVATE_USE_441           , "Reserved for private use #441"sv },
-		{ linktype_t::PRIVATE_USE_442           , "Reserved for private use #442"sv },
-		{ linktype_t::PRIVATE_USE_443           , "Reserved for private use #443"sv },
-		{ linktype_t::PRIVATE_USE_444           , "Reserved for private use #444"sv },
-		{ linktype_t::PRIVATE_USE_445           , "Reserved for private use #445"sv },
-		{ linktype_t::PRIVATE_USE_446           , "Reserved for private use #446"sv },
-		{ linktype_t::PRIVATE_USE_447           , "Reserved for private use #447"sv },
-		{ linktype_t::PRIVATE_USE_448           , "Reserved for private use #448"sv },
-		{ linktype_t::PRIVATE_USE_449           , "Reserved for private use #449"sv },
-		{ linktype_t::PRIVATE_USE_450           , "Reserved for private use #450"sv },
-		{ linktype_t::PRIVATE_USE_451           , "Reserved for private use #451"sv },
-		{ linktype_t::PRIVATE_USE_452           , "Reserved for private use #452"sv },
-		{ linktype_t::PRIVATE_USE_453           , "Reserved for private use #453"sv },
-		{ linktype_t::PRIVATE_USE_454           , "Reserved for private use #454"sv },
-		{ linktype_t::PRIVATE_USE_455           , "Reserved for private use #455"sv },
-		{ linktype_t::PRIVATE_USE_456           , "Reserved for private use #456"sv },
-		{ linktype_t::PRIVATE_USE_457           , "Reserved for private use #457"sv },
-		{ linktype_t::PRIVATE_USE_458           , "Reserved for private use #458"sv },
-		{ linktype_t::PRIVATE_USE_459           , "Reserved for private use #459"sv },
-		{ linktype_t::PRIVATE_USE_460           , "Reserved for private use #460"sv },
-		{ linktype_t::PRIVATE_USE_461           , "Reserved for private use #461"sv },
-		{ linktype_t::PRIVATE_USE_462           , "Reserved for private use #462"sv },
-		{ linktype_t::PRIVATE_USE_463           , "Reserved for private use #463"sv },
-		{ linktype_t::PRIVATE_USE_464           , "Reserved for private use #464"sv },
-		{ linktype_t::PRIVATE_USE_465           , "Reserved for private use #465"sv },
-		{ linktype_t::PRIVATE_USE_466           , "Reserved for private use #466"sv },
-		{ linktype_t::PRIVATE_USE_467           , "Reserved for private use #467"sv },
-		{ linktype_t::PRIVATE_USE_468           , "Reserved for private use #468"sv },
-		{ linktype_t::PRIVATE_USE_469           , "Reserved for private use #469"sv },
-		{ linktype_t::PRIVATE_USE_470           , "Reserved for private use #470"sv },
-		{ linktype_t::PRIVATE_USE_471           , "Reserved for private use #471"sv },
-		{ linktype_t::PRIVATE_USE_472           , "Reserved for private use #472"sv },
-		{ linktype_t::PRIVATE_USE_473           , "Reserved for private use #473"sv },
-		{ linktype_t::PRIVATE_USE_474           , "Reserved for private use #474"sv },
-		{ linktype_t::PRIVATE_USE_475           , "Reserved for private use #475"sv },
-		{ linktype_t::PRIVATE_USE_476           , "Reserved for private use #476"sv },
-		{ linktype_t::PRIVATE_USE_477           , "Reserved for private use #477"sv },
-		{ linktype_t::PRIVATE_USE_478           , "Reserved for private use #478"sv },
-		{ linktype_t::PRIVATE_USE_479           , "Reserved for private use #479"sv },
-		{ linktype_t::PRIVATE_USE_480           , "Reserved for private use #480"sv },
-		{ linktype_t::PRIVATE_USE_481           , "Reserved for private use #481"sv },
-		{ linktype_t::PRIVATE_USE_482           , "Reserved for private use #482"sv },
-		{ linktype_t::PRIVATE_USE_483           , "Reserved for private use #483"sv },
-		{ linktype_t::PRIVATE_USE_484           , "Reserved for private use #484"sv },
-		{ linktype_t::PRIVATE_USE_485           , "Reserved for private use #485"sv },
-		{ linktype_t::PRIVATE_USE_486           , "Reserved for private use #486"sv },
-		{ linktype_t::PRIVATE_USE_487           , "Reserved for private use #487"sv },
-		{ linktype_t::PRIVATE_USE_488           , "Reserved for private use #488"sv },
-		{ linktype_t::PRIVATE_USE_489           , "Reserved for private use #489"sv },
-		{ linktype_t::PRIVATE_USE_490           , "Reserved for private use #490"sv },
-		{ linktype_t::PRIVATE_USE_491           , "Reserved for private use #491"sv },
-		{ linktype_t::PRIVATE_USE_492           , "Reserved for private use #492"sv },
-		{ linktype_t::PRIVATE_USE_493           , "Reserved for private use #493"sv },
-		{ linktype_t::PRIVATE_USE_494           , "Reserved for private use #494"sv },
-		{ linktype_t::PRIVATE_USE_495           , "Reserved for private use #495"sv },
-		{ linktype_t::PRIVATE_USE_496           , "Reserved for private use #496"sv },
-		{ linktype_t::PRIVATE_USE_497           , "Reserved for private use #497"sv },
-		{ linktype_t::PRIVATE_USE_498           , "Reserved for private use #498"sv },
-		{ linktype_t::PRIVATE_USE_499           , "Reserved for private use #499"sv },
-		{ linktype_t::PRIVATE_USE_500           , "Reserved for private use #500"sv },
-		{ linktype_t::PRIVATE_USE_501           , "Reserved for private use #501"sv },
-		{ linktype_t::PRIVATE_USE_502           , "Reserved for private use #502"sv },
-		{ linktype_t::PRIVATE_USE_503           , "Reserved for private use #503"sv },
-		{ linktype_t::PRIVATE_USE_504           , "Reserved for private use #504"sv },
-		{ linktype_t::PRIVATE_USE_505           , "Reserved for private use #505"sv },
-		{ linktype_t::PRIVATE_USE_506           , "Reserved for private use #506"sv },
-		{ linktype_t::PRIVATE_USE_507           , "Reserved for private use #507"sv },
-		{ linktype_t::PRIVATE_USE_508           , "Reserved for private use #508"sv },
-		{ linktype_t::PRIVATE_USE_509           , "Reserved for private use #509"sv },
-		{ linktype_t::PRIVATE_USE_510           , "Reserved for private use #510"sv },
-		{ linktype_t::PRIVATE_USE_511           , "Reserved for private use #511"sv },
-		{ linktype_t::PRIVATE_USE_512           , "Reserved for private use #512"sv },
-		{ linktype_t::PRIVATE_USE_513           , "Reserved for private use #513"sv },
-		{ linktype_t::PRIVATE_USE_514           , "Reserved for private use #514"sv },
-		{ linktype_t::PRIVATE_USE_515           , "Reserved for private use #515"sv },
-		{ linktype_t::PRIVATE_USE_516           , "Reserved for private use #516"sv },
-		{ linktype_t::PRIVATE_USE_517           , "Reserved for private use #517"sv },
-		{ linktype_t::PRIVATE_USE_518           , "Reserved for private use #518"sv },
-		{ linktype_t::PRIVATE_USE_519           , "Reserved for private use #519"sv },
-		{ linktype_t::PRIVATE_USE_520           , "Reserved for private use #520"sv },
-		{ linktype_t::PRIVATE_USE_521           , "Reserved for private use #521"sv },
-		{ linktype_t::PRIVATE_USE_522           , "Reserved for private use #522"sv },
-		{ linktype_t::PRIVATE_USE_523           , "Reserved for private use #523"sv },
-		{ linktype_t::PRIVATE_USE_524           , "Reserved for private use #524"sv },
-		{ linktype_t::PRIVATE_USE_525           , "Reserved for private use #525"sv },
-		{ linktype_t::PRIVATE_USE_526           , "Reserved for private use #526"sv },
-		{ linktype_t::PRIVATE_USE_527           , "Reserved for private use #527"sv },
-		{ linktype_t::PRIVATE_USE_528           , "Reserved for private use #528"sv },
-		{ linktype_t::PRIVATE_USE_529           , "Reserved for private use #529"sv },
-		{ linktype_t::PRIVATE_USE_530           , "Reserved for private use #530"sv },
-		{ linktype_t::PRIVATE_USE_531           , "Reserved for private use #531"sv },
-		{ linktype_t::PRIVATE_USE_532           , "Reserved for private use #532"sv },
-		{ linktype_t::PRIVATE_USE_533           , "Reserved for private use #533"sv },
-		{ linktype_t::PRIVATE_USE_534           , "Reserved for private use #534"sv },
+	constexpr static linktype_table_t<linktype_info_t> linktype_infos{
+		{ linktype_t::BSD_LOOPBACK              , { "BSD_LOOPBACK"sv, "BSD loopback encapsulation"sv } },
+		{ linktype_t::ETHERNET                  , { "ETHERNET"sv, "IEEE 802.3 Ethernet"sv } },
+		{ linktype_t::EXP_ETHERNET              , { "EXP_ETHERNET"sv, "Xerox experimental 3Mb Ethernet"sv } },
+		{ linktype_t::AX25                      , { "AX25"sv, "AX.25 layer 2 packets"sv } },
+		{ linktype_t::PRONET                    , { "PRONET"sv, "Reserved for Proteon PRONet Token Ring"sv } },
+		{ linktype_t::CHAOS                     , { "CHAOS"sv, "Reserved for MIT Chaosnet"sv } },
+		{ linktype_t::IEEE802_5                 , { "IEEE802_5"sv, "IEEE 802.5 Token Ring"sv } },
+		{ linktype_t::ARCNET_BSD                , { "ARCNET_BSD"sv, "Reserved for ARCNET Data Packets with BSD encapsulation"sv } },
+		{ linktype_t::SLIP                      , { "SLIP"sv, "SLIP"sv } },
+		{ linktype_t::PPP                       , { "PPP"sv, "PPP"sv } },
+		{ linktype_t::FDDI                      , { "FDDI"sv, "FDDI: per ANSI INCITS 239-1994"sv } },
+		{ linktype_t::PPP_HDLC                  , { "PPP_HDLC"sv, "PPP in HDLC-like framing"sv } },
+		{ linktype_t::PPP_ETHER                 , { "PPP_ETHER"sv, "PPPoE"sv } },
+		{ linktype_t::SYMANTEC_FIREWALL         , { "SYMANTEC_FIREWALL"sv, "Reserved for Symantec Enterprise Firewall"sv } },
+		{ linktype_t::ATM_RFC1483               , { "ATM_RFC1483"sv, "LLC/SNAP-encapsulated ATM"sv } },
+		{ linktype_t::RAW                       , { "RAW"sv, "Raw IP; begins with an IPv4 or IPv6 header"sv } },
+		{ linktype_t::SLIP_BSDOS                , { "SLIP_BSDOS"sv, "Reserved for BSD/OS SLIP BPF header"sv } },
+		{ linktype_t::PPP_BSDOS                 , { "PPP_BSDOS"sv, "Reserved for BSD/OS PPP BPF header"sv } },
+		{ linktype_t::C_HDLC                    , { "C_HDLC"sv, "Cisco PPP with HDLC framing"sv } },
+		{ linktype_t::IEEE802_11                , { "IEEE802_11"sv, "IEEE 802.11 wireless LAN"sv } },
+		{ linktype_t::ATM_CLIP                  , { "ATM_CLIP"sv, "ATM Classical IP, with no header preceding IP"sv } },
+		{ linktype_t::FRELAY                    , { "FRELAY"sv, "Frame Relay LAPF frames"sv } },
+		{ linktype_t::LOOP                      , { "LOOP"sv, "OpenBSD loopback encapsulation"sv } },
+		{ linktype_t::ENC                       , { "ENC"sv, "Reserved for OpenBSD IPSEC encapsulation"sv } },
+		{ linktype_t::LANE8023                  , { "LANE8023"sv, "Reserved for ATM LANE + 802.3"sv } },
+		{ linktype_t::HIPPI                     , { "HIPPI"sv, "Reserved for NetBSD HIPPI"sv } },
+		{ linktype_t::HDLC                      , { "HDLC"sv, "Reserved for NetBSD HDLC framing"sv } },
+		{ linktype_t::LINUX_SLL                 , { "LINUX_SLL"sv, "Linux cooked capture encapsulation"sv } },
+		{ linktype_t::LTALK                     , { "LTALK"sv, "Apple LocalTalk"sv } },
+		{ linktype_t::ECONET                    , { "ECONET"sv, "Reserved for Acorn Econet"sv } },
+		{ linktype_t::IPFILTER                  , { "IPFILTER"sv, "Reserved for OpenBSD ipfilter"sv } },
+		{ linktype_t::PFLOG                     , { "PFLOG"sv, "OpenBSD pflog; struct pfloghdr structure"sv } },
+		{ linktype_t::CISCO_IOS                 , { "CISCO_IOS"sv, "Reserved for Cisco-internal use"sv } },
+		{ linktype_t::IEEE802_11_PRISM          , { "IEEE802_11_PRISM"sv, "Prism monitor mode"sv } },
+		{ linktype_t::IEEE802_11_AIRONET        , { "IEEE802_11_AIRONET"sv, "Reserved for 802.11 + FreeFreeBSD Aironet radio metadata"sv } },
+		{ linktype_t::HHDLC                     , { "HHDLC"sv, "Reserved for Siemens HiPath HDLC"sv } },
+		{ linktype_t::IP_OVER_FC                , { "IP_OVER_FC"sv, "IP-over-Fibre Channel, starting with the Network_Header"sv } },
+		{ linktype_t::SUNATM                    , { "SUNATM"sv, "ATM traffic captured from a SunATM device"sv } },
+		{ linktype_t::RIO                       , { "RIO"sv, "Reserved for RapidIO"sv } },
+		{ linktype_t::PCI_EXP                   , { "PCI_EXP"sv, "Reserved for PCI Express"sv } },
+		{ linktype_t::AURORA                    , { "AURORA"sv, "Reserved for Xilinx Aurora link layer"sv } },
+		{ linktype_t::IEEE802_11_RADIOTAP       , { "IEEE802_11_RADIOTAP"sv, "Radiotap header, followed by an 802.11 header"sv } },
+		{ linktype_t::TZSP                      , { "TZSP"sv, "Reserved for Tazmen Sniffer Protocol"sv } },
+		{ linktype_t::ARCNET_LINUX              , { "ARCNET_LINUX"sv, "Reserved for ARCNET Data Packets with Linux encapsulation"sv } },
+		{ linktype_t::JUNIPER_MLPPP             , { "JUNIPER_MLPPP"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_MLFR              , { "JUNIPER_MLFR"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_ES                , { "JUNIPER_ES"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_GGSN              , { "JUNIPER_GGSN"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_MFR               , { "JUNIPER_MFR"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_ATM2              , { "JUNIPER_ATM2"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_SERVICES          , { "JUNIPER_SERVICES"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_ATM1              , { "JUNIPER_ATM1"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::APPLE_IP_OVER_IEEE1394    , { "APPLE_IP_OVER_IEEE1394"sv, "Apple IP-over-IEEE 1394 cooked header"sv } },
+		{ linktype_t::MTP2_WITH_PHDR            , { "MTP2_WITH_PHDR"sv, "Signaling System 7 (SS7) Message Transfer Part Level"sv } },
+		{ linktype_t::MTP2                      , { "MTP2"sv, "SS7 Level 2"sv } },
+		{ linktype_t::MTP3                      , { "MTP3"sv, "SS7 Level 3, with no MTP2 header"sv } },
+		{ linktype_t::SCCP                      , { "SCCP"sv, "SS7 Control Part, with no MTP3 or MTP2 header"sv } },
+		{ linktype_t::DOCSIS                    , { "DOCSIS"sv, "DOCSIS MAC frames"sv } },
+		{ linktype_t::LINUX_IRDA                , { "LINUX_IRDA"sv, "Linux-IrDA packets"sv } },
+		{ linktype_t::IBM_SP                    , { "IBM_SP"sv, "Reserved for IBM SP switch"sv } },
+		{ linktype_t::IBM_SN                    , { "IBM_SN"sv, "Reserved for IBM Next Federation switch"sv } },
+		{ linktype_t::RESERVED_01               , { "RESERVED_01"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_02               , { "RESERVED_02"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_03               , { "RESERVED_03"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_04               , { "RESERVED_04"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_05               , { "RESERVED_05"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_06               , { "RESERVED_06"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_07               , { "RESERVED_07"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_08               , { "RESERVED_08"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_09               , { "RESERVED_09"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_10               , { "RESERVED_10"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_11               , { "RESERVED_11"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_12               , { "RESERVED_12"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_13               , { "RESERVED_13"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_14               , { "RESERVED_14"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_15               , { "RESERVED_15"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::RESERVED_16               , { "RESERVED_16"sv, "For private use (deprecated)"sv } },
+		{ linktype_t::IEEE802_11_AVS            , { "IEEE802_11_AVS"sv, "AVS header, followed by an 802.11 header"sv } },
+		{ linktype_t::JUNIPER_MONITOR           , { "JUNIPER_MONITOR"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::BACNET_MS_TP              , { "BACNET_MS_TP"sv, "BACnet MS/TP frames"sv } },
+		{ linktype_t::PPP_PPPD                  , { "PPP_PPPD"sv, "PPP in HDLC-like encapsulation, like LINKTYPE_PPP_HDLC, different stuffing"sv } },
+		{ linktype_t::JUNIPER_PPPOE             , { "JUNIPER_PPPOE"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_PPPOE_ATM         , { "JUNIPER_PPPOE_ATM"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::GPRS_LLC                  , { "GPRS_LLC"sv, "General Packet Radio Service Logical Link Control, as per 3GPP TS 04.64"sv } },
+		{ linktype_t::GPF_T                     , { "GPF_T"sv, "Transparent-mapped generic framing procedure"sv } },
+		{ linktype_t::GPF_F                     , { "GPF_F"sv, "Frame-mapped generic framing procedure"sv } },
+		{ linktype_t::GCOM_T1E1                 , { "GCOM_T1E1"sv, "Reserved for Gcom T1/E1 line monitoring equipment"sv } },
+		{ linktype_t::GCOM_SERIAL               , { "GCOM_SERIAL"sv, "Reserved for Gcom T1/E1 line monitoring equipment"sv } },
+		{ linktype_t::JUNIPER_PIC_PEER          , { "JUNIPER_PIC_PEER"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::ERF_ETH                   , { "ERF_ETH"sv, "Endace ERF header followed by 802.3 Ethernet"sv } },
+		{ linktype_t::ERF_POS                   , { "ERF_POS"sv, "Endace ERF header followed by Packet-over-SONET"sv } },
+		{ linktype_t::LINUX_LAPD                , { "LINUX_LAPD"sv, "Linux vISDN LAPD frames"sv } },
+		{ linktype_t::JUNIPER_ETHER             , { "JUNIPER_ETHER"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_PPP               , { "JUNIPER_PPP"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_FRELAY            , { "JUNIPER_FRELAY"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_CHDLC             , { "JUNIPER_CHDLC"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::MFR                       , { "MFR"sv, "FRF.16.1 Multi-Link Frame Relay frames, beginning with an FRF.12 Interface fragmentation format fragmentation header"sv } },
+		{ linktype_t::JUNIPER_VP                , { "JUNIPER_VP"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::A429                      , { "A429"sv, "Reserved for ARINC 429 frames"sv } },
+		{ linktype_t::A653_ICM                  , { "A653_ICM"sv, "Reserved for Arinc 653 Interpartition Communication messages"sv } },
+		{ linktype_t::USB_FREEBSD               , { "USB_FREEBSD"sv, "USB packets, beginning with a FreeBSD USB header"sv } },
+		{ linktype_t::BLUETOOTH_HCI_H4          , { "BLUETOOTH_HCI_H4"sv, "Bluetooth HCI UART transport layer; the frame contains an HCI packet indicator octet, as specified by the UART Transport Layer portion of the most recent Bluetooth Core specification, followed by an HCI packet of the specified packet type, as specified by the Host Controller Interface Functional Specification portion of the most recent Bluetooth Core Specification"sv } },
+		{ linktype_t::IEEE802_16_MAC_CPS        , { "IEEE802_16_MAC_CPS"sv, "Reserved for IEEE 802.16 MAC Common Part Sublayer"sv } },
+		{ linktype_t::USB_LINUX                 , { "USB_LINUX"sv, "USB packets, beginning with a Linux USB header, as specified by the struct usbmon_packet in the Documentation/usb/usbmon.txt file in the Linux source tree. Only the first 48 octets of that header are present. All fields in the header are in host byte order. When performing a live capture, the host byte order is the byte order of the machine on which the packets are captured. When reading a PCAP file, the byte order is the byte order for the file, as specified by the file's magic number; when reading a PCAPNG file, the byte order is the byte order for the section of the PCAPNG file, as specified by the Section Header Block"sv } },
+		{ linktype_t::CAN20B                    , { "CAN20B"sv, "Reserved for Controller Area Network (CAN) v. 2.0B packets"sv } },
+		{ linktype_t::IEEE802_15_4_LINUX        , { "IEEE802_15_4_LINUX"sv, "IEEE 802.15.4, with address fields padded, as is done by Linux drivers"sv } },
+		{ linktype_t::PPI                       , { "PPI"sv, "Per-Packet Information information, as specified by the Per-Packet Information Header Specification , followed by a packet with the LINKTYPE_ value specified by the pph_dlt field of that header"sv } },
+		{ linktype_t::IEEE802_16_MAC_CPS_RADIO  , { "IEEE802_16_MAC_CPS_RADIO"sv, "Reserved for 802.16 MAC Common Part Sublayer plus radio header"sv } },
+		{ linktype_t::JUNIPER_ISM               , { "JUNIPER_ISM"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::IEEE802_15_4_WITHFCS      , { "IEEE802_15_4_WITHFCS"sv, "IEEE 802.15.4 Low-Rate Wireless Networks, with each packet having the FCS at the end of the frame"sv } },
+		{ linktype_t::SITA                      , { "SITA"sv, "Various link-layer types, with a pseudo-header"sv } },
+		{ linktype_t::ERF                       , { "ERF"sv, "Endace ERF records"sv } },
+		{ linktype_t::RAIF1                     , { "RAIF1"sv, "Reserved for Ethernet packets captured from a u10 Networks board"sv } },
+		{ linktype_t::IPMB_KONTRON              , { "IPMB_KONTRON"sv, "Reserved for IPMB packet for IPMI, with a 2-octet header"sv } },
+		{ linktype_t::JUNIPER_ST                , { "JUNIPER_ST"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::BLUETOOTH_HCI_H4_WITH_PHDR, { "BLUETOOTH_HCI_H4_WITH_PHDR"sv, "Bluetooth HCI UART transport layer; the frame contains a 4-octet direction field, in network byte order (big-endian), the low-order bit of which is set if the frame was sent from the host to the controller and clear if the frame was received by the host from the controller, followed by an HCI packet indicator octet, as specified by the UART Transport Layer portion of the most recent Bluetooth Core specification, followed by an HCI packet of the specified packet type, as specified by the Host Controller Interface Functional Specification portion of the most recent Bluetooth Core Specification"sv } },
+		{ linktype_t::AX25_KISS                 , { "AX25_KISS"sv, "AX.25 packet, with a KISS header"sv } },
+		{ linktype_t::LAPD                      , { "LAPD"sv, "Link Access Procedures on the D Channel (LAPD) frames, starting with the address field, with no pseudo-header"sv } },
+		{ linktype_t::PPP_WITH_DIR              , { "PPP_WITH_DIR"sv, "PPP, as per RFC 1661 and RFC 1662 , preceded with a one-octet pseudo-header with a zero value meaning received by this host and a non-zero value meaning sent by this host; if the first 2 octets are 0xff and 0x03, it's PPP in HDLC-like framing, with the PPP header following those two octets, otherwise it's PPP without framing, and the packet begins with the PPP header. The data in the frame is not octet-stuffed or bit-stuffed"sv } },
+		{ linktype_t::C_HDLC_WITH_DIR           , { "C_HDLC_WITH_DIR"sv, "Cisco PPP with HDLC framing, preceded with a one-octet pseudo-header with a zero value meaning received by this host and a non-zero value meaning sent by this host"sv } },
+		{ linktype_t::FRELAY_WITH_DIR           , { "FRELAY_WITH_DIR"sv, "Frame Relay LAPF frames, beginning with a one-octet pseudo-header with a zero value meaning received by this host (DCE->DTE) and a non-zero value meaning sent by this host (DTE->DCE), followed by an ITU-T Recommendation Q.922 LAPF header starting with the address field, and without an FCS at the end of the frame"sv } },
+		{ linktype_t::LAPB_WITH_DIR             , { "LAPB_WITH_DIR"sv, "Link Access Procedure, Balanced (LAPB), as specified by ITU-T Recommendation X.25 , preceded with a one-octet pseudo-header with a zero value meaning received by this host (DCE->DTE) and a non-zero value meaning sent by this host (DTE->DCE)"sv } },
+		{ linktype_t::Reserved                  , { "Reserved"sv, "Reserved for an unspecified link-layer type"sv } },
+		{ linktype_t::I2C_LINUX                 , { "I2C_LINUX"sv, "Linux I2C packets"sv } },
+		{ linktype_t::FLEXRAY                   , { "FLEXRAY"sv, "FlexRay frames or symbols, with a pseudo-header"sv } },
+		{ linktype_t::MOST                      , { "MOST"sv, "Reserved for Media Oriented Systems Transport (MOST) bus"sv } },
+		{ linktype_t::LIN                       , { "LIN"sv, "Local Interconnect Network (LIN) automotive bus"sv } },
+		{ linktype_t::X2E_SERIAL                , { "X2E_SERIAL"sv, "Reserved for X2E serial line captures"sv } },
+		{ linktype_t::X2E_XORAYA                , { "X2E_XORAYA"sv, "Reserved for X2E Xoraya data loggers"sv } },
+		{ linktype_t::IEEE802_15_4_NONASK_PHY   , { "IEEE802_15_4_NONASK_PHY"sv, "IEEE 802.15.4 Low-Rate Wireless Networks, with each packet having the FCS at the end of the frame, and with the PHY-level data for the O-QPSK, BPSK, GFSK, MSK, and RCC DSS BPSK PHYs (4 octets of 0 as preamble, one octet of SFD, one octet of frame length + reserved bit) preceding the MAC-layer data (starting with the frame control field)"sv } },
+		{ linktype_t::LINUX_EVDEV               , { "LINUX_EVDEV"sv, "Reserved for Linux evdev messages"sv } },
+		{ linktype_t::GSMTAP_UM                 , { "GSMTAP_UM"sv, "Reserved for GSM Um interface, with gsmtap header"sv } },
+		{ linktype_t::GSMTAP_ABIS               , { "GSMTAP_ABIS"sv, "Reserved for GSM Abis interface, with gsmtap header"sv } },
+		{ linktype_t::MPLS                      , { "MPLS"sv, "MPLS packets with MPLS label as the header"sv } },
+		{ linktype_t::USB_LINUX_MMAPPED         , { "USB_LINUX_MMAPPED"sv, "USB packets, beginning with a Linux USB header, as specified by the struct usbmon_packet in the Documentation/usb/usbmon.txt file in the Linux source tree. All 64 octets of the header are present. All fields in the header are in host byte order. When performing a live capture, the host byte order is the byte order of the machine on which the packets are captured. When reading a PCAP file, the byte order is the byte order for the file, as specified by the file's magic number; when reading a PCAPNG file, the byte order is the byte order for the section of the PCAPNG file, as specified by the Section Header Block. For isochronous transfers, the ndesc field specifies the number of isochronous descriptors that follow"sv } },
+		{ linktype_t::DECT                      , { "DECT"sv, "Reserved for DECT packets, with a pseudo-header"sv } },
+		{ linktype_t::AOS                       , { "AOS"sv, "Reserved for OS Space Data Link Protocol"sv } },
+		{ linktype_t::WIHART                    , { "WIHART"sv, "Reserved for Wireless HART (Highway Addressable Remote Transducer)"sv } },
+		{ linktype_t::FC_2                      , { "FC_2"sv, "Fibre Channel FC-2 frames, beginning with a Frame_Header"sv } },
+		{ linktype_t::FC_2_WITH_FRAME_DELIMS    , { "FC_2_WITH_FRAME_DELIMS"sv, "Fibre Channel FC-2 frames, beginning an encoding of the SOF, followed by a Frame_Header, and ending with an encoding of the SOF. The encodings represent the frame delimiters as 4-octet sequences representing the corresponding ordered sets, with K28.5 represented as 0xBC, and the D symbols as the corresponding octet values; for example, SOFi2, which is K28.5 - D21.5 - D1.2 - D21.2, is represented as 0xBC 0xB5 0x55 0x55"sv } },
+		{ linktype_t::IPNET                     , { "IPNET"sv, "Solaris ipnet"sv } },
+		{ linktype_t::CAN_SOCKETCAN             , { "CAN_SOCKETCAN"sv, "Controller Area Network frames"sv } },
+		{ linktype_t::IPV4                      , { "IPV4"sv, "Raw IPv4; the packet begins with an IPv4 header"sv } },
+		{ linktype_t::IPV6                      , { "IPV6"sv, "Raw IPv6; the packet begins with an IPv6 header"sv } },
+		{ linktype_t::IEEE802_15_4_NOFCS        , { "IEEE802_15_4_NOFCS"sv, "IEEE 802.15.4 Low-Rate Wireless Network, without the FCS at the end of the frame"sv } },
+		{ linktype_t::DBUS                      , { "DBUS"sv, "Raw D-Bus messages , starting with the endianness flag, followed by the message type, etc., but without the authentication handshake before the message sequence"sv } },
+		{ linktype_t::JUNIPER_VS                , { "JUNIPER_VS"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_SRX_E2E           , { "JUNIPER_SRX_E2E"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::JUNIPER_FIBRECHANNEL      , { "JUNIPER_FIBRECHANNEL"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::DVB_CI                    , { "DVB_CI"sv, "DVB-CI messages"sv } },
+		{ linktype_t::MUX27010                  , { "MUX27010"sv, "Variant of 3GPP TS 27.010 multiplexing protocol"sv } },
+		{ linktype_t::STANAG_5066_D_PDU         , { "STANAG_5066_D_PDU"sv, "D_PDUs as described by NATO standard STANAG 5066, starting with the synchronization sequence, and including both header and data CRCs. The current version of STANAG 5066 is backwards-compatible with the 1.0.2 version , although newer versions are classified"sv } },
+		{ linktype_t::JUNIPER_ATM_CEMIC         , { "JUNIPER_ATM_CEMIC"sv, "Reserved for Juniper Networks"sv } },
+		{ linktype_t::NFLOG                     , { "NFLOG"sv, "Linux netlink NETLINK NFLOG socket log messages"sv } },
+		{ linktype_t::NETANALYZER               , { "NETANALYZER"sv, "Ethernet frames with netANALYZER pseudo-header"sv } },
+		{ linktype_t::NETANALYZER_TRANSPARENT   , { "NETANALYZER_TRANSPARENT"sv, "Ethernet frames with netANALYZER pseudo-header, preamble, and SFD"sv } },
+		{ linktype_t::IPOIB                     , { "IPOIB"sv, "IP-over-InfiniBand"sv } },
+		{ linktype_t::MPEG_2_TS                 , { "MPEG_2_TS"sv, "MPEG-2 Transport Stream transport packets"sv } },
+		{ linktype_t::NG40                      , { "NG40"sv, "Frames from ng4T GmbH's ng40 protocol tester"sv } },
+		{ linktype_t::NFC_LLCP                  , { "NFC_LLCP"sv, "NFC Logical Link Control Protocol frames, with a pseudo-header"sv } },
+		{ linktype_t::PFSYNC                    , { "PFSYNC"sv, "Reserved for pfsync output"sv } },
+		{ linktype_t::INFINIBAND                , { "INFINIBAND"sv, "Raw InfiniBand frames, starting with the Local Routing Header, as specified in Chapter 5 Data packet format of InfiniBand™ Architectural Specification Release 1.2.1 Volume 1 - General Specifications"sv } },
+		{ linktype_t::SCTP                      , { "SCTP"sv, "SCTP packets, as defined by RFC 4960 , with no lower-level protocols such as IPv4 or IPv6"sv } },
+		{ linktype_t::USBPCAP                   , { "USBPCAP"sv, "USB packets, beginning with a USBPcap header"sv } },
+		{ linktype_t::RTAC_SERIAL               , { "RTAC_SERIAL"sv, "Serial-line packet from the Schweitzer Engineering Laboratories RTAC product"sv } },
+		{ linktype_t::BLUETOOTH_LE_LL           , { "BLUETOOTH_LE_LL"sv, "Bluetooth Low Energy air interface Link Layer packets, in the format described in Section 2.1 (PACKET FORMAT) of volume 6 of the Bluetooth Specification Version 4.0 (see PDF page 2200), but without the Preamble"sv } },
+		{ linktype_t::WIRESHARK_UPPER_PDU       , { "WIRESHARK_UPPER_PDU"sv, "Reserved for Wireshark"sv } },
+		{ linktype_t::NETLINK                   , { "NETLINK"sv, "Linux Netlink capture encapsulation"sv } },
+		{ linktype_t::BLUETOOTH_LINUX_MONITOR   , { "BLUETOOTH_LINUX_MONITOR"sv, "Bluetooth Linux Monitor"sv } },
+		{ linktype_t::BLUETOOTH_BREDR_BB        , { "BLUETOOTH_BREDR_BB"sv, "Bluetooth Basic Rate and Enhanced Data Rate baseband packets"sv } },
+		{ linktype_t::BLUETOOTH_LE_LL_WITH_PHDR , { "BLUETOOTH_LE_LL_WITH_PHDR"sv, "Bluetooth Low Energy link-layer packets"sv } },
+		{ linktype_t::PROFIBUS_DL               , { "PROFIBUS_DL"sv, "PROFIBUS data link layer packets, as specified by IEC standard 61158-4-3, beginning with the start delimiter, ending with the end delimiter, and including all octets between them"sv } },
+		{ linktype_t::PKTAP                     , { "PKTAP"sv, "Apple PKTAP capture encapsulation"sv } },
+		{ linktype_t::EPON                      , { "EPON"sv, "Ethernet-over-passive-optical-network packets, starting with the last 6 octets of the modified preamble as specified by 65.1.3.2 Transmit in Clause 65 of Section 5 of IEEE 802.3, followed immediately by an Ethernet frame"sv } },
+		{ linktype_t::IPMI_HPM_2                , { "IPMI_HPM_2"sv, "IPMI trace packets, as specified by Table 3-20 Trace Data Block Format in the PICMG HPM.2 specification The timestamps for packets in this format must match the timestamps in the Trace Data Blocks"sv } },
+		{ linktype_t::ZWAVE_R1_R2               , { "ZWAVE_R1_R2"sv, "Z-Wave RF profile R1 and R2 packets"sv } },
+		{ linktype_t::ZWAVE_R3                  , { "ZWAVE_R3"sv, "Z-Wave RF profile R3 packets"sv } },
+		{ linktype_t::WATTSTOPPER_DLM           , { "WATTSTOPPER_DLM"sv, "WattStopper Digital Lighting Management (DLM) and Legrand Nitoo Open protocol packets"sv } },
+		{ linktype_t::ISO_14443                 , { "ISO_14443"sv, "ISO 14443 contactless smartcard messages"sv } },
+		{ linktype_t::RDS                       , { "RDS"sv, "IEC 62106 Radio data system (RDS) groups"sv } },
+		{ linktype_t::USB_DARWIN                , { "USB_DARWIN"sv, "USB packets captured on a Darwin-based operating system (macOS, etc.)"sv } },
+		{ linktype_t::OPENFLOW                  , { "OPENFLOW"sv, "Reserved for OpenBSD DLT_OPENFLOW"sv } },
+		{ linktype_t::SDLC                      , { "SDLC"sv, "SDLC packets, as specified by Chapter 1, DLC Links, section Synchronous Data Link Control (SDLC) of Systems Network Architecture Formats, GA27-3136-20 , without the flag fields, zero-bit insertion, or Frame Check Sequence field, containing SNA path information units (PIUs) as the payload"sv } },
+		{ linktype_t::TI_LLN_SNIFFER            , { "TI_LLN_SNIFFER"sv, "Reserved for Texas Instruments protocol sniffer"sv } },
+		{ linktype_t::LORATAP                   , { "LORATAP"sv, "LoRaTap pseudo-header , followed by the payload, which is typically the PHYPayload from the LoRaWan specification"sv } },
+		{ linktype_t::VSOCK                     , { "VSOCK"sv, "Protocol for communication between host and guest machines in VMware and KVM hypervisors"sv } },
+		{ linktype_t::NORDIC_BLE                , { "NORDIC_BLE"sv, "Messages to and from a Nordic Semiconductor nRF Sniffer for Bluetooth LE packets"sv } },
+		{ linktype_t::DOCSIS31_XRA31            , { "DOCSIS31_XRA31"sv, "DOCSIS packets and bursts, preceded by a pseudo-header"sv } },
+		{ linktype_t::ETHERNET_MPACKET          , { "ETHERNET_MPACKET"sv, "mPackets, as specified by IEEE 802.3br Figure 99-4, starting with the preamble and always ending with a CRC field"sv } },
+		{ linktype_t::DISPLAYPORT_AUX           , { "DISPLAYPORT_AUX"sv, "DisplayPort AUX channel monitoring messages"sv } },
+		{ linktype_t::LINUX_SLL2                , { "LINUX_SLL2"sv, "Linux cooked capture encapsulation v2"sv } },
+		{ linktype_t::SERCOS_MONITOR            , { "SERCOS_MONITOR"sv, "Reserved for Sercos Monitor"sv } },
+		{ linktype_t::OPENVIZSLA                , { "OPENVIZSLA"sv, "OpenVizsla FPGA-based USB sniffer"sv } },
+		{ linktype_t::EBHSCR                    , { "EBHSCR"sv, "Elektrobit High Speed Capture and Replay (EBHSCR) format"sv } },
+		{ linktype_t::VPP_DISPATCH              , { "VPP_DISPATCH"sv, "fd.io VPP graph dispatcher trace records"sv } },
+		{ linktype_t::DSA_TAG_BRCM              , { "DSA_TAG_BRCM"sv, "Ethernet frames, with a Broadcom switch tag inserted"sv } },
+		{ linktype_t::DSA_TAG_BRCM_PREPEND      , { "DSA_TAG_BRCM_PREPEND"sv, "Ethernet frames, with a Broadcom switch tag prepended"sv } },
+		{ linktype_t::IEEE802_15_4_TAP          , { "IEEE802_15_4_TAP"sv, "IEEE 802.15.4 Low-Rate Wireless Networks, with a pseudo-header containing TLVs with metadata preceding the 802.15.4 header"sv } },
+		{ linktype_t::DSA_TAG_DSA               , { "DSA_TAG_DSA"sv, "Ethernet frames, with a Marvell DSA switch tag inserted"sv } },
+		{ linktype_t::DSA_TAG_EDSA              , { "DSA_TAG_EDSA"sv, "Ethernet frames, with a Marvell EDSA switch tag inserted"sv } },
+		{ linktype_t::ELEE                      , { "ELEE"sv, "Payload of lawful intercept packets using the ELEE protocol The packet begins with the ELEE header; it does not include any transport-layer or lower-layer headers for protocols used to transport ELEE packets"sv } },
+		{ linktype_t::Z_WAVE_SERIAL             , { "Z_WAVE_SERIAL"sv, "Serial frames transmitted between a host and a Z-Wave chip over an RS-232 or USB serial connection"sv } },
+		{ linktype_t::USB_2_0                   , { "USB_2_0"sv, "USB 2.0, 1.1, or 1.0 packet, beginning with a PID, as described by Chapter 8 Protocol Layer of the the Universal Serial Bus Specification Revision 2.0"sv } },
+		{ linktype_t::ATSC_ALP                  , { "ATSC_ALP"sv, "ATSC Link-Layer Protocol frames, as described in section 5 of the A/330 Link-Layer Protocol specification, found at https://www.atsc.org/atsc-documents/type/3-0-standards/, beginning with a Base Header"sv } },
+		{ linktype_t::ETW                       , { "ETW"sv, "Event Tracing for Windows messages"sv } },
+		{ linktype_t::NETANALYZER_NG            , { "NETANALYZER_NG"sv, "Reserved for Hilscher Gesellschaft fuer Systemautomation mbH netANALYZER NG hardware and software"sv } },
+		{ linktype_t::ZBOSS_NCP                 , { "ZBOSS_NCP"sv, "ZBOSS NCP Serial Protocol, with a pseudo-header"sv } },
+		{ linktype_t::USB_2_0_LOW_SPEED         , { "USB_2_0_LOW_SPEED"sv, "Low-Speed USB 2.0, 1.1, or 1.0 packet, beginning with a PID, as described by Chapter 8 Protocol Layer of the https://www.usb.org/document-library/usb-20-specification the Universal Serial Bus Specification Revision 2.0"sv } },
+		{ linktype_t::USB_2_0_FULL_SPEED        , { "USB_2_0_FULL_SPEED"sv, "Full-Speed USB 2.0, 1.1, or 1.0 packet, beginning with a PID, as described by Chapter 8 Protocol Layer of the https://www.usb.org/document-library/usb-20-specification the Universal Serial Bus Specification Revision 2.0"sv } },
+		{ linktype_t::USB_2_0_HIGH_SPEED        , { "USB_2_0_HIGH_SPEED"sv, "High-Speed USB 2.0 packet, beginning with a PID, as described by Chapter 8 Protocol Layer of the https://www.usb.org/document-library/usb-20-specification the Universal Serial Bus Specification Revision 2.0"sv } },
+		{ linktype_t::AUERSWALD_LOG             , { "AUERSWALD_LOG"sv, "Auerswald Logger Protocol, as described in https://github.com/Auerswald-GmbH/auerlog/blob/master/auerlog.txt"sv } },
+		{ linktype_t::ZWAVE_TAP                 , { "ZWAVE_TAP"sv, "Z-Wave packets, as specified by ITU-T Recommendation G.9959, with a https://gitlab.com/exegin/zwave-g9959-tap TAP meta-data header"sv } },
+		{ linktype_t::SILABS_DEBUG_CHANNEL      , { "SILABS_DEBUG_CHANNEL"sv, "Silicon Labs debug channel protocol, as described in https://github.com/SiliconLabs/java_packet_trace_library/blob/master/doc/debug-channel.md"sv } },
+		{ linktype_t::FIRA_UCI                  , { "FIRA_UCI"sv, "Ultra-wideband (UWB) controller interface protocol (UCI)"sv } },
+		{ linktype_t::MDB                       , { "MDB"sv, "MDB (Multi-Drop Bus) protocol between a vending machine controller and peripherals inside the vending machine, with the message format specified by https://www.kaiser.cx/pcap-mdb.html the PCAP format for MDB specification"sv } },
+		{ linktype_t::DECT_NR                   , { "DECT_NR"sv, "DECT-2020 New Radio (NR) MAC layer specified in https://www.etsi.org/committee/1394-dect ETSI TS 103 636-4. The Physical Header Field is always encoded using 80 bits (10 bytes). Broadcast transmissions using 40 bits (5 bytes) is padded with 40 zero bits (5 bytes). When padding is used the Receiver Identity value 0x0000 (reserved address) is used to detect broadcast transmissions"sv } },
+		{ linktype_t::PRIVATE_USE_000           , { "PRIVATE_USE_000"sv, "Reserved for private use #0"sv } },
+		{ linktype_t::PRIVATE_USE_001           , { "PRIVATE_USE_001"sv, "Reserved for private use #1"sv } },
+		{ linktype_t::PRIVATE_USE_002           , { "PRIVATE_USE_002"sv, "Reserved for private use #2"sv } },
+		{ linktype_t::PRIVATE_USE_003           , { "PRIVATE_USE_003"sv, "Reserved for private use #3"sv } },
+		{ linktype_t::PRIVATE_USE_004           , { "PRIVATE_USE_004"sv, "Reserved for private use #4"sv } },
+		{ linktype_t::PRIVATE_USE_005           , { "PRIVATE_USE_005"sv, "Reserved for private use #5"sv } },
+		{ linktype_t::PRIVATE_USE_006           , { "PRIVATE_USE_006"sv, "Reserved for private use #6"sv } },
+		{ linktype_t::PRIVATE_USE_007           , { "PRIVATE_USE_007"sv, "Reserved for private use #7"sv } },
+		{ linktype_t::PRIVATE_USE_008           , { "PRIVATE_USE_008"sv, "Reserved for private use #8"sv } },
+		{ linktype_t::PRIVATE_USE_009           , { "PRIVATE_USE_009"sv, "Reserved for private use #9"sv } },
+		{ linktype_t::PRIVATE_USE_010           , { "PRIVATE_USE_010"sv, "Reserved for private use #10"sv } },
+		{ linktype_t::PRIVATE_USE_011           , { "PRIVATE_USE_011"sv, "Reserved for private use #11"sv } },
+		{ linktype_t::PRIVATE_USE_012           , { "PRIVATE_USE_012"sv, "Reserved for private use #12"sv } },
+		{ linktype_t::PRIVATE_USE_013           , { "PRIVATE_USE_013"sv, "Reserved for private use #13"sv } },
+		{ linktype_t::PRIVATE_USE_014           , { "PRIVATE_USE_014"sv, "Reserved for private use #14"sv } },
+		{ linktype_t::PRIVATE_USE_015           , { "PRIVATE_USE_015"sv, "Reserved for private use #15"sv } },
+		{ linktype_t::PRIVATE_USE_016           , { "PRIVATE_USE_016"sv, "Reserved for private use #16"sv } },
+		{ linktype_t::PRIVATE_USE_017           , { "PRIVATE_USE_017"sv, "Reserved for private use #17"sv } },
+		{ linktype_t::PRIVATE_USE_018           , { "PRIVATE_USE_018"sv, "Reserved for private use #18"sv } },
+		{ linktype_t::PRIVATE_USE_019           , { "PRIVATE_USE_019"sv, "Reserved for private use #19"sv } },
+		{ linktype_t::PRIVATE_USE_020           , { "PRIVATE_USE_020"sv, "Reserved for private use #20"sv } },
+		{ linktype_t::PRIVATE_USE_021           , { "PRIVATE_USE_021"sv, "Reserved for private use #21"sv } },
+		{ linktype_t::PRIVATE_USE_022           , { "PRIVATE_USE_022"sv, "Reserved for private use #22"sv } },
+		{ linktype_t::PRIVATE_USE_023           , { "PRIVATE_USE_023"sv, "Reserved for private use #23"sv } },
+		{ linktype_t::PRIVATE_USE_024           , { "PRIVATE_USE_024"sv, "Reserved for private use #24"sv } },
+		{ linktype_t::PRIVATE_USE_025           , { "PRIVATE_USE_025"sv, "Reserved for private use #25"sv } },
+		{ linktype_t::PRIVATE_USE_026           , { "PRIVATE_USE_026"sv, "Reserved for private use #26"sv } },
+		{ linktype_t::PRIVATE_USE_027           , { "PRIVATE_USE_027"sv, "Reserved for private use #27"sv } },
+		{ linktype_t::PRIVATE_USE_028           , { "PRIVATE_USE_028"sv, "Reserved for private use #28"sv } },
+		{ linktype_t::PRIVATE_USE_029           , { "PRIVATE_USE_029"sv, "Reserved for private use #29"sv } },
+		{ linktype_t::PRIVATE_USE_030           , { "PRIVATE_USE_030"sv, "Reserved for private use #30"sv } },
+		{ linktype_t::PRIVATE_USE_031           , { "PRIVATE_USE_031"sv, "Reserved for private use #31"sv } },
+		{ linktype_t::PRIVATE_USE_032           , { "PRIVATE_USE_032"sv, "Reserved for private use #32"sv } },
+		{ linktype_t::PRIVATE_USE_033           , { "PRIVATE_USE_033"sv, "Reserved for private use #33"sv } },
+		{ linktype_t::PRIVATE_USE_034           , { "PRIVATE_USE_034"sv, "Reserved for private use #34"sv } },
+		{ linktype_t::PRIVATE_USE_035           , { "PRIVATE_USE_035"sv, "Reserved for private use #35"sv } },
+		{ linktype_t::PRIVATE_USE_036           , { "PRIVATE_USE_036"sv, "Reserved for private use #36"sv } },
+		{ linktype_t::PRIVATE_USE_037           , { "PRIVATE_USE_037"sv, "Reserved for private use #37"sv } },
+		{ linktype_t::PRIVATE_USE_038           , { "PRIVATE_USE_038"sv, "Reserved for private use #38"sv } },
+		{ linktype_t::PRIVATE_USE_039           , { "PRIVATE_USE_039"sv, "Reserved for private use #39"sv } },
+		{ linktype_t::PRIVATE_USE_040           , { "PRIVATE_USE_040"sv, "Reserved for private use #40"sv } },
+		{ linktype_t::PRIVATE_USE_041           , { "PRIVATE_USE_041"sv, "Reserved for private use #41"sv } },
+		{ linktype_t::PRIVATE_USE_042           , { "PRIVATE_USE_042"sv, "Reserved for private use #42"sv } },
+		{ linktype_t::PRIVATE_USE_043           , { "PRIVATE_USE_043"sv, "Reserved for private use #43"sv } },
+		{ linktype_t::PRIVATE_USE_044           , { "PRIVATE_USE_044"sv, "Reserved for private use #44"sv } },
+		{ linktype_t::PRIVATE_USE_045           , { "PRIVATE_USE_045"sv, "Reserved for private use #45"sv } },
+		{ linktype_t::PRIVATE_USE_046           , { "PRIVATE_USE_046"sv, "Reserved for private use #46"sv } },
+		{ linktype_t::PRIVATE_USE_047           , { "PRIVATE_USE_047"sv, "Reserved for private use #47"sv } },
+		{ linktype_t::PRIVATE_USE_048           , { "PRIVATE_USE_048"sv, "Reserved for private use #48"sv } },
+		{ linktype_t::PRIVATE_USE_049           , { "PRIVATE_USE_049"sv, "Reserved for private use #49"sv } },
+		{ linktype_t::PRIVATE_USE_050           , { "PRIVATE_USE_050"sv, "Reserved for private use #50"sv } },
+		{ linktype_t::PRIVATE_USE_051           , { "PRIVATE_USE_051"sv, "Reserved for private use #51"sv } },
+		{ linktype_t::PRIVATE_USE_052           , { "PRIVATE_USE_052"sv, "Reserved for private use #52"sv } },
+		{ linktype_t::PRIVATE_USE_053           , { "PRIVATE_USE_053"sv, "Reserved for private use #53"sv } },
+		{ linktype_t::PRIVATE_USE_054           , { "PRIVATE_USE_054"sv, "Reserved for private use #54"sv } },
+		{ linktype_t::PRIVATE_USE_055           , { "PRIVATE_USE_055"sv, "Reserved for private use #55"sv } },
+		{ linktype_t::PRIVATE_USE_056           , { "PRIVATE_USE_056"sv, "Reserved for private use #56"sv } },
+		{ linktype_t::PRIVATE_USE_057           , { "PRIVATE_USE_057"sv, "Reserved for private use #57"sv } },
+		{ linktype_t::PRIVATE_USE_058           , { "PRIVATE_USE_058"sv, "Reserved for private use #58"sv } },
+		{ linktype_t::PRIVATE_USE_059           , { "PRIVATE_USE_059"sv, "Reserved for private use #59"sv } },
+		{ linktype_t::PRIVATE_USE_060           , { "PRIVATE_USE_060"sv, "Reserved for private use #60"sv } },
+		{ linktype_t::PRIVATE_USE_061           , { "PRIVATE_USE_061"sv, "Reserved for private use #61"sv } },
+		{ linktype_t::PRIVATE_USE_062           , { "PRIVATE_USE_062"sv, "Reserved for private use #62"sv } },
+		{ linktype_t::PRIVATE_USE_063           , { "PRIVATE_USE_063"sv, "Reserved for private use #63"sv } },
+		{ linktype_t::PRIVATE_USE_064           , { "PRIVATE_USE_064"sv, "Reserved for private use #64"sv } },
+		{ linktype_t::PRIVATE_USE_065           , { "PRIVATE_USE_065"sv, "Reserved for private use #65"sv } },
+		{ linktype_t::PRIVATE_USE_066           , { "PRIVATE_USE_066"sv, "Reserved for private use #66"sv } },
+		{ linktype_t::PRIVATE_USE_067           , { "PRIVATE_USE_067"sv, "Reserved for private use #67"sv } },
+		{ linktype_t::PRIVATE_USE_068           , { "PRIVATE_USE_068"sv, "Reserved for private use #68"sv } },
+		{ linktype_t::PRIVATE_USE_069           , { "PRIVATE_USE_069"sv, "Reserved for private use #69"sv } },
+		{ linktype_t::PRIVATE_USE_070           , { "PRIVATE_USE_070"sv, "Reserved for private use #70"sv } },
+		{ linktype_t::PRIVATE_USE_071           , { "PRIVATE_USE_071"sv, "Reserved for private use #71"sv } },
+		{ linktype_t::PRIVATE_USE_072           , { "PRIVATE_USE_072"sv, "Reserved for private use #72"sv } },
+		{ linktype_t::PRIVATE_USE_073           , { "PRIVATE_USE_073"sv, "Reserved for private use #73"sv } },
+		{ linktype_t::PRIVATE_USE_074           , { "PRIVATE_USE_074"sv, "Reserved for private use #74"sv } },
+		{ linktype_t::PRIVATE_USE_075           , { "PRIVATE_USE_075"sv, "Reserved for private use #75"sv } },
+		{ linktype_t::PRIVATE_USE_076           , { "PRIVATE_USE_076"sv, "Reserved for private use #76"sv } },
+		{ linktype_t::PRIVATE_USE_077           , { "PRIVATE_USE_077"sv, "Reserved for private use #77"sv } },
+		{ linktype_t::PRIVATE_USE_078           , { "PRIVATE_USE_078"sv, "Reserved for private use #78"sv } },
+		{ linktype_t::PRIVATE_USE_079           , { "PRIVATE_USE_079"sv, "Reserved for private use #79"sv } },
+		{ linktype_t::PRIVATE_USE_080           , { "PRIVATE_USE_080"sv, "Reserved for private use #80"sv } },
+		{ linktype_t::PRIVATE_USE_081           , { "PRIVATE_USE_081"sv, "Reserved for private use #81"sv } },
+		{ linktype_t::PRIVATE_USE_082           , { "PRIVATE_USE_082"sv, "Reserved for private use #82"sv } },
+		{ linktype_t::PRIVATE_USE_083           , { "PRIVATE_USE_083"sv, "Reserved for private use #83"sv } },
+		{ linktype_t::PRIVATE_USE_084           , { "PRIVATE_USE_084"sv, "Reserved for private use #84"sv } },
+		{ linktype_t::PRIVATE_USE_085           , { "PRIVATE_USE_085"sv, "Reserved for private use #85"sv } },
+		{ linktype_t::PRIVATE_USE_086           , { "PRIVATE_USE_086"sv, "Reserved for private use #86"sv } },
+		{ linktype_t::PRIVATE_USE_087           , { "PRIVATE_USE_087"sv, "Reserved for private use #87"sv } },
+		{ linktype_t::PRIVATE_USE_088           , { "PRIVATE_USE_088"sv, "Reserved for private use #88"sv } },
+		{ linktype_t::PRIVATE_USE_089           , { "PRIVATE_USE_089"sv, "Reserved for private use #89"sv } },
+		{ linktype_t::PRIVATE_USE_090           , { "PRIVATE_USE_090"sv, "Reserved for private use #90"sv } },
+		{ linktype_t::PRIVATE_USE_091           , { "PRIVATE_USE_091"sv, "Reserved for private use #91"sv } },
+		{ linktype_t::PRIVATE_USE_092           , { "PRIVATE_USE_092"sv, "Reserved for private use #92"sv } },
+		{ linktype_t::PRIVATE_USE_093           , { "PRIVATE_USE_093"sv, "Reserved for private use #93"sv } },
+		{ linktype_t::PRIVATE_USE_094           , { "PRIVATE_USE_094"sv, "Reserved for private use #94"sv } },
+		{ linktype_t::PRIVATE_USE_095           , { "PRIVATE_USE_095"sv, "Reserved for private use #95"sv } },
+		{ linktype_t::PRIVATE_USE_096           , { "PRIVATE_USE_096"sv, "Reserved for private use #96"sv } },
+		{ linktype_t::PRIVATE_USE_097           , { "PRIVATE_USE_097"sv, "Reserved for private use #97"sv } },
+		{ linktype_t::PRIVATE_USE_098           , { "PRIVATE_USE_098"sv, "Reserved for private use #98"sv } },
+		{ linktype_t::PRIVATE_USE_099           , { "PRIVATE_USE_099"sv, "Reserved for private use #99"sv } },
+		{ linktype_t::PRIVATE_USE_100           , { "PRIVATE_USE_100"sv, "Reserved for private use #100"sv } },
+		{ linktype_t::PRIVATE_USE_101           , { "PRIVATE_USE_101"sv, "Reserved for private use #101"sv } },
+		{ linktype_t::PRIVATE_USE_102           , { "PRIVATE_USE_102"sv, "Reserved for private use #102"sv } },
+		{ linktype_t::PRIVATE_USE_103           , { "PRIVATE_USE_103"sv, "Reserved for private use #103"sv } },
+		{ linktype_t::PRIVATE_USE_104           , { "PRIVATE_USE_104"sv, "Reserved for private use #104"sv } },
+		{ linktype_t::PRIVATE_USE_105           , { "PRIVATE_USE_105"sv, "Reserved for private use #105"sv } },
+		{ linktype_t::PRIVATE_USE_106           , { "PRIVATE_USE_106"sv, "Reserved for private use #106"sv } },
+		{ linktype_t::PRIVATE_USE_107           , { "PRIVATE_USE_107"sv, "Reserved for private use #107"sv } },
+		{ linktype_t::PRIVATE_USE_108           , { "PRIVATE_USE_108"sv, "Reserved for private use #108"sv } },
+		{ linktype_t::PRIVATE_USE_109           , { "PRIVATE_USE_109"sv, "Reserved for private use #109"sv } },
+		{ linktype_t::PRIVATE_USE_110           , { "PRIVATE_USE_110"sv, "Reserved for private use #110"sv } },
+		{ linktype_t::PRIVATE_USE_111           , { "PRIVATE_USE_111"sv, "Reserved for private use #111"sv } },
+		{ linktype_t::PRIVATE_USE_112           , { "PRIVATE_USE_112"sv, "Reserved for private use #112"sv } },
+		{ linktype_t::PRIVATE_USE_113           , { "PRIVATE_USE_113"sv, "Reserved for private use #113"sv } },
+		{ linktype_t::PRIVATE_USE_114           , { "PRIVATE_USE_114"sv, "Reserved for private use #114"sv } },
+		{ linktype_t::PRIVATE_USE_115           , { "PRIVATE_USE_115"sv, "Reserved for private use #115"sv } },
+		{ linktype_t::PRIVATE_USE_116           , { "PRIVATE_USE_116"sv, "Reserved for private use #116"sv } },
+		{ linktype_t::PRIVATE_USE_117           , { "PRIVATE_USE_117"sv, "Reserved for private use #117"sv } },
+		{ linktype_t::PRIVATE_USE_118           , { "PRIVATE_USE_118"sv, "Reserved for private use #118"sv } },
+		{ linktype_t::PRIVATE_USE_119           , { "PRIVATE_USE_119"sv, "Reserved for private use #119"sv } },
+		{ linktype_t::PRIVATE_USE_120           , { "PRIVATE_USE_120"sv, "Reserved for private use #120"sv } },
+		{ linktype_t::PRIVATE_USE_121           , { "PRIVATE_USE_121"sv, "Reserved for private use #121"sv } },
+		{ linktype_t::PRIVATE_USE_122           , { "PRIVATE_USE_122"sv, "Reserved for private use #122"sv } },
+		{ linktype_t::PRIVATE_USE_123           , { "PRIVATE_USE_123"sv, "Reserved for private use #123"sv } },
+		{ linktype_t::PRIVATE_USE_124           , { "PRIVATE_USE_124"sv, "Reserved for private use #124"sv } },
+		{ linktype_t::PRIVATE_USE_125           , { "PRIVATE_USE_125"sv, "Reserved for private use #125"sv } },
+		{ linktype_t::PRIVATE_USE_126           , { "PRIVATE_USE_126"sv, "Reserved for private use #126"sv } },
+		{ linktype_t::PRIVATE_USE_127           , { "PRIVATE_USE_127"sv, "Reserved for private use #127"sv } },
+		{ linktype_t::PRIVATE_USE_128           , { "PRIVATE_USE_128"sv, "Reserved for private use #128"sv } },
+		{ linktype_t::PRIVATE_USE_129           , { "PRIVATE_USE_129"sv, "Reserved for private use #129"sv } },
+		{ linktype_t::PRIVATE_USE_130           , { "PRIVATE_USE_130"sv, "Reserved for private use #130"sv } },
+		{ linktype_t::PRIVATE_USE_131           , { "PRIVATE_USE_131"sv, "Reserved for private use #131"sv } },
+		{ linktype_t::PRIVATE_USE_132           , { "PRIVATE_USE_132"sv, "Reserved for private use #132"sv } },
+		{ linktype_t::PRIVATE_USE_133           , { "PRIVATE_USE_133"sv, "Reserved for private use #133"sv } },
+		{ linktype_t::PRIVATE_USE_134           , { "PRIVATE_USE_134"sv, "Reserved for private use #134"sv } },
+		{ linktype_t::PRIVATE_USE_135           , { "PRIVATE_USE_135"sv, "Reserved for private use #135"sv } },
+		{ linktype_t::PRIVATE_USE_136           , { "PRIVATE_USE_136"sv, "Reserved for private use #136"sv } },
+		{ linktype_t::PRIVATE_USE_137           , { "PRIVATE_USE_137"sv, "Reserved for private use #137"sv } },
+		{ linktype_t::PRIVATE_USE_138           , { "PRIVATE_USE_138"sv, "Reserved for private use #138"sv } },
+		{ linktype_t::PRIVATE_USE_139           , { "PRIVATE_USE_139"sv, "Reserved for private use #139"sv } },
+		{ linktype_t::PRIVATE_USE_140           , { "PRIVATE_USE_140"sv, "Reserved for private use #140"sv } },
+		{ linktype_t::PRIVATE_USE_141           , { "PRIVATE_USE_141"sv, "Reserved for private use #141"sv } },
+		{ linktype_t::PRIVATE_USE_142           , { "PRIVATE_USE_142"sv, "Reserved for private use #142"sv } },
+		{ linktype_t::PRIVATE_USE_143           , { "PRIVATE_USE_143"sv, "Reserved for private use #143"sv } },
+		{ linktype_t::PRIVATE_USE_144           , { "PRIVATE_USE_144"sv, "Reserved for private use #144"sv } },
+		{ linktype_t::PRIVATE_USE_145           , { "PRIVATE_USE_145"sv, "Reserved for private use #145"sv } },
+		{ linktype_t::PRIVATE_USE_146           , { "PRIVATE_USE_146"sv, "Reserved for private use #146"sv } },
+		{ linktype_t::PRIVATE_USE_147           , { "PRIVATE_USE_147"sv, "Reserved for private use #147"sv } },
+		{ linktype_t::PRIVATE_USE_148           , { "PRIVATE_USE_148"sv, "Reserved for private use #148"sv } },
+		{ linktype_t::PRIVATE_USE_149           , { "PRIVATE_USE_149"sv, "Reserved for private use #149"sv } },
+		{ linktype_t::PRIVATE_USE_150           , { "PRIVATE_USE_150"sv, "Reserved for private use #150"sv } },
+		{ linktype_t::PRIVATE_USE_151           , { "PRIVATE_USE_151"sv, "Reserved for private use #151"sv } },
+		{ linktype_t::PRIVATE_USE_152           , { "PRIVATE_USE_152"sv, "Reserved for private use #152"sv } },
+		{ linktype_t::PRIVATE_USE_153           , { "PRIVATE_USE_153"sv, "Reserved for private use #153"sv } },
+		{ linktype_t::PRIVATE_USE_154           , { "PRIVATE_USE_154"sv, "Reserved for private use #154"sv } },
+		{ linktype_t::PRIVATE_USE_155           , { "PRIVATE_USE_155"sv, "Reserved for private use #155"sv } },
+		{ linktype_t::PRIVATE_USE_156           , { "PRIVATE_USE_156"sv, "Reserved for private use #156"sv } },
+		{ linktype_t::PRIVATE_USE_157           , { "PRIVATE_USE_157"sv, "Reserved for private use #157"sv } },
+		{ linktype_t::PRIVATE_USE_158           , { "PRIVATE_USE_158"sv, "Reserved for private use #158"sv } },
+		{ linktype_t::PRIVATE_USE_159           , { "PRIVATE_USE_159"sv, "Reserved for private use #159"sv } },
+		{ linktype_t::PRIVATE_USE_160           , { "PRIVATE_USE_160"sv, "Reserved for private use #160"sv } },
+		{ linktype_t::PRIVATE_USE_161           , { "PRIVATE_USE_161"sv, "Reserved for private use #161"sv } },
+		{ linktype_t::PRIVATE_USE_162           , { "PRIVATE_USE_162"sv, "Reserved for private use #162"sv } },
+		{ linktype_t::PRIVATE_USE_163           , { "PRIVATE_USE_163"sv, "Reserved for private use #163"sv } },
+		{ linktype_t::PRIVATE_USE_164           , { "PRIVATE_USE_164"sv, "Reserved for private use #164"sv } },
+		{ linktype_t::PRIVATE_USE_165           , { "PRIVATE_USE_165"sv, "Reserved for private use #165"sv } },
+		{ linktype_t::PRIVATE_USE_166           , { "PRIVATE_USE_166"sv, "Reserved for private use #166"sv } },
+		{ linktype_t::PRIVATE_USE_167           , { "PRIVATE_USE_167"sv, "Reserved for private use #167"sv } },
+		{ linktype_t::PRIVATE_USE_168           , { "PRIVATE_USE_168"sv, "Reserved for private use #168"sv } },
+		{ linktype_t::PRIVATE_USE_169           , { "PRIVATE_USE_169"sv, "Reserved for private use #169"sv } },
+		{ linktype_t::PRIVATE_USE_170           , { "PRIVATE_USE_170"sv, "Reserved for private use #170"sv } },
+		{ linktype_t::PRIVATE_USE_171           , { "PRIVATE_USE_171"sv, "Reserved for private use #171"sv } },
+		{ linktype_t::PRIVATE_USE_172           , { "PRIVATE_USE_172"sv, "Reserved for private use #172"sv } },
+		{ linktype_t::PRIVATE_USE_173           , { "PRIVATE_USE_173"sv, "Reserved for private use #173"sv } },
+		{ linktype_t::PRIVATE_USE_174           , { "PRIVATE_USE_174"sv, "Reserved for private use #174"sv } },
+		{ linktype_t::PRIVATE_USE_175           , { "PRIVATE_USE_175"sv, "Reserved for private use #175"sv } },
+		{ linktype_t::PRIVATE_USE_176           , { "PRIVATE_USE_176"sv, "Reserved for private use #176"sv } },
+		{ linktype_t::PRIVATE_USE_177           , { "PRIVATE_USE_177"sv, "Reserved for private use #177"sv } },
+		{ linktype_t::PRIVATE_USE_178           , { "PRIVATE_USE_178"sv, "Reserved for private use #178"sv } },
+		{ linktype_t::PRIVATE_USE_179           , { "PRIVATE_USE_179"sv, "Reserved for private use #179"sv } },
+		{ linktype_t::PRIVATE_USE_180           , { "PRIVATE_USE_180"sv, "Reserved for private use #180"sv } },
+		{ linktype_t::PRIVATE_USE_181           , { "PRIVATE_USE_181"sv, "Reserved for private use #181"sv } },
+		{ linktype_t::PRIVATE_USE_182           , { "PRIVATE_USE_182"sv, "Reserved for private use #182"sv } },
+		{ linktype_t::PRIVATE_USE_183           , { "PRIVATE_USE_183"sv, "Reserved for private use #183"sv } },
+		{ linktype_t::PRIVATE_USE_184           , { "PRIVATE_USE_184"sv, "Reserved for private use #184"sv } },
+		{ linktype_t::PRIVATE_USE_185           , { "PRIVATE_USE_185"sv, "Reserved for private use #185"sv } },
+		{ linktype_t::PRIVATE_USE_186           , { "PRIVATE_USE_186"sv, "Reserved for private use #186"sv } },
+		{ linktype_t::PRIVATE_USE_187           , { "PRIVATE_USE_187"sv, "Reserved for private use #187"sv } },
+		{ linktype_t::PRIVATE_USE_188           , { "PRIVATE_USE_188"sv, "Reserved for private use #188"sv } },
+		{ linktype_t::PRIVATE_USE_189           , { "PRIVATE_USE_189"sv, "Reserved for private use #189"sv } },
+		{ linktype_t::PRIVATE_USE_190           , { "PRIVATE_USE_190"sv, "Reserved for private use #190"sv } },
+		{ linktype_t::PRIVATE_USE_191           , { "PRIVATE_USE_191"sv, "Reserved for private use #191"sv } },
+		{ linktype_t::PRIVATE_USE_192           , { "PRIVATE_USE_192"sv, "Reserved for private use #192"sv } },
+		{ linktype_t::PRIVATE_USE_193           , { "PRIVATE_USE_193"sv, "Reserved for private use #193"sv } },
+		{ linktype_t::PRIVATE_USE_194           , { "PRIVATE_USE_194"sv, "Reserved for private use #194"sv } },
+		{ linktype_t::PRIVATE_USE_195           , { "PRIVATE_USE_195"sv, "Reserved for private use #195"sv } },
+		{ linktype_t::PRIVATE_USE_196           , { "PRIVATE_USE_196"sv, "Reserved for private use #196"sv } },
+		{ linktype_t::PRIVATE_USE_197           , { "PRIVATE_USE_197"sv, "Reserved for private use #197"sv } },
+		{ linktype_t::PRIVATE_USE_198           , { "PRIVATE_USE_198"sv, "Reserved for private use #198"sv } },
+		{ linktype_t::PRIVATE_USE_199           , { "PRIVATE_USE_199"sv, "Reserved for private use #199"sv } },
+		{ linktype_t::PRIVATE_USE_200           , { "PRIVATE_USE_200"sv, "Reserved for private use #200"sv } },
+		{ linktype_t::PRIVATE_USE_201           , { "PRIVATE_USE_201"sv, "Reserved for private use #201"sv } },
+		{ linktype_t::PRIVATE_USE_202           , { "PRIVATE_USE_202"sv, "Reserved for private use #202"sv } },
+		{ linktype_t::PRIVATE_USE_203           , { "PRIVATE_USE_203"sv, "Reserved for private use #203"sv } },
+		{ linktype_t::PRIVATE_USE_204           , { "PRIVATE_USE_204"sv, "Reserved for private use #204"sv } },
+		{ linktype_t::PRIVATE_USE_205           , { "PRIVATE_USE_205"sv, "Reserved for private use #205"sv } },
+		{ linktype_t::PRIVATE_USE_206           , { "PRIVATE_USE_206"sv, "Reserved for private use #206"sv } },
+		{ linktype_t::PRIVATE_USE_207           , { "PRIVATE_USE_207"sv, "Reserved for private use #207"sv } },
+		{ linktype_t::PRIVATE_USE_208           , { "PRIVATE_USE_208"sv, "Reserved for private use #208"sv } },
+		{ linktype_t::PRIVATE_USE_209           , { "PRIVATE_USE_209"sv, "Reserved for private use #209"sv } },
+		{ linktype_t::PRIVATE_USE_210           , { "PRIVATE_USE_210"sv, "Reserved for private use #210"sv } },
+		{ linktype_t::PRIVATE_USE_211           , { "PRIVATE_USE_211"sv, "Reserved for private use #211"sv } },
+		{ linktype_t::PRIVATE_USE_212           , { "PRIVATE_USE_212"sv, "Reserved for private use #212"sv } },
+		{ linktype_t::PRIVATE_USE_213           , { "PRIVATE_USE_213"sv, "Reserved for private use #213"sv } },
+		{ linktype_t::PRIVATE_USE_214           , { "PRIVATE_USE_214"sv, "Reserved for private use #214"sv } },
+		{ linktype_t::PRIVATE_USE_215           , { "PRIVATE_USE_215"sv, "Reserved for private use #215"sv } },
+		{ linktype_t::PRIVATE_USE_216           , { "PRIVATE_USE_216"sv, "Reserved for private use #216"sv } },
+		{ linktype_t::PRIVATE_USE_217           , { "PRIVATE_USE_217"sv, "Reserved for private use #217"sv } },
+		{ linktype_t::PRIVATE_USE_218           , { "PRIVATE_USE_218"sv, "Reserved for private use #218"sv } },
+		{ linktype_t::PRIVATE_USE_219           , { "PRIVATE_USE_219"sv, "Reserved for private use #219"sv } },
+		{ linktype_t::PRIVATE_USE_220           , { "PRIVATE_USE_220"sv, "Reserved for private use #220"sv } },
+		{ linktype_t::PRIVATE_USE_221           , { "PRIVATE_USE_221"sv, "Reserved for private use #221"sv } },
+		{ linktype_t::PRIVATE_USE_222           , { "PRIVATE_USE_222"sv, "Reserved for private use #222"sv } },
+		{ linktype_t::PRIVATE_USE_223           , { "PRIVATE_USE_223"sv, "Reserved for private use #223"sv } },
+		{ linktype_t::PRIVATE_USE_224           , { "PRIVATE_USE_224"sv, "Reserved for private use #224"sv } },
+		{ linktype_t::PRIVATE_USE_225           , { "PRIVATE_USE_225"sv, "Reserved for private use #225"sv } },
+		{ linktype_t::PRIVATE_USE_226           , { "PRIVATE_USE_226"sv, "Reserved for private use #226"sv } },
+		{ linktype_t::PRIVATE_USE_227           , { "PRIVATE_USE_227"sv, "Reserved for private use #227"sv } },
+		{ linktype_t::PRIVATE_USE_228           , { "PRIVATE_USE_228"sv, "Reserved for private use #228"sv } },
+		{ linktype_t::PRIVATE_USE_229           , { "PRIVATE_USE_229"sv, "Reserved for private use #229"sv } },
+		{ linktype_t::PRIVATE_USE_230           , { "PRIVATE_USE_230"sv, "Reserved for private use #230"sv } },
+		{ linktype_t::PRIVATE_USE_231           , { "PRIVATE_USE_231"sv, "Reserved for private use #231"sv } },
+		{ linktype_t::PRIVATE_USE_232           , { "PRIVATE_USE_232"sv, "Reserved for private use #232"sv } },
+		{ linktype_t::PRIVATE_USE_233           , { "PRIVATE_USE_233"sv, "Reserved for private use #233"sv } },
+		{ linktype_t::PRIVATE_USE_234           , { "PRIVATE_USE_234"sv, "Reserved for private use #234"sv } },
+		{ linktype_t::PRIVATE_USE_235           , { "PRIVATE_USE_235"sv, "Reserved for private use #235"sv } },
+		{ linktype_t::PRIVATE_USE_236           , { "PRIVATE_USE_236"sv, "Reserved for private use #236"sv } },
+		{ linktype_t::PRIVATE_USE_237           , { "PRIVATE_USE_237"sv, "Reserved for private use #237"sv } },
+		{ linktype_t::PRIVATE_USE_238           , { "PRIVATE_USE_238"sv, "Reserved for private use #238"sv } },
+		{ linktype_t::PRIVATE_USE_239           , { "PRIVATE_USE_239"sv, "Reserved for private use #239"sv } },
+		{ linktype_t::PRIVATE_USE_240           , { "PRIVATE_USE_240"sv, "Reserved for private use #240"sv } },
+		{ linktype_t::PRIVATE_USE_241           , { "PRIVATE_USE_241"sv, "Reserved for private use #241"sv } },
+		{ linktype_t::PRIVATE_USE_242           , { "PRIVATE_USE_242"sv, "Reserved for private use #242"sv } },
+		{ linktype_t::PRIVATE_USE_243           , { "PRIVATE_USE_243"sv, "Reserved for private use #243"sv } },
+		{ linktype_t::PRIVATE_USE_244           , { "PRIVATE_USE_244"sv, "Reserved for private use #244"sv } },
+		{ linktype_t::PRIVATE_USE_245           , { "PRIVATE_USE_245"sv, "Reserved for private use #245"sv } },
+		{ linktype_t::PRIVATE_USE_246           , { "PRIVATE_USE_246"sv, "Reserved for private use #246"sv } },
+		{ linktype_t::PRIVATE_USE_247           , { "PRIVATE_USE_247"sv, "Reserved for private use #247"sv } },
+		{ linktype_t::PRIVATE_USE_248           , { "PRIVATE_USE_248"sv, "Reserved for private use #248"sv } },
+		{ linktype_t::PRIVATE_USE_249           , { "PRIVATE_USE_249"sv, "Reserved for private use #249"sv } },
+		{ linktype_t::PRIVATE_USE_250           , { "PRIVATE_USE_250"sv, "Reserved for private use #250"sv } },
+		{ linktype_t::PRIVATE_USE_251           , { "PRIVATE_USE_251"sv, "Reserved for private use #251"sv } },
+		{ linktype_t::PRIVATE_USE_252           , { "PRIVATE_USE_252"sv, "Reserved for private use #252"sv } },
+		{ linktype_t::PRIVATE_USE_253           , { "PRIVATE_USE_253"sv, "Reserved for private use #253"sv } },
+		{ linktype_t::PRIVATE_USE_254           , { "PRIVATE_USE_254"sv, "Reserved for private use #254"sv } },
+		{ linktype_t::PRIVATE_USE_255           , { "PRIVATE_USE_255"sv, "Reserved for private use #255"sv } },
+		{ linktype_t::PRIVATE_USE_256           , { "PRIVATE_USE_256"sv, "Reserved for private use #256"sv } },
+		{ linktype_t::PRIVATE_USE_257           , { "PRIVATE_USE_257"sv, "Reserved for private use #257"sv } },
+		{ linktype_t::PRIVATE_USE_258           , { "PRIVATE_USE_258"sv, "Reserved for private use #258"sv } },
+		{ linktype_t::PRIVATE_USE_259           , { "PRIVATE_USE_259"sv, "Reserved for private use #259"sv } },
+		{ linktype_t::PRIVATE_USE_260           , { "PRIVATE_USE_260"sv, "Reserved for private use #260"sv } },
+		{ linktype_t::PRIVATE_USE_261           , { "PRIVATE_USE_261"sv, "Reserved for private use #261"sv } },
+		{ linktype_t::PRIVATE_USE_262           , { "PRIVATE_USE_262"sv, "Reserved for private use #262"sv } },
+		{ linktype_t::PRIVATE_USE_263           , { "PRIVATE_USE_263"sv, "Reserved for private use #263"sv } },
+		{ linktype_t::PRIVATE_USE_264           , { "PRIVATE_USE_264"sv, "Reserved for private use #264"sv } },
+		{ linktype_t::PRIVATE_USE_265           , { "PRIVATE_USE_265"sv, "Reserved for private use #265"sv } },
+		{ linktype_t::PRIVATE_USE_266           , { "PRIVATE_USE_266"sv, "Reserved for private use #266"sv } },
+		{ linktype_t::PRIVATE_USE_267           , { "PRIVATE_USE_267"sv, "Reserved for private use #267"sv } },
+		{ linktype_t::PRIVATE_USE_268           , { "PRIVATE_USE_268"sv, "Reserved for private use #268"sv } },
+		{ linktype_t::PRIVATE_USE_269           , { "PRIVATE_USE_269"sv, "Reserved for private use #269"sv } },
+		{ linktype_t::PRIVATE_USE_270           , { "PRIVATE_USE_270"sv, "Reserved for private use #270"sv } },
+		{ linktype_t::PRIVATE_USE_271           , { "PRIVATE_USE_271"sv, "Reserved for private use #271"sv } },
+		{ linktype_t::PRIVATE_USE_272           , { "PRIVATE_USE_272"sv, "Reserved for private use #272"sv } },
+		{ linktype_t::PRIVATE_USE_273           , { "PRIVATE_USE_273"sv, "Reserved for private use #273"sv } },
+		{ linktype_t::PRIVATE_USE_274           , { "PRIVATE_USE_274"sv, "Reserved for private use #274"sv } },
+		{ linktype_t::PRIVATE_USE_275           , { "PRIVATE_USE_275"sv, "Reserved for private use #275"sv } },
+		{ linktype_t::PRIVATE_USE_276           , { "PRIVATE_USE_276"sv, "Reserved for private use #276"sv } },
+		{ linktype_t::PRIVATE_USE_277           , { "PRIVATE_USE_277"sv, "Reserved for private use #277"sv } },
+		{ linktype_t::PRIVATE_USE_278           , { "PRIVATE_USE_278"sv, "Reserved for private use #278"sv } },
+		{ linktype_t::PRIVATE_USE_279           , { "PRIVATE_USE_279"sv, "Reserved for private use #279"sv } },
+		{ linktype_t::PRIVATE_USE_280           , { "PRIVATE_USE_280"sv, "Reserved for private use #280"sv } },
+		{ linktype_t::PRIVATE_USE_281           , { "PRIVATE_USE_281"sv, "Reserved for private use #281"sv } },
+		{ linktype_t::PRIVATE_USE_282           , { "PRIVATE_USE_282"sv, "Reserved for private use #282"sv } },
+		{ linktype_t::PRIVATE_USE_283           , { "PRIVATE_USE_283"sv, "Reserved for private use #283"sv } },
+		{ linktype_t::PRIVATE_USE_284           , { "PRIVATE_USE_284"sv, "Reserved for private use #284"sv } },
+		{ linktype_t::PRIVATE_USE_285           , { "PRIVATE_USE_285"sv, "Reserved for private use #285"sv } },
+		{ linktype_t::PRIVATE_USE_286           , { "PRIVATE_USE_286"sv, "Reserved for private use #286"sv } },
+		{ linktype_t::PRIVATE_USE_287           , { "PRIVATE_USE_287"sv, "Reserved for private use #287"sv } },
+		{ linktype_t::PRIVATE_USE_288           , { "PRIVATE_USE_288"sv, "Reserved for private use #288"sv } },
+		{ linktype_t::PRIVATE_USE_289           , { "PRIVATE_USE_289"sv, "Reserved for private use #289"sv } },
+		{ linktype_t::PRIVATE_USE_290           , { "PRIVATE_USE_290"sv, "Reserved for private use #290"sv } },
+		{ linktype_t::PRIVATE_USE_291           , { "PRIVATE_USE_291"sv, "Reserved for private use #291"sv } },
+		{ linktype_t::PRIVATE_USE_292           , { "PRIVATE_USE_292"sv, "Reserved for private use #292"sv } },
+		{ linktype_t::PRIVATE_USE_293           , { "PRIVATE_USE_293"sv, "Reserved for private use #293"sv } },
+		{ linktype_t::PRIVATE_USE_294           , { "PRIVATE_USE_294"sv, "Reserved for private use #294"sv } },
+		{ linktype_t::PRIVATE_USE_295           , { "PRIVATE_USE_295"sv, "Reserved for private use #295"sv } },
+		{ linktype_t::PRIVATE_USE_296           , { "PRIVATE_USE_296"sv, "Reserved for private use #296"sv } },
+		{ linktype_t::PRIVATE_USE_297           , { "PRIVATE_USE_297"sv, "Reserved for private use #297"sv } },
+		{ linktype_t::PRIVATE_USE_298           , { "PRIVATE_USE_298"sv, "Reserved for private use #298"sv } },
+		{ linktype_t::PRIVATE_USE_299           , { "PRIVATE_USE_299"sv, "Reserved for private use #299"sv } },
+		{ linktype_t::PRIVATE_USE_300           , { "PRIVATE_USE_300"sv, "Reserved for private use #300"sv } },
+		{ linktype_t::PRIVATE_USE_301           , { "PRIVATE_USE_301"sv, "Reserved for private use #301"sv } },
+		{ linktype_t::PRIVATE_USE_302           , { "PRIVATE_USE_302"sv, "Reserved for private use #302"sv } },
+		{ linktype_t::PRIVATE_USE_303           , { "PRIVATE_USE_303"sv, "Reserved for private use #303"sv } },
+		{ linktype_t::PRIVATE_USE_304           , { "PRIVATE_USE_304"sv, "Reserved for private use #304"sv } },
+		{ linktype_t::PRIVATE_USE_305           , { "PRIVATE_USE_305"sv, "Reserved for private use #305"sv } },
+		{ linktype_t::PRIVATE_USE_306           , { "PRIVATE_USE_306"sv, "Reserved for private use #306"sv } },
+		{ linktype_t::PRIVATE_USE_307           , { "PRIVATE_USE_307"sv, "Reserved for private use #307"sv } },
+		{ linktype_t::PRIVATE_USE_308           , { "PRIVATE_USE_308"sv, "Reserved for private use #308"sv } },
+		{ linktype_t::PRIVATE_USE_309           , { "PRIVATE_USE_309"sv, "Reserved for private use #309"sv } },
+		{ linktype_t::PRIVATE_USE_310           , { "PRIVATE_USE_310"sv, "Reserved for private use #310"sv } },
+		{ linktype_t::PRIVATE_USE_311           , { "PRIVATE_USE_311"sv, "Reserved for private use #311"sv } },
+		{ linktype_t::PRIVATE_USE_312           , { "PRIVATE_USE_312"sv, "Reserved for private use #312"sv } },
+		{ linktype_t::PRIVATE_USE_313           , { "PRIVATE_USE_313"sv, "Reserved for private use #313"sv } },
+		{ linktype_t::PRIVATE_USE_314           , { "PRIVATE_USE_314"sv, "Reserved for private use #314"sv } },
+		{ linktype_t::PRIVATE_USE_315           , { "PRIVATE_USE_315"sv, "Reserved for private use #315"sv } },
+		{ linktype_t::PRIVATE_USE_316           , { "PRIVATE_USE_316"sv, "Reserved for private use #316"sv } },
+		{ linktype_t::PRIVATE_USE_317           , { "PRIVATE_USE_317"sv, "Reserved for private use #317"sv } },
+		{ linktype_t::PRIVATE_USE_318           , { "PRIVATE_USE_318"sv, "Reserved for private use #318"sv } },
+		{ linktype_t::PRIVATE_USE_319           , { "PRIVATE_USE_319"sv, "Reserved for private use #319"sv } },
+		{ linktype_t::PRIVATE_USE_320           , { "PRIVATE_USE_320"sv, "Reserved for private use #320"sv } },
+		{ linktype_t::PRIVATE_USE_321           , { "PRIVATE_USE_321"sv, "Reserved for private use #321"sv } },
+		{ linktype_t::PRIVATE_USE_322           , { "PRIVATE_USE_322"sv, "Reserved for private use #322"sv } },
+		{ linktype_t::PRIVATE_USE_323           , { "PRIVATE_USE_323"sv, "Reserved for private use #323"sv } },
+		{ linktype_t::PRIVATE_USE_324           , { "PRIVATE_USE_324"sv, "Reserved for private use #324"sv } },
+		{ linktype_t::PRIVATE_USE_325           , { "PRIVATE_USE_325"sv, "Reserved for private use #325"sv } },
+		{ linktype_t::PRIVATE_USE_326           , { "PRIVATE_USE_326"sv, "Reserved for private use #326"sv } },
+		{ linktype_t::PRIVATE_USE_327           , { "PRIVATE_USE_327"sv, "Reserved for private use #327"sv } },
+		{ linktype_t::PRIVATE_USE_328           , { "PRIVATE_USE_328"sv, "Reserved for private use #328"sv } },
+		{ linktype_t::PRIVATE_USE_329           , { "PRIVATE_USE_329"sv, "Reserved for private use #329"sv } },
+		{ linktype_t::PRIVATE_USE_330           , { "PRIVATE_USE_330"sv, "Reserved for private use #330"sv } },
+		{ linktype_t::PRIVATE_USE_331           , { "PRIVATE_USE_331"sv, "Reserved for private use #331"sv } },
+		{ linktype_t::PRIVATE_USE_332           , { "PRIVATE_USE_332"sv, "Reserved for private use #332"sv } },
+		{ linktype_t::PRIVATE_USE_333           , { "PRIVATE_USE_333"sv, "Reserved for private use #333"sv } },
+		{ linktype_t::PRIVATE_USE_334           , { "PRIVATE_USE_334"sv, "Reserved for private use #334"sv } },
+		{ linktype_t::PRIVATE_USE_335           , { "PRIVATE_USE_335"sv, "Reserved for private use #335"sv } },
+		{ linktype_t::PRIVATE_USE_336           , { "PRIVATE_USE_336"sv, "Reserved for private use #336"sv } },
+		{ linktype_t::PRIVATE_USE_337           , { "PRIVATE_USE_337"sv, "Reserved for private use #337"sv } },
+		{ linktype_t::PRIVATE_USE_338           , { "PRIVATE_USE_338"sv, "Reserved for private use #338"sv } },
+		{ linktype_t::PRIVATE_USE_339           , { "PRIVATE_USE_339"sv, "Reserved for private use #339"sv } },
+		{ linktype_t::PRIVATE_USE_340           , { "PRIVATE_USE_340"sv, "Reserved for private use #340"sv } },
+		{ linktype_t::PRIVATE_USE_341           , { "PRIVATE_USE_341"sv, "Reserved for private use #341"sv } },
+		{ linktype_t::PRIVATE_USE_342           , { "PRIVATE_USE_342"sv, "Reserved for private use #342"sv } },
+		{ linktype_t::PRIVATE_USE_343           , { "PRIVATE_USE_343"sv, "Reserved for private use #343"sv } },
+		{ linktype_t::PRIVATE_USE_344           , { "PRIVATE_USE_344"sv, "Reserved for private use #344"sv } },
+		{ linktype_t::PRIVATE_USE_345           , { "PRIVATE_USE_345"sv, "Reserved for private use #345"sv } },
+		{ linktype_t::PRIVATE_USE_346           , { "PRIVATE_USE_346"sv, "Reserved for private use #346"sv } },
+		{ linktype_t::PRIVATE_USE_347           , { "PRIVATE_USE_347"sv, "Reserved for private use #347"sv } },
+		{ linktype_t::PRIVATE_USE_348           , { "PRIVATE_USE_348"sv, "Reserved for private use #348"sv } },
+		{ linktype_t::PRIVATE_USE_349           , { "PRIVATE_USE_349"sv, "Reserved for private use #349"sv } },
+		{ linktype_t::PRIVATE_USE_350           , { "PRIVATE_USE_350"sv, "Reserved for private use #350"sv } },
+		{ linktype_t::PRIVATE_USE_351           , { "PRIVATE_USE_351"sv, "Reserved for private use #351"sv } },
+		{ linktype_t::PRIVATE_USE_352           , { "PRIVATE_USE_352"sv, "Reserved for private use #352"sv } },
+		{ linktype_t::PRIVATE_USE_353           , { "PRIVATE_USE_353"sv, "Reserved for private use #353"sv } },
+		{ linktype_t::PRIVATE_USE_354           , { "PRIVATE_USE_354"sv, "Reserved for private use #354"sv } },
+		{ linktype_t::PRIVATE_USE_355           , { "PRIVATE_USE_355"sv, "Reserved for private use #355"sv } },
+		{ linktype_t::PRIVATE_USE_356           , { "PRIVATE_USE_356"sv, "Reserved for private use #356"sv } },
+		{ linktype_t::PRIVATE_USE_357           , { "PRIVATE_USE_357"sv, "Reserved for private use #357"sv } },
+		{ linktype_t::PRIVATE_USE_358           , { "PRIVATE_USE_358"sv, "Reserved for private use #358"sv } },
+		{ linktype_t::PRIVATE_USE_359           , { "PRIVATE_USE_359"sv, "Reserved for private use #359"sv } },
+		{ linktype_t::PRIVATE_USE_360           , { "PRIVATE_USE_360"sv, "Reserved for private use #360"sv } },
+		{ linktype_t::PRIVATE_USE_361           , { "PRIVATE_USE_361"sv, "Reserved for private use #361"sv } },
+		{ linktype_t::PRIVATE_USE_362           , { "PRIVATE_USE_362"sv, "Reserved for private use #362"sv } },
+		{ linktype_t::PRIVATE_USE_363           , { "PRIVATE_USE_363"sv, "Reserved for private use #363"sv } },
+		{ linktype_t::PRIVATE_USE_364           , { "PRIVATE_USE_364"sv, "Reserved for private use #364"sv } },
+		{ linktype_t::PRIVATE_USE_365           , { "PRIVATE_USE_365"sv, "Reserved for private use #365"sv } },
+		{ linktype_t::PRIVATE_USE_366           , { "PRIVATE_USE_366"sv, "Reserved for private use #366"sv } },
+		{ linktype_t::PRIVATE_USE_367           , { "PRIVATE_USE_367"sv, "Reserved for private use #367"sv } },
+		{ linktype_t::PRIVATE_USE_368           , { "PRIVATE_USE_368"sv, "Reserved for private use #368"sv } },
+		{ linktype_t::PRIVATE_USE_369           , { "PRIVATE_USE_369"sv, "Reserved for private use #369"sv } },
+		{ linktype_t::PRIVATE_USE_370           , { "PRIVATE_USE_370"sv, "Reserved for private use #370"sv } },
+		{ linktype_t::PRIVATE_USE_371           , { "PRIVATE_USE_371"sv, "Reserved for private use #371"sv } },
+		{ linktype_t::PRIVATE_USE_372           , { "PRIVATE_USE_372"sv, "Reserved for private use #372"sv } },
+		{ linktype_t::PRIVATE_USE_373           , { "PRIVATE_USE_373"sv, "Reserved for private use #373"sv } },
+		{ linktype_t::PRIVATE_USE_374           , { "PRIVATE_USE_374"sv, "Reserved for private use #374"sv } },
+		{ linktype_t::PRIVATE_USE_375           , { "PRIVATE_USE_375"sv, "Reserved for private use #375"sv } },
+		{ linktype_t::PRIVATE_USE_376           , { "PRIVATE_USE_376"sv, "Reserved for private use #376"sv } },
+		{ linktype_t::PRIVATE_USE_377           , { "PRIVATE_USE_377"sv, "Reserved for private use #377"sv } },
+		{ linktype_t::PRIVATE_USE_378           , { "PRIVATE_USE_378"sv, "Reserved for private use #378"sv } },
+		{ linktype_t::PRIVATE_USE_379           , { "PRIVATE_USE_379"sv, "Reserved for private use #379"sv } },
+		{ linktype_t::PRIVATE_USE_380           , { "PRIVATE_USE_380"sv, "Reserved for private use #380"sv } },
+		{ linktype_t::PRIVATE_USE_381           , { "PRIVATE_USE_381"sv, "Reserved for private use #381"sv } },
+		{ linktype_t::PRIVATE_USE_382           , { "PRIVATE_USE_382"sv, "Reserved for private use #382"sv } },
+		{ linktype_t::PRIVATE_USE_383           , { "PRIVATE_USE_383"sv, "Reserved for private use #383"sv } },
+		{ linktype_t::PRIVATE_USE_384           , { "PRIVATE_USE_384"sv, "Reserved for private use #384"sv } },
+		{ linktype_t::PRIVATE_USE_385           , { "PRIVATE_USE_385"sv, "Reserved for private use #385"sv } },
+		{ linktype_t::PRIVATE_USE_386           , { "PRIVATE_USE_386"sv, "Reserved for private use #386"sv } },
+		{ linktype_t::PRIVATE_USE_387           , { "PRIVATE_USE_387"sv, "Reserved for private use #387"sv } },
+		{ linktype_t::PRIVATE_USE_388           , { "PRIVATE_USE_388"sv, "Reserved for private use #388"sv } },
+		{ linktype_t::PRIVATE_USE_389           , { "PRIVATE_USE_389"sv, "Reserved for private use #389"sv } },
+		{ linktype_t::PRIVATE_USE_390           , { "PRIVATE_USE_390"sv, "Reserved for private use #390"sv } },
+		{ linktype_t::PRIVATE_USE_391           , { "PRIVATE_USE_391"sv, "Reserved for private use #391"sv } },
+		{ linktype_t::PRIVATE_USE_392           , { "PRIVATE_USE_392"sv, "Reserved for private use #392"sv } },
+		{ linktype_t::PRIVATE_USE_393           , { "PRIVATE_USE_393"sv, "Reserved for private use #393"sv } },
+		{ linktype_t::PRIVATE_USE_394           , { "PRIVATE_USE_394"sv, "Reserved for private use #394"sv } },
+		{ linktype_t::PRIVATE_USE_395           , { "PRIVATE_USE_395"sv, "Reserved for private use #395"sv } },
+		{ linktype_t::PRIVATE_USE_396           , { "PRIVATE_USE_396"sv, "Reserved for private use #396"sv } },
+		{ linktype_t::PRIVATE_USE_397           , { "PRIVATE_USE_397"sv, "Reserved for private use #397"sv } },
+		{ linktype_t::PRIVATE_USE_398           , { "PRIVATE_USE_398"sv, "Reserved for private use #398"sv } },
+		{ linktype_t::PRIVATE_USE_399           , { "PRIVATE_USE_399"sv, "Reserved for private use #399"sv } },
+		{ linktype_t::PRIVATE_USE_400           , { "PRIVATE_USE_400"sv, "Reserved for private use #400"sv } },
+		{ linktype_t::PRIVATE_USE_401           , { "PRIVATE_USE_401"sv, "Reserved for private use #401"sv } },
+		{ linktype_t::PRIVATE_USE_402           , { "PRIVATE_USE_402"sv, "Reserved for private use #402"sv } },
+		{ linktype_t::PRIVATE_USE_403           , { "PRIVATE_USE_403"sv, "Reserved for private use #403"sv } },
+		{ linktype_t::PRIVATE_USE_404           , { "PRIVATE_USE_404"sv, "Reserved for private use #404"sv } },
+		{ linktype_t::PRIVATE_USE_405           , { "PRIVATE_USE_405"sv, "Reserved for private use #405"sv } },
+		{ linktype_t::PRIVATE_USE_406           , { "PRIVATE_USE_406"sv, "Reserved for private use #406"sv } },
+		{ linktype_t::PRIVATE_USE_407           , { "PRIVATE_USE_407"sv, "Reserved for private use #407"sv } },
+		{ linktype_t::PRIVATE_USE_408           , { "PRIVATE_USE_408"sv, "Reserved for private use #408"sv } },
+		{ linktype_t::PRIVATE_USE_409           , { "PRIVATE_USE_409"sv, "Reserved for private use #409"sv } },
+		{ linktype_t::PRIVATE_USE_410           , { "PRIVATE_USE_410"sv, "Reserved for private use #410"sv } },
+		{ linktype_t::PRIVATE_USE_411           , { "PRIVATE_USE_411"sv, "Reserved for private use #411"sv } },
+		{ linktype_t::PRIVATE_USE_412           , { "PRIVATE_USE_412"sv, "Reserved for private use #412"sv } },
+		{ linktype_t::PRIVATE_USE_413           , { "PRIVATE_USE_413"sv, "Reserved for private use #413"sv } },
+		{ linktype_t::PRIVATE_USE_414           , { "PRIVATE_USE_414"sv, "Reserved for private use #414"sv } },
+		{ linktype_t::PRIVATE_USE_415           , { "PRIVATE_USE_415"sv, "Reserved for private use #415"sv } },
+		{ linktype_t::PRIVATE_USE_416           , { "PRIVATE_USE_416"sv, "Reserved for private use #416"sv } },
+		{ linktype_t::PRIVATE_USE_417           , { "PRIVATE_USE_417"sv, "Reserved for private use #417"sv } },
+		{ linktype_t::PRIVATE_USE_418           , { "PRIVATE_USE_418"sv, "Reserved for private use #418"sv } },
+		{ linktype_t::PRIVATE_USE_419           , { "PRIVATE_USE_419"sv, "Reserved for private use #419"sv } },
+		{ linktype_t::PRIVATE_USE_420           , { "PRIVATE_USE_420"sv, "Reserved for private use #420"sv } },
+		{ linktype_t::PRIVATE_USE_421           , { "PRIVATE_USE_421"sv, "Reserved for private use #421"sv } },
+		{ linktype_t::PRIVATE_USE_422           , { "PRIVATE_USE_422"sv, "Reserved for private use #422"sv } },
+		{ linktype_t::PRIVATE_USE_423           , { "PRIVATE_USE_423"sv, "Reserved for private use #423"sv } },
+		{ linktype_t::PRIVATE_USE_424           , { "PRIVATE_USE_424"sv, "Reserved for private use #424"sv } },
+		{ linktype_t::PRIVATE_USE_425           , { "PRIVATE_USE_425"sv, "Reserved for private use #425"sv } },
+		{ linktype_t::PRIVATE_USE_426           , { "PRIVATE_USE_426"sv, "Reserved for private use #426"sv } },
+		{ linktype_t::PRIVATE_USE_427           , { "PRIVATE_USE_427"sv, "Reserved for private use #427"sv } },
+		{ linktype_t::PRIVATE_USE_428           , { "PRIVATE_USE_428"sv, "Reserved for private use #428"sv } },
+		{ linktype_t::PRIVATE_USE_429           , { "PRIVATE_USE_429"sv, "Reserved for private use #429"sv } },
+		{ linktype_t::PRIVATE_USE_430           , { "PRIVATE_USE_430"sv, "Reserved for private use #430"sv } },
+		{ linktype_t::PRIVATE_USE_431           , { "PRIVATE_USE_431"sv, "Reserved for private use #431"sv } },
+		{ linktype_t::PRIVATE_USE_432           , { "PRIVATE_USE_432"sv, "Reserved for private use #432"sv } },
+		{ linktype_t::PRIVATE_USE_433           , { "PRIVATE_USE_433"sv, "Reserved for private use #433"sv } },
+		{ linktype_t::PRIVATE_USE_434           , { "PRIVATE_USE_434"sv, "Reserved for private use #434"sv } },
+		{ linktype_t::PRIVATE_USE_435           , { "PRIVATE_USE_435"sv, "Reserved for private use #435"sv } },
+		{ linktype_t::PRIVATE_USE_436           , { "PRIVATE_USE_436"sv, "Reserved for private use #436"sv } },
+		{ linktype_t::PRIVATE_USE_437           , { "PRIVATE_USE_437"sv, "Reserved for private use #437"sv } },
+		{ linktype_t::PRIVATE_USE_438           , { "PRIVATE_USE_438"sv, "Reserved for private use #438"sv } },
+		{ linktype_t::PRIVATE_USE_439           , { "PRIVATE_USE_439"sv, "Reserved for private use #439"sv } },
+		{ linktype_t::PRIVATE_USE_440           , { "PRIVATE_USE_440"sv, "Reserved for private use #440"sv } },
+		{ linktype_t::PRIVATE_USE_441           , { "PRIVATE_USE_441"sv, "Reserved for private use #441"sv } },
+		{ linktype_t::PRIVATE_USE_442           , { "PRIVATE_USE_442"sv, "Reserved for private use #442"sv } },
+		{ linktype_t::PRIVATE_USE_443           , { "PRIVATE_USE_443"sv, "Reserved for private use #443"sv } },
+		{ linktype_t::PRIVATE_USE_444           , { "PRIVATE_USE_444"sv, "Reserved for private use #444"sv } },
+		{ linktype_t::PRIVATE_USE_445           , { "PRIVATE_USE_445"sv, "Reserved for private use #445"sv } },
+		{ linktype_t::PRIVATE_USE_446           , { "PRIVATE_USE_446"sv, "Reserved for private use #446"sv } },
+		{ linktype_t::PRIVATE_USE_447           , { "PRIVATE_USE_447"sv, "Reserved for private use #447"sv } },
+		{ linktype_t::PRIVATE_USE_448           , { "PRIVATE_USE_448"sv, "Reserved for private use #448"sv } },
+		{ linktype_t::PRIVATE_USE_449           , { "PRIVATE_USE_449"sv, "Reserved for private use #449"sv } },
+		{ linktype_t::PRIVATE_USE_450           , { "PRIVATE_USE_450"sv, "Reserved for private use #450"sv } },
+		{ linktype_t::PRIVATE_USE_451           , { "PRIVATE_USE_451"sv, "Reserved for private use #451"sv } },
+		{ linktype_t::PRIVATE_USE_452           , { "PRIVATE_USE_452"sv, "Reserved for private use #452"sv } },
+		{ linktype_t::PRIVATE_USE_453           , { "PRIVATE_USE_453"sv, "Reserved for private use #453"sv } },
+		{ linktype_t::PRIVATE_USE_454           , { "PRIVATE_USE_454"sv, "Reserved for private use #454"sv } },
+		{ linktype_t::PRIVATE_USE_455           , { "PRIVATE_USE_455"sv, "Reserved for private use #455"sv } },
+		{ linktype_t::PRIVATE_USE_456           , { "PRIVATE_USE_456"sv, "Reserved for private use #456"sv } },
+		{ linktype_t::PRIVATE_USE_457           , { "PRIVATE_USE_457"sv, "Reserved for private use #457"sv } },
+		{ linktype_t::PRIVATE_USE_458           , { "PRIVATE_USE_458"sv, "Reserved for private use #458"sv } },
+		{ linktype_t::PRIVATE_USE_459           , { "PRIVATE_USE_459"sv, "Reserved for private use #459"sv } },
+		{ linktype_t::PRIVATE_USE_460           , { "PRIVATE_USE_460"sv, "Reserved for private use #460"sv } },
+		{ linktype_t::PRIVATE_USE_461           , { "PRIVATE_USE_461"sv, "Reserved for private use #461"sv } },
+		{ linktype_t::PRIVATE_USE_462           , { "PRIVATE_USE_462"sv, "Reserved for private use #462"sv } },
+		{ linktype_t::PRIVATE_USE_463           , { "PRIVATE_USE_463"sv, "Reserved for private use #463"sv } },
+		{ linktype_t::PRIVATE_USE_464           , { "PRIVATE_USE_464"sv, "Reserved for private use #464"sv } },
+		{ linktype_t::PRIVATE_USE_465           , { "PRIVATE_USE_465"sv, "Reserved for private use #465"sv } },
+		{ linktype_t::PRIVATE_USE_466           , { "PRIVATE_USE_466"sv, "Reserved for private use #466"sv } },
+		{ linktype_t::PRIVATE_USE_467           , { "PRIVATE_USE_467"sv, "Reserved for private use #467"sv } },
+		{ linktype_t::PRIVATE_USE_468           , { "PRIVATE_USE_468"sv, "Reserved for private use #468"sv } },
+		{ linktype_t::PRIVATE_USE_469           , { "PRIVATE_USE_469"sv, "Reserved for private use #469"sv } },
+		{ linktype_t::PRIVATE_USE_470           , { "PRIVATE_USE_470"sv, "Reserved for private use #470"sv } },
+		{ linktype_t::PRIVATE_USE_471           , { "PRIVATE_USE_471"sv, "Reserved for private use #471"sv } },
+		{ linktype_t::PRIVATE_USE_472           , { "PRIVATE_USE_472"sv, "Reserved for private use #472"sv } },
+		{ linktype_t::PRIVATE_USE_473           , { "PRIVATE_USE_473"sv, "Reserved for private use #473"sv } },
+		{ linktype_t::PRIVATE_USE_474           , { "PRIVATE_USE_474"sv, "Reserved for private use #474"sv } },
+		{ linktype_t::PRIVATE_USE_475           , { "PRIVATE_USE_475"sv, "Reserved for private use #475"sv } },
+		{ linktype_t::PRIVATE_USE_476           , { "PRIVATE_USE_476"sv, "Reserved for private use #476"sv } },
+		{ linktype_t::PRIVATE_USE_477           , { "PRIVATE_USE_477"sv, "Reserved for private use #477"sv } },
+		{ linktype_t::PRIVATE_USE_478           , { "PRIVATE_USE_478"sv, "Reserved for private use #478"sv } },
+		{ linktype_t::PRIVATE_USE_479           , { "PRIVATE_USE_479"sv, "Reserved for private use #479"sv } },
+		{ linktype_t::PRIVATE_USE_480           , { "PRIVATE_USE_480"sv, "Reserved for private use #480"sv } },
+		{ linktype_t::PRIVATE_USE_481           , { "PRIVATE_USE_481"sv, "Reserved for private use #481"sv } },
+		{ linktype_t::PRIVATE_USE_482           , { "PRIVATE_USE_482"sv, "Reserved for private use #482"sv } },
+		{ linktype_t::PRIVATE_USE_483           , { "PRIVATE_USE_483"sv, "Reserved for private use #483"sv } },
+		{ linktype_t::PRIVATE_USE_484           , { "PRIVATE_USE_484"sv, "Reserved for private use #484"sv } },
+		{ linktype_t::PRIVATE_USE_485           , { "PRIVATE_USE_485"sv, "Reserved for private use #485"sv } },
+		{ linktype_t::PRIVATE_USE_486           , { "PRIVATE_USE_486"sv, "Reserved for private use #486"sv } },
+		{ linktype_t::PRIVATE_USE_487           , { "PRIVATE_USE_487"sv, "Reserved for private use #487"sv } },
+		{ linktype_t::PRIVATE_USE_488           , { "PRIVATE_USE_488"sv, "Reserved for private use #488"sv } },
+		{ linktype_t::PRIVATE_USE_489           , { "PRIVATE_USE_489"sv, "Reserved for private use #489"sv } },
+		{ linktype_t::PRIVATE_USE_490           , { "PRIVATE_USE_490"sv, "Reserved for private use #490"sv } },
+		{ linktype_t::PRIVATE_USE_491           , { "PRIVATE_USE_491"sv, "Reserved for private use #491"sv } },
+		{ linktype_t::PRIVATE_USE_492           , { "PRIVATE_USE_492"sv, "Reserved for private use #492"sv } },
+		{ linktype_t::PRIVATE_USE_493           , { "PRIVATE_USE_493"sv, "Reserved for private use #493"sv } },
+		{ linktype_t::PRIVATE_USE_494           , { "PRIVATE_USE_494"sv, "Reserved for private use #494"sv } },
+		{ linktype_t::PRIVATE_USE_495           , { "PRIVATE_USE_495"sv, "Reserved for private use #495"sv } },
+		{ linktype_t::PRIVATE_USE_496           , { "PRIVATE_USE_496"sv, "Reserved for private use #496"sv } },
+		{ linktype_t::PRIVATE_USE_497           , { "PRIVATE_USE_497"sv, "Reserved for private use #497"sv } },
+		{ linktype_t::PRIVATE_USE_498           , { "PRIVATE_USE_498"sv, "Reserved for private use #498"sv } },
+		{ linktype_t::PRIVATE_USE_499           , { "PRIVATE_USE_499"sv, "Reserved for private use #499"sv } },
+		{ linktype_t::PRIVATE_USE_500           , { "PRIVATE_USE_500"sv, "Reserved for private use #500"sv } },
+		{ linktype_t::PRIVATE_USE_501           , { "PRIVATE_USE_501"sv, "Reserved for private use #501"sv } },
+		{ linktype_t::PRIVATE_USE_502           , { "PRIVATE_USE_502"sv, "Reserved for private use #502"sv } },
+		{ linktype_t::PRIVATE_USE_503           , { "PRIVATE_USE_503"sv, "Reserved for private use #503"sv } },
+		{ linktype_t::PRIVATE_USE_504           , { "PRIVATE_USE_504"sv, "Reserved for private use #504"sv } },
+		{ linktype_t::PRIVATE_USE_505           , { "PRIVATE_USE_505"sv, "Reserved for private use #505"sv } },
+		{ linktype_t::PRIVATE_USE_506           , { "PRIVATE_USE_506"sv, "Reserved for private use #506"sv } },
+		{ linktype_t::PRIVATE_USE_507           , { "PRIVATE_USE_507"sv, "Reserved for private use #507"sv } },
+		{ linktype_t::PRIVATE_USE_508           , { "PRIVATE_USE_508"sv, "Reserved for private use #508"sv } },
+		{ linktype_t::PRIVATE_USE_509           , { "PRIVATE_USE_509"sv, "Reserved for private use #509"sv } },
+		{ linktype_t::PRIVATE_USE_510           , { "PRIVATE_USE_510"sv, "Reserved for private use #510"sv } },
+		{ linktype_t::PRIVATE_USE_511           , { "PRIVATE_USE_511"sv, "Reserved for private use #511"sv } },
+		{ linktype_t::PRIVATE_USE_512           , { "PRIVATE_USE_512"sv, "Reserved for private use #512"sv } },
+		{ linktype_t::PRIVATE_USE_513           , { "PRIVATE_USE_513"sv, "Reserved for private use #513"sv } },
+		{ linktype_t::PRIVATE_USE_514           , { "PRIVATE_USE_514"sv, "Reserved for private use #514"sv } },
+		{ linktype_t::PRIVATE_USE_515           , { "PRIVATE_USE_515"sv, "Reserved for private use #515"sv } },
+		{ linktype_t::PRIVATE_USE_516           , { "PRIVATE_USE_516"sv, "Reserved for private use #516"sv } },
+		{ linktype_t::PRIVATE_USE_517           , { "PRIVATE_USE_517"sv, "Reserved for private use #517"sv } },
+		{ linktype_t::PRIVATE_USE_518           , { "PRIVATE_USE_518"sv, "Reserved for private use #518"sv } },
+		{ linktype_t::PRIVATE_USE_519           , { "PRIVATE_USE_519"sv, "Reserved for private use #519"sv } },
+		{ linktype_t::PRIVATE_USE_520           , { "PRIVATE_USE_520"sv, "Reserved for private use #520"sv } },
+		{ linktype_t::PRIVATE_USE_521           , { "PRIVATE_USE_521"sv, "Reserved for private use #521"sv } },
+		{ linktype_t::PRIVATE_USE_522           , { "PRIVATE_USE_522"sv, "Reserved for private use #522"sv } },
+		{ linktype_t::PRIVATE_USE_523           , { "PRIVATE_USE_523"sv, "Reserved for private use #523"sv } },
+		{ linktype_t::PRIVATE_USE_524           , { "PRIVATE_USE_524"sv, "Reserved for private use #524"sv } },
+		{ linktype_t::PRIVATE_USE_525           , { "PRIVATE_USE_525"sv, "Reserved for private use #525"sv } },
+		{ linktype_t::PRIVATE_USE_526           , { "PRIVATE_USE_526"sv, "Reserved for private use #526"sv } },
+		{ linktype_t::PRIVATE_USE_527           , { "PRIVATE_USE_527"sv, "Reserved for private use #527"sv } },
+		{ linktype_t::PRIVATE_USE_528           , { "PRIVATE_USE_528"sv, "Reserved for private use #528"sv } },
+		{ linktype_t::PRIVATE_USE_529           , { "PRIVATE_USE_529"sv, "Reserved for private use #529"sv } },
+		{ linktype_t::PRIVATE_USE_530           , { "PRIVATE_USE_530"sv, "Reserved for private use #530"sv } },
+		{ linktype_t::PRIVATE_USE_531           , { "PRIVATE_USE_531"sv, "Reserved for private use #531"sv } },
+		{ linktype_t::PRIVATE_USE_532           , { "PRIVATE_USE_532"sv, "Reserved for private use #532"sv } },
+		{ linktype_t::PRIVATE_USE_533           , { "PRIVATE_USE_533"sv, "Reserved for private use #533"sv } },
+		{ linktype_t::PRIVATE_USE_534           , { "PRIVATE_USE_534"sv, "Reserved for private use #534"sv } },
 	};
+
+	const linktype_info_t& linktype_info(const linktype_t type) noexcept {
+		return linktype_infos[type];
+	}
 }
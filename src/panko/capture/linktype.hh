@@ -5,9 +5,12 @@
 #if !defined(PANKO_CAPTURE_LINKTYPE_HH)
 #define PANKO_CAPTURE_LINKTYPE_HH
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "panko/internal/defs.hh"
 
@@ -771,15 +774,107 @@ namespace Panko::capture {
 		PRIVATE_USE_END            = 0xFFFFU, /*!< End of private use range */
 	};
 
+	/* This is generated along with `linktype_t` by `contrib/scripts/gen_linktype_table.py` */
+	/*! \brief One past the largest assigned LINKTYPE below the private use range */
+	constexpr inline std::size_t linktype_public_slots{0x012EU};
+
 	[[nodiscard]]
 	constexpr bool is_private(const linktype_t& type) noexcept {
-		constexpr static auto range_beg{static_cast<std::uint16_t>(linktype_t::PRIVATE_USE_BEG)};
-		constexpr static auto range_end{static_cast<std::uint16_t>(linktype_t::PRIVATE_USE_BEG)};
+		constexpr auto range_beg{static_cast<std::uint16_t>(linktype_t::PRIVATE_USE_BEG)};
+		constexpr auto range_end{static_cast<std::uint16_t>(linktype_t::PRIVATE_USE_END)};
 		const auto value{static_cast<std::uint16_t>(type)};
 		return (value >= range_beg) && (value <= range_end);
 	}
 
-	PANKO_API const std::unordered_map<linktype_t, std::string_view> linktype_names;
+	/*! \brief The number of slots in a `linktype_table_t`, one for each public and private use LINKTYPE */
+	constexpr inline std::size_t linktype_slots{
+		linktype_public_slots +
+		(static_cast<std::size_t>(linktype_t::PRIVATE_USE_END) - static_cast<std::size_t>(linktype_t::PRIVATE_USE_BEG)) + 1zu
+	};
+
+	/*! \brief Returns the slot of a LINKTYPE in a dense table, or `linktype_slots` if it is unassigned */
+	[[nodiscard]]
+	constexpr std::size_t linktype_slot(const linktype_t type) noexcept {
+		const auto value{static_cast<std::size_t>(type)};
+		if (value < linktype_public_slots) {
+			return value;
+		}
+		if (is_private(type)) {
+			return linktype_public_slots + (value - static_cast<std::size_t>(linktype_t::PRIVATE_USE_BEG));
+		}
+		return linktype_slots;
+	}
+
+	/*! \brief A dense, direct-indexed table of values keyed by LINKTYPE.
+
+		This is intended for things looked up per packet, such as the dissector for the encapsulation of
+		a capture interface, and so is a flat array indexed by `linktype_slot` rather than a hash map. It
+		can be built at compile time, so tables of constants need no static initialization.
+
+		Looking up a LINKTYPE that is unassigned, or that has no entry, gives a value initialized `T`.
+
+		\code{.cc}
+		constexpr static linktype_table_t<dissector_t> encapsulations{
+			{ linktype_t::ETHERNET, dissect_ethernet },
+			{ linktype_t::RAW,      dissect_raw_ip   },
+		};
+		\endcode
+
+		\tparam T The type of value to hold.
+	*/
+	template<typename T>
+	struct linktype_table_t final {
+	private:
+		/* The last entry is for unassigned LINKTYPEs and is never set */
+		std::array<T, linktype_slots + 1zu> _entries{};
+	public:
+		constexpr linktype_table_t() noexcept = default;
+
+		constexpr linktype_table_t(const std::initializer_list<std::pair<linktype_t, T>> entries) noexcept {
+			for (const auto& [type, value] : entries) {
+				set(type, value);
+			}
+		}
+
+		/*! \brief Set the entry for `type`, returning false if it is an unassigned LINKTYPE */
+		constexpr bool set(const linktype_t type, const T& value) noexcept {
+			const auto slot{linktype_slot(type)};
+			if (slot == linktype_slots) {
+				return false;
+			}
+			_entries[slot] = value;
+			return true;
+		}
+
+		[[nodiscard]]
+		constexpr const T& operator[](const linktype_t type) const noexcept {
+			return _entries[linktype_slot(type)];
+		}
+	};
+
+	/*! \brief The name and description of a LINKTYPE */
+	struct linktype_info_t final {
+		/*! \brief The name, the `linktype_t` member name, such as `ETHERNET` */
+		std::string_view name;
+		/*! \brief A short human readable description */
+		std::string_view description;
+	};
+
+	/*! \brief Returns the name and description of a LINKTYPE, which are both empty if it is unassigned */
+	[[nodiscard]]
+	PANKO_API const linktype_info_t& linktype_info(linktype_t type) noexcept;
+
+	/*! \brief Returns the name of a LINKTYPE, such as `ETHERNET`, or an empty string if it is unassigned */
+	[[nodiscard]]
+	inline std::string_view linktype_name(const linktype_t type) noexcept {
+		return linktype_info(type).name;
+	}
+
+	/*! \brief Returns a short description of a LINKTYPE, or an empty string if it is unassigned */
+	[[nodiscard]]
+	inline std::string_view linktype_description(const linktype_t type) noexcept {
+		return linktype_info(type).description;
+	}
 }
 
 #endif /* PANKO_CAPTURE_LINKTYPE_HH */
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* arena.hh - Bump allocated scratch memory */
+#pragma once
+#if !defined(PANKO_CORE_ARENA_HH)
+#define PANKO_CORE_ARENA_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+
+namespace Panko::core {
+	/*! \brief A simple bump allocator for short-lived scratch memory.
+
+		Allocations are carved out of large blocks and are never freed individually, instead the whole arena is
+		released at once with `reset()` or when it is destroyed. This makes it well suited for things like
+		transcoded strings that only need to live as long as the packet they came from.
+
+		\warning Only trivially destructible types may be allocated from the arena, as no destructors are ever run.
+	*/
+	struct arena_t final {
+	private:
+		struct block_t final {
+			std::unique_ptr<std::byte[]> data;
+			std::size_t size;
+		};
+
+		std::vector<block_t> _blocks{};
+		std::size_t _block_size;
+		std::size_t _current{};
+		std::size_t _offset{};
+
+		[[nodiscard]]
+		static std::size_t align_up(const std::uintptr_t addr, const std::size_t align) noexcept {
+			return static_cast<std::size_t>((addr + (align - 1zu)) & ~std::uintptr_t{align - 1zu}) - addr;
+		}
+
+		/* Move on to a block that can hold at least `size` bytes at `align` */
+		void next_block(const std::size_t size, const std::size_t align) {
+			const auto needed{size + align};
+
+			/* Blocks kept after a reset are reused before any new ones are allocated */
+			while (++_current < _blocks.size()) {
+				if (_blocks[_current].size >= needed) {
+					_offset = 0zu;
+					return;
+				}
+			}
+
+			const auto block_size{std::max(_block_size, needed)};
+			_blocks.emplace_back(block_t{std::make_unique_for_overwrite<std::byte[]>(block_size), block_size});
+			_current = _blocks.size() - 1zu;
+			_offset = 0zu;
+		}
+	public:
+		/*! \brief Construct an empty arena.
+
+			No memory is allocated until the first call to `allocate`.
+
+			\param block_size The size of each block of memory the arena allocates from.
+		*/
+		explicit arena_t(const std::size_t block_size = 4096zu) noexcept :
+			_block_size{block_size}, _current{~0zu}
+		{ }
+
+		arena_t(const arena_t&) = delete;
+		arena_t& operator=(const arena_t&) = delete;
+
+		arena_t(arena_t&& other) noexcept :
+			_blocks{std::move(other._blocks)}, _block_size{other._block_size},
+			_current{std::exchange(other._current, ~0zu)}, _offset{std::exchange(other._offset, 0zu)}
+		{ }
+
+		arena_t& operator=(arena_t&& other) noexcept {
+			_blocks = std::move(other._blocks);
+			_block_size = other._block_size;
+			_current = std::exchange(other._current, ~0zu);
+			_offset = std::exchange(other._offset, 0zu);
+			return *this;
+		}
+
+		~arena_t() noexcept = default;
+
+		/*! \brief Allocate `size` bytes aligned to `align`.
+
+			\param size The number of bytes to allocate.
+			\param align The alignment of the allocation, must be a power of two.
+			\returns A pointer to the allocated memory, this is never null.
+			\throws std::bad_alloc If a new block could not be allocated.
+		*/
+		[[nodiscard]]
+		void* allocate(const std::size_t size, const std::size_t align = alignof(std::max_align_t)) {
+			if (_current < _blocks.size()) {
+				auto& block{_blocks[_current]};
+				const auto addr{reinterpret_cast<std::uintptr_t>(block.data.get()) + _offset};
+				const auto pad{align_up(addr, align)};
+				if ((block.size - _offset) >= (pad + size)) {
+					_offset += pad + size;
+					return block.data.get() + (_offset - size);
+				}
+			}
+
+			next_block(size, align);
+			auto& block{_blocks[_current]};
+			const auto pad{align_up(reinterpret_cast<std::uintptr_t>(block.data.get()), align)};
+			_offset = pad + size;
+			return block.data.get() + pad;
+		}
+
+		/*! \brief Allocate space for `count` objects of type `T`.
+
+			The objects are not initialized.
+
+			\tparam T The type to allocate.
+			\param count The number of objects to allocate space for.
+		*/
+		template<typename T>
+		[[nodiscard]]
+		std::span<T> allocate(const std::size_t count) {
+			static_assert(std::is_trivially_destructible_v<T>, "Only trivially destructible types can be arena allocated");
+			if (count > (~0zu / sizeof(T))) {
+				throw std::bad_alloc{};
+			}
+			return {static_cast<T*>(allocate(count * sizeof(T), alignof(T))), count};
+		}
+
+		/*! \brief Release all allocations.
+
+			The blocks of memory are kept for reuse, so that a steady state workload stops allocating entirely.
+
+			\warning All pointers to memory allocated from the arena are invalid after this call.
+		*/
+		void reset() noexcept {
+			_current = _blocks.empty() ? ~0zu : 0zu;
+			_offset = 0zu;
+		}
+
+		/*! \brief Release all allocations and free the memory backing them. */
+		void release() noexcept {
+			_blocks.clear();
+			_blocks.shrink_to_fit();
+			_current = ~0zu;
+			_offset = 0zu;
+		}
+
+		/*! \brief Returns the total number of bytes of memory held by the arena */
+		[[nodiscard]]
+		std::size_t capacity() const noexcept {
+			std::size_t total{};
+			for (const auto& block : _blocks) {
+				total += block.size;
+			}
+			return total;
+		}
+	};
+}
+
+#endif /* PANKO_CORE_ARENA_HH */
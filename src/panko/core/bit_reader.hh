@@ -0,0 +1,550 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* bit_reader.hh - Non-throwing bit stream reader over a `bytearray_t` */
+
+#pragma once
+#if !defined(PANKO_CORE_BIT_READER_HH)
+#define PANKO_CORE_BIT_READER_HH
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <type_traits>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/bitfield.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/endian.hh"
+#include "panko/core/errcodes.hh"
+
+namespace Panko::core {
+	using Panko::core::error_codes::read_error_t;
+
+	/*! \enum Panko::core::bit_order_t
+		\brief The order the bits of each byte are read in
+	*/
+	enum struct bit_order_t : std::uint8_t {
+		MsbFirst, /*!< Most significant bit first, as in H.264, ASN.1 PER, and most network protocols */
+		LsbFirst, /*!< Least significant bit first, as in DEFLATE, radiotap, and CAN */
+	};
+
+	/*! \enum Panko::core::per_variant_t
+		\brief The variant of the ASN.1 Packed Encoding Rules (X.691)
+	*/
+	enum struct per_variant_t : std::uint8_t {
+		Aligned,   /*!< PER ALIGNED, as used by S1AP, X2AP, and NGAP */
+		Unaligned, /*!< PER UNALIGNED, as used by RRC */
+	};
+
+	/*! \brief An ASN.1 PER length determinant */
+	struct per_length_t final {
+		/*! \brief The length, or the size of this fragment if `fragment` is set */
+		std::size_t length;
+		/*! \brief If set, another length determinant follows this fragment (X.691 11.9.3.8) */
+		bool fragment;
+	};
+
+	/*! \brief A non-owning, non-throwing bit stream reader over a `bytearray_t`.
+
+		Values are read from a 64-bit register that is refilled a whole word at a time, so reads never
+		have to touch more than one or two bytes of the underlying data each. Values can be up to 64 bits
+		wide and straddle any number of byte boundaries.
+
+		With `bit_order_t::MsbFirst` the bits of each byte are read starting from the most significant,
+		and a value is read most significant bit first. With `bit_order_t::LsbFirst` it is the other way
+		around, and a value is read least significant bit first.
+
+		Like `reader_t`, any read that runs off the end of the data sets the sticky `truncated()` flag,
+		after which all reads fail.
+
+		\code{.cc}
+		bit_reader_t rdr{nal_unit};
+		const auto forbidden_zero{rdr.read<1zu>()};
+		const auto nal_ref_idc{rdr.read<2zu>()};
+		const auto nal_unit_type{rdr.read<5zu>()};
+		const auto first_mb_in_slice{rdr.read_ue()};
+		\endcode
+
+		\warning The `bit_reader_t` does not hold a reference to the backing storage of the `bytearray_t`
+		it was constructed from, so the `bytearray_t` must outlive it.
+
+		\tparam order The order the bits of each byte are read in.
+	*/
+	template<bit_order_t order = bit_order_t::MsbFirst>
+	struct basic_bit_reader_t final {
+		using byte_t = std::byte;
+	private:
+		/* The most bits a single refill is guaranteed to leave in the register */
+		static constexpr std::size_t max_direct{56zu};
+
+		const byte_t* _data{nullptr};
+		std::size_t _length{};
+		/* The next byte to refill the register from */
+		std::size_t _next{};
+		/*
+			The register, the next bit to read is the top bit for MSB first and the bottom bit for LSB first.
+			Past the `_count` valid bits it may hold the bits of following bytes that are not yet counted.
+		*/
+		std::uint64_t _bits{};
+		std::size_t _count{};
+		bool _truncated{false};
+
+		/* Top up the register to at least `max_direct` bits, or as many as remain */
+		void refill() noexcept {
+			if ((_length - _next) >= sizeof(std::uint64_t)) {
+				if constexpr (order == bit_order_t::MsbFirst) {
+					_bits |= load<std::uint64_t, std::endian::big>(_data + _next) >> _count;
+				} else {
+					_bits |= load<std::uint64_t, std::endian::little>(_data + _next) << _count;
+				}
+				const auto bytes{(63zu - _count) / 8zu};
+				_next += bytes;
+				_count += bytes * 8zu;
+				return;
+			}
+
+			for (; _count <= max_direct && _next < _length; ++_next, _count += 8zu) {
+				const auto byte{std::to_integer<std::uint64_t>(_data[_next])};
+				if constexpr (order == bit_order_t::MsbFirst) {
+					_bits |= byte << (max_direct - _count);
+				} else {
+					_bits |= byte << _count;
+				}
+			}
+		}
+
+		/* The next `bits` bits without consuming them, there must be that many in the register */
+		[[nodiscard, gnu::always_inline]]
+		std::uint64_t look(const std::size_t bits) const noexcept {
+			if constexpr (order == bit_order_t::MsbFirst) {
+				return _bits >> (64zu - bits);
+			} else {
+				return _bits & (~0ULL >> (64zu - bits));
+			}
+		}
+
+		[[gnu::always_inline]]
+		void consume(const std::size_t bits) noexcept {
+			if constexpr (order == bit_order_t::MsbFirst) {
+				_bits <<= bits;
+			} else {
+				_bits >>= bits;
+			}
+			_count -= bits;
+		}
+
+		/* Read 1 to 64 bits, which must all be remaining */
+		[[nodiscard]]
+		std::uint64_t take(const std::size_t bits) noexcept {
+			if (bits > max_direct) {
+				/* The first part holds the most significant bits for MSB first, and the least for LSB first */
+				const auto first{take(bits - 32zu)};
+				const auto second{take(32zu)};
+				if constexpr (order == bit_order_t::MsbFirst) {
+					return (first << 32U) | second;
+				} else {
+					return first | (second << (bits - 32zu));
+				}
+			}
+
+			if (_count < bits) {
+				refill();
+			}
+			const auto value{look(bits)};
+			consume(bits);
+			return value;
+		}
+
+		/* Check there are `bits` bits remaining, setting the sticky truncated flag if not */
+		[[nodiscard]]
+		bool require(const std::size_t bits) noexcept {
+			if (_truncated || bits_remaining() < bits) [[unlikely]] {
+				_truncated = true;
+				return false;
+			}
+			return true;
+		}
+
+		/* The number of zero bits before the next one bit, as far as the register can see */
+		[[nodiscard]]
+		std::size_t leading_zeros() const noexcept {
+			if constexpr (order == bit_order_t::MsbFirst) {
+				return static_cast<std::size_t>(std::countl_zero(_bits));
+			} else {
+				return static_cast<std::size_t>(std::countr_zero(_bits));
+			}
+		}
+	public:
+		constexpr basic_bit_reader_t() noexcept = default;
+
+		/*! \brief Construct a bit reader over the whole of a `bytearray_t` */
+		basic_bit_reader_t(const bytearray_t& buffer) noexcept :
+			_data{buffer.data()}, _length{buffer.length()}
+		{ }
+
+		/*! \brief Construct a bit reader over a span of bytes */
+		constexpr basic_bit_reader_t(const std::span<const byte_t> buffer) noexcept :
+			_data{buffer.data()}, _length{buffer.size()}
+		{ }
+
+		/*! \brief Returns the total length of the data this reader is over in bits */
+		[[nodiscard]]
+		constexpr std::size_t length() const noexcept {
+			return _length * 8zu;
+		}
+
+		/*! \brief Returns the current read offset in bits */
+		[[nodiscard]]
+		constexpr std::size_t bit_offset() const noexcept {
+			return (_next * 8zu) - _count;
+		}
+
+		/*! \brief Returns the number of bits remaining after the current read offset */
+		[[nodiscard]]
+		constexpr std::size_t bits_remaining() const noexcept {
+			return length() - bit_offset();
+		}
+
+		/*! \brief Returns true if the current read offset is on a byte boundary */
+		[[nodiscard]]
+		constexpr bool byte_aligned() const noexcept {
+			return (_count % 8zu) == 0zu;
+		}
+
+		/*! \brief Returns true if any read on this reader has run out of data */
+		[[nodiscard]]
+		constexpr bool truncated() const noexcept {
+			return _truncated;
+		}
+
+		/*! \brief Returns true if no read on this reader has run out of data */
+		[[nodiscard]]
+		constexpr bool ok() const noexcept {
+			return !_truncated;
+		}
+
+		[[nodiscard]]
+		constexpr explicit operator bool() const noexcept {
+			return ok();
+		}
+
+		/*! \brief Returns a span over the whole bytes remaining in the reader, after aligning to a byte boundary */
+		[[nodiscard]]
+		constexpr std::span<const byte_t> rest() const noexcept {
+			const auto offset{(bit_offset() + 7zu) / 8zu};
+			return {_data + offset, _length - offset};
+		}
+
+		/* == Fixed width fields == */
+
+		/*! \brief Read the next `bits` bits as an unsigned value.
+
+			\tparam bits The width of the field, from 1 to 64 bits.
+			\returns The value in the smallest unsigned type that holds it, or `read_error_t::Truncated`.
+		*/
+		template<std::size_t bits>
+		[[nodiscard]]
+		std::expected<smallest_type_for<bits>, read_error_t> read() noexcept {
+			static_assert(bits != 0zu && bits <= 64zu, "Fields must be from 1 to 64 bits wide");
+
+			if (!require(bits)) [[unlikely]] {
+				return std::unexpected(read_error_t::Truncated);
+			}
+			return static_cast<smallest_type_for<bits>>(take(bits));
+		}
+
+		/*! \brief Read the next `bits` bits as a two's complement signed value.
+
+			\tparam bits The width of the field, from 1 to 64 bits.
+			\returns The sign extended value, or `read_error_t::Truncated`.
+		*/
+		template<std::size_t bits>
+		[[nodiscard]]
+		std::expected<std::make_signed_t<smallest_type_for<bits>>, read_error_t> read_signed() noexcept {
+			using result_t = std::make_signed_t<smallest_type_for<bits>>;
+
+			const auto value{read<bits>()};
+			if (!value) [[unlikely]] {
+				return std::unexpected(value.error());
+			}
+			const auto sign{1ULL << (bits - 1zu)};
+			return static_cast<result_t>((std::uint64_t{*value} ^ sign) - sign);
+		}
+
+		/*! \brief Read the next `bits` bits, or return `fallback` if there are not enough.
+
+			This is intended for runs of reads where the `truncated()` flag is checked once at the end.
+		*/
+		template<std::size_t bits>
+		[[nodiscard]]
+		smallest_type_for<bits> read_or(const smallest_type_for<bits> fallback = {}) noexcept {
+			return read<bits>().value_or(fallback);
+		}
+
+		/*! \brief Read the next `bits` bits without advancing.
+
+			As this does not advance the reader, a failed peek does not set the sticky `truncated()` flag.
+
+			\tparam bits The width of the field, from 1 to 56 bits.
+			\returns The value, or `read_error_t::Truncated` if there are not enough bits remaining.
+		*/
+		template<std::size_t bits>
+		[[nodiscard]]
+		std::expected<smallest_type_for<bits>, read_error_t> peek() noexcept {
+			static_assert(bits != 0zu && bits <= max_direct, "Peeks must be from 1 to 56 bits wide");
+
+			if (_truncated || bits_remaining() < bits) [[unlikely]] {
+				return std::unexpected(read_error_t::Truncated);
+			}
+			if (_count < bits) {
+				refill();
+			}
+			return static_cast<smallest_type_for<bits>>(look(bits));
+		}
+
+		/*! \brief Read a field whose width is only known at runtime.
+
+			\param bits The width of the field, from 0 to 64 bits.
+			\returns The value, or `read_error_t::Truncated` if there are not enough bits remaining.
+		*/
+		[[nodiscard]]
+		std::expected<std::uint64_t, read_error_t> read(const std::size_t bits) noexcept {
+			if (bits > 64zu || !require(bits)) [[unlikely]] {
+				_truncated = true;
+				return std::unexpected(read_error_t::Truncated);
+			}
+			if (bits == 0zu) {
+				return 0U;
+			}
+			return take(bits);
+		}
+
+		/*! \brief Read a single bit as a flag */
+		[[nodiscard]]
+		std::expected<bool, read_error_t> read_flag() noexcept {
+			const auto bit{read<1zu>()};
+			if (!bit) [[unlikely]] {
+				return std::unexpected(bit.error());
+			}
+			return *bit != 0U;
+		}
+
+		/*! \brief Read a `bitfield_t` from the next `F::width` bits.
+
+			\code{.cc}
+			using flags_t = bitfield_t<std::uint8_t, tcp_flags, bit_t<0>, bit_t<1>, bits_t<2, 7>>;
+			const auto flags{rdr.read_field<flags_t>()};
+			\endcode
+
+			\tparam F The `bitfield_t` type to read.
+		*/
+		template<typename F>
+		[[nodiscard]]
+		std::expected<F, read_error_t> read_field() noexcept {
+			using value_t = typename F::vtype;
+			const auto value{read<static_cast<std::size_t>(F::width)>()};
+			if (!value) [[unlikely]] {
+				return std::unexpected(value.error());
+			}
+			return F{static_cast<value_t>(*value)};
+		}
+
+		/*! \brief Advance the read offset by `bits` bits.
+
+			\returns true if the skip was in bounds, false otherwise.
+		*/
+		bool skip(std::size_t bits) noexcept {
+			if (!require(bits)) [[unlikely]] {
+				return false;
+			}
+
+			if (bits > _count) {
+				/* Drop the register and jump straight to the byte the skip ends in */
+				bits -= _count;
+				_bits = 0U;
+				_count = 0zu;
+				_next += bits / 8zu;
+				bits %= 8zu;
+				if (bits != 0zu) {
+					refill();
+				}
+			}
+			consume(bits);
+			return true;
+		}
+
+		/*! \brief Advance the read offset to the next byte boundary, if it is not already on one */
+		void align() noexcept {
+			consume(_count % 8zu);
+		}
+
+		/* == Variable length codes == */
+
+		/*! \brief Read an unsigned Exp-Golomb code, the `ue(v)` of H.264 and H.265.
+
+			\returns The value, `read_error_t::Truncated`, or `read_error_t::Malformed` if the code has more
+			than 31 leading zeros and so does not fit in 32 bits.
+		*/
+		[[nodiscard]]
+		std::expected<std::uint32_t, read_error_t> read_ue() noexcept {
+			if (_truncated) [[unlikely]] {
+				return std::unexpected(read_error_t::Truncated);
+			}
+			if (_count < 32zu) {
+				refill();
+			}
+
+			/* Only the counted bits are known, the rest of the register may not have been filled */
+			const auto zeros{std::min(leading_zeros(), _count)};
+			if (zeros > 31zu) {
+				return std::unexpected(read_error_t::Malformed);
+			}
+			if (zeros == _count || !require((zeros * 2zu) + 1zu)) [[unlikely]] {
+				_truncated = true;
+				return std::unexpected(read_error_t::Truncated);
+			}
+
+			/* The zeros and the one bit that ends them are all in the register already */
+			consume(zeros + 1zu);
+			const auto info{(zeros != 0zu) ? take(zeros) : 0U};
+			return static_cast<std::uint32_t>(((1ULL << zeros) - 1U) + info);
+		}
+
+		/*! \brief Read a signed Exp-Golomb code, the `se(v)` of H.264 and H.265.
+
+			\see read_ue
+		*/
+		[[nodiscard]]
+		std::expected<std::int32_t, read_error_t> read_se() noexcept {
+			const auto code{read_ue()};
+			if (!code) [[unlikely]] {
+				return std::unexpected(code.error());
+			}
+			/* 0, 1, -1, 2, -2, ... */
+			const auto magnitude{static_cast<std::int64_t>((std::uint64_t{*code} + 1U) / 2U)};
+			return static_cast<std::int32_t>(((*code % 2U) != 0U) ? magnitude : -magnitude);
+		}
+
+		/* == ASN.1 PER == */
+
+		/*! \brief Read a constrained whole number in the range `lower` to `upper` (X.691 11.5).
+
+			\tparam variant Whether the encoding is PER ALIGNED or UNALIGNED.
+			\returns The value, `read_error_t::Truncated`, or `read_error_t::Malformed` if the range is empty or
+			the encoded value is out of it.
+		*/
+		template<per_variant_t variant = per_variant_t::Aligned>
+		[[nodiscard]]
+		std::expected<std::uint64_t, read_error_t> read_per_constrained(
+			const std::uint64_t lower, const std::uint64_t upper
+		) noexcept {
+			if (upper < lower) [[unlikely]] {
+				return std::unexpected(read_error_t::Malformed);
+			}
+
+			/* The range minus one, which is the largest offset from `lower` */
+			const auto span{upper - lower};
+			std::size_t bits{static_cast<std::size_t>(std::bit_width(span))};
+			if constexpr (variant == per_variant_t::Aligned) {
+				if (span > 0xFFFFU) {
+					/* The indefinite length case, a length in octets then the octet-aligned value */
+					const auto octets{read_per_constrained<variant>(1U, (bits + 7zu) / 8zu)};
+					if (!octets) [[unlikely]] {
+						return std::unexpected(octets.error());
+					}
+					align();
+					bits = static_cast<std::size_t>(*octets) * 8zu;
+				} else if (span > 0xFFU) {
+					align();
+					bits = 16zu;
+				} else if (span == 0xFFU) {
+					align();
+				}
+			}
+
+			const auto value{read(bits)};
+			if (!value) [[unlikely]] {
+				return std::unexpected(value.error());
+			}
+			if (*value > span) [[unlikely]] {
+				return std::unexpected(read_error_t::Malformed);
+			}
+			return lower + *value;
+		}
+
+		/*! \brief Read an unconstrained length determinant (X.691 11.9).
+
+			Lengths of 16K and over are split into fragments, each of which is followed by the length
+			determinant for the rest.
+
+			\tparam variant Whether the encoding is PER ALIGNED or UNALIGNED.
+			\returns The length, `read_error_t::Truncated`, or `read_error_t::Malformed`.
+		*/
+		template<per_variant_t variant = per_variant_t::Aligned>
+		[[nodiscard]]
+		std::expected<per_length_t, read_error_t> read_per_length() noexcept {
+			if constexpr (variant == per_variant_t::Aligned) {
+				align();
+			}
+
+			const auto first{read<8zu>()};
+			if (!first) [[unlikely]] {
+				return std::unexpected(first.error());
+			}
+
+			if ((*first & 0x80U) == 0U) {
+				return per_length_t{*first, false};
+			}
+			if ((*first & 0xC0U) == 0x80U) {
+				const auto second{read<8zu>()};
+				if (!second) [[unlikely]] {
+					return std::unexpected(second.error());
+				}
+				return per_length_t{(std::size_t{*first & 0x3FU} << 8U) | *second, false};
+			}
+
+			const auto multiplier{std::size_t{*first & 0x3FU}};
+			if (multiplier == 0zu || multiplier > 4zu) [[unlikely]] {
+				return std::unexpected(read_error_t::Malformed);
+			}
+			return per_length_t{multiplier * 16384zu, true};
+		}
+
+		/*! \brief Read a normally small non-negative whole number (X.691 11.6), as used for extension
+			addition bitmaps and choice indices past the extension marker.
+
+			\tparam variant Whether the encoding is PER ALIGNED or UNALIGNED.
+			\returns The value, `read_error_t::Truncated`, or `read_error_t::Malformed`.
+		*/
+		template<per_variant_t variant = per_variant_t::Aligned>
+		[[nodiscard]]
+		std::expected<std::uint64_t, read_error_t> read_per_normally_small() noexcept {
+			const auto large{read_flag()};
+			if (!large) [[unlikely]] {
+				return std::unexpected(large.error());
+			}
+			if (!*large) {
+				return read(6zu);
+			}
+
+			/* Otherwise it is a semi-constrained whole number with a lower bound of 0 */
+			const auto octets{read_per_length<variant>()};
+			if (!octets) [[unlikely]] {
+				return std::unexpected(octets.error());
+			}
+			if (octets->fragment || octets->length == 0zu || octets->length > 8zu) [[unlikely]] {
+				return std::unexpected(read_error_t::Malformed);
+			}
+			return read(octets->length * 8zu);
+		}
+	};
+
+	/*! \brief A most significant bit first bit reader */
+	using bit_reader_t = basic_bit_reader_t<bit_order_t::MsbFirst>;
+	/*! \brief A least significant bit first bit reader */
+	using lsb_bit_reader_t = basic_bit_reader_t<bit_order_t::LsbFirst>;
+}
+
+#endif /* PANKO_CORE_BIT_READER_HH */
@@ -16,8 +16,6 @@
 #include <string_view>
 #include <vector>
 
-#include <spdlog/spdlog.h>
-
 #include "panko/internal/defs.hh"
 #include "panko/core/types.hh"
 #include "panko/core/bytearray.hh"
@@ -28,86 +26,342 @@
 namespace Panko::core {
 	using Panko::core::error_codes::strdec_error_t;
 	using Panko::core::error_codes::decomp_error_t;
+	using Panko::core::integers::uint24_t;
+
+	namespace {
+		/* The location of a string's data in the buffer */
+		struct str_extent_t final {
+			std::size_t offset;
+			std::size_t length;
+		};
+
+		/* Check that the `len` bytes at `idx` are in the buffer */
+		[[nodiscard]]
+		std::expected<str_extent_t, strdec_error_t> fixed_extent(
+			const std::span<const std::byte> buffer, const std::size_t idx, const std::size_t len
+		) noexcept {
+			if (idx > buffer.size() || (buffer.size() - idx) < len) {
+				return std::unexpected(strdec_error_t::Overrun);
+			}
+			return str_extent_t{idx, len};
+		}
+
+		/* Find the first null code unit of `unit_size` bytes, returning the number of code units before it */
+		[[nodiscard]]
+		std::size_t find_nul_unit(const std::span<const std::byte> data, const std::size_t unit_size) noexcept {
+			switch (unit_size) {
+				case 2zu: return strutils::find_nul16(data);
+				case 4zu: return strutils::find_nul32(data);
+				default:  return strutils::find_nul(data);
+			}
+		}
+
+		/* Find the extent of a string starting at `idx` that ends at the first null code unit in `max_len` code units */
+		[[nodiscard]]
+		std::expected<str_extent_t, strdec_error_t> zt_extent(
+			const std::span<const std::byte> buffer, const std::size_t idx, const std::size_t max_len,
+			const std::size_t unit_size = 1zu
+		) noexcept {
+			if (idx > buffer.size()) {
+				return std::unexpected(strdec_error_t::Overrun);
+			}
+
+			const auto remaining{(buffer.size() - idx) / unit_size};
+			const auto bounded{max_len != 0zu && max_len <= remaining};
+			const auto window{bounded ? max_len : remaining};
+
+			const auto len{find_nul_unit(buffer.subspan(idx, window * unit_size), unit_size)};
+			/* Running off the end of the buffer without finding a terminator is an overrun */
+			if (len == window && !bounded) {
+				return std::unexpected(strdec_error_t::Overrun);
+			}
+
+			return str_extent_t{idx, len * unit_size};
+		}
+
+		/* Read a `T` wide length prefix at `idx` holding the number of `unit_size` code units in the string after it */
+		template<typename T>
+		[[nodiscard]]
+		std::expected<str_extent_t, strdec_error_t> lp_extent(
+			const std::span<const std::byte> buffer, const std::size_t idx, const std::endian endian,
+			const std::size_t unit_size = 1zu
+		) noexcept {
+			constexpr auto prefix_len{wire_size_v<T>};
+
+			if (idx > buffer.size() || (buffer.size() - idx) < prefix_len) {
+				return std::unexpected(strdec_error_t::Overrun);
+			}
+
+			const auto* const prefix{buffer.data() + idx};
+			const auto len{static_cast<std::uint64_t>((endian == std::endian::little) ?
+				load<T, std::endian::little>(prefix) : load<T, std::endian::big>(prefix)
+			)};
+
+			const auto offset{idx + prefix_len};
+			if (((buffer.size() - offset) / unit_size) < len) {
+				return std::unexpected(strdec_error_t::Overrun);
+			}
+
+			return str_extent_t{offset, static_cast<std::size_t>(len) * unit_size};
+		}
+
+		/* Read an unsigned LEB128 length prefix of at most 5 bytes at `idx`, otherwise the same as `lp_extent` */
+		[[nodiscard]]
+		std::expected<str_extent_t, strdec_error_t> leb128_extent(
+			const std::span<const std::byte> buffer, const std::size_t idx, const std::size_t unit_size = 1zu
+		) noexcept {
+			constexpr auto max_prefix_len{5zu};
+
+			if (idx >= buffer.size()) {
+				return std::unexpected(strdec_error_t::Overrun);
+			}
+
+			std::uint64_t len{};
+			std::size_t prefix_len{};
+			for (;;) {
+				if (prefix_len == max_prefix_len) {
+					return std::unexpected(strdec_error_t::Malformed);
+				}
+				if ((idx + prefix_len) >= buffer.size()) {
+					return std::unexpected(strdec_error_t::Overrun);
+				}
+
+				const auto byte{std::to_integer<std::uint8_t>(buffer[idx + prefix_len])};
+				len |= std::uint64_t{byte & 0x7FU} << (7zu * prefix_len);
+				++prefix_len;
+
+				if ((byte & 0x80U) == 0U) {
+					break;
+				}
+			}
+
+			const auto offset{idx + prefix_len};
+			if (((buffer.size() - offset) / unit_size) < len) {
+				return std::unexpected(strdec_error_t::Overrun);
+			}
+
+			return str_extent_t{offset, static_cast<std::size_t>(len) * unit_size};
+		}
+
+		/* Truncate the string at the first null code unit if there is one */
+		[[nodiscard]]
+		std::expected<str_extent_t, strdec_error_t> strip_nul_padding(
+			const std::span<const std::byte> buffer, const std::expected<str_extent_t, strdec_error_t> extent,
+			const std::size_t unit_size = 1zu
+		) noexcept {
+			if (!extent) {
+				return extent;
+			}
+			const auto data{buffer.subspan(extent->offset, extent->length)};
+			return str_extent_t{extent->offset, find_nul_unit(data, unit_size) * unit_size};
+		}
+
+		/* Get a view of an 8-bit ASCII string, every byte is valid so this is the whole extent */
+		[[nodiscard]]
+		std::expected<std::string_view, strdec_error_t> decode_ascii(
+			const std::span<const std::byte> buffer, const std::expected<str_extent_t, strdec_error_t> extent
+		) noexcept {
+			if (!extent) {
+				return std::unexpected(extent.error());
+			}
+
+			return std::string_view{reinterpret_cast<const char*>(buffer.data() + extent->offset), extent->length};
+		}
+
+		/* Get a view of the longest 7-bit ASCII prefix of the string */
+		[[nodiscard]]
+		std::expected<std::string_view, strdec_error_t> decode_ascii7(
+			const std::span<const std::byte> buffer, const std::expected<str_extent_t, strdec_error_t> extent
+		) noexcept {
+			if (!extent) {
+				return std::unexpected(extent.error());
+			}
+
+			const auto data{buffer.subspan(extent->offset, extent->length)};
+			const auto len{strutils::ascii_valid_prefix(data)};
+
+			if (len == 0zu && !data.empty()) {
+				return std::unexpected(strdec_error_t::Invalid);
+			}
+
+			return std::string_view{reinterpret_cast<const char*>(data.data()), len};
+		}
+
+		/* Get a view of the longest valid UTF-8 prefix of the string */
+		[[nodiscard]]
+		std::expected<std::u8string_view, strdec_error_t> decode_utf8(
+			const std::span<const std::byte> buffer, const std::expected<str_extent_t, strdec_error_t> extent
+		) noexcept {
+			if (!extent) {
+				return std::unexpected(extent.error());
+			}
+
+			const auto data{buffer.subspan(extent->offset, extent->length)};
+			const auto len{strutils::utf8_valid_prefix(data)};
+
+			if (len == 0zu && !data.empty()) {
+				return std::unexpected(strdec_error_t::Invalid);
+			}
+
+			return std::u8string_view{reinterpret_cast<const char8_t*>(data.data()), len};
+		}
+
+		/* Work out the endian of a UTF-16 or UTF-32 string from its byte-order-mark */
+		template<typename CharT>
+		[[nodiscard]]
+		std::optional<std::endian> detect_bom(const std::span<const std::byte> data) noexcept {
+			if (data.size() < sizeof(CharT)) {
+				return std::nullopt;
+			}
+
+			constexpr auto bom{static_cast<CharT>(0xFEFFU)};
+			if (load<CharT, std::endian::little>(data.data()) == bom) {
+				return std::endian::little;
+			}
+			if (load<CharT, std::endian::big>(data.data()) == bom) {
+				return std::endian::big;
+			}
+			return std::nullopt;
+		}
+
+		/* Get a view of the longest valid prefix of a UTF-16 or UTF-32 string
+
+			If the string is native endian and suitably aligned this is a view directly into the buffer, otherwise
+			the code units are loaded into memory allocated from the arena of the `bytearray_t`. If `endian` is not
+			set, it is taken from the byte-order-mark at the start of the string, which is not part of the result.
+		*/
+		template<typename CharT>
+		[[nodiscard]]
+		std::expected<std::basic_string_view<CharT>, strdec_error_t> decode_utf(
+			bytearray_t& owner, const std::expected<str_extent_t, strdec_error_t> extent,
+			std::optional<std::endian> endian
+		) {
+			if (!extent) {
+				return std::unexpected(extent.error());
+			}
+
+			const std::span<const std::byte> buffer{owner.data(), owner.length()};
+			auto data{buffer.subspan(extent->offset, extent->length - (extent->length % sizeof(CharT)))};
+
+			if (!endian) {
+				endian = detect_bom<CharT>(data);
+				if (!endian) {
+					return std::unexpected(strdec_error_t::Invalid);
+				}
+				data = data.subspan(sizeof(CharT));
+			}
+
+			const auto units{data.size() / sizeof(CharT)};
+			const auto* str{static_cast<const CharT*>(static_cast<const void*>(data.data()))};
+
+			const auto aligned{(reinterpret_cast<std::uintptr_t>(data.data()) % alignof(CharT)) == 0U};
+			if (*endian != std::endian::native || !aligned) {
+				const auto transcoded{owner.arena().allocate<CharT>(units)};
+				if constexpr (sizeof(CharT) == 2zu) {
+					strutils::utf16_from_bytes(transcoded, data, *endian);
+				} else {
+					strutils::utf32_from_bytes(transcoded, data, *endian);
+				}
+				str = transcoded.data();
+			}
+
+			const auto len{[&]() {
+				if constexpr (sizeof(CharT) == 2zu) {
+					return strutils::utf16_valid_prefix({str, units});
+				} else {
+					return strutils::utf32_valid_prefix({str, units});
+				}
+			}()};
+
+			if (len == 0zu && units != 0zu) {
+				return std::unexpected(strdec_error_t::Invalid);
+			}
+
+			return std::basic_string_view<CharT>{str, len};
+		}
+
+		/* Decode an EBCDIC string into Latin-1 in memory allocated from the arena of the `bytearray_t` */
+		[[nodiscard]]
+		std::expected<std::string_view, strdec_error_t> decode_ebcdic(
+			bytearray_t& owner, const std::expected<str_extent_t, strdec_error_t> extent
+		) {
+			if (!extent) {
+				return std::unexpected(extent.error());
+			}
+
+			const std::span<const std::byte> data{owner.data() + extent->offset, extent->length};
+			const auto decoded{owner.arena().allocate<char>(data.size())};
+			strutils::ebcdic_to_latin1(decoded, data);
+
+			return std::string_view{decoded.data(), decoded.size()};
+		}
+
+		/* Decode the longest valid prefix of a Shift-JIS string in memory allocated from the arena of the `bytearray_t` */
+		[[nodiscard]]
+		std::expected<std::wstring_view, strdec_error_t> decode_shiftjis(
+			bytearray_t& owner, const std::expected<str_extent_t, strdec_error_t> extent
+		) {
+			if (!extent) {
+				return std::unexpected(extent.error());
+			}
+
+			const std::span<const std::byte> data{owner.data() + extent->offset, extent->length};
+			const auto decoded{owner.arena().allocate<wchar_t>(data.size())};
+			const auto len{strutils::shiftjis_to_wide(decoded, data)};
+
+			if (len == 0zu && !data.empty()) {
+				return std::unexpected(strdec_error_t::Invalid);
+			}
+
+			return std::wstring_view{decoded.data(), len};
+		}
+	}
 
 	/* 8-bit ASCII */
 
 	/* string_ascii - Fixed length 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, fixed_extent(_backing_span, idx, len));
 	}
 
 	/* string_ascii_zp - Fixed length null-padded 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len)));
 	}
 
 	/* string_ascii_zt - Zero/Null terminated 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, zt_extent(_backing_span, idx, max_len));
 	}
 
 	/* string_ascii_lp8 - 8bit length prefixed 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native));
 	}
 
 	/* string_ascii_lp16 - 16bit length prefixed 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, lp_extent<std::uint16_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ascii_lp24 - 24bit length prefixed 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, lp_extent<uint24_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ascii_lp32 - 32bit length prefixed 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, lp_extent<std::uint32_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ascii_lp64 - 64bit length prefixed 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, lp_extent<std::uint64_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ascii_leb128 - LEB128 length prefixed 8-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii(_backing_span, leb128_extent(_backing_span, idx));
 	}
 
 
@@ -115,245 +369,143 @@ namespace Panko::core {
 
 	/* string_ascii7 - Fixed length 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, fixed_extent(_backing_span, idx, len));
 	}
 
-	/* string_ascii7_zt - Zero/Null terminated 7-bit ASCII */
+	/* string_ascii7_zp - Fixed length null-padded 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len)));
 	}
 
-	/* string_ascii7_zp - Fixed length null-padded 7-bit ASCII */
+	/* string_ascii7_zt - Zero/Null terminated 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, zt_extent(_backing_span, idx, max_len));
 	}
 
 	/* string_ascii7_lp8 - 8bit length prefixed 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native));
 	}
 
 	/* string_ascii7_lp16 - 16bit length prefixed 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, lp_extent<std::uint16_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ascii7_lp24 - 24bit length prefixed 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, lp_extent<uint24_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ascii7_lp32 - 32bit length prefixed 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, lp_extent<std::uint32_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ascii7_lp64 - 64bit length prefixed 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, lp_extent<std::uint64_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ascii7_leb128 - LEB128 length prefixed 7-bit ASCII */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ascii7_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ascii7(_backing_span, leb128_extent(_backing_span, idx));
 	}
 
 
 	/* EBCDIC */
 
-	/* string_ebcdic - Fixed length terminated EBCDIC */
+	/* string_ebcdic - Fixed length EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, fixed_extent(_backing_span, idx, len));
 	}
 
-	/* string_ebcdic_zt - Zero/Null terminated EBCDIC */
+	/* string_ebcdic_zp - Fixed length null-padded EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len)));
 	}
 
-	/* string_ebcdic_zp - Fixed length null-padded EBCDIC */
+	/* string_ebcdic_zt - Zero/Null terminated EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, zt_extent(_backing_span, idx, max_len));
 	}
 
 	/* string_ebcdic_lp8 - 8bit length prefixed EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native));
 	}
 
 	/* string_ebcdic_lp16 - 16bit length prefixed EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, lp_extent<std::uint16_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ebcdic_lp24 - 24bit length prefixed EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, lp_extent<uint24_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ebcdic_lp32 - 32bit length prefixed EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, lp_extent<std::uint32_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ebcdic_lp64 - 64bit length prefixed EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, lp_extent<std::uint64_t>(_backing_span, idx, endian));
 	}
 
 	/* string_ebcdic_leb128 - LEB128 length prefixed EBCDIC */
 	std::expected<std::string_view, strdec_error_t> bytearray_t::string_ebcdic_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_ebcdic(*this, leb128_extent(_backing_span, idx));
 	}
 
 
 	/* UTF-8 */
 
-	/* string_utf8 - Fixed length terminated UTF-8 */
+	/* string_utf8 - Fixed length UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, fixed_extent(_backing_span, idx, len));
 	}
 
-	/* string_utf8_zt - Zero/Null terminated UTF-8 */
+	/* string_utf8_zp - Fixed length null-padded UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len)));
 	}
 
-	/* string_utf8_zp - Fixed length null-padded UTF-8 */
+	/* string_utf8_zt - Zero/Null terminated UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, zt_extent(_backing_span, idx, max_len));
 	}
 
 	/* string_utf8_lp8 - 8bit length prefixed UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native));
 	}
 
 	/* string_utf8_lp16 - 16bit length prefixed UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, lp_extent<std::uint16_t>(_backing_span, idx, endian));
 	}
 
 	/* string_utf8_lp24 - 24bit length prefixed UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, lp_extent<uint24_t>(_backing_span, idx, endian));
 	}
 
 	/* string_utf8_lp32 - 32bit length prefixed UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, lp_extent<std::uint32_t>(_backing_span, idx, endian));
 	}
 
 	/* string_utf8_lp64 - 64bit length prefixed UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, lp_extent<std::uint64_t>(_backing_span, idx, endian));
 	}
 
 	/* string_utf8_leb128 - LEB128 length prefixed UTF-8 */
 	std::expected<std::u8string_view, strdec_error_t> bytearray_t::string_utf8_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf8(_backing_span, leb128_extent(_backing_span, idx));
 	}
 
 
@@ -361,245 +513,143 @@ namespace Panko::core {
 
 	/* string_utf16_bom - Fixed length UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, fixed_extent(_backing_span, idx, len), std::nullopt);
 	}
 
-	/* string_utf16_bom_zt - Zero/Null terminated UTF-16 w/ Byte-Order-Mark */
+	/* string_utf16_bom_zp - Fixed length null-padded UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len), 2zu), std::nullopt);
 	}
 
-	/* string_utf16_zp - Fixed length null-padded UTF-16 w/ Byte-Order-Mark */
+	/* string_utf16_bom_zt - Zero/Null terminated UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, zt_extent(_backing_span, idx, max_len, 2zu), std::nullopt);
 	}
 
 	/* string_utf16_bom_lp8 - 8bit length prefixed UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native, 2zu), std::nullopt);
 	}
 
 	/* string_utf16_bom_lp16 - 16bit length prefixed UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint16_t>(_backing_span, idx, endian, 2zu), std::nullopt);
 	}
 
 	/* string_utf16_bom_lp24 - 24bit length prefixed UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<uint24_t>(_backing_span, idx, endian, 2zu), std::nullopt);
 	}
 
 	/* string_utf16_bom_lp32 - 32bit length prefixed UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint32_t>(_backing_span, idx, endian, 2zu), std::nullopt);
 	}
 
 	/* string_utf16_bom_lp64 - 64bit length prefixed UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint64_t>(_backing_span, idx, endian, 2zu), std::nullopt);
 	}
 
 	/* string_utf16_bom_leb128 - LEB128 length prefixed UTF-16 w/ Byte-Order-Mark */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16_bom_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, leb128_extent(_backing_span, idx, 2zu), std::nullopt);
 	}
 
 
 	/* UTF-16 Little Endian */
 
-	/* string_utf16le - Fixed length terminated UTF-16 Little-Endian */
+	/* string_utf16le - Fixed length UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, fixed_extent(_backing_span, idx, len), std::endian::little);
 	}
 
-	/* string_utf16le_zt - Zero/Null terminated UTF-16 Little-Endian */
+	/* string_utf16le_zp - Fixed length null-padded UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len), 2zu), std::endian::little);
 	}
 
-	/* string_utf16le_zp - Fixed length null-padded UTF-16 Little-Endian */
+	/* string_utf16le_zt - Zero/Null terminated UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, zt_extent(_backing_span, idx, max_len, 2zu), std::endian::little);
 	}
 
 	/* string_utf16le_lp8 - 8bit length prefixed UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native, 2zu), std::endian::little);
 	}
 
 	/* string_utf16le_lp16 - 16bit length prefixed UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint16_t>(_backing_span, idx, endian, 2zu), std::endian::little);
 	}
 
 	/* string_utf16le_lp24 - 24bit length prefixed UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<uint24_t>(_backing_span, idx, endian, 2zu), std::endian::little);
 	}
 
 	/* string_utf16le_lp32 - 32bit length prefixed UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint32_t>(_backing_span, idx, endian, 2zu), std::endian::little);
 	}
 
 	/* string_utf16le_lp64 - 64bit length prefixed UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint64_t>(_backing_span, idx, endian, 2zu), std::endian::little);
 	}
 
 	/* string_utf16le_leb128 - LEB128 length prefixed UTF-16 Little-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16le_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, leb128_extent(_backing_span, idx, 2zu), std::endian::little);
 	}
 
 
 	/* UTF-16 Big Endian */
 
-	/* string_utf16be - Fixed length terminated UTF-16 Big-Endian */
+	/* string_utf16be - Fixed length UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, fixed_extent(_backing_span, idx, len), std::endian::big);
 	}
 
-	/* string_utf16be_zt - Zero/Null terminated UTF-16 Big-Endian */
+	/* string_utf16be_zp - Fixed length null-padded UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len), 2zu), std::endian::big);
 	}
 
-	/* string_utf16be_zp - Fixed length null-padded UTF-16 Big-Endian */
+	/* string_utf16be_zt - Zero/Null terminated UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, zt_extent(_backing_span, idx, max_len, 2zu), std::endian::big);
 	}
 
 	/* string_utf16be_lp8 - 8bit length prefixed UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native, 2zu), std::endian::big);
 	}
 
 	/* string_utf16be_lp16 - 16bit length prefixed UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint16_t>(_backing_span, idx, endian, 2zu), std::endian::big);
 	}
 
 	/* string_utf16be_lp24 - 24bit length prefixed UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<uint24_t>(_backing_span, idx, endian, 2zu), std::endian::big);
 	}
 
 	/* string_utf16be_lp32 - 32bit length prefixed UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint32_t>(_backing_span, idx, endian, 2zu), std::endian::big);
 	}
 
 	/* string_utf16be_lp64 - 64bit length prefixed UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, lp_extent<std::uint64_t>(_backing_span, idx, endian, 2zu), std::endian::big);
 	}
 
 	/* string_utf16be_leb128 - LEB128 length prefixed UTF-16 Big-Endian */
 	std::expected<std::u16string_view, strdec_error_t> bytearray_t::string_utf16be_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char16_t>(*this, leb128_extent(_backing_span, idx, 2zu), std::endian::big);
 	}
 
 
@@ -607,424 +657,191 @@ namespace Panko::core {
 
 	/* string_utf32_bom - Fixed length UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, fixed_extent(_backing_span, idx, len), std::nullopt);
 	}
 
-	/* string_utf32_bom_zt - Zero/Null terminated UTF-32 w/ Byte-Order-Mark */
+	/* string_utf32_bom_zp - Fixed length null-padded UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len), 4zu), std::nullopt);
 	}
 
-	/* string_utf32_bom_zp - Fixed length null-padded UTF-32 w/ Byte-Order-Mark */
+	/* string_utf32_bom_zt - Zero/Null terminated UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, zt_extent(_backing_span, idx, max_len, 4zu), std::nullopt);
 	}
 
 	/* string_utf32_bom_lp8 - 8bit length prefixed UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native, 4zu), std::nullopt);
 	}
 
 	/* string_utf32_bom_lp16 - 16bit length prefixed UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint16_t>(_backing_span, idx, endian, 4zu), std::nullopt);
 	}
 
 	/* string_utf32_bom_lp24 - 24bit length prefixed UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<uint24_t>(_backing_span, idx, endian, 4zu), std::nullopt);
 	}
 
 	/* string_utf32_bom_lp32 - 32bit length prefixed UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint32_t>(_backing_span, idx, endian, 4zu), std::nullopt);
 	}
 
 	/* string_utf32_bom_lp64 - 64bit length prefixed UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint64_t>(_backing_span, idx, endian, 4zu), std::nullopt);
 	}
 
 	/* string_utf32_bom_leb128 - LEB128 length prefixed UTF-32 w/ Byte-Order-Mark */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32_bom_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, leb128_extent(_backing_span, idx, 4zu), std::nullopt);
 	}
 
 
 	/* UTF-32 Little Endian */
 
-	/* string_utf32le - Fixed length terminated UTF-32 Little-Endian */
+	/* string_utf32le - Fixed length UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, fixed_extent(_backing_span, idx, len), std::endian::little);
 	}
 
-	/* string_utf32le_zt - Zero/Null terminated UTF-32 Little-Endian */
+	/* string_utf32le_zp - Fixed length null-padded UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len), 4zu), std::endian::little);
 	}
 
-	/* string_utf32le_zp - Fixed length null-padded UTF-32 Little-Endian */
+	/* string_utf32le_zt - Zero/Null terminated UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, zt_extent(_backing_span, idx, max_len, 4zu), std::endian::little);
 	}
 
 	/* string_utf32le_lp8 - 8bit length prefixed UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native, 4zu), std::endian::little);
 	}
 
 	/* string_utf32le_lp16 - 16bit length prefixed UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint16_t>(_backing_span, idx, endian, 4zu), std::endian::little);
 	}
 
 	/* string_utf32le_lp24 - 24bit length prefixed UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<uint24_t>(_backing_span, idx, endian, 4zu), std::endian::little);
 	}
 
 	/* string_utf32le_lp32 - 32bit length prefixed UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint32_t>(_backing_span, idx, endian, 4zu), std::endian::little);
 	}
 
 	/* string_utf32le_lp64 - 64bit length prefixed UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint64_t>(_backing_span, idx, endian, 4zu), std::endian::little);
 	}
 
 	/* string_utf32le_leb128 - LEB128 length prefixed UTF-32 Little-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32le_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, leb128_extent(_backing_span, idx, 4zu), std::endian::little);
 	}
 
 
 	/* UTF-32 Big Endian */
 
-	/* string_utf32be - Fixed length terminated UTF-32 Big-Endian */
+	/* string_utf32be - Fixed length UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, fixed_extent(_backing_span, idx, len), std::endian::big);
 	}
 
-	/* string_utf32be_zt - Zero/Null terminated UTF-32 Big-Endian */
+	/* string_utf32be_zp - Fixed length null-padded UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len), 4zu), std::endian::big);
 	}
 
-	/* string_utf32le_zp - Fixed length null-padded UTF-32 Big-Endian */
+	/* string_utf32be_zt - Zero/Null terminated UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, zt_extent(_backing_span, idx, max_len, 4zu), std::endian::big);
 	}
 
 	/* string_utf32be_lp8 - 8bit length prefixed UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native, 4zu), std::endian::big);
 	}
 
 	/* string_utf32be_lp16 - 16bit length prefixed UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint16_t>(_backing_span, idx, endian, 4zu), std::endian::big);
 	}
 
 	/* string_utf32be_lp24 - 24bit length prefixed UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<uint24_t>(_backing_span, idx, endian, 4zu), std::endian::big);
 	}
 
 	/* string_utf32be_lp32 - 32bit length prefixed UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint32_t>(_backing_span, idx, endian, 4zu), std::endian::big);
 	}
 
 	/* string_utf32be_lp64 - 64bit length prefixed UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, lp_extent<std::uint64_t>(_backing_span, idx, endian, 4zu), std::endian::big);
 	}
 
 	/* string_utf32be_leb128 - LEB128 length prefixed UTF-32 Big-Endian */
 	std::expected<std::u32string_view, strdec_error_t> bytearray_t::string_utf32be_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_utf<char32_t>(*this, leb128_extent(_backing_span, idx, 4zu), std::endian::big);
 	}
 
 
 	/* SHIFT-JIS */
 
-	/* string_shiftjis - Fixed length terminated SHIFT-JIS */
+	/* string_shiftjis - Fixed length SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, fixed_extent(_backing_span, idx, len));
 	}
 
 	/* string_shiftjis_zt - Zero/Null terminated SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis_zt(const std::size_t idx, const std::size_t max_len) {
-		(void)idx;
-		(void)max_len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, zt_extent(_backing_span, idx, max_len));
 	}
-	/* string_shiftjis_zp - Fixed length null-padded terminated SHIFT-JIS */
+
+	/* string_shiftjis_zp - Fixed length null-padded SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis_zp(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, strip_nul_padding(_backing_span, fixed_extent(_backing_span, idx, len)));
 	}
 
 	/* string_shiftjis_lp8 - 8bit length prefixed SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis_lp8(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, lp_extent<std::uint8_t>(_backing_span, idx, std::endian::native));
 	}
+
 	/* string_shiftjis_lp16 - 16bit length prefixed SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis_lp16(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, lp_extent<std::uint16_t>(_backing_span, idx, endian));
 	}
+
 	/* string_shiftjis_lp24 - 24bit length prefixed SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis_lp24(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, lp_extent<uint24_t>(_backing_span, idx, endian));
 	}
+
 	/* string_shiftjis_lp32 - 32bit length prefixed SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis_lp32(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, lp_extent<std::uint32_t>(_backing_span, idx, endian));
 	}
+
 	/* string_shiftjis_lp64 - 64bit length prefixed SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis_lp64(const std::size_t idx, const std::endian endian) {
-		(void)idx;
-		(void)endian;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, lp_extent<std::uint64_t>(_backing_span, idx, endian));
 	}
+
 	/* string_shiftjis_leb128 - LEB128 length prefixed SHIFT-JIS */
 	std::expected<std::wstring_view, strdec_error_t> bytearray_t::string_shiftjis_leb128(const std::size_t idx) {
-		(void)idx;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	#if defined(PANKO_WITH_BROTLI)
-	/* decompress_brotli - Decompress bytearray slice with brotli */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_brotli(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-	#endif /* PANKO_WITH_BROTLI */
-
-	/* decompress_bz2 - Decompress bytearray slice with bz2 */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_bz2(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	/* decompress_deflate - Decompress bytearray slice with zlib deflate */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_deflate(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	/* decompress_lz4 - Decompress bytearray slice with lz4 */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lz4(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	/* decompress_lz77 - Decompress bytearray slice with lz77 */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lz77(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	/* decompress_lz77huff - Decompress bytearray slice with lz77+huffman */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lz77huff(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	/* decompress_lzma - Decompress bytearray slice with lzma */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lzma(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	/* decompress_lznt1 - Decompress bytearray slice with lznt1 */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lznt1(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	#if defined(PANKO_WITH_SNAPPY)
-	/* decompress_snappy - Decompress bytearray slice with snappy */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_snappy(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-	#endif /* PANKO_WITH_SNAPPY */
-
-	/* decompress_xz - Decompress bytearray slice with xz */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_xz(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
-	}
-
-	/* decompress_zstd - Decompress bytearray slice with zstd */
-	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_zstd(const std::size_t idx, const std::size_t len) {
-		(void)idx;
-		(void)len;
-		/* TODO(aki): Implement */
-		spdlog::get("panko")->warn("bytearray_t::{} is unimplemented!", __FUNCTION__);
-		return {};
+		return decode_shiftjis(*this, leb128_extent(_backing_span, idx));
 	}
 
 }
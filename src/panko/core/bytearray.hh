@@ -24,8 +24,12 @@
 #include "panko/config.hh"
 #include "panko/internal/defs.hh"
 #include "panko/core/types.hh"
+#include "panko/core/arena.hh"
+#include "panko/core/checksum.hh"
+#include "panko/core/endian.hh"
 #include "panko/core/errcodes.hh"
 #include "panko/core/integers.hh"
+#include "panko/core/unpack.hh"
 
 namespace Panko::core {
 	using Panko::core::error_codes::strdec_error_t;
@@ -47,6 +51,9 @@ namespace Panko::core {
 		std::span<byte_t> _backing_span;
 		std::size_t _backing_offset{};
 		std::size_t _index_offset{};
+		/* Shared with sub-slices, so strings they decode outlive both the slice and this `bytearray_t` */
+		std::shared_ptr<arena_t> _owned_arena{};
+		arena_t* _arena{nullptr};
 
 		template<typename T>
 		[[nodiscard]]
@@ -61,190 +68,16 @@ namespace Panko::core {
 			throw std::out_of_range("bytearray access out of range (1)");
 		}
 
-		/* TODO(aki): Replace array with span */
-		template<std::size_t N>
-		void index(const std::size_t idx, std::array<byte_t, N>& data) {
-			if ((idx + N) <= _backing_span.size()) {
-				for (std::size_t off{}; off < N; ++off) {
-					data[0] = *index<byte_t>(idx + off);
-				}
-			}
-			throw std::out_of_range("bytearray access out of range (0)");
-		}
-
-		template<typename T, std::size_t len>
+		/* The `len` bytes at `idx`, which must all be within the buffer */
 		[[nodiscard]]
-		T from_bytes_be(std::array<byte_t, len>& data) {
-			using ptype = std::make_unsigned_t<Panko::core::types::promoted_type_t<T>>;
-			static_assert(len != 0zu && len <= 8zu, "Length of T must be between 1 and 8 bytes");
-
-			if constexpr (len == 1zu) {
-				return static_cast<T>(data[0]);
-			}
-
-			if constexpr (len == 2zu) {
-				return static_cast<T>(
-					(ptype(data[0]) << 8U) | ptype(data[1])
-				);
-			}
-
-			if constexpr (len == 3zu) {
-				return static_cast<T>(
-					(ptype(data[0]) << 16U) | (ptype(data[1]) << 8U) |
-					ptype(data[2])
-				);
-			}
-
-			if constexpr (len == 4zu) {
-				return static_cast<T>(
-					(ptype(data[0]) << 24U) | (ptype(data[1]) << 16U) |
-					(ptype(data[2]) <<  8U) | ptype(data[3])
-				);
-			}
-
-			if constexpr (len == 5zu) {
-				return static_cast<T>(
-					(ptype(data[0]) << 32U) | (ptype(data[1]) << 24U) |
-					(ptype(data[2]) << 16U) | (ptype(data[3]) <<  8U) |
-					ptype(data[4])
-				);
-			}
-
-			if constexpr (len == 6zu) {
-				return static_cast<T>(
-					(ptype(data[0]) << 40U) | (ptype(data[1]) << 32U) |
-					(ptype(data[2]) << 24U) | (ptype(data[3]) << 16U) |
-					(ptype(data[4]) <<  8U) | ptype(data[5])
-				);
-			}
-
-			if constexpr (len == 7zu) {
-				return static_cast<T>(
-					(ptype(data[0]) << 48U) | (ptype(data[1]) << 40U) |
-					(ptype(data[2]) << 32U) | (ptype(data[3]) << 24U) |
-					(ptype(data[4]) << 16U) | (ptype(data[5]) <<  8U) |
-					ptype(data[6])
-				);
-			}
-
-			if constexpr (len == 8zu) {
-				return static_cast<T>(
-					(ptype(data[0]) << 56U) | (ptype(data[1]) << 48U) |
-					(ptype(data[2]) << 40U) | (ptype(data[3]) << 32U) |
-					(ptype(data[4]) << 24U) | (ptype(data[5]) << 16U) |
-					(ptype(data[6]) <<  8U) | ptype(data[7])
-				);
+		std::span<const byte_t> checked_range(const std::size_t idx, const std::size_t len) const {
+			if (idx > _backing_span.size() || (_backing_span.size() - idx) < len) {
+				throw std::out_of_range("bytearray access out of range (2)");
 			}
+			return _backing_span.subspan(idx, len);
 		}
-		template<typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
-		[[nodiscard]]
-		T from_bytes_be(std::array<byte_t, sizeof(T)>& data) {
-			const auto raw{[&](){
-				if constexpr (std::is_same_v<T, std::float16_t>) {
-					return from_byte_be<std::uint16_t>(data);
-				}
 
-				if constexpr (std::is_same_v<T, std::float32_t>) {
-					return from_byte_be<std::uint32_t>(data);
-
-				}
-				if constexpr (std::is_same_v<T, std::float64_t>) {
-					return from_byte_be<std::uint64_t>(data);
-				}
-			}()};
-			T _data{};
-			std::memcpy(&_data, &raw, sizeof(raw));
-			return _data;
-		}
-
-		template<typename T, std::size_t len>
-		[[nodiscard]]
-		T from_bytes_le(std::array<byte_t, len>& data) {
-			using ptype = std::make_unsigned_t<Panko::core::types::promoted_type_t<T>>;
-
-			static_assert(len != 0zu && len <= 8zu, "Length of T must be between 1 and 8 bytes");
-
-			if constexpr (len == 1zu) {
-				return static_cast<T>(data[0]);
-			}
-
-			if constexpr (len == 2zu) {
-				return static_cast<T>(
-					(ptype(data[1]) << 8U) | ptype(data[0])
-				);
-			}
-
-			if constexpr (len == 3zu) {
-				return static_cast<T>(
-					(ptype(data[2]) << 16U) | (ptype(data[1]) << 8U) |
-					ptype(data[0])
-				);
-			}
-
-			if constexpr (len == 4zu) {
-				return static_cast<T>(
-					(ptype(data[3]) << 24U) | (ptype(data[2]) << 16U) |
-					(ptype(data[1]) <<  8U) | ptype(data[0])
-				);
-			}
-
-			if constexpr (len == 5zu) {
-				return static_cast<T>(
-					(ptype(data[4]) << 32U) | (ptype(data[3]) << 24U) |
-					(ptype(data[2]) << 16U) | (ptype(data[1]) <<  8U) |
-					ptype(data[0])
-				);
-			}
-
-			if constexpr (len == 6zu) {
-				return static_cast<T>(
-					(ptype(data[5]) << 40U) | (ptype(data[4]) << 32U) |
-					(ptype(data[3]) << 24U) | (ptype(data[2]) << 16U) |
-					(ptype(data[1]) <<  8U) | ptype(data[0])
-				);
-			}
-
-			if constexpr (len == 7zu) {
-				return static_cast<T>(
-					(ptype(data[6]) << 48U) | (ptype(data[5]) << 40U) |
-					(ptype(data[4]) << 32U) | (ptype(data[3]) << 24U) |
-					(ptype(data[2]) << 16U) | (ptype(data[1]) <<  8U) |
-					ptype(data[0])
-				);
-			}
-
-			if constexpr (len == 8zu) {
-				return static_cast<T>(
-					(ptype(data[7]) << 56U) | (ptype(data[6]) << 48U) |
-					(ptype(data[5]) << 40U) | (ptype(data[4]) << 32U) |
-					(ptype(data[3]) << 24U) | (ptype(data[2]) << 16U) |
-					(ptype(data[1]) <<  8U) | ptype(data[0])
-				);
-			}
-		}
-
-		template<typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
-		[[nodiscard]]
-		T from_bytes_le(std::array<byte_t, sizeof(T)>& data) {
-			const auto raw{[&](){
-				if constexpr (std::is_same_v<T, std::float16_t>) {
-					return from_byte_le<std::uint16_t>(data);
-				}
-
-				if constexpr (std::is_same_v<T, std::float32_t>) {
-					return from_byte_le<std::uint32_t>(data);
-
-				}
-				if constexpr (std::is_same_v<T, std::float64_t>) {
-					return from_byte_le<std::uint64_t>(data);
-				}
-			}()};
-			T _data{};
-			std::memcpy(&_data, &raw, sizeof(raw));
-			return _data;
-		}
-
-					/*! \brief Construct a sub-slice `bytearray_t`
+		/*! \brief Construct a sub-slice `bytearray_t`
 
 			This constructor is only used with `operator[](idx, len)` and `slice(idx, len)` to get
 			a sub-view into the `bytearray_t`.
@@ -252,8 +85,13 @@ namespace Panko::core {
 			\param storage The backing storage for the parent `bytearray_t`.
 			\param subspan The subspan slice into the backing storage.
 			\param offset The offset into the parents backing storage this subslice is.
+			\param arena The arena of the parent `bytearray_t`.
+			\param owned_arena The parent's ownership of `arena`, if it owns it.
 		*/
-		bytearray_t(storage_t storage, std::span<byte_t> subspan, const std::size_t offset, std::nullptr_t) :
+		bytearray_t(
+			storage_t storage, std::span<byte_t> subspan, const std::size_t offset, arena_t* const arena,
+			std::shared_ptr<arena_t> owned_arena
+		) :
 			_backing_storage{[&]() -> storage_t {
 				if (storage.has_value()) {
 					return std::make_optional(std::shared_ptr<byte_t>(*storage));
@@ -261,7 +99,9 @@ namespace Panko::core {
 				return std::nullopt;
 			}()},
 			_backing_span{subspan},
-			_backing_offset{offset}
+			_backing_offset{offset},
+			_owned_arena{std::move(owned_arena)},
+			_arena{arena}
 		{ }
 
 	public:
@@ -486,6 +326,26 @@ namespace Panko::core {
 			return !_backing_span.empty();
 		}
 
+		/*! \brief Returns a pointer to the first byte of the `bytearray_t`
+
+			\warning No bounds checking is done on accesses through this pointer, it is intended for the
+			`reader_t` and other consumers that have already validated the range they intend to touch.
+		*/
+		[[nodiscard]]
+		constexpr byte_t* data() noexcept {
+			return _backing_span.data();
+		}
+
+		/*! \brief Returns a pointer to the first byte of the `bytearray_t`
+
+			\warning No bounds checking is done on accesses through this pointer, it is intended for the
+			`reader_t` and other consumers that have already validated the range they intend to touch.
+		*/
+		[[nodiscard]]
+		constexpr const byte_t* data() const noexcept {
+			return _backing_span.data();
+		}
+
 // 			template<typename T>
 // 			[[nodiscard]]
 // 			T& operator[](const std::size_t idx) {
@@ -498,6 +358,35 @@ namespace Panko::core {
 // 				return *index<const T>(idx);
 // 			}
 
+		/* == Scratch Memory == */
+
+		/*! \brief Use `arena` for any memory the `bytearray_t` needs to allocate.
+
+			This is currently used by the string decoders that can not return a view directly into the
+			`bytearray_t`, such as UTF-16 strings that are not native endian.
+
+			\warning The `arena` must outlive any strings decoded after this call, and resetting it invalidates them.
+
+			\param arena The arena to allocate from.
+		*/
+		void use_arena(arena_t& arena) noexcept {
+			_arena = &arena;
+		}
+
+		/*! \brief Returns the arena the `bytearray_t` allocates from.
+
+			If no arena was set with `use_arena`, then one owned by this `bytearray_t` is created on first use. Sub-slices
+			share the arena of the `bytearray_t` they were sliced from, and keep it alive if it is an owned one.
+		*/
+		[[nodiscard]]
+		arena_t& arena() {
+			if (_arena == nullptr) {
+				_owned_arena = std::make_shared<arena_t>();
+				_arena = _owned_arena.get();
+			}
+			return *_arena;
+		}
+
 		/* == Buffer Slicing == */
 
 		/*! \brief Obtain a sub-slice bytearray_t from this `bytearray_t`.
@@ -514,7 +403,8 @@ namespace Panko::core {
 
 		/*! \brief Obtain a sub-slice bytearray_t from this `bytearray_t`.
 
-			This method constructs a sub-slice of this `bytearray_t`.
+			This method constructs a sub-slice of this `bytearray_t`, which shares its `arena()`, so strings
+			decoded from the slice are not tied to the lifetime of the slice itself.
 
 			\param start The index into the `bytearray_t` to start the slice.
 			\param end The index into the `bytearray_t` to end the slice.
@@ -525,7 +415,8 @@ namespace Panko::core {
 				throw std::out_of_range("bytearray access out of range");
 			}
 			const auto len{(end - start) + 1};
-			return {_backing_storage, _backing_span.subspan(start, len), start, nullptr};
+			auto& scratch{arena()};
+			return {_backing_storage, _backing_span.subspan(start, len), start, &scratch, _owned_arena};
 		}
 
 		/* == Buffer conjoining == */
@@ -548,24 +439,14 @@ namespace Panko::core {
 		*/
 		template<typename T, std::endian endian>
 		[[nodiscard]]
-		T at(const std::size_t idx) {
-			constexpr static auto type_size{[&](){
-				using Panko::core::integers::is_intn_v;
-				if constexpr (is_intn_v<T>) {
-					return (T::bits + 7zu) / 8zu;
-				} else {
-					return sizeof(T);
-				}
-			}()};
+		T at(const std::size_t idx) const {
+			constexpr auto type_size{wire_size_v<T>};
 
-			std::array<byte_t, type_size> data{};
-			index(idx, data);
-
-			if constexpr (endian == std::endian::little) {
-				return from_bytes_le<T>(data);
-			} else {
-				return from_bytes_be<T>(data);
+			if (idx > _backing_span.size() || (_backing_span.size() - idx) < type_size) {
+				throw std::out_of_range("bytearray access out of range (0)");
 			}
+
+			return load<T, endian>(_backing_span.data() + idx);
 		}
 
 		/*! \brief Extract the next element of the specified type from the buffer.
@@ -586,22 +467,51 @@ namespace Panko::core {
 		template<typename T, std::endian endian>
 		[[nodiscard]]
 		T next() {
-			constexpr static auto type_size{[&](){
-				using Panko::core::integers::is_intn_v;
-				if constexpr (is_intn_v<T>) {
-					return (T::bits + 7zu) / 8zu;
-				} else {
-					return sizeof(T);
-				}
-			}()};
-
 			auto res{at<T, endian>(_index_offset)};
 
-			_index_offset += type_size;
+			_index_offset += wire_size_v<T>;
 
 			return res;
 		}
 
+		/*! \brief Unpack an array of `dst.size()` packed values starting at the given offset into the buffer.
+
+			\code{.cc}
+			std::array<std::int32_t, 16> samples{};
+			arr.unpack<int24_t, std::endian::big>(4zu, std::span{samples});
+			\endcode
+
+			\see Panko::core::unpack
+			\tparam T The packed type to extract, an integral or `intN_t` type.
+			\tparam endian The endian of the packed values.
+			\param idx The offset into the `bytearray_t` to begin the extraction.
+			\param dst Where to unpack the values to.
+			\throws std::out_of_range If there aren't `dst.size()` values in the buffer.
+		*/
+		template<typename T, std::endian endian>
+		void unpack(const std::size_t idx, const std::span<unpacked_t<T>> dst) const {
+			unpack_bits<packed_bits_v<T>, endian>(idx, dst);
+		}
+
+		/*! \brief Unpack an array of `dst.size()` values of `bits` bits, packed back to back, from the given offset.
+
+			\see Panko::core::unpack_bits
+			\tparam bits The width of each packed value.
+			\tparam endian The endian of the packed values.
+			\param idx The offset into the `bytearray_t` to begin the extraction.
+			\param dst Where to unpack the values to.
+			\throws std::out_of_range If there aren't `dst.size()` values in the buffer.
+		*/
+		template<std::size_t bits, std::endian endian, typename U, std::size_t extent>
+		void unpack_bits(const std::size_t idx, const std::span<U, extent> dst) const {
+			const auto len{((dst.size() * bits) + 7zu) / 8zu};
+			if (idx > _backing_span.size() || (_backing_span.size() - idx) < len) {
+				throw std::out_of_range("bytearray access out of range (0)");
+			}
+
+			static_cast<void>(Panko::core::unpack_bits<bits, endian>(_backing_span.subspan(idx, len), dst));
+		}
+
 		/* == String Helpers == */
 
 		/* 8-bit ASCII */
@@ -610,8 +520,8 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as an 8-bit ASCII string.
 
-			It will ingest control characters and null terminators up until the first byte out of the ASCII range
-			is encountered or the target length is reached, whichever occurs first.
+			Every byte is valid 8-bit ASCII, so control characters and null terminators are all ingested up until
+			the target length is reached.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param len The length of the string.
@@ -623,10 +533,8 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as an 8-bit ASCII string.
 
-			It will ingest control characters and null terminators up until the first byte out of the ASCII range
-			is encountered or the target length is reached, whichever occurs first.
-
-			This method is effectively the same as `string_ascii`.
+			It will ingest control characters up until the first null byte or the target length is reached,
+			whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param len The length of the string.
@@ -638,8 +546,8 @@ namespace Panko::core {
 
 			This method will read up until a null terminator or `max_len` and decode it as an 8-bit ASCII string.
 
-			It will ingest all control characters up until the first byte out of the ASCII range, if it's a
-			null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
+			It will ingest all control characters up until the null terminator, or we reach `max_len` if it
+			non-zero, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
@@ -652,8 +560,8 @@ namespace Panko::core {
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
 			number of ASCII characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			ASCII range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix.
 
 			\code{.unparsed}
 			╭─────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -672,8 +580,8 @@ namespace Panko::core {
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
 			to `endian` and use that as the number ASCII characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			ASCII range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -693,8 +601,8 @@ namespace Panko::core {
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
 			to `endian` and use that as the number ASCII characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			ASCII range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -714,8 +622,8 @@ namespace Panko::core {
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
 			to `endian` and use that as the number ASCII characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			ASCII range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -735,8 +643,8 @@ namespace Panko::core {
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
 			to `endian` and use that as the number ASCII characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			ASCII range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬──────┬──────┬──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -756,8 +664,8 @@ namespace Panko::core {
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
 			as an unsigned integer and use that as the number of ASCII characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			ASCII range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬┈┈┈┈┈┈┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -790,10 +698,8 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as 7-bit ASCII string.
 
-			It will ingest control characters and null terminators up until the first byte out of the ASCII
-			range (0x00-0x7F) is encountered or the target length is reached, whichever occurs first.
-
-			This method is effectively the same as `string_ascii7`.
+			It will ingest control characters up until the first byte out of the ASCII range (0x00-0x7F), the first
+			null byte, or the target length is reached, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param len The length of the string.
@@ -803,10 +709,10 @@ namespace Panko::core {
 
 		/*! \brief Read a null-terminated 7-bit ASCII encoded string from the `bytearray_t`.
 
-			This method will read up until a null terminator (0x00)	or `max_len` and decode it as a 7-bit ASCII string.
+			This method will read up until a null terminator (0x00) or `max_len` and decode it as a 7-bit ASCII string.
 
 			It will ingest all control characters up until the first byte out of the ASCII range (0x00-0x7F),
-			it it's a null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
+			the null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
@@ -942,10 +848,11 @@ namespace Panko::core {
 
 		/*! \brief Read a fixed length EBCDIC encoded string from the `bytearray_t`.
 
-			This method reads a fixed number of bytes from the `bytearray_t` and decodes them an as EBCDIC string.
+			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as an IBM code page 037
+			EBCDIC string into ISO-8859-1.
 
-			It will ingest control characters and null terminators up until the first byte out of the EBCDIC range
-			is encountered or the target length is reached, whichever occurs first.
+			Every EBCDIC byte has a Latin-1 equivalent, so control characters and null terminators are all decoded
+			and the whole of the target length is always ingested.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param len The length of the string.
@@ -955,12 +862,11 @@ namespace Panko::core {
 
 		/*! \brief Read a fixed length null padded EBCDIC encoded string from the `bytearray_t`.
 
-			This method reads a fixed number of bytes from the `bytearray_t` and decodes them an as EBCDIC string.
-
-			It will ingest control characters and null terminators up until the first byte out of the EBCDIC range
-			is encountered or the target length is reached, whichever occurs first.
+			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as an IBM code page 037
+			EBCDIC string into ISO-8859-1.
 
-			This method is effectively the same as 'string_ebcdic`.
+			It will ingest all control characters up until the first null byte or the target length is reached,
+			whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param len The length of the string.
@@ -970,10 +876,11 @@ namespace Panko::core {
 
 		/*! \brief Read a null-terminated EBCDIC encoded string from the `bytearray_t`.
 
-			This method will read up until a null terminator or `max_len` and decode it as an EBCDIC string.
+			This method will read up until a null terminator or `max_len` and decode it as an IBM code page 037
+			EBCDIC string into ISO-8859-1.
 
-			It will ingest all control characters up until the first byte out of the EBCDIC range, it it's a
-			null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
+			It will ingest all control characters up until the null terminator, or we reach `max_len` if it
+			non-zero, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
@@ -986,8 +893,8 @@ namespace Panko::core {
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
 			number of EBCDIC characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			EBCDIC range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix, and decode them into ISO-8859-1.
 
 			\code{.unparsed}
 			╭─────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1006,8 +913,8 @@ namespace Panko::core {
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
 			to `endian` and use that as the number EBCDIC characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			EBCDIC range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix, and decode them into ISO-8859-1.
 
 			\code{.unparsed}
 			╭──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1027,8 +934,8 @@ namespace Panko::core {
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
 			to `endian` and use that as the number EBCDIC characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			EBCDIC range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix, and decode them into ISO-8859-1.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1048,8 +955,8 @@ namespace Panko::core {
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
 			to `endian` and use that as the number EBCDIC characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			EBCDIC range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix, and decode them into ISO-8859-1.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1069,8 +976,8 @@ namespace Panko::core {
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
 			to `endian` and use that as the number EBCDIC characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			EBCDIC range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix, and decode them into ISO-8859-1.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬──────┬──────┬──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1090,8 +997,8 @@ namespace Panko::core {
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
 			as an unsigned integer and use that as the number of EBCDIC characters to read directly after it.
 
-			It will ingest all control characters and null terminators up until the first byte is outside of the
-			EBCDIC range or we hit the number of characters contained in the length prefix byte.
+			It will ingest all control characters and null terminators up until we hit the number of characters
+			contained in the length prefix, and decode them into ISO-8859-1.
 
 			\code{.unparsed}
 			╭──────┬┈┈┈┈┈┈┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1116,6 +1023,8 @@ namespace Panko::core {
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param len The length of the string.
+			\returns A view into the `bytearray_t`, `strdec_error_t::Overrun` if the string extends past the end of
+			the buffer, or `strdec_error_t::Invalid` if the first codepoint is not valid UTF-8.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u8string_view, strdec_error_t> string_utf8(const std::size_t idx, const std::size_t len);
@@ -1124,13 +1033,13 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as UTF-8.
 
-			It will ingest up until the first invalid UTF-8 codepoint encountered or the target length is reached,
-			whichever occurs first.
-
-			This method is effectively the same as `string_utf8`.
+			It will ingest up until the first invalid UTF-8 codepoint encountered, the first null byte, or the target
+			length is reached, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param len The length of the string.
+			\returns A view into the `bytearray_t`, `strdec_error_t::Overrun` if the string extends past the end of
+			the buffer, or `strdec_error_t::Invalid` if the first codepoint is not valid UTF-8.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u8string_view, strdec_error_t> string_utf8_zp(const std::size_t idx, const std::size_t len);
@@ -1144,6 +1053,8 @@ namespace Panko::core {
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
+			\returns A view into the `bytearray_t`, `strdec_error_t::Overrun` if the end of the buffer is reached
+			without finding the terminator, or `strdec_error_t::Invalid` if the first codepoint is not valid UTF-8.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u8string_view, strdec_error_t> string_utf8_zt(const std::size_t idx, const std::size_t max_len = 0zu);
@@ -1151,10 +1062,10 @@ namespace Panko::core {
 		/*! \brief Read an 8-bit length prefixed UTF-8 encoded string from the `bytearray_t`.
 
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
-			number of UTF-8 codepoints to read directly after it.
+			number of bytes of UTF-8 data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-8
-			codepoint, or we hit the number of characters contained in the length prefix byte.
+			codepoint, or we hit the number of bytes contained in the length prefix.
 
 			\code{.unparsed}
 			╭─────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1171,10 +1082,10 @@ namespace Panko::core {
 		/*! \brief Read a 16-bit length prefixed UTF-8 encoded string from the `bytearray_t`.
 
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-8 codepoints to read directly after it.
+			to `endian` and use that as the number of bytes of UTF-8 data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-8
-			codepoint, or we hit the number of characters contained in the length prefix byte.
+			codepoint, or we hit the number of bytes contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1192,10 +1103,10 @@ namespace Panko::core {
 		/*! \brief Read a 24-bit length prefixed UTF-8 encoded string from the `bytearray_t`.
 
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-8 codepoints to read directly after it.
+			to `endian` and use that as the number of bytes of UTF-8 data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-8
-			codepoint, or we hit the number of characters contained in the length prefix byte.
+			codepoint, or we hit the number of bytes contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1213,10 +1124,10 @@ namespace Panko::core {
 		/*! \brief Read a 32-bit length prefixed UTF-8 encoded string from the `bytearray_t`.
 
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-8 codepoints to read directly after it.
+			to `endian` and use that as the number of bytes of UTF-8 data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-8
-			codepoint, or we hit the number of characters contained in the length prefix byte.
+			codepoint, or we hit the number of bytes contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1234,10 +1145,10 @@ namespace Panko::core {
 		/*! \brief Read a 64-bit length prefixed UTF-8 encoded string from the `bytearray_t`.
 
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-8 codepoint to read directly after it.
+			to `endian` and use that as the number of bytes of UTF-8 data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-8
-			codepoint, or we hit the number of characters contained in the length prefix byte.
+			codepoint, or we hit the number of bytes contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬──────┬──────┬──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1255,10 +1166,10 @@ namespace Panko::core {
 		/*! \brief Read a LEB128 length prefixed UTF-8 encoded string from the `bytearray_t`.
 
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
-			as an unsigned integer and use that as the number of UTF-8 codepoints to read directly after it.
+			as an unsigned integer and use that as the number of bytes of UTF-8 data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-8
-			codepoint, or we hit the number of characters contained in the length prefix byte.
+			codepoint, or we hit the number of bytes contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬┈┈┈┈┈┈┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -1283,7 +1194,7 @@ namespace Panko::core {
 			whichever occurs first, but only if the first codepoint is a valid byte-order-mark.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16_bom(const std::size_t idx, const std::size_t len);
@@ -1293,13 +1204,11 @@ namespace Panko::core {
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as UTF-16 according to
 			the byte-order-mark found at the first byte.
 
-			It will ingest up until the first invalid UTF-16 codepoint encountered or the target length is reached,
-			whichever occurs first, but only if the first codepoint is a valid byte-order-mark.
-
-			This method is effectively the same as `string_utf16_bom`.
+			It will ingest up until the first invalid UTF-16 codepoint encountered, the first null code unit, or the target
+			length is reached, whichever occurs first, but only if the first codepoint is a valid byte-order-mark.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16_bom_zp(const std::size_t idx, const std::size_t len);
@@ -1314,7 +1223,7 @@ namespace Panko::core {
 			but only if the first codepoint is a valid byte-order-mark.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
+			\param max_len The maximum length of the string in code units if the null terminator is not found, 0 for no limit.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16_bom_zt(const std::size_t idx, const std::size_t max_len = 0zu);
@@ -1322,7 +1231,7 @@ namespace Panko::core {
 		/*! \brief Read an 8-bit length prefixed UTF-16 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
-			number of UTF-16 codepoints to read directly after it.
+			number of UTF-16 code units to read directly after it.
 
 			The UTF-16 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1346,7 +1255,7 @@ namespace Panko::core {
 		/*! \brief Read a 16-bit length prefixed UTF-16 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 code units to read directly after it.
 
 			The UTF-16 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1371,7 +1280,7 @@ namespace Panko::core {
 		/*! \brief Read a 24-bit length prefixed UTF-16 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 code units to read directly after it.
 
 			The UTF-16 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1396,7 +1305,7 @@ namespace Panko::core {
 		/*! \brief Read a 32-bit length prefixed UTF-16 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 code units to read directly after it.
 
 			The UTF-16 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1421,7 +1330,7 @@ namespace Panko::core {
 		/*! \brief Read a 64-bit length prefixed UTF-16 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 code units to read directly after it.
 
 			The UTF-16 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1446,7 +1355,7 @@ namespace Panko::core {
 		/*! \brief Read a LEB128 length prefixed UTF-16 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
-			as an unsigned integer and use that as the number of UTF-16 codepoints to read directly after it.
+			as an unsigned integer and use that as the number of UTF-16 code units to read directly after it.
 
 			The UTF-16 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1477,7 +1386,7 @@ namespace Panko::core {
 			whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16le(const std::size_t idx, const std::size_t len);
@@ -1486,13 +1395,11 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as UTF-16 little-endian.
 
-			It will ingest up until the first invalid UTF-16 codepoint encountered or the target length is reached,
-			whichever occurs first.
-
-			This method is effectively the same as `string_utf16le`.
+			It will ingest up until the first invalid UTF-16 codepoint encountered, the first null code unit, or the target
+			length is reached, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16le_zp(const std::size_t idx, const std::size_t len);
@@ -1506,7 +1413,7 @@ namespace Panko::core {
 			it it's a null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
+			\param max_len The maximum length of the string in code units if the null terminator is not found, 0 for no limit.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16le_zt(const std::size_t idx, const std::size_t max_len = 0zu);
@@ -1514,7 +1421,7 @@ namespace Panko::core {
 		/*! \brief Read an 8-bit length prefixed little endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
-			number of UTF-16 little endian codepoints to read directly after it.
+			number of UTF-16 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1534,7 +1441,7 @@ namespace Panko::core {
 		/*! \brief Read a 16-bit length prefixed little endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 little endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1555,7 +1462,7 @@ namespace Panko::core {
 		/*! \brief Read a 24-bit length prefixed little endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 little endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1576,7 +1483,7 @@ namespace Panko::core {
 		/*! \brief Read a 32-bit length prefixed little endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 little endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1597,7 +1504,7 @@ namespace Panko::core {
 		/*! \brief Read a 64-bit length prefixed little endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 little endian codepoint to read directly after it.
+			to `endian` and use that as the number of UTF-16 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1618,7 +1525,7 @@ namespace Panko::core {
 		/*! \brief Read a LEB128 length prefixed little endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
-			as an unsigned integer and use that as the number of UTF-16 little endian codepoints to read directly
+			as an unsigned integer and use that as the number of UTF-16 little endian code units to read directly
 			after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
@@ -1646,7 +1553,7 @@ namespace Panko::core {
 			whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16be(const std::size_t idx, const std::size_t len);
@@ -1655,13 +1562,11 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as UTF-16 big-endian.
 
-			It will ingest up until the first invalid UTF-16 codepoint encountered or the target length is reached,
-			whichever occurs first.
-
-			This method is effectively the same as `string_utf16be`.
+			It will ingest up until the first invalid UTF-16 codepoint encountered, the first null code unit, or the target
+			length is reached, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16be_zp(const std::size_t idx, const std::size_t len);
@@ -1675,7 +1580,7 @@ namespace Panko::core {
 			it it's a null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
+			\param max_len The maximum length of the string in code units if the null terminator is not found, 0 for no limit.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u16string_view, strdec_error_t> string_utf16be_zt(const std::size_t idx, const std::size_t max_len = 0zu);
@@ -1683,7 +1588,7 @@ namespace Panko::core {
 		/*! \brief Read an 8-bit length prefixed big endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
-			number of UTF-8 big endian codepoints to read directly after it.
+			number of UTF-16 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1703,7 +1608,7 @@ namespace Panko::core {
 		/*! \brief Read a 16-bit length prefixed big endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 big endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1724,7 +1629,7 @@ namespace Panko::core {
 		/*! \brief Read a 24-bit length prefixed big endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 big endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1745,7 +1650,7 @@ namespace Panko::core {
 		/*! \brief Read a 32-bit length prefixed big endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 big endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-16 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1766,7 +1671,7 @@ namespace Panko::core {
 		/*! \brief Read a 64-bit length prefixed big endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-16 big endian codepoint to read directly after it.
+			to `endian` and use that as the number of UTF-16 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1787,7 +1692,7 @@ namespace Panko::core {
 		/*! \brief Read a LEB128 length prefixed big endian UTF-16 encoded string from the `bytearray_t`.
 
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
-			as an unsigned integer and use that as the number of UTF-16 big endian codepoints to read directly after it.
+			as an unsigned integer and use that as the number of UTF-16 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-16
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -1815,7 +1720,7 @@ namespace Panko::core {
 			whichever occurs first, but only if the first codepoint is a valid byte-order-mark.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32_bom(const std::size_t idx, const std::size_t len);
@@ -1825,13 +1730,11 @@ namespace Panko::core {
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as UTF-32 according to
 			the byte-order-mark found at the first byte.
 
-			It will ingest up until the first invalid UTF-32 codepoint encountered or the target length is reached,
-			whichever occurs first, but only if the first codepoint is a valid byte-order-mark.
-
-			This method is effectively the same as `string_utf32_bom`.
+			It will ingest up until the first invalid UTF-32 codepoint encountered, the first null code unit, or the target
+			length is reached, whichever occurs first, but only if the first codepoint is a valid byte-order-mark.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32_bom_zp(const std::size_t idx, const std::size_t len);
@@ -1846,7 +1749,7 @@ namespace Panko::core {
 			but only if the first codepoint is a valid byte-order-mark.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
+			\param max_len The maximum length of the string in code units if the null terminator is not found, 0 for no limit.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32_bom_zt(const std::size_t idx, const std::size_t max_len = 0zu);
@@ -1854,7 +1757,7 @@ namespace Panko::core {
 		/*! \brief Read an 8-bit length prefixed UTF-32 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
-			number of UTF-32 codepoints to read directly after it.
+			number of UTF-32 code units to read directly after it.
 
 			The UTF-32 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1878,7 +1781,7 @@ namespace Panko::core {
 		/*! \brief Read a 16-bit length prefixed UTF-32 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 code units to read directly after it.
 
 			The UTF-32 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1903,7 +1806,7 @@ namespace Panko::core {
 		/*! \brief Read a 24-bit length prefixed UTF-32 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 code units to read directly after it.
 
 			The UTF-32 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1928,7 +1831,7 @@ namespace Panko::core {
 		/*! \brief Read a 32-bit length prefixed UTF-32 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 code units to read directly after it.
 
 			The UTF-32 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1953,7 +1856,7 @@ namespace Panko::core {
 		/*! \brief Read a 64-bit length prefixed UTF-32 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 code units to read directly after it.
 
 			The UTF-32 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -1978,7 +1881,7 @@ namespace Panko::core {
 		/*! \brief Read a LEB128 length prefixed UTF-32 encoded string with a Byte-Order-Mark from the `bytearray_t`.
 
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
-			as an unsigned integer and use that as the number of UTF-32 codepoints to read directly after it.
+			as an unsigned integer and use that as the number of UTF-32 code units to read directly after it.
 
 			The UTF-32 codepoints are decoded according to the Byte-Order-Mark found as the first codepoint in the
 			string directly preceding the end of the length prefix bytes.
@@ -2009,7 +1912,7 @@ namespace Panko::core {
 			whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32le(const std::size_t idx, const std::size_t len);
@@ -2018,13 +1921,11 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as UTF-32 little-endian.
 
-			It will ingest up until the first invalid UTF-32 codepoint encountered or the target length is reached,
-			whichever occurs first.
-
-			This method is effectively the same as `string_utf32le`.
+			It will ingest up until the first invalid UTF-32 codepoint encountered, the first null code unit, or the target
+			length is reached, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32le_zp(const std::size_t idx, const std::size_t len);
@@ -2038,7 +1939,7 @@ namespace Panko::core {
 			it it's a null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
+			\param max_len The maximum length of the string in code units if the null terminator is not found, 0 for no limit.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32le_zt(const std::size_t idx, const std::size_t max_len = 0zu);
@@ -2046,7 +1947,7 @@ namespace Panko::core {
 		/*! \brief Read an 8-bit length prefixed little endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
-			number of UTF-32 little endian codepoints to read directly after it.
+			number of UTF-32 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2066,7 +1967,7 @@ namespace Panko::core {
 		/*! \brief Read a 16-bit length prefixed little endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 little endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2087,7 +1988,7 @@ namespace Panko::core {
 		/*! \brief Read a 24-bit length prefixed little endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 little endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2108,7 +2009,7 @@ namespace Panko::core {
 		/*! \brief Read a 32-bit length prefixed little endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 little endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2129,7 +2030,7 @@ namespace Panko::core {
 		/*! \brief Read a 64-bit length prefixed little endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 little endian codepoint to read directly after it.
+			to `endian` and use that as the number of UTF-32 little endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2150,7 +2051,7 @@ namespace Panko::core {
 		/*! \brief Read a LEB128 length prefixed little endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
-			as an unsigned integer and use that as the number of UTF-32 little endian codepoints to read directly
+			as an unsigned integer and use that as the number of UTF-32 little endian code units to read directly
 			after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
@@ -2178,7 +2079,7 @@ namespace Panko::core {
 			whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32be(const std::size_t idx, const std::size_t len);
@@ -2187,13 +2088,11 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as UTF-32 big-endian.
 
-			It will ingest up until the first invalid UTF-32 codepoint encountered or the target length is reached,
-			whichever occurs first.
-
-			This method is effectively the same as `string_utf32be`.
+			It will ingest up until the first invalid UTF-32 codepoint encountered, the first null code unit, or the target
+			length is reached, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param len The length of the string.
+			\param len The length of the string in bytes.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32be_zp(const std::size_t idx, const std::size_t len);
@@ -2207,7 +2106,7 @@ namespace Panko::core {
 			it it's a null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
-			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
+			\param max_len The maximum length of the string in code units if the null terminator is not found, 0 for no limit.
 		*/
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::u32string_view, strdec_error_t> string_utf32be_zt(const std::size_t idx, const std::size_t max_len = 0zu);
@@ -2215,7 +2114,7 @@ namespace Panko::core {
 		/*! \brief Read an 8-bit length prefixed big endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
-			number of UTF-32 big endian codepoints to read directly after it.
+			number of UTF-32 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2235,7 +2134,7 @@ namespace Panko::core {
 		/*! \brief Read a 16-bit length prefixed big endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 big endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2256,7 +2155,7 @@ namespace Panko::core {
 		/*! \brief Read a 24-bit length prefixed big endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 big endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2277,7 +2176,7 @@ namespace Panko::core {
 		/*! \brief Read a 32-bit length prefixed big endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 big endian codepoints to read directly after it.
+			to `endian` and use that as the number of UTF-32 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2298,7 +2197,7 @@ namespace Panko::core {
 		/*! \brief Read a 64-bit length prefixed big endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number UTF-32 big endian codepoint to read directly after it.
+			to `endian` and use that as the number of UTF-32 big endian code units to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
 			codepoint, or we hit the number of characters contained in the length prefix byte.
@@ -2319,7 +2218,7 @@ namespace Panko::core {
 		/*! \brief  Read a LEB128 length prefixed big endian UTF-32 encoded string from the `bytearray_t`.
 
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
-			as an unsigned integer and use that as the number of UTF-32 big endian codepoints to read directly after
+			as an unsigned integer and use that as the number of UTF-32 big endian code units to read directly after
 			it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid UTF-32
@@ -2356,10 +2255,8 @@ namespace Panko::core {
 
 			This method reads a fixed number of bytes from the `bytearray_t` and decodes them as SHIFT-JIS.
 
-			It will ingest up until the first invalid SHIFT-JIS codepoint encountered or the target length is
-			reached, whichever occurs first.
-
-			This method is effectively the same as `string_shiftjis`.
+			It will ingest up until the first invalid SHIFT-JIS codepoint encountered, the first null byte, or the
+			target length is reached, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param len The length of the string.
@@ -2371,8 +2268,8 @@ namespace Panko::core {
 
 			This method will read up until a null terminator or `max_len` and decode it as a SHIFT-JIS string.
 
-			It will ingest all control characters up until the first byte out of the SHIFT-JIS codepoint,
-			it it's a null terminator, or we reach `max_len` if it non-zero, whichever occurs first.
+			It will ingest all control characters up until the first invalid SHIFT-JIS codepoint, the null
+			terminator, or we reach `max_len` if it non-zero, whichever occurs first.
 
 			\param idx The offset into the `bytearray_t` to start the extraction from.
 			\param max_len The maximum length of the string if the null terminator is not found, 0 for no limit.
@@ -2383,10 +2280,10 @@ namespace Panko::core {
 		/*! \brief Read an 8-bit length prefixed SHIFT-JIS encoded string from the `bytearray_t`.
 
 			This method will read the first 8 bits at the offset `idx` as an unsigned integer and use that as the
-			number of SHIFT-JSI codepoints to read directly after it.
+			number of bytes of SHIFT-JIS data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid
-			SHIFT-JIS codepoint, or we hit the number of characters contained in the length prefix byte.
+			SHIFT-JIS codepoint, or we hit the length contained in the length prefix.
 
 			\code{.unparsed}
 			╭─────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -2403,10 +2300,10 @@ namespace Panko::core {
 		/*! \brief Read a 16-bit length prefixed SHIFT-JIS encoded string from the `bytearray_t`.
 
 			This method will read the first 16 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number SHIFT-JIS codepoints to read directly after it.
+			to `endian` and use that as the number of bytes of SHIFT-JIS data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid
-			SHIFT-JIS codepoint, or we hit the number of characters contained in the length prefix byte.
+			SHIFT-JIS codepoint, or we hit the length contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -2424,10 +2321,10 @@ namespace Panko::core {
 		/*! \brief Read a 24-bit length prefixed SHIFT-JIS encoded string from the `bytearray_t`.
 
 			This method will read the first 24 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number SHIFT-JIS codepoints to read directly after it.
+			to `endian` and use that as the number of bytes of SHIFT-JIS data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid
-			SHIFT-JIS codepoint, or we hit the number of characters contained in the length prefix byte.
+			SHIFT-JIS codepoint, or we hit the length contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -2445,10 +2342,10 @@ namespace Panko::core {
 		/*! \brief Read a 32-bit length prefixed SHIFT-JIS encoded string from the `bytearray_t`.
 
 			This method will read the first 32 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number SHIFT-JIS codepoints to read directly after it.
+			to `endian` and use that as the number of bytes of SHIFT-JIS data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid
-			SHIFT-JIS codepoint, or we hit the number of characters contained in the length prefix byte.
+			SHIFT-JIS codepoint, or we hit the length contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -2466,10 +2363,10 @@ namespace Panko::core {
 		/*! \brief Read a 64-bit length prefixed SHIFT-JIS encoded string from the `bytearray_t`.
 
 			This method will read the first 64 bits at the offset `idx`, decode them as an unsigned integer according
-			to `endian` and use that as the number SHIFT-JIS codepoint to read directly after it.
+			to `endian` and use that as the number of bytes of SHIFT-JIS data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid
-			SHIFT-JIS codepoint, or we hit the number of characters contained in the length prefix byte.
+			SHIFT-JIS codepoint, or we hit the length contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬──────┬──────┬──────┬──────┬──────┬──────┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -2487,10 +2384,10 @@ namespace Panko::core {
 		/*! \brief  Read a LEB128 length prefixed SHIFT-JIS encoded string from the `bytearray_t`.
 
 			This method will read up to 5 bytes at the offset `idx` to construct an LEB128 byte stream, decode that
-			as an unsigned integer and use that as the number of SHIFT-JIS codepoints to read directly after it.
+			as an unsigned integer and use that as the number of bytes of SHIFT-JIS data to read directly after it.
 
 			It will ingest all control characters and null terminators up until the first byte is an invalid
-			SHIFT-JIS codepoint, or we hit the number of characters contained in the length prefix byte.
+			SHIFT-JIS codepoint, or we hit the length contained in the length prefix.
 
 			\code{.unparsed}
 			╭──────┬┈┈┈┈┈┈┬──────┬┈┈┈┈┈┈┈┈┈┈┈┈┈╮
@@ -2504,6 +2401,93 @@ namespace Panko::core {
 		[[nodiscard]]
 		PANKO_CLS_API std::expected<std::wstring_view, strdec_error_t> string_shiftjis_leb128(const std::size_t idx);
 
+		/* == Checksum Helpers == */
+
+		/*! \brief Compute the Internet checksum over `len` bytes starting at `idx`.
+
+			Verifying an IPv4 header in place is checking that the checksum over the whole header is 0.
+
+			\code{.cc}
+			const auto ihl{std::size_t{arr.at<std::uint8_t, std::endian::big>(0zu) & 0x0FU} * 4zu};
+			const bool valid{arr.checksum_inet(0zu, ihl) == 0U};
+			\endcode
+
+			\see Panko::core::checksum::inet_checksum
+			\param idx The offset into the `bytearray_t` to start from.
+			\param len The number of bytes to checksum.
+			\param initial The one's complement sum of any preceding data, such as a pseudo-header.
+			\throws std::out_of_range If the range is not within the buffer.
+		*/
+		[[nodiscard]]
+		std::uint16_t checksum_inet(const std::size_t idx, const std::size_t len, const std::uint16_t initial = 0U) const {
+			return checksum::inet_checksum(checked_range(idx, len), initial);
+		}
+
+		/*! \brief Compute the CRC-32 over `len` bytes starting at `idx`.
+
+			\see Panko::core::checksum::crc32
+			\param idx The offset into the `bytearray_t` to start from.
+			\param len The number of bytes to checksum.
+			\param crc The CRC of any preceding data.
+			\throws std::out_of_range If the range is not within the buffer.
+		*/
+		[[nodiscard]]
+		std::uint32_t checksum_crc32(const std::size_t idx, const std::size_t len, const std::uint32_t crc = 0U) const {
+			return checksum::crc32(checked_range(idx, len), crc);
+		}
+
+		/*! \brief Compute the CRC-32C over `len` bytes starting at `idx`.
+
+			\see Panko::core::checksum::crc32c
+			\param idx The offset into the `bytearray_t` to start from.
+			\param len The number of bytes to checksum.
+			\param crc The CRC of any preceding data.
+			\throws std::out_of_range If the range is not within the buffer.
+		*/
+		[[nodiscard]]
+		std::uint32_t checksum_crc32c(const std::size_t idx, const std::size_t len, const std::uint32_t crc = 0U) const {
+			return checksum::crc32c(checked_range(idx, len), crc);
+		}
+
+		/*! \brief Compute a CRC-16 over `len` bytes starting at `idx`.
+
+			\see Panko::core::checksum::crc16
+			\param idx The offset into the `bytearray_t` to start from.
+			\param len The number of bytes to checksum.
+			\param variant Which of the CRC-16s to compute.
+			\throws std::out_of_range If the range is not within the buffer.
+		*/
+		[[nodiscard]]
+		std::uint16_t checksum_crc16(const std::size_t idx, const std::size_t len, const checksum::crc16_t variant) const {
+			return checksum::crc16(checked_range(idx, len), variant);
+		}
+
+		/*! \brief Compute the Adler-32 checksum over `len` bytes starting at `idx`.
+
+			\see Panko::core::checksum::adler32
+			\param idx The offset into the `bytearray_t` to start from.
+			\param len The number of bytes to checksum.
+			\param adler The checksum of any preceding data.
+			\throws std::out_of_range If the range is not within the buffer.
+		*/
+		[[nodiscard]]
+		std::uint32_t checksum_adler32(const std::size_t idx, const std::size_t len, const std::uint32_t adler = 1U) const {
+			return checksum::adler32(checked_range(idx, len), adler);
+		}
+
+		/*! \brief Compute the 8-bit Fletcher checksum over `len` bytes starting at `idx`.
+
+			\see Panko::core::checksum::fletcher16
+			\param idx The offset into the `bytearray_t` to start from.
+			\param len The number of bytes to checksum.
+			\param fletcher The checksum of any preceding data.
+			\throws std::out_of_range If the range is not within the buffer.
+		*/
+		[[nodiscard]]
+		std::uint16_t checksum_fletcher16(const std::size_t idx, const std::size_t len, const std::uint16_t fletcher = 0U) const {
+			return checksum::fletcher16(checked_range(idx, len), fletcher);
+		}
+
 		/* == Decompression Helpers == */
 
 		#if defined(PANKO_WITH_BROTLI)
@@ -2545,6 +2529,8 @@ namespace Panko::core {
 			This method decompresses a block of data starting at `idx` that is `len` bytes long with the zlib DEFLATE
 			decompression method.
 
+			The data may have either a zlib or gzip wrapper, or none at all, which is detected from the header.
+
 			\note
 			The returned `bytearray_t` owns it's buffer, as such the memory will be automatically reclaimed
 			when the last reference to it dies unless an explicit call to `bytearray_t::disown` is called to get
@@ -2561,6 +2547,9 @@ namespace Panko::core {
 			This method decompresses a block of data starting at `idx` that is `len` bytes long with the LZ4
 			decompression method.
 
+			The data must be in the LZ4 frame format, if the frame header has the content size the output is sized
+			from it.
+
 			\note
 			The returned `bytearray_t` owns it's buffer, as such the memory will be automatically reclaimed
 			when the last reference to it dies unless an explicit call to `bytearray_t::disown` is called to get
@@ -2577,6 +2566,8 @@ namespace Panko::core {
 			This method decompresses a block of data starting at `idx` that is `len` bytes long with the LZ77
 			decompression method.
 
+			This is the plain LZ77 format from [MS-XCA], as used by Windows and the SMB2 compression transform.
+
 			\note
 			The returned `bytearray_t` owns it's buffer, as such the memory will be automatically reclaimed
 			when the last reference to it dies unless an explicit call to `bytearray_t::disown` is called to get
@@ -2593,6 +2584,9 @@ namespace Panko::core {
 			This method decompresses a block of data starting at `idx` that is `len` bytes long with the LZ77 with
 			Huffman tables decompression method.
 
+			This is the LZ77+Huffman format from [MS-XCA]. As the format does not record the uncompressed size,
+			the end of the data is taken to be the end of stream symbol once all of the input has been read.
+
 			\note
 			The returned `bytearray_t` owns it's buffer, as such the memory will be automatically reclaimed
 			when the last reference to it dies unless an explicit call to `bytearray_t::disown` is called to get
@@ -2609,6 +2603,8 @@ namespace Panko::core {
 			This method decompresses a block of data starting at `idx` that is `len` bytes long with the LZMA
 			decompression method.
 
+			The data must be in the legacy `.lzma` format, for the `.xz` container see `decompress_xz`.
+
 			\note
 			The returned `bytearray_t` owns it's buffer, as such the memory will be automatically reclaimed
 			when the last reference to it dies unless an explicit call to `bytearray_t::disown` is called to get
@@ -2625,6 +2621,9 @@ namespace Panko::core {
 			This method decompresses a block of data starting at `idx` that is `len` bytes long with the LZNT1
 			decompression method.
 
+			A chunk that decompresses to less than 4KiB and is followed by another chunk is zero padded out to 4KiB,
+			as is done by Windows.
+
 			\note
 			The returned `bytearray_t` owns it's buffer, as such the memory will be automatically reclaimed
 			when the last reference to it dies unless an explicit call to `bytearray_t::disown` is called to get
@@ -2642,6 +2641,8 @@ namespace Panko::core {
 			This method decompresses a block of data starting at `idx` that is `len` bytes long with the snappy
 			decompression method.
 
+			The data must be a raw snappy block, not the framed stream format.
+
 			\note
 			The returned `bytearray_t` owns it's buffer, as such the memory will be automatically reclaimed
 			when the last reference to it dies unless an explicit call to `bytearray_t::disown` is called to get
@@ -2675,6 +2676,9 @@ namespace Panko::core {
 			This method decompresses a block of data starting at `idx` that is `len` bytes long with the ZSTD
 			decompression method.
 
+			If the data is a single frame with the content size in its header, it is decompressed in one shot into
+			an exactly sized buffer.
+
 			\note
 			The returned `bytearray_t` owns it's buffer, as such the memory will be automatically reclaimed
 			when the last reference to it dies unless an explicit call to `bytearray_t::disown` is called to get
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* bytearray_chain.cc - Several `bytearray_t` fragments presented as one buffer */
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/bytearray_chain.hh"
+#include "panko/core/checksum.hh"
+
+namespace Panko::core {
+	void bytearray_chain_t::append(bytearray_t& fragment) {
+		const auto len{fragment.length()};
+		if (len == 0zu) {
+			return;
+		}
+
+		std::unique_ptr<bytearray_t> slice{new bytearray_t(fragment.slice(0zu, len - 1zu))};
+		slice->use_arena(*_arena);
+		_fragments.push_back(std::move(slice));
+		_starts.push_back(_length);
+		_length += len;
+	}
+
+	void bytearray_chain_t::copy_out(const std::size_t idx, const std::span<byte_t> dst) const noexcept {
+		auto frag{fragment_of(idx)};
+		auto local{idx - _starts[frag]};
+		std::size_t copied{};
+
+		while (copied < dst.size()) {
+			const auto& fragment{*_fragments[frag]};
+			const auto count{std::min(fragment.length() - local, dst.size() - copied)};
+			std::memcpy(dst.data() + copied, fragment.data() + local, count);
+			copied += count;
+			++frag;
+			local = 0zu;
+		}
+	}
+
+	std::span<bytearray_chain_t::byte_t> bytearray_chain_t::stitch(const std::size_t idx, const std::size_t len) {
+		const auto stitched{_arena->allocate<byte_t>(len)};
+		copy_out(idx, stitched);
+		return stitched;
+	}
+
+	bytearray_chain_t bytearray_chain_t::slice(const std::size_t start, const std::size_t end) {
+		if (start >= _length || end >= _length || end < start) {
+			throw std::out_of_range("bytearray chain access out of range");
+		}
+
+		bytearray_chain_t chain{};
+		const auto last{fragment_of(end)};
+		for (auto frag{fragment_of(start)}; frag <= last; ++frag) {
+			auto& fragment{*_fragments[frag]};
+			const auto frag_start{_starts[frag]};
+			const auto frag_end{frag_start + fragment.length() - 1zu};
+
+			auto sub{fragment.slice(std::max(start, frag_start) - frag_start, std::min(end, frag_end) - frag_start)};
+			chain.append(sub);
+		}
+
+		return chain;
+	}
+
+	std::span<const bytearray_chain_t::byte_t> bytearray_chain_t::contiguous(const std::size_t idx, const std::size_t len) {
+		if (idx > _length || (_length - idx) < len) {
+			throw std::out_of_range("bytearray chain access out of range");
+		}
+		if (len == 0zu) {
+			return {};
+		}
+
+		const auto frag{fragment_of(idx)};
+		const auto local{idx - _starts[frag]};
+		const auto& fragment{*_fragments[frag]};
+		if ((fragment.length() - local) >= len) {
+			return {fragment.data() + local, len};
+		}
+
+		return stitch(idx, len);
+	}
+
+	std::uint16_t bytearray_chain_t::checksum_inet(
+		const std::size_t idx, const std::size_t len, const std::uint16_t initial
+	) const {
+		auto sum{initial};
+		std::size_t offset{};
+		for_each_part(idx, len, [&](const std::span<const byte_t> part) {
+			/* A part starting at an odd offset has all of its bytes in the other half of each word */
+			const auto part_sum{checksum::inet_sum(part)};
+			sum = checksum::inet_add(sum, (offset % 2zu) != 0zu ? std::byteswap(part_sum) : part_sum);
+			offset += part.size();
+		});
+		return static_cast<std::uint16_t>(~sum);
+	}
+
+	std::uint32_t bytearray_chain_t::checksum_crc32(const std::size_t idx, const std::size_t len, std::uint32_t crc) const {
+		for_each_part(idx, len, [&](const std::span<const byte_t> part) {
+			crc = checksum::crc32(part, crc);
+		});
+		return crc;
+	}
+
+	std::uint32_t bytearray_chain_t::checksum_crc32c(const std::size_t idx, const std::size_t len, std::uint32_t crc) const {
+		for_each_part(idx, len, [&](const std::span<const byte_t> part) {
+			crc = checksum::crc32c(part, crc);
+		});
+		return crc;
+	}
+
+	std::uint16_t bytearray_chain_t::checksum_crc16(
+		const std::size_t idx, const std::size_t len, const checksum::crc16_t variant
+	) const {
+		std::uint16_t crc{};
+		bool first{true};
+		for_each_part(idx, len, [&](const std::span<const byte_t> part) {
+			crc = first ? checksum::crc16(part, variant) : checksum::crc16(part, variant, crc);
+			first = false;
+		});
+		/* An empty range is the CRC of nothing */
+		return first ? checksum::crc16({}, variant) : crc;
+	}
+
+	std::uint32_t bytearray_chain_t::checksum_adler32(const std::size_t idx, const std::size_t len, std::uint32_t adler) const {
+		for_each_part(idx, len, [&](const std::span<const byte_t> part) {
+			adler = checksum::adler32(part, adler);
+		});
+		return adler;
+	}
+
+	std::uint16_t bytearray_chain_t::checksum_fletcher16(
+		const std::size_t idx, const std::size_t len, std::uint16_t fletcher
+	) const {
+		for_each_part(idx, len, [&](const std::span<const byte_t> part) {
+			fletcher = checksum::fletcher16(part, fletcher);
+		});
+		return fletcher;
+	}
+}
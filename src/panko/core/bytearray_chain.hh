@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* bytearray_chain.hh - Several `bytearray_t` fragments presented as one buffer */
+
+#pragma once
+#if !defined(PANKO_CORE_BYTEARRAY_CHAIN_HH)
+#define PANKO_CORE_BYTEARRAY_CHAIN_HH
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/arena.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/checksum.hh"
+#include "panko/core/endian.hh"
+
+namespace Panko::core {
+	/*! \struct Panko::core::bytearray_chain_t
+		\brief A sequence of `bytearray_t` fragments accessed as one logical buffer
+
+		This is for data that arrives in pieces, like a reassembled TCP stream or IP datagram, so that it can
+		be dissected without first being copied into one contiguous `bytearray_t`.
+
+		Accesses that fall inside one fragment go straight to it, only those that straddle a fragment boundary
+		have their bytes stitched together, into a small temporary for `at` and `next`, or into the arena of the
+		chain for strings and `contiguous`.
+
+		\code{.cc}
+		bytearray_chain_t chain{};
+		chain.append(first_segment);
+		chain.append(second_segment);
+
+		const auto len{chain.at<std::uint32_t, std::endian::big>(0zu)};
+		const auto name{chain.string<&bytearray_t::string_ascii_lp8>(4zu)};
+		\endcode
+
+		\note The fragments are slices of the `bytearray_t`s they were appended from, so they share the
+		backing storage of owning buffers, and non-owning buffers must outlive the chain.
+	*/
+	struct bytearray_chain_t final {
+		using byte_t = bytearray_t::byte_t;
+	private:
+		std::vector<std::unique_ptr<bytearray_t>> _fragments{};
+		/* The offset of the start of each fragment into the chain, for finding fragments by binary search */
+		std::vector<std::size_t> _starts{};
+		std::size_t _length{};
+		std::size_t _index_offset{};
+		/* Boxed so the fragments can keep pointing at it when the chain is moved */
+		std::unique_ptr<arena_t> _arena{std::make_unique<arena_t>()};
+
+		/* Find the fragment holding the byte at `idx`, which must be in the chain */
+		[[nodiscard]]
+		std::size_t fragment_of(const std::size_t idx) const noexcept {
+			const auto next{std::upper_bound(_starts.begin(), _starts.end(), idx)};
+			return static_cast<std::size_t>(std::distance(_starts.begin(), next)) - 1zu;
+		}
+
+		/* Copy the bytes from `idx` onwards into `dst`, the range must be in the chain */
+		PANKO_CLS_API void copy_out(std::size_t idx, std::span<byte_t> dst) const noexcept;
+
+		/* Stitch the `len` bytes at `idx` together in the arena, the range must be in the chain */
+		[[nodiscard]]
+		PANKO_CLS_API std::span<byte_t> stitch(std::size_t idx, std::size_t len);
+
+		/* Call `on_part` with each piece of the `len` bytes at `idx` in turn, as spans into the fragments */
+		template<typename F>
+		void for_each_part(const std::size_t idx, const std::size_t len, F&& on_part) const {
+			if (idx > _length || (_length - idx) < len) {
+				throw std::out_of_range("bytearray chain access out of range");
+			}
+			if (len == 0zu) {
+				return;
+			}
+
+			auto frag{fragment_of(idx)};
+			auto local{idx - _starts[frag]};
+			for (std::size_t done{}; done < len; ++frag, local = 0zu) {
+				const auto& fragment{*_fragments[frag]};
+				const auto count{std::min(fragment.length() - local, len - done)};
+				on_part(std::span<const byte_t>{fragment.data() + local, count});
+				done += count;
+			}
+		}
+	public:
+		bytearray_chain_t() = default;
+
+		bytearray_chain_t(const bytearray_chain_t&) = delete;
+		bytearray_chain_t& operator=(const bytearray_chain_t&) = delete;
+
+		bytearray_chain_t(bytearray_chain_t&&) noexcept = default;
+		bytearray_chain_t& operator=(bytearray_chain_t&&) noexcept = default;
+
+		~bytearray_chain_t() noexcept = default;
+
+		/* == Building the chain == */
+
+		/*! \brief Add a fragment onto the end of the chain.
+
+			The chain holds a slice of `fragment`, so no data is copied. Empty fragments are skipped.
+
+			\param fragment The fragment to append.
+		*/
+		PANKO_CLS_API void append(bytearray_t& fragment);
+
+		/* == Chain Properties == */
+
+		/*! \brief Returns the total length of all the fragments in bytes */
+		[[nodiscard]]
+		std::size_t length() const noexcept {
+			return _length;
+		}
+
+		/*! \brief Returns the number of fragments in the chain */
+		[[nodiscard]]
+		std::size_t fragments() const noexcept {
+			return _fragments.size();
+		}
+
+		/*! \brief Returns the fragment at `idx`
+
+			\param idx The index of the fragment, not a byte offset.
+		*/
+		[[nodiscard]]
+		bytearray_t& fragment(const std::size_t idx) {
+			return *_fragments.at(idx);
+		}
+
+		[[nodiscard]]
+		bool valid() const noexcept {
+			return _length != 0zu;
+		}
+
+		/*! \brief Returns the arena that stitched data and decoded strings are allocated from.
+
+			\warning Resetting the arena invalidates any strings or `contiguous` spans obtained from the chain.
+		*/
+		[[nodiscard]]
+		arena_t& arena() noexcept {
+			return *_arena;
+		}
+
+		/* == Chain Slicing == */
+
+		/*! \brief Obtain a sub-chain of this `bytearray_chain_t`.
+
+			Like `bytearray_t::slice`, `end` is the index of the last byte in the slice. The fragments of the
+			new chain are slices of the fragments of this one, so no data is copied.
+
+			\param start The index into the chain to start the slice.
+			\param end The index into the chain to end the slice.
+			\throws std::out_of_range If the slice is not in the chain.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API bytearray_chain_t slice(std::size_t start, std::size_t end);
+
+		/*! \brief Get the `len` bytes at `idx` as one contiguous span.
+
+			If the range falls inside one fragment, this is a view directly into it, otherwise the bytes are
+			copied into the arena of the chain.
+
+			\param idx The index into the chain of the first byte.
+			\param len The number of bytes.
+			\throws std::out_of_range If the range is not in the chain.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::span<const byte_t> contiguous(std::size_t idx, std::size_t len);
+
+		/* == Raw integer type access == */
+
+		/*! \brief Extract an element at the given offset into the chain with the specified endian.
+
+			\see bytearray_t::at
+
+			\tparam T The type to extract.
+			\tparam endian The endian of the type to extract.
+			\param idx The offset into the chain to begin the extraction.
+			\throws std::out_of_range If the element is not in the chain.
+		*/
+		template<typename T, std::endian endian>
+		[[nodiscard]]
+		T at(const std::size_t idx) const {
+			constexpr auto type_size{wire_size_v<T>};
+
+			if (idx > _length || (_length - idx) < type_size) {
+				throw std::out_of_range("bytearray chain access out of range");
+			}
+
+			const auto frag{fragment_of(idx)};
+			const auto local{idx - _starts[frag]};
+			const auto& fragment{*_fragments[frag]};
+			if ((fragment.length() - local) >= type_size) {
+				return load<T, endian>(fragment.data() + local);
+			}
+
+			std::array<byte_t, type_size> stitched{};
+			copy_out(idx, stitched);
+			return load<T, endian>(stitched.data());
+		}
+
+		/*! \brief Extract the next element of the specified type from the chain.
+
+			\see bytearray_t::next
+
+			\tparam T The type to extract.
+			\tparam endian The endian of the type to extract.
+		*/
+		template<typename T, std::endian endian>
+		[[nodiscard]]
+		T next() {
+			auto res{at<T, endian>(_index_offset)};
+
+			_index_offset += wire_size_v<T>;
+
+			return res;
+		}
+
+		/* == String Helpers == */
+
+		/*! \brief Decode a string from the chain with any of the `bytearray_t::string_*` methods.
+
+			The string is first decoded from the fragment it starts in. Only if it runs off the end of that
+			fragment are the bytes from there on stitched together, growing the stitched window until the
+			string fits or the chain runs out.
+
+			\code{.cc}
+			const auto host{chain.string<&bytearray_t::string_ascii_lp16>(12zu, std::endian::big)};
+			\endcode
+
+			\note Strings that are not views into a fragment are allocated from the arena of the chain.
+
+			\note Default arguments can't be passed through a member pointer, so every argument after `idx` must
+			be given, such as the `max_len` of the `_zt` methods.
+
+			\tparam method The `bytearray_t` string method to decode with.
+			\param idx The offset into the chain of the string.
+			\param args Any other arguments to `method`, such as the length or endian.
+		*/
+		template<auto method, typename... Args>
+		[[nodiscard]]
+		auto string(const std::size_t idx, Args&&... args) {
+			using result_t = std::invoke_result_t<decltype(method), bytearray_t&, std::size_t, Args...>;
+
+			if (idx >= _length) {
+				return result_t{std::unexpect, strdec_error_t::Overrun};
+			}
+
+			const auto frag{fragment_of(idx)};
+			const auto local{idx - _starts[frag]};
+			auto res{std::invoke(method, *_fragments[frag], local, args...)};
+			if (res || res.error() != strdec_error_t::Overrun || frag == (_fragments.size() - 1zu)) {
+				return res;
+			}
+
+			/* Start with a window of the rest of this fragment and all of the next, and double it from there */
+			const auto remaining{_length - idx};
+			auto window{std::min(remaining, (_starts[frag + 1zu] - idx) + _fragments[frag + 1zu]->length())};
+			while (true) {
+				const auto stitched{stitch(idx, window)};
+				bytearray_t view{stitched.data(), stitched.size()};
+				view.use_arena(*_arena);
+
+				res = std::invoke(method, view, 0zu, args...);
+				if (res || res.error() != strdec_error_t::Overrun || window == remaining) {
+					return res;
+				}
+				window = std::min(remaining, window * 2zu);
+			}
+		}
+
+		/* == Checksum Helpers == */
+
+		/*! \brief Compute the Internet checksum over `len` bytes starting at `idx`.
+
+			Each fragment is summed in place, the sums of fragments that start at an odd offset into the range
+			are byte swapped to line them back up before they are added together.
+
+			\see bytearray_t::checksum_inet
+			\throws std::out_of_range If the range is not in the chain.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::uint16_t checksum_inet(std::size_t idx, std::size_t len, std::uint16_t initial = 0U) const;
+
+		/*! \brief Compute the CRC-32 over `len` bytes starting at `idx`.
+
+			\see bytearray_t::checksum_crc32
+			\throws std::out_of_range If the range is not in the chain.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::uint32_t checksum_crc32(std::size_t idx, std::size_t len, std::uint32_t crc = 0U) const;
+
+		/*! \brief Compute the CRC-32C over `len` bytes starting at `idx`.
+
+			\see bytearray_t::checksum_crc32c
+			\throws std::out_of_range If the range is not in the chain.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::uint32_t checksum_crc32c(std::size_t idx, std::size_t len, std::uint32_t crc = 0U) const;
+
+		/*! \brief Compute a CRC-16 over `len` bytes starting at `idx`.
+
+			\see bytearray_t::checksum_crc16
+			\throws std::out_of_range If the range is not in the chain.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::uint16_t checksum_crc16(std::size_t idx, std::size_t len, checksum::crc16_t variant) const;
+
+		/*! \brief Compute the Adler-32 checksum over `len` bytes starting at `idx`.
+
+			\see bytearray_t::checksum_adler32
+			\throws std::out_of_range If the range is not in the chain.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::uint32_t checksum_adler32(std::size_t idx, std::size_t len, std::uint32_t adler = 1U) const;
+
+		/*! \brief Compute the 8-bit Fletcher checksum over `len` bytes starting at `idx`.
+
+			\see bytearray_t::checksum_fletcher16
+			\throws std::out_of_range If the range is not in the chain.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::uint16_t checksum_fletcher16(std::size_t idx, std::size_t len, std::uint16_t fletcher = 0U) const;
+	};
+}
+
+#endif /* PANKO_CORE_BYTEARRAY_CHAIN_HH */
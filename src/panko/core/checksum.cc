@@ -0,0 +1,552 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* checksum.cc - Checksums and CRCs for verifying packet integrity */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "panko/internal/defs.hh"
+#include "panko/internal/cpu.hh"
+#include "panko/core/checksum.hh"
+#include "panko/core/endian.hh"
+
+#if defined(PANKO_ARCH_X86_64)
+#	include <immintrin.h>
+#elif defined(PANKO_ARCH_AARCH64)
+#	include <arm_acle.h>
+#	include <arm_neon.h>
+#endif
+
+namespace Panko::core::checksum {
+	namespace {
+		/* == Internet checksum == */
+
+		/*
+			The one's complement sum doesn't care about byte order, as long as the words are all summed in the
+			same order and the result is swapped at the end, see RFC 1071 section 2. So the kernels all sum native
+			endian words, and return the unfolded sum.
+
+			The vector kernels sum 16-bit words into 32-bit lanes, which can take 0x8000 blocks before they may
+			overflow, at which point they are spilled into the 64-bit total.
+		*/
+
+		constexpr std::size_t inet_max_blocks{0x8000zu};
+
+		[[nodiscard]]
+		std::uint64_t inet_sum_scalar(const std::uint8_t* const data, const std::size_t len) noexcept {
+			std::uint64_t sum{};
+			std::size_t idx{};
+
+			/* 32-bit words are congruent to the sum of their 16-bit halves modulo 0xFFFF */
+			for (; (len - idx) >= 4zu; idx += 4zu) {
+				std::uint32_t word{};
+				std::memcpy(&word, data + idx, sizeof(word));
+				sum += word;
+			}
+
+			for (; (len - idx) >= 2zu; idx += 2zu) {
+				std::uint16_t word{};
+				std::memcpy(&word, data + idx, sizeof(word));
+				sum += word;
+			}
+
+			/* An odd trailing byte is the first byte of a word padded with zero */
+			if (idx < len) {
+				std::array<std::uint8_t, 2> pad{{data[idx], 0U}};
+				std::uint16_t word{};
+				std::memcpy(&word, pad.data(), sizeof(word));
+				sum += word;
+			}
+
+			return sum;
+		}
+
+		[[nodiscard]]
+		constexpr std::uint16_t inet_fold(std::uint64_t sum) noexcept {
+			sum = (sum & 0xFFFF'FFFFU) + (sum >> 32U);
+			sum = (sum & 0xFFFF'FFFFU) + (sum >> 32U);
+			sum = (sum & 0xFFFFU) + (sum >> 16U);
+			sum = (sum & 0xFFFFU) + (sum >> 16U);
+			return static_cast<std::uint16_t>(sum);
+		}
+
+		/* == CRC-32 == */
+
+		/* x^n mod P, for a degree 32 polynomial `poly` given with its x^32 term */
+		[[nodiscard]]
+		constexpr std::uint64_t xpow_mod(const std::size_t n, const std::uint64_t poly) noexcept {
+			std::uint64_t rem{1U};
+			for (std::size_t idx{}; idx < n; ++idx) {
+				rem <<= 1U;
+				if ((rem & (1ULL << 32U)) != 0U) {
+					rem ^= poly;
+				}
+			}
+			return rem;
+		}
+
+		/* x^n / P, for a degree 32 polynomial `poly` given with its x^32 term */
+		[[nodiscard]]
+		constexpr std::uint64_t xpow_div(const std::size_t n, const std::uint64_t poly) noexcept {
+			std::uint64_t quotient{};
+			std::uint64_t rem{1U};
+			for (std::size_t idx{}; idx < n; ++idx) {
+				rem <<= 1U;
+				quotient <<= 1U;
+				if ((rem & (1ULL << 32U)) != 0U) {
+					rem ^= poly;
+					quotient |= 1U;
+				}
+			}
+			return quotient;
+		}
+
+		/* Bit reverse the low 33 bits of `value` */
+		[[nodiscard]]
+		constexpr std::uint64_t reflect33(const std::uint64_t value) noexcept {
+			std::uint64_t res{};
+			for (std::size_t bit{}; bit < 33zu; ++bit) {
+				if ((value & (1ULL << bit)) != 0U) {
+					res |= 1ULL << (32zu - bit);
+				}
+			}
+			return res;
+		}
+
+		/*
+			The constants for folding with carry-less multiplication, from Gopal et al. "Fast CRC Computation for
+			Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009). Everything is bit reflected as the
+			CRCs are, so they are shifted up by one to line up with the 64-bit halves of a 128-bit lane.
+		*/
+		struct fold_constants_t final {
+			/* Folding 4 lanes across 512 bits */
+			std::uint64_t k1;
+			std::uint64_t k2;
+			/* Folding 1 lane across 128 bits */
+			std::uint64_t k3;
+			std::uint64_t k4;
+			/* Folding from 96 to 64 bits */
+			std::uint64_t k5;
+			/* The Barrett reduction from 64 to 32 bits */
+			std::uint64_t poly;
+			std::uint64_t mu;
+		};
+
+		struct crc32_params_t final {
+			std::array<std::array<std::uint32_t, 256>, 8> tables;
+			fold_constants_t fold;
+		};
+
+		/* `poly` is the normal, not reflected, form without the x^32 term */
+		[[nodiscard]]
+		constexpr crc32_params_t make_crc32_params(const std::uint32_t poly) noexcept {
+			const auto full{(1ULL << 32U) | poly};
+			const auto reflected{static_cast<std::uint32_t>(reflect33(full) >> 1U)};
+
+			crc32_params_t params{};
+			/* Slicing-by-8, table `n` advances a byte through `n` more zero bytes */
+			for (std::uint32_t byte{}; byte < 256U; ++byte) {
+				auto crc{byte};
+				for (std::size_t bit{}; bit < 8zu; ++bit) {
+					crc = ((crc & 1U) != 0U) ? (crc >> 1U) ^ reflected : crc >> 1U;
+				}
+				params.tables[0][byte] = crc;
+			}
+			for (std::size_t byte{}; byte < 256zu; ++byte) {
+				auto crc{params.tables[0][byte]};
+				for (std::size_t table{1zu}; table < 8zu; ++table) {
+					crc = params.tables[0][crc & 0xFFU] ^ (crc >> 8U);
+					params.tables[table][byte] = crc;
+				}
+			}
+
+			params.fold = fold_constants_t{
+				reflect33(xpow_mod((4zu * 128zu) + 32zu, full)),
+				reflect33(xpow_mod((4zu * 128zu) - 32zu, full)),
+				reflect33(xpow_mod(128zu + 32zu, full)),
+				reflect33(xpow_mod(128zu - 32zu, full)),
+				reflect33(xpow_mod(64zu, full)),
+				reflect33(full),
+				reflect33(xpow_div(64zu, full)),
+			};
+			return params;
+		}
+
+		constexpr auto crc32_ieee{make_crc32_params(0x04C1'1DB7U)};
+		constexpr auto crc32_castagnoli{make_crc32_params(0x1EDC'6F41U)};
+
+		/* The published constants for CRC-32, to make sure the generated ones are right */
+		static_assert(crc32_ieee.fold.k1 == 0x1'5444'2BD4U && crc32_ieee.fold.k2 == 0x1'C6E4'1596U);
+		static_assert(crc32_ieee.fold.k3 == 0x1'7519'97D0U && crc32_ieee.fold.k4 == 0x0'CCAA'009EU);
+		static_assert(crc32_ieee.fold.k5 == 0x1'63CD'6124U);
+		static_assert(crc32_ieee.fold.poly == 0x1'DB71'0641U && crc32_ieee.fold.mu == 0x1'F701'1641U);
+
+		/* `crc` here and in all of the kernels is the raw register, without the pre and post inversion */
+		template<const crc32_params_t& params>
+		[[nodiscard]]
+		std::uint32_t crc32_slice8(std::uint32_t crc, const std::byte* const data, const std::size_t len) noexcept {
+			const auto& tables{params.tables};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto low{load<std::uint32_t, std::endian::little>(data + idx) ^ crc};
+				const auto high{load<std::uint32_t, std::endian::little>(data + idx + 4zu)};
+				crc =
+					tables[7][low & 0xFFU] ^ tables[6][(low >> 8U) & 0xFFU] ^
+					tables[5][(low >> 16U) & 0xFFU] ^ tables[4][low >> 24U] ^
+					tables[3][high & 0xFFU] ^ tables[2][(high >> 8U) & 0xFFU] ^
+					tables[1][(high >> 16U) & 0xFFU] ^ tables[0][high >> 24U];
+			}
+
+			for (; idx < len; ++idx) {
+				crc = tables[0][(crc ^ std::to_integer<std::uint32_t>(data[idx])) & 0xFFU] ^ (crc >> 8U);
+			}
+			return crc;
+		}
+
+#if defined(PANKO_ARCH_X86_64)
+		/* SSE2 is part of the x86-64 baseline, so this needs no dispatch */
+		[[nodiscard]]
+		std::uint64_t inet_sum_sse2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto zero{_mm_setzero_si128()};
+			std::uint64_t sum{};
+			std::size_t idx{};
+
+			while ((len - idx) >= 16zu) {
+				const auto blocks{std::min((len - idx) / 16zu, inet_max_blocks)};
+				auto acc{_mm_setzero_si128()};
+				for (std::size_t block{}; block < blocks; ++block, idx += 16zu) {
+					const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + idx))};
+					acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(input, zero));
+					acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(input, zero));
+				}
+
+				std::array<std::uint32_t, 4> lanes{};
+				_mm_storeu_si128(reinterpret_cast<__m128i_u*>(lanes.data()), acc);
+				for (const auto lane : lanes) {
+					sum += lane;
+				}
+			}
+
+			return sum + inet_sum_scalar(data + idx, len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::uint64_t inet_sum_avx2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto zero{_mm256_setzero_si256()};
+			std::uint64_t sum{};
+			std::size_t idx{};
+
+			while ((len - idx) >= 32zu) {
+				const auto blocks{std::min((len - idx) / 32zu, inet_max_blocks)};
+				auto acc{_mm256_setzero_si256()};
+				for (std::size_t block{}; block < blocks; ++block, idx += 32zu) {
+					const auto input{_mm256_loadu_si256(reinterpret_cast<const __m256i_u*>(data + idx))};
+					acc = _mm256_add_epi32(acc, _mm256_unpacklo_epi16(input, zero));
+					acc = _mm256_add_epi32(acc, _mm256_unpackhi_epi16(input, zero));
+				}
+
+				std::array<std::uint32_t, 8> lanes{};
+				_mm256_storeu_si256(reinterpret_cast<__m256i_u*>(lanes.data()), acc);
+				for (const auto lane : lanes) {
+					sum += lane;
+				}
+			}
+
+			return sum + inet_sum_sse2(data + idx, len - idx);
+		}
+
+		PANKO_TARGET("pclmul,sse4.1")
+		[[nodiscard]]
+		inline __m128i clmul_load(const std::byte* const ptr) noexcept {
+			return _mm_loadu_si128(reinterpret_cast<const __m128i_u*>(ptr));
+		}
+
+		PANKO_TARGET("pclmul,sse4.1")
+		[[nodiscard]]
+		inline __m128i clmul_pair(const std::uint64_t low, const std::uint64_t high) noexcept {
+			return _mm_set_epi64x(std::bit_cast<long long>(high), std::bit_cast<long long>(low));
+		}
+
+		/* Fold `acc` forward over the distance `k` was made for, and add in `next` */
+		PANKO_TARGET("pclmul,sse4.1")
+		[[nodiscard]]
+		inline __m128i clmul_fold(const __m128i acc, const __m128i k, const __m128i next) noexcept {
+			return _mm_xor_si128(
+				_mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x11), _mm_clmulepi64_si128(acc, k, 0x00)), next
+			);
+		}
+
+		/*
+			Fold 64 byte blocks with carry-less multiplication, then reduce to 32 bits with a Barrett reduction,
+			as in the paper. `len` must be at least 64 and a multiple of 16.
+		*/
+		template<const crc32_params_t& params>
+		PANKO_TARGET("pclmul,sse4.1")
+		[[nodiscard]]
+		std::uint32_t crc32_fold_pclmul(const std::uint32_t crc, const std::byte* data, std::size_t len) noexcept {
+			constexpr auto& fold{params.fold};
+
+			auto x1{_mm_xor_si128(clmul_load(data), _mm_cvtsi32_si128(std::bit_cast<int>(crc)))};
+			auto x2{clmul_load(data + 16zu)};
+			auto x3{clmul_load(data + 32zu)};
+			auto x4{clmul_load(data + 48zu)};
+			data += 64zu;
+			len -= 64zu;
+
+			auto k{clmul_pair(fold.k1, fold.k2)};
+			for (; len >= 64zu; data += 64zu, len -= 64zu) {
+				x1 = clmul_fold(x1, k, clmul_load(data));
+				x2 = clmul_fold(x2, k, clmul_load(data + 16zu));
+				x3 = clmul_fold(x3, k, clmul_load(data + 32zu));
+				x4 = clmul_fold(x4, k, clmul_load(data + 48zu));
+			}
+
+			/* Fold the 4 lanes, and then any remaining 16 byte blocks, into one */
+			k = clmul_pair(fold.k3, fold.k4);
+			x1 = clmul_fold(x1, k, x2);
+			x1 = clmul_fold(x1, k, x3);
+			x1 = clmul_fold(x1, k, x4);
+			for (; len >= 16zu; data += 16zu, len -= 16zu) {
+				x1 = clmul_fold(x1, k, clmul_load(data));
+			}
+
+			/* 128 bits to 64 bits */
+			const auto low32{_mm_setr_epi32(-1, 0, -1, 0)};
+			x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), _mm_clmulepi64_si128(x1, k, 0x10));
+			x1 = _mm_xor_si128(
+				_mm_clmulepi64_si128(_mm_and_si128(x1, low32), clmul_pair(fold.k5, 0U), 0x00), _mm_srli_si128(x1, 4)
+			);
+
+			/* Barrett reduction down to 32 bits */
+			k = clmul_pair(fold.poly, fold.mu);
+			auto reduced{_mm_clmulepi64_si128(_mm_and_si128(x1, low32), k, 0x10)};
+			reduced = _mm_clmulepi64_si128(_mm_and_si128(reduced, low32), k, 0x00);
+			x1 = _mm_xor_si128(x1, reduced);
+
+			return std::bit_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+		}
+
+		template<const crc32_params_t& params>
+		PANKO_TARGET("pclmul,sse4.1")
+		[[nodiscard]]
+		std::uint32_t crc32_pclmul(std::uint32_t crc, const std::byte* const data, const std::size_t len) noexcept {
+			if (len < 64zu) {
+				return crc32_slice8<params>(crc, data, len);
+			}
+
+			const auto folded{len & ~15zu};
+			crc = crc32_fold_pclmul<params>(crc, data, folded);
+			return crc32_slice8<params>(crc, data + folded, len - folded);
+		}
+#elif defined(PANKO_ARCH_AARCH64)
+		[[nodiscard]]
+		std::uint64_t inet_sum_neon(const std::uint8_t* const data, const std::size_t len) noexcept {
+			std::uint64_t sum{};
+			std::size_t idx{};
+
+			while ((len - idx) >= 16zu) {
+				const auto blocks{std::min((len - idx) / 16zu, inet_max_blocks)};
+				auto acc{vdupq_n_u32(0U)};
+				for (std::size_t block{}; block < blocks; ++block, idx += 16zu) {
+					/* Pairwise add each pair of 16-bit words into the 32-bit lanes */
+					acc = vpadalq_u16(acc, vreinterpretq_u16_u8(vld1q_u8(data + idx)));
+				}
+				sum += vaddlvq_u32(acc);
+			}
+
+			return sum + inet_sum_scalar(data + idx, len - idx);
+		}
+
+		template<bool castagnoli>
+		PANKO_TARGET("arch=armv8-a+crc")
+		[[nodiscard]]
+		std::uint32_t crc32_armv8(std::uint32_t crc, const std::byte* const data, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto word{load<std::uint64_t, std::endian::little>(data + idx)};
+				crc = castagnoli ? __crc32cd(crc, word) : __crc32d(crc, word);
+			}
+
+			for (; idx < len; ++idx) {
+				const auto byte{std::to_integer<std::uint8_t>(data[idx])};
+				crc = castagnoli ? __crc32cb(crc, byte) : __crc32b(crc, byte);
+			}
+			return crc;
+		}
+#endif
+
+		using crc32_kernel_t = std::uint32_t (*)(std::uint32_t, const std::byte*, std::size_t) noexcept;
+
+		template<const crc32_params_t& params, bool castagnoli>
+		[[nodiscard]]
+		crc32_kernel_t select_crc32() noexcept {
+			const auto& feat{Panko::internal::cpu::features()};
+#if defined(PANKO_ARCH_X86_64)
+			if (feat.pclmul && feat.sse42) {
+				return crc32_pclmul<params>;
+			}
+#elif defined(PANKO_ARCH_AARCH64)
+			if (feat.arm_crc32) {
+				return crc32_armv8<castagnoli>;
+			}
+#endif
+			static_cast<void>(feat);
+			return crc32_slice8<params>;
+		}
+
+		/* == CRC-16 == */
+
+		struct crc16_params_t final {
+			std::array<std::uint16_t, 256> table;
+			std::uint16_t init;
+			std::uint16_t xorout;
+			bool reflected;
+		};
+
+		/* `poly` is the normal, not reflected, form without the x^16 term */
+		[[nodiscard]]
+		constexpr crc16_params_t make_crc16_params(
+			const std::uint16_t poly, const std::uint16_t init, const bool reflected, const std::uint16_t xorout
+		) noexcept {
+			crc16_params_t params{{}, init, xorout, reflected};
+
+			const auto reflected_poly{static_cast<std::uint16_t>(reflect33(std::uint64_t{poly} << 17U))};
+			for (std::uint32_t byte{}; byte < 256U; ++byte) {
+				if (reflected) {
+					auto crc{byte};
+					for (std::size_t bit{}; bit < 8zu; ++bit) {
+						crc = ((crc & 1U) != 0U) ? (crc >> 1U) ^ reflected_poly : crc >> 1U;
+					}
+					params.table[byte] = static_cast<std::uint16_t>(crc);
+				} else {
+					auto crc{byte << 8U};
+					for (std::size_t bit{}; bit < 8zu; ++bit) {
+						crc = ((crc & 0x8000U) != 0U) ? (crc << 1U) ^ poly : crc << 1U;
+					}
+					params.table[byte] = static_cast<std::uint16_t>(crc);
+				}
+			}
+			return params;
+		}
+
+		/* In the same order as `crc16_t` */
+		constexpr std::array<crc16_params_t, 6> crc16_variants{{
+			make_crc16_params(0x8005U, 0x0000U, true, 0x0000U),
+			make_crc16_params(0x1021U, 0xFFFFU, false, 0x0000U),
+			make_crc16_params(0x1021U, 0x0000U, true, 0x0000U),
+			make_crc16_params(0x8005U, 0xFFFFU, true, 0x0000U),
+			make_crc16_params(0x1021U, 0xFFFFU, true, 0xFFFFU),
+			make_crc16_params(0x1021U, 0x0000U, false, 0x0000U),
+		}};
+
+		[[nodiscard]]
+		std::uint16_t crc16_update(
+			const crc16_params_t& params, std::uint16_t crc, const std::span<const std::byte> data
+		) noexcept {
+			const auto& table{params.table};
+			if (params.reflected) {
+				for (const auto byte : data) {
+					crc = static_cast<std::uint16_t>(
+						(crc >> 8U) ^ table[(crc ^ std::to_integer<std::uint16_t>(byte)) & 0xFFU]
+					);
+				}
+			} else {
+				for (const auto byte : data) {
+					crc = static_cast<std::uint16_t>(
+						(crc << 8U) ^ table[((crc >> 8U) ^ std::to_integer<std::uint16_t>(byte)) & 0xFFU]
+					);
+				}
+			}
+			return static_cast<std::uint16_t>(crc ^ params.xorout);
+		}
+
+		/* == Adler-32 and Fletcher-16 == */
+
+		constexpr std::uint32_t adler_mod{65521U};
+		/* The most bytes that can be summed before the second sum may overflow 32 bits, from zlib */
+		constexpr std::size_t adler_max_run{5552zu};
+		/* Likewise for the Fletcher sums modulo 255, rounded down from 5802 */
+		constexpr std::size_t fletcher_max_run{4096zu};
+	}
+
+	std::uint16_t inet_sum(const std::span<const std::byte> data, const std::uint16_t initial) noexcept {
+		static const auto impl{PANKO_SELECT_KERNEL(inet_sum)};
+
+		auto native_initial{initial};
+		if constexpr (std::endian::native == std::endian::little) {
+			native_initial = std::byteswap(initial);
+		}
+
+		const auto sum{inet_fold(
+			impl(reinterpret_cast<const std::uint8_t*>(data.data()), data.size()) + native_initial
+		)};
+		if constexpr (std::endian::native == std::endian::little) {
+			return std::byteswap(sum);
+		} else {
+			return sum;
+		}
+	}
+
+	std::uint32_t crc32(const std::span<const std::byte> data, const std::uint32_t crc) noexcept {
+		static const auto impl{select_crc32<crc32_ieee, false>()};
+		return ~impl(~crc, data.data(), data.size());
+	}
+
+	std::uint32_t crc32c(const std::span<const std::byte> data, const std::uint32_t crc) noexcept {
+		static const auto impl{select_crc32<crc32_castagnoli, true>()};
+		return ~impl(~crc, data.data(), data.size());
+	}
+
+	std::uint16_t crc16(const std::span<const std::byte> data, const crc16_t variant) noexcept {
+		const auto& params{crc16_variants[static_cast<std::size_t>(variant)]};
+		return crc16_update(params, params.init, data);
+	}
+
+	std::uint16_t crc16(const std::span<const std::byte> data, const crc16_t variant, const std::uint16_t crc) noexcept {
+		const auto& params{crc16_variants[static_cast<std::size_t>(variant)]};
+		return crc16_update(params, static_cast<std::uint16_t>(crc ^ params.xorout), data);
+	}
+
+	std::uint32_t adler32(std::span<const std::byte> data, const std::uint32_t adler) noexcept {
+		auto low{adler & 0xFFFFU};
+		auto high{adler >> 16U};
+
+		while (!data.empty()) {
+			const auto run{data.first(std::min(data.size(), adler_max_run))};
+			for (const auto byte : run) {
+				low += std::to_integer<std::uint32_t>(byte);
+				high += low;
+			}
+			low %= adler_mod;
+			high %= adler_mod;
+			data = data.subspan(run.size());
+		}
+
+		return (high << 16U) | low;
+	}
+
+	std::uint16_t fletcher16(std::span<const std::byte> data, const std::uint16_t fletcher) noexcept {
+		std::uint32_t low{fletcher & 0xFFU};
+		std::uint32_t high{static_cast<std::uint32_t>(fletcher >> 8U)};
+
+		while (!data.empty()) {
+			const auto run{data.first(std::min(data.size(), fletcher_max_run))};
+			for (const auto byte : run) {
+				low += std::to_integer<std::uint32_t>(byte);
+				high += low;
+			}
+			low %= 255U;
+			high %= 255U;
+			data = data.subspan(run.size());
+		}
+
+		return static_cast<std::uint16_t>((high << 8U) | low);
+	}
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* checksum.hh - Checksums and CRCs for verifying packet integrity */
+#pragma once
+#if !defined(PANKO_CORE_CHECKSUM_HH)
+#define PANKO_CORE_CHECKSUM_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "panko/internal/defs.hh"
+
+namespace Panko::core::checksum {
+	/*! \brief The CRC-16 variants `crc16` can compute
+
+		The names are those of the Catalogue of parametrised CRC algorithms.
+	*/
+	enum struct crc16_t : std::uint8_t {
+		/*! CRC-16/ARC, the IBM CRC-16 used by LHA and many others */
+		Arc,
+		/*! CRC-16/IBM-3740, often called CRC-16/CCITT-FALSE */
+		CcittFalse,
+		/*! CRC-16/KERMIT, the CCITT CRC as used by Bluetooth and Kermit */
+		Kermit,
+		/*! CRC-16/MODBUS, the Modbus RTU frame check */
+		Modbus,
+		/*! CRC-16/IBM-SDLC, the X.25, HDLC, and PPP frame check sequence */
+		X25,
+		/*! CRC-16/XMODEM, as used by XMODEM and ZMODEM */
+		XModem,
+	};
+
+	/*! \brief Compute the one's complement sum of `data` as 16-bit big-endian words, as per RFC 1071.
+
+		The sum can be continued over more data by passing it back in as `initial`, as long as the data it was
+		over was an even number of bytes long. This is how a pseudo-header is included in a TCP or UDP checksum.
+
+		The implementation is vectorized where possible (AVX2, SSE2, or NEON), and selected at runtime.
+
+		\param data The data to sum, if it is an odd length it is padded with a zero byte.
+		\param initial The sum of any preceding data.
+		\returns The folded 16-bit sum.
+	*/
+	[[nodiscard]]
+	PANKO_API std::uint16_t inet_sum(std::span<const std::byte> data, std::uint16_t initial = 0U) noexcept;
+
+	/*! \brief Add two one's complement sums together */
+	[[nodiscard]]
+	constexpr std::uint16_t inet_add(const std::uint16_t lhs, const std::uint16_t rhs) noexcept {
+		const auto sum{std::uint32_t{lhs} + std::uint32_t{rhs}};
+		return static_cast<std::uint16_t>((sum & 0xFFFFU) + (sum >> 16U));
+	}
+
+	/*! \brief Compute the Internet checksum of `data`, used by IPv4, ICMP, TCP, and UDP.
+
+		Summing over data that includes a correct checksum gives 0, so that is how it is verified.
+
+		\see inet_sum
+		\returns The checksum, as it would be read from the packet in network byte order.
+	*/
+	[[nodiscard]]
+	inline std::uint16_t inet_checksum(const std::span<const std::byte> data, const std::uint16_t initial = 0U) noexcept {
+		return static_cast<std::uint16_t>(~inet_sum(data, initial));
+	}
+
+	/*! \brief Compute the CRC-32 of `data`, as used by the Ethernet FCS, zlib, and PNG.
+
+		The CRC can be continued over more data by passing the result back in as `crc`.
+
+		The implementation uses carry-less multiplication (PCLMULQDQ) or the ARMv8 CRC instructions where
+		possible, and slicing-by-8 tables otherwise.
+
+		\param data The data to checksum.
+		\param crc The CRC of any preceding data.
+	*/
+	[[nodiscard]]
+	PANKO_API std::uint32_t crc32(std::span<const std::byte> data, std::uint32_t crc = 0U) noexcept;
+
+	/*! \brief Compute the CRC-32C (Castagnoli) of `data`, as used by SCTP and iSCSI.
+
+		\see crc32
+	*/
+	[[nodiscard]]
+	PANKO_API std::uint32_t crc32c(std::span<const std::byte> data, std::uint32_t crc = 0U) noexcept;
+
+	/*! \brief Compute a CRC-16 of `data`.
+
+		\param data The data to checksum.
+		\param variant Which of the CRC-16s to compute.
+	*/
+	[[nodiscard]]
+	PANKO_API std::uint16_t crc16(std::span<const std::byte> data, crc16_t variant) noexcept;
+
+	/*! \brief Continue a CRC-16 over more data.
+
+		\param data The data to checksum.
+		\param variant Which of the CRC-16s to compute.
+		\param crc The CRC of the preceding data.
+	*/
+	[[nodiscard]]
+	PANKO_API std::uint16_t crc16(std::span<const std::byte> data, crc16_t variant, std::uint16_t crc) noexcept;
+
+	/*! \brief Compute the Adler-32 checksum of `data`, as used by zlib.
+
+		\param data The data to checksum.
+		\param adler The checksum of any preceding data.
+	*/
+	[[nodiscard]]
+	PANKO_API std::uint32_t adler32(std::span<const std::byte> data, std::uint32_t adler = 1U) noexcept;
+
+	/*! \brief Compute the 8-bit Fletcher checksum of `data`, as used by OSPF and IS-IS.
+
+		The two running sums are returned as the high and low byte respectively, each reduced modulo 255 into
+		the range 0-254. Summing over data that includes a correct ISO 8473 checksum gives 0.
+
+		\param data The data to checksum.
+		\param fletcher The checksum of any preceding data.
+	*/
+	[[nodiscard]]
+	PANKO_API std::uint16_t fletcher16(std::span<const std::byte> data, std::uint16_t fletcher = 0U) noexcept;
+}
+
+#endif /* PANKO_CORE_CHECKSUM_HH */
@@ -0,0 +1,2092 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* decompress.cc - bytearray_t decompression helpers */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <utility>
+
+#define ZLIB_CONST
+#include <bzlib.h>
+#include <lz4frame.h>
+#include <lzma.h>
+#include <zlib.h>
+#include <zstd.h>
+
+#include "panko/config.hh"
+
+#if defined(PANKO_WITH_BROTLI)
+#	include <brotli/decode.h>
+#endif
+
+#if defined(PANKO_WITH_SNAPPY)
+#	include <snappy.h>
+#endif
+
+#include "panko/internal/defs.hh"
+#include "panko/core/arena.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/decompress.hh"
+#include "panko/core/errcodes.hh"
+#include "panko/core/units.hh"
+
+namespace Panko::core {
+	using Panko::core::error_codes::decomp_error_t;
+	using namespace Panko::core::units::IEC;
+
+	namespace {
+		/* Output buffers are handed out in power of two size classes, the classes from 4KiB to 16MiB are pooled */
+		constexpr std::size_t min_class_shift{12zu};
+		constexpr std::size_t max_class_shift{24zu};
+		constexpr std::size_t class_count{max_class_shift - min_class_shift + 1zu};
+		constexpr std::size_t pooled_per_class{4zu};
+
+		/* The largest any single decompressed buffer is allowed to grow */
+		constexpr std::size_t max_output{256_MiB};
+		/* The initial output size, relative to the input, when the format does not tell us */
+		constexpr std::size_t default_ratio{4zu};
+		/* The best ratio DEFLATE can achieve, used to keep sizes from untrusted headers sane */
+		constexpr std::size_t deflate_max_ratio{1032zu};
+		/* The best ratio LZ4 can achieve, each extra length byte of a match is worth 255 bytes of output */
+		constexpr std::size_t lz4_max_ratio{255zu};
+		/* Roughly the best ratio LZMA achieves, on a long run of a single byte */
+		constexpr std::size_t lzma_max_ratio{7168zu};
+		/* The best ratio zstd can achieve, an RLE block turns 4 bytes into up to 128KiB */
+		constexpr std::size_t zstd_max_ratio{32768zu};
+		/* The memory liblzma is allowed to use for the dictionary and such */
+		constexpr std::uint64_t lzma_memlimit{256_MiB};
+		/* The scratch memory the codecs without a memory limit of their own may use for a single call */
+		constexpr std::size_t scratch_limit{64_MiB};
+		/* Scratch memory past this is given back once the call is done, rather than kept for the next one */
+		constexpr std::size_t scratch_keep{8_MiB};
+
+		/* Set once the thread's buffer pool is gone, so late buffer releases go straight to `free` */
+		thread_local constinit bool buffer_pool_gone{false};
+
+		struct buffer_pool_t final {
+		private:
+			std::array<std::array<std::byte*, pooled_per_class>, class_count> _free{};
+			std::array<std::size_t, class_count> _count{};
+		public:
+			buffer_pool_t() noexcept = default;
+			buffer_pool_t(const buffer_pool_t&) = delete;
+			buffer_pool_t& operator=(const buffer_pool_t&) = delete;
+			buffer_pool_t(buffer_pool_t&&) = delete;
+			buffer_pool_t& operator=(buffer_pool_t&&) = delete;
+
+			~buffer_pool_t() noexcept {
+				buffer_pool_gone = true;
+				for (std::size_t size_class{}; size_class < class_count; ++size_class) {
+					for (std::size_t idx{}; idx < _count[size_class]; ++idx) {
+						std::free(_free[size_class][idx]);
+					}
+				}
+			}
+
+			[[nodiscard]]
+			std::byte* take(const std::size_t size_class) noexcept {
+				if (_count[size_class] == 0zu) {
+					return nullptr;
+				}
+				return _free[size_class][--_count[size_class]];
+			}
+
+			[[nodiscard]]
+			bool give(const std::size_t size_class, std::byte* const buff) noexcept {
+				if (_count[size_class] == pooled_per_class) {
+					return false;
+				}
+				_free[size_class][_count[size_class]++] = buff;
+				return true;
+			}
+		};
+
+		[[nodiscard]]
+		buffer_pool_t& buffer_pool() noexcept {
+			thread_local buffer_pool_t pool{};
+			return pool;
+		}
+
+		/* Returns the pool size class for a buffer of `capacity` bytes, or `class_count` if it is not pooled */
+		[[nodiscard]]
+		std::size_t size_class_of(const std::size_t capacity) noexcept {
+			const auto shift{static_cast<std::size_t>(std::countr_zero(capacity))};
+			if (shift > max_class_shift) {
+				return class_count;
+			}
+			return shift - min_class_shift;
+		}
+
+		/* Round `size` up to the capacity of the size class that can hold it */
+		[[nodiscard]]
+		std::size_t buffer_capacity(const std::size_t size) noexcept {
+			return std::bit_ceil(std::max(size, 1zu << min_class_shift));
+		}
+
+		[[nodiscard]]
+		std::byte* acquire_buffer(const std::size_t capacity) {
+			if (const auto size_class{size_class_of(capacity)}; size_class < class_count) {
+				if (auto* const buff{buffer_pool().take(size_class)}; buff != nullptr) {
+					return buff;
+				}
+			}
+
+			auto* const buff{static_cast<std::byte*>(std::malloc(capacity))};
+			if (buff == nullptr) {
+				throw std::bad_alloc{};
+			}
+			return buff;
+		}
+
+		/* This can be called from any thread, the buffer just ends up in the pool of whoever drops it last */
+		void release_buffer(std::byte* const buff, const std::size_t capacity) noexcept {
+			if (const auto size_class{size_class_of(capacity)}; size_class < class_count && !buffer_pool_gone) {
+				if (buffer_pool().give(size_class, buff)) {
+					return;
+				}
+			}
+			std::free(buff);
+		}
+
+		/* A growable output buffer backed by the size class pool */
+		struct output_t final {
+		private:
+			std::size_t _capacity;
+			std::byte* _data;
+			std::size_t _length{};
+		public:
+			/*! \param hint The expected decompressed size, the buffer starts at the size class that holds it. */
+			explicit output_t(const std::size_t hint) :
+				_capacity{buffer_capacity(std::min(hint, max_output))}, _data{acquire_buffer(_capacity)}
+			{ }
+
+			output_t(const output_t&) = delete;
+			output_t& operator=(const output_t&) = delete;
+			output_t(output_t&&) = delete;
+			output_t& operator=(output_t&&) = delete;
+
+			~output_t() noexcept {
+				if (_data != nullptr) {
+					release_buffer(_data, _capacity);
+				}
+			}
+
+			[[nodiscard]]
+			std::byte* tail() noexcept {
+				return _data + _length;
+			}
+
+			[[nodiscard]]
+			std::size_t room() const noexcept {
+				return _capacity - _length;
+			}
+
+			[[nodiscard]]
+			std::size_t length() const noexcept {
+				return _length;
+			}
+
+			void commit(const std::size_t len) noexcept {
+				_length += len;
+			}
+
+			/* Move up to the next size class, returns false if that would be over `max_output` */
+			[[nodiscard]]
+			bool grow() {
+				if (_capacity >= max_output) {
+					return false;
+				}
+
+				const auto capacity{_capacity * 2zu};
+				auto* const buff{acquire_buffer(capacity)};
+				std::memcpy(buff, _data, _length);
+				release_buffer(_data, _capacity);
+				_data = buff;
+				_capacity = capacity;
+				return true;
+			}
+
+			/* Make sure there are at least `len` bytes of room */
+			[[nodiscard]]
+			bool reserve(const std::size_t len) {
+				while (room() < len) {
+					if (!grow()) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			/* Make sure there is at least one byte of room */
+			[[nodiscard]]
+			bool ensure_room() {
+				return room() != 0zu || grow();
+			}
+
+			/* Hand the buffer over, it goes back into the pool when the last reference to it is dropped */
+			[[nodiscard]]
+			std::shared_ptr<std::byte> release() {
+				return {
+					std::exchange(_data, nullptr),
+					[capacity{_capacity}](std::byte* const buff) noexcept { release_buffer(buff, capacity); }
+				};
+			}
+		};
+
+		/* Scratch memory for the codecs that can't be reset, so a fresh one for each call is cheap.
+
+			Blocks are carved out of an arena in power of two size classes, and freed blocks go on a free list for
+			their class to be handed out again, so a codec that frees and reallocates as it goes, as brotli does
+			for every metablock, reuses the same memory rather than growing the arena. Past `scratch_limit` bytes
+			allocations fail, which the codecs report as running out of memory.
+		*/
+		struct scratch_t final {
+		private:
+			struct alignas(std::max_align_t) header_t final {
+				std::size_t size_class;
+				header_t* next;
+			};
+
+			constexpr static std::size_t min_class_shift{6zu};
+
+			arena_t _arena{64_KiB};
+			std::array<header_t*, std::numeric_limits<std::size_t>::digits> _free{};
+			std::size_t _used{};
+			bool _exhausted{false};
+		public:
+			[[nodiscard]]
+			void* allocate(const std::size_t size) noexcept {
+				if (size > scratch_limit) {
+					_exhausted = true;
+					return nullptr;
+				}
+				const auto size_class{std::max<std::size_t>(std::bit_width(size + sizeof(header_t) - 1zu), min_class_shift)};
+
+				auto*& head{_free[size_class]};
+				if (head != nullptr) {
+					auto* const block{std::exchange(head, head->next)};
+					return block + 1;
+				}
+
+				const auto bytes{1zu << size_class};
+				if (_used + bytes > scratch_limit) {
+					_exhausted = true;
+					return nullptr;
+				}
+				try {
+					auto* const block{new (_arena.allocate(bytes, alignof(header_t))) header_t{size_class, nullptr}};
+					_used += bytes;
+					return block + 1;
+				} catch (const std::bad_alloc&) {
+					return nullptr;
+				}
+			}
+
+			void free(void* const ptr) noexcept {
+				if (ptr == nullptr) {
+					return;
+				}
+				auto* const block{static_cast<header_t*>(ptr) - 1};
+				block->next = std::exchange(_free[block->size_class], block);
+			}
+
+			/* Whether an allocation failed for going over `scratch_limit`, rather than there being no memory */
+			[[nodiscard]]
+			bool exhausted() const noexcept {
+				return _exhausted;
+			}
+
+			/* Release everything, keeping the memory for the next call unless there is a lot of it */
+			void reset() noexcept {
+				_free.fill(nullptr);
+				_used = 0zu;
+				_exhausted = false;
+				if (_arena.capacity() > scratch_keep) {
+					_arena.release();
+				} else {
+					_arena.reset();
+				}
+			}
+		};
+
+		/* Allocation hooks for the codecs that can't be reset, so their state comes out of the scratch memory */
+		[[nodiscard]]
+		void* scratch_alloc(void* const opaque, const std::size_t size) noexcept {
+			return static_cast<scratch_t*>(opaque)->allocate(size);
+		}
+
+		void scratch_free(void* const opaque, void* const ptr) noexcept {
+			static_cast<scratch_t*>(opaque)->free(ptr);
+		}
+
+		/* Resets the scratch memory once the codec using it is done */
+		struct scratch_lease_t final {
+		private:
+			scratch_t& _scratch;
+		public:
+			explicit scratch_lease_t(scratch_t& scratch) noexcept : _scratch{scratch} { }
+
+			scratch_lease_t(const scratch_lease_t&) = delete;
+			scratch_lease_t& operator=(const scratch_lease_t&) = delete;
+			scratch_lease_t(scratch_lease_t&&) = delete;
+			scratch_lease_t& operator=(scratch_lease_t&&) = delete;
+
+			~scratch_lease_t() noexcept {
+				_scratch.reset();
+			}
+		};
+
+		/* LZ77+Huffman has 256 literal and 256 match symbols, with codes of up to 15 bits */
+		constexpr std::size_t xpress_symbols{512zu};
+		constexpr std::uint32_t xpress_max_bits{15U};
+		/* Codes of up to this many bits, and pairs of literals that fit in it, are resolved with one lookup */
+		constexpr std::uint32_t xpress_fast_bits{12U};
+
+		/* The decoding tables for one LZ77+Huffman block
+
+			Each fast table entry packs the first symbol and its length, the second symbol of a literal pair, the
+			total length of both, and the number of symbols resolved, which is 0 if the code is longer than
+			`xpress_fast_bits` and has to be decoded canonically from `first_code` and `sorted`.
+		*/
+		struct xpress_table_t final {
+			std::array<std::uint32_t, 1zu << xpress_fast_bits> fast{};
+			std::array<std::uint16_t, xpress_max_bits + 1U> count{};
+			std::array<std::uint16_t, xpress_max_bits + 1U> first_code{};
+			std::array<std::uint16_t, xpress_max_bits + 1U> first_index{};
+			std::array<std::uint16_t, xpress_symbols> sorted{};
+		};
+
+		/* The per-thread codec contexts, these are created on first use and reset rather than rebuilt for each call */
+		struct codec_state_t final {
+		private:
+			z_stream _inflate{};
+			bool _inflate_ready{false};
+			ZSTD_DCtx* _zstd{nullptr};
+			LZ4F_dctx* _lz4{nullptr};
+			lzma_stream _xz = LZMA_STREAM_INIT;
+			lzma_stream _lzma = LZMA_STREAM_INIT;
+		public:
+			scratch_t scratch{};
+			xpress_table_t xpress{};
+
+			codec_state_t() noexcept = default;
+			codec_state_t(const codec_state_t&) = delete;
+			codec_state_t& operator=(const codec_state_t&) = delete;
+			codec_state_t(codec_state_t&&) = delete;
+			codec_state_t& operator=(codec_state_t&&) = delete;
+
+			~codec_state_t() noexcept {
+				if (_inflate_ready) {
+					inflateEnd(&_inflate);
+				}
+				ZSTD_freeDCtx(_zstd);
+				if (_lz4 != nullptr) {
+					LZ4F_freeDecompressionContext(_lz4);
+				}
+				lzma_end(&_xz);
+				lzma_end(&_lzma);
+			}
+
+			[[nodiscard]]
+			z_stream& inflater() {
+				if (!_inflate_ready) {
+					if (inflateInit2(&_inflate, MAX_WBITS) != Z_OK) {
+						throw std::bad_alloc{};
+					}
+					_inflate_ready = true;
+				}
+				return _inflate;
+			}
+
+			[[nodiscard]]
+			ZSTD_DCtx& zstd() {
+				if (_zstd == nullptr) {
+					_zstd = ZSTD_createDCtx();
+					if (_zstd == nullptr) {
+						throw std::bad_alloc{};
+					}
+				}
+				return *_zstd;
+			}
+
+			[[nodiscard]]
+			LZ4F_dctx& lz4() {
+				if (_lz4 == nullptr) {
+					if (LZ4F_isError(LZ4F_createDecompressionContext(&_lz4, LZ4F_VERSION)) != 0U) {
+						_lz4 = nullptr;
+						throw std::bad_alloc{};
+					}
+				}
+				return *_lz4;
+			}
+
+			/* liblzma re-uses the decoder already set up on a stream, so keep one stream for each format */
+			[[nodiscard]]
+			lzma_stream& xz() noexcept {
+				return _xz;
+			}
+
+			[[nodiscard]]
+			lzma_stream& lzma_alone() noexcept {
+				return _lzma;
+			}
+		};
+
+		[[nodiscard]]
+		codec_state_t& codec_state() noexcept {
+			thread_local codec_state_t state{};
+			return state;
+		}
+
+		/* Check that the `len` bytes at `idx` are in the buffer */
+		[[nodiscard]]
+		std::expected<std::span<const std::byte>, decomp_error_t> compressed_range(
+			const std::span<const std::byte> buffer, const std::size_t idx, const std::size_t len
+		) noexcept {
+			if (idx > buffer.size() || (buffer.size() - idx) < len) {
+				return std::unexpected(decomp_error_t::Overrun);
+			}
+			return buffer.subspan(idx, len);
+		}
+
+		[[nodiscard]]
+		std::expected<bytearray_t, decomp_error_t> into_bytearray(output_t& out) {
+			auto buff{out.release()};
+			return std::expected<bytearray_t, decomp_error_t>{std::in_place, buff, out.length()};
+		}
+
+		[[nodiscard]]
+		std::uint8_t byte_at(const std::span<const std::byte> data, const std::size_t idx) noexcept {
+			return std::to_integer<std::uint8_t>(data[idx]);
+		}
+
+		/* Work out if a DEFLATE stream has a gzip, zlib, or no wrapper, and return the window bits to match */
+		[[nodiscard]]
+		int deflate_window_bits(const std::span<const std::byte> data) noexcept {
+			if (data.size() >= 2zu) {
+				const auto cmf{byte_at(data, 0zu)};
+				const auto flg{byte_at(data, 1zu)};
+				if (cmf == 0x1FU && flg == 0x8BU) {
+					return MAX_WBITS + 16;
+				}
+				/* A zlib header has a CM of 8, a window of at most 32K, and FCHECK makes the header a multiple of 31 */
+				if ((cmf & 0x0FU) == 8U && (cmf >> 4U) <= 7U && ((cmf * 256U) + flg) % 31U == 0U) {
+					return MAX_WBITS;
+				}
+			}
+			return -MAX_WBITS;
+		}
+
+		/* A gzip member ends with the length of the uncompressed data, modulo 2^32 */
+		[[nodiscard]]
+		std::size_t deflate_size_hint(const std::span<const std::byte> data, const int window_bits) noexcept {
+			const auto fallback{data.size() * default_ratio};
+			if (window_bits <= MAX_WBITS || data.size() < 18zu) {
+				return fallback;
+			}
+			const auto isize{load<std::uint32_t, std::endian::little>(data.data() + (data.size() - 4zu))};
+			return std::min<std::size_t>(isize, data.size() * deflate_max_ratio);
+		}
+
+		/* Both zlib and libbzip2 are limited to 32-bit lengths, so feed them in chunks */
+		[[nodiscard]]
+		unsigned int clamp_u32(const std::size_t len) noexcept {
+			return static_cast<unsigned int>(std::min<std::size_t>(len, std::numeric_limits<unsigned int>::max()));
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> inflate_into(output_t& out, const std::span<const std::byte> data, const int window_bits) {
+			auto& strm{codec_state().inflater()};
+			if (inflateReset2(&strm, window_bits) != Z_OK) {
+				return std::unexpected(decomp_error_t::Unspecified);
+			}
+			/* Resetting doesn't touch the input, which could be left over from a failed call */
+			strm.avail_in = 0U;
+
+			std::size_t fed{};
+			while (true) {
+				if (strm.avail_in == 0U) {
+					const auto chunk{clamp_u32(data.size() - fed)};
+					strm.next_in = reinterpret_cast<const Bytef*>(data.data() + fed);
+					strm.avail_in = chunk;
+					fed += chunk;
+				}
+				if (!out.ensure_room()) {
+					return std::unexpected(decomp_error_t::TooLarge);
+				}
+
+				const auto room{clamp_u32(out.room())};
+				strm.next_out = reinterpret_cast<Bytef*>(out.tail());
+				strm.avail_out = room;
+				const auto res{inflate(&strm, Z_NO_FLUSH)};
+				out.commit(room - strm.avail_out);
+
+				switch (res) {
+					case Z_STREAM_END: return {};
+					case Z_OK:
+					case Z_BUF_ERROR: break;
+					case Z_MEM_ERROR: throw std::bad_alloc{};
+					default: return std::unexpected(decomp_error_t::Invalid);
+				}
+
+				/* Room left over with all of the input used up means the stream needs more than we have */
+				if (strm.avail_out != 0U && strm.avail_in == 0U && fed == data.size()) {
+					return std::unexpected(decomp_error_t::Truncated);
+				}
+			}
+		}
+
+		[[nodiscard]]
+		void* bz2_alloc(void* const opaque, const int count, const int size) noexcept {
+			return scratch_alloc(opaque, static_cast<std::size_t>(count) * static_cast<std::size_t>(size));
+		}
+
+		void bz2_free(void* const opaque, void* const ptr) noexcept {
+			scratch_free(opaque, ptr);
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> bunzip_into(output_t& out, const std::span<const std::byte> data) {
+			auto& state{codec_state()};
+			const scratch_lease_t lease{state.scratch};
+
+			/* libbzip2 has no way to reset a stream, but with its memory coming from the scratch a fresh one is cheap */
+			bz_stream strm{};
+			strm.bzalloc = bz2_alloc;
+			strm.bzfree = bz2_free;
+			strm.opaque = &state.scratch;
+			if (const auto res{BZ2_bzDecompressInit(&strm, 0, 0)}; res != BZ_OK) {
+				if (res == BZ_MEM_ERROR) {
+					if (state.scratch.exhausted()) {
+						return std::unexpected(decomp_error_t::TooLarge);
+					}
+					throw std::bad_alloc{};
+				}
+				return std::unexpected(decomp_error_t::Unspecified);
+			}
+			const std::unique_ptr<bz_stream, decltype(&BZ2_bzDecompressEnd)> guard{&strm, BZ2_bzDecompressEnd};
+
+			std::size_t fed{};
+			while (true) {
+				if (strm.avail_in == 0U) {
+					const auto chunk{clamp_u32(data.size() - fed)};
+					/* libbzip2 never writes through `next_in`, it's just not const */
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+					strm.next_in = const_cast<char*>(reinterpret_cast<const char*>(data.data() + fed));
+					strm.avail_in = chunk;
+					fed += chunk;
+				}
+				if (!out.ensure_room()) {
+					return std::unexpected(decomp_error_t::TooLarge);
+				}
+
+				const auto room{clamp_u32(out.room())};
+				strm.next_out = reinterpret_cast<char*>(out.tail());
+				strm.avail_out = room;
+				const auto res{BZ2_bzDecompress(&strm)};
+				out.commit(room - strm.avail_out);
+
+				switch (res) {
+					case BZ_STREAM_END: return {};
+					case BZ_OK: break;
+					case BZ_MEM_ERROR:
+						if (state.scratch.exhausted()) {
+							return std::unexpected(decomp_error_t::TooLarge);
+						}
+						throw std::bad_alloc{};
+					default: return std::unexpected(decomp_error_t::Invalid);
+				}
+
+				if (strm.avail_out != 0U && strm.avail_in == 0U && fed == data.size()) {
+					return std::unexpected(decomp_error_t::Truncated);
+				}
+			}
+		}
+
+		/* The legacy .lzma header has the uncompressed size at offset 5, or all ones if it is unknown */
+		[[nodiscard]]
+		std::size_t lzma_size_hint(const std::span<const std::byte> data) noexcept {
+			const auto fallback{data.size() * default_ratio};
+			if (data.size() < 13zu) {
+				return fallback;
+			}
+			const auto size{load<std::uint64_t, std::endian::little>(data.data() + 5zu)};
+			if (size == std::numeric_limits<std::uint64_t>::max()) {
+				return fallback;
+			}
+			return static_cast<std::size_t>(std::min<std::uint64_t>(size, data.size() * lzma_max_ratio));
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unlzma_into(output_t& out, lzma_stream& strm, const std::span<const std::byte> data) {
+			strm.next_in = reinterpret_cast<const std::uint8_t*>(data.data());
+			strm.avail_in = data.size();
+
+			while (true) {
+				if (!out.ensure_room()) {
+					return std::unexpected(decomp_error_t::TooLarge);
+				}
+
+				const auto room{out.room()};
+				strm.next_out = reinterpret_cast<std::uint8_t*>(out.tail());
+				strm.avail_out = room;
+				const auto res{lzma_code(&strm, LZMA_FINISH)};
+				out.commit(room - strm.avail_out);
+
+				switch (res) {
+					case LZMA_STREAM_END: return {};
+					case LZMA_OK: break;
+					/* We always make more room, so no progress means we ran out of input */
+					case LZMA_BUF_ERROR: return std::unexpected(decomp_error_t::Truncated);
+					case LZMA_MEMLIMIT_ERROR: return std::unexpected(decomp_error_t::TooLarge);
+					case LZMA_MEM_ERROR: throw std::bad_alloc{};
+					default: return std::unexpected(decomp_error_t::Invalid);
+				}
+			}
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unxz_into(output_t& out, const std::span<const std::byte> data) {
+			auto& strm{codec_state().xz()};
+			switch (lzma_stream_decoder(&strm, lzma_memlimit, LZMA_CONCATENATED)) {
+				case LZMA_OK: break;
+				case LZMA_MEM_ERROR: throw std::bad_alloc{};
+				default: return std::unexpected(decomp_error_t::Unspecified);
+			}
+			return unlzma_into(out, strm, data);
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unlzma_alone_into(output_t& out, const std::span<const std::byte> data) {
+			auto& strm{codec_state().lzma_alone()};
+			switch (lzma_alone_decoder(&strm, lzma_memlimit)) {
+				case LZMA_OK: break;
+				case LZMA_MEM_ERROR: throw std::bad_alloc{};
+				default: return std::unexpected(decomp_error_t::Unspecified);
+			}
+			return unlzma_into(out, strm, data);
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unzstd_into(output_t& out, ZSTD_DCtx& dctx, const std::span<const std::byte> data) {
+			ZSTD_DCtx_reset(&dctx, ZSTD_reset_session_only);
+
+			ZSTD_inBuffer input{data.data(), data.size(), 0zu};
+			while (true) {
+				if (!out.ensure_room()) {
+					return std::unexpected(decomp_error_t::TooLarge);
+				}
+
+				ZSTD_outBuffer output{out.tail(), out.room(), 0zu};
+				const auto res{ZSTD_decompressStream(&dctx, &output, &input)};
+				out.commit(output.pos);
+
+				if (ZSTD_isError(res) != 0U) {
+					return std::unexpected(decomp_error_t::Invalid);
+				}
+				/* A result of 0 is the end of a frame, there may be more frames after it */
+				if (input.pos == input.size) {
+					if (res == 0zu) {
+						return {};
+					}
+					if (output.pos != output.size) {
+						return std::unexpected(decomp_error_t::Truncated);
+					}
+				}
+			}
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unlz4_into(output_t& out, LZ4F_dctx& dctx, const std::span<const std::byte> data) {
+			std::size_t offset{};
+			while (true) {
+				if (!out.ensure_room()) {
+					return std::unexpected(decomp_error_t::TooLarge);
+				}
+
+				const auto room{out.room()};
+				auto produced{room};
+				auto consumed{data.size() - offset};
+				const auto res{LZ4F_decompress(&dctx, out.tail(), &produced, data.data() + offset, &consumed, nullptr)};
+				out.commit(produced);
+				offset += consumed;
+
+				if (LZ4F_isError(res) != 0U) {
+					return std::unexpected(decomp_error_t::Invalid);
+				}
+				/* A result of 0 is the end of a frame, there may be more frames after it */
+				if (offset == data.size()) {
+					if (res == 0zu) {
+						return {};
+					}
+					if (produced != room) {
+						return std::unexpected(decomp_error_t::Truncated);
+					}
+				}
+			}
+		}
+
+#if defined(PANKO_WITH_BROTLI)
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unbrotli_into(output_t& out, const std::span<const std::byte> data) {
+			auto& state{codec_state()};
+			const scratch_lease_t lease{state.scratch};
+
+			/* There is no way to reset a brotli decoder, but with its memory coming from the scratch a fresh one is cheap */
+			const std::unique_ptr<BrotliDecoderState, decltype(&BrotliDecoderDestroyInstance)> decoder{
+				BrotliDecoderCreateInstance(scratch_alloc, scratch_free, &state.scratch), BrotliDecoderDestroyInstance
+			};
+			if (decoder == nullptr) {
+				throw std::bad_alloc{};
+			}
+
+			auto avail_in{data.size()};
+			auto* next_in{reinterpret_cast<const std::uint8_t*>(data.data())};
+			while (true) {
+				if (!out.ensure_room()) {
+					return std::unexpected(decomp_error_t::TooLarge);
+				}
+
+				const auto room{out.room()};
+				auto avail_out{room};
+				auto* next_out{reinterpret_cast<std::uint8_t*>(out.tail())};
+				const auto res{BrotliDecoderDecompressStream(
+					decoder.get(), &avail_in, &next_in, &avail_out, &next_out, nullptr
+				)};
+				out.commit(room - avail_out);
+
+				switch (res) {
+					case BROTLI_DECODER_RESULT_SUCCESS: return {};
+					case BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT: break;
+					case BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT: return std::unexpected(decomp_error_t::Truncated);
+					case BROTLI_DECODER_RESULT_ERROR:
+					default:
+						if (state.scratch.exhausted()) {
+							return std::unexpected(decomp_error_t::TooLarge);
+						}
+						return std::unexpected(decomp_error_t::Invalid);
+				}
+			}
+		}
+#endif
+
+		/* Wide match copies may write up to this many bytes past the end of the match */
+		constexpr std::size_t copy_slack{32zu};
+
+		/* Expand a match of `len` bytes from `offset` bytes back, the source and destination may overlap.
+
+			Rather than copying byte by byte, short offsets have their pattern doubled up until it is at least 16
+			bytes wide, and then the rest is done with 16 or 32 byte copies that may run up to `copy_slack` bytes
+			past the end of the match.
+		*/
+		void copy_match(std::byte* dst, const std::size_t offset, const std::size_t len) noexcept {
+			const auto* src{dst - offset};
+			auto* const end{dst + len};
+
+			if (offset == 1zu) {
+				std::memset(dst, std::to_integer<int>(*src), len);
+				return;
+			}
+
+			while (static_cast<std::size_t>(dst - src) < 16zu) {
+				const auto dist{static_cast<std::size_t>(dst - src)};
+				std::memcpy(dst, src, dist);
+				dst += dist;
+				if (dst >= end) {
+					return;
+				}
+			}
+
+			if (static_cast<std::size_t>(dst - src) >= 32zu) {
+				do {
+					std::memcpy(dst, src, 32zu);
+					dst += 32zu;
+					src += 32zu;
+				} while (dst < end);
+			} else {
+				do {
+					std::memcpy(dst, src, 16zu);
+					dst += 16zu;
+					src += 16zu;
+				} while (dst < end);
+			}
+		}
+
+		/* [MS-XCA] 2.4 Plain LZ77 */
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unlz77_into(output_t& out, const std::span<const std::byte> data) {
+			std::size_t pos{};
+			std::uint32_t flags{};
+			std::uint32_t flag_count{};
+			/* Where the spare high nibble of a previous length byte is, match lengths share them in pairs */
+			std::size_t nibble_pos{};
+
+			while (true) {
+				if (flag_count == 0U) {
+					if ((data.size() - pos) < 4zu) {
+						return std::unexpected(decomp_error_t::Truncated);
+					}
+					flags = load<std::uint32_t, std::endian::little>(data.data() + pos);
+					pos += 4zu;
+					flag_count = 32U;
+				}
+
+				/* Flags are used from the top down, and a run of clear flags is a run of literals */
+				const auto literals{std::min(
+					static_cast<std::uint32_t>(std::countl_zero(flags << (32U - flag_count))), flag_count
+				)};
+				if (literals != 0U) {
+					if ((data.size() - pos) < literals) {
+						return std::unexpected(decomp_error_t::Truncated);
+					}
+					if (!out.reserve(literals)) {
+						return std::unexpected(decomp_error_t::TooLarge);
+					}
+					std::memcpy(out.tail(), data.data() + pos, literals);
+					out.commit(literals);
+					pos += literals;
+					flag_count -= literals;
+					continue;
+				}
+
+				--flag_count;
+				/* A set flag with no input left is the end of the stream */
+				if (pos == data.size()) {
+					return {};
+				}
+				if ((data.size() - pos) < 2zu) {
+					return std::unexpected(decomp_error_t::Truncated);
+				}
+				const auto match{load<std::uint16_t, std::endian::little>(data.data() + pos)};
+				pos += 2zu;
+
+				const std::size_t offset{(match >> 3U) + 1zu};
+				std::size_t length{match & 0x07U};
+				if (length == 7zu) {
+					if (nibble_pos == 0zu) {
+						if (pos == data.size()) {
+							return std::unexpected(decomp_error_t::Truncated);
+						}
+						length = byte_at(data, pos) & 0x0FU;
+						nibble_pos = pos++;
+					} else {
+						length = byte_at(data, nibble_pos) >> 4U;
+						nibble_pos = 0zu;
+					}
+
+					if (length == 15zu) {
+						if (pos == data.size()) {
+							return std::unexpected(decomp_error_t::Truncated);
+						}
+						length = byte_at(data, pos++);
+
+						if (length == 255zu) {
+							if ((data.size() - pos) < 2zu) {
+								return std::unexpected(decomp_error_t::Truncated);
+							}
+							length = load<std::uint16_t, std::endian::little>(data.data() + pos);
+							pos += 2zu;
+
+							if (length == 0zu) {
+								if ((data.size() - pos) < 4zu) {
+									return std::unexpected(decomp_error_t::Truncated);
+								}
+								length = load<std::uint32_t, std::endian::little>(data.data() + pos);
+								pos += 4zu;
+							}
+							if (length < (15zu + 7zu)) {
+								return std::unexpected(decomp_error_t::Invalid);
+							}
+							length -= 15zu + 7zu;
+						}
+						length += 15zu;
+					}
+					length += 7zu;
+				}
+				length += 3zu;
+
+				if (offset > out.length()) {
+					return std::unexpected(decomp_error_t::Invalid);
+				}
+				if (length > max_output || !out.reserve(length + copy_slack)) {
+					return std::unexpected(decomp_error_t::TooLarge);
+				}
+				copy_match(out.tail(), offset, length);
+				out.commit(length);
+			}
+		}
+
+		/* Accessors for the packed `xpress_table_t::fast` entries */
+		[[nodiscard]]
+		constexpr std::uint32_t xpress_entry(
+			const std::uint32_t sym, const std::uint32_t len, const std::uint32_t sym2, const std::uint32_t total,
+			const std::uint32_t count
+		) noexcept {
+			return sym | (len << 9U) | (sym2 << 13U) | (total << 22U) | (count << 27U);
+		}
+
+		[[nodiscard]]
+		constexpr std::uint32_t xpress_sym(const std::uint32_t entry) noexcept { return entry & 0x1FFU; }
+		[[nodiscard]]
+		constexpr std::uint32_t xpress_len(const std::uint32_t entry) noexcept { return (entry >> 9U) & 0x0FU; }
+		[[nodiscard]]
+		constexpr std::uint32_t xpress_sym2(const std::uint32_t entry) noexcept { return (entry >> 13U) & 0x1FFU; }
+		[[nodiscard]]
+		constexpr std::uint32_t xpress_total(const std::uint32_t entry) noexcept { return (entry >> 22U) & 0x1FU; }
+		[[nodiscard]]
+		constexpr std::uint32_t xpress_count(const std::uint32_t entry) noexcept { return entry >> 27U; }
+
+		/* Build the decoding tables from the 4-bit code lengths at the start of a block */
+		[[nodiscard]]
+		bool build_xpress_table(xpress_table_t& table, const std::span<const std::byte> lengths) noexcept {
+			const auto code_len = [&](const std::size_t sym) noexcept -> std::uint32_t {
+				const auto packed{byte_at(lengths, sym / 2zu)};
+				return (sym % 2zu) == 0zu ? (packed & 0x0FU) : (packed >> 4U);
+			};
+
+			table.count.fill(0U);
+			for (std::size_t sym{}; sym < xpress_symbols; ++sym) {
+				++table.count[code_len(sym)];
+			}
+			table.count[0] = 0U;
+
+			/* Reject over-subscribed codes, incomplete ones are fine as long as the unused codes never show up */
+			std::int32_t left{1};
+			for (std::uint32_t len{1U}; len <= xpress_max_bits; ++len) {
+				left = (left * 2) - table.count[len];
+				if (left < 0) {
+					return false;
+				}
+			}
+
+			std::uint32_t code{};
+			std::uint32_t index{};
+			for (std::uint32_t len{1U}; len <= xpress_max_bits; ++len) {
+				table.first_code[len] = static_cast<std::uint16_t>(code);
+				table.first_index[len] = static_cast<std::uint16_t>(index);
+				index += table.count[len];
+				code = (code + table.count[len]) << 1U;
+			}
+
+			/* Symbols are ordered by code length and then by value, which is also the order of their codes */
+			auto next{table.first_index};
+			for (std::size_t sym{}; sym < xpress_symbols; ++sym) {
+				if (const auto len{code_len(sym)}; len != 0U) {
+					table.sorted[next[len]++] = static_cast<std::uint16_t>(sym);
+				}
+			}
+
+			table.fast.fill(0U);
+			for (std::uint32_t len{1U}; len <= xpress_fast_bits; ++len) {
+				const auto span{1U << (xpress_fast_bits - len)};
+				for (std::uint32_t idx{}; idx < table.count[len]; ++idx) {
+					const auto sym{table.sorted[table.first_index[len] + idx]};
+					const auto base{static_cast<std::uint32_t>(table.first_code[len] + idx) << (xpress_fast_bits - len)};
+					std::fill_n(table.fast.begin() + base, span, xpress_entry(sym, len, 0U, len, 1U));
+				}
+			}
+
+			/* Where a literal's code leaves room for the whole code of another literal, resolve both at once */
+			constexpr auto fast_mask{(1U << xpress_fast_bits) - 1U};
+			for (std::uint32_t idx{}; idx < table.fast.size(); ++idx) {
+				const auto entry{table.fast[idx]};
+				const auto len{xpress_len(entry)};
+				if (xpress_count(entry) == 0U || xpress_sym(entry) >= 256U || len >= xpress_fast_bits) {
+					continue;
+				}
+				/* Only the symbol and length of the entry are looked at, which pairing does not change */
+				const auto next_entry{table.fast[(idx << len) & fast_mask]};
+				const auto next_len{xpress_len(next_entry)};
+				if (xpress_count(next_entry) == 0U || xpress_sym(next_entry) >= 256U || (len + next_len) > xpress_fast_bits) {
+					continue;
+				}
+				table.fast[idx] = xpress_entry(xpress_sym(entry), len, xpress_sym(next_entry), len + next_len, 2U);
+			}
+			return true;
+		}
+
+		/* The LZ77+Huffman bit stream, read most significant bit first out of 16-bit little endian words.
+
+			This mirrors the 32-bit window of the [MS-XCA] reference decoder exactly, as the extended match lengths
+			are stored as whole bytes at the current input position, in between the words of the bit stream.
+		*/
+		struct xpress_bits_t final {
+		private:
+			std::span<const std::byte> _data;
+			std::size_t _pos;
+			std::uint32_t _bits{};
+			std::int32_t _extra{16};
+			std::size_t _overread{};
+
+			[[nodiscard]]
+			std::uint32_t next_word() noexcept {
+				if ((_data.size() - _pos) >= 2zu) {
+					const auto word{load<std::uint16_t, std::endian::little>(_data.data() + _pos)};
+					_pos += 2zu;
+					return word;
+				}
+				/* The final words of the window may legitimately be past the end of the input */
+				_overread += 2zu;
+				if (_pos != _data.size()) {
+					return byte_at(_data, _pos++);
+				}
+				return 0U;
+			}
+		public:
+			xpress_bits_t(const std::span<const std::byte> data, const std::size_t pos) noexcept :
+				_data{data}, _pos{pos}
+			{
+				_bits = next_word() << 16U;
+				_bits |= next_word();
+			}
+
+			[[nodiscard]]
+			std::uint32_t peek(const std::uint32_t len) const noexcept {
+				return _bits >> (32U - len);
+			}
+
+			void consume(const std::uint32_t len) noexcept {
+				_bits <<= len;
+				_extra -= static_cast<std::int32_t>(len);
+				if (_extra < 0) {
+					_bits |= next_word() << static_cast<std::uint32_t>(-_extra);
+					_extra += 16;
+				}
+			}
+
+			[[nodiscard]]
+			std::uint32_t take(const std::uint32_t len) noexcept {
+				if (len == 0U) {
+					return 0U;
+				}
+				const auto value{peek(len)};
+				consume(len);
+				return value;
+			}
+
+			/* Read a whole byte or word from the current input position */
+			[[nodiscard]]
+			std::expected<std::uint32_t, decomp_error_t> byte() noexcept {
+				if (_overread != 0zu || _pos == _data.size()) {
+					return std::unexpected(decomp_error_t::Truncated);
+				}
+				return byte_at(_data, _pos++);
+			}
+
+			template<typename T>
+			[[nodiscard]]
+			std::expected<std::uint32_t, decomp_error_t> word() noexcept {
+				if (_overread != 0zu || (_data.size() - _pos) < sizeof(T)) {
+					return std::unexpected(decomp_error_t::Truncated);
+				}
+				const auto value{load<T, std::endian::little>(_data.data() + _pos)};
+				_pos += sizeof(T);
+				return value;
+			}
+
+			[[nodiscard]]
+			std::size_t position() const noexcept {
+				return _pos;
+			}
+
+			/* True once all of the input has been read into the window */
+			[[nodiscard]]
+			bool exhausted() const noexcept {
+				return _pos == _data.size();
+			}
+
+			/* True if the window has run more than two words past the end, so what is being decoded is made up */
+			[[nodiscard]]
+			bool overrun() const noexcept {
+				return _overread > 4zu;
+			}
+		};
+
+		/* Decode a code longer than `xpress_fast_bits` */
+		[[nodiscard]]
+		std::expected<std::uint32_t, decomp_error_t> xpress_slow_symbol(
+			const xpress_table_t& table, xpress_bits_t& bits
+		) noexcept {
+			for (auto len{xpress_fast_bits + 1U}; len <= xpress_max_bits; ++len) {
+				const auto idx{bits.peek(len) - table.first_code[len]};
+				if (idx < table.count[len]) {
+					bits.consume(len);
+					return table.sorted[table.first_index[len] + idx];
+				}
+			}
+			return std::unexpected(decomp_error_t::Invalid);
+		}
+
+		/* [MS-XCA] 2.2 LZ77+Huffman
+
+			As the uncompressed size is not known, the end of stream symbol is taken to be a 256 decoded once all
+			of the input has been read, as it is otherwise the same as a 3 byte match at offset 1.
+		*/
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unlz77huff_into(
+			output_t& out, xpress_table_t& table, const std::span<const std::byte> data
+		) {
+			constexpr auto table_len{xpress_symbols / 2zu};
+			constexpr auto block_len{64_KiB};
+
+			std::size_t pos{};
+			while (true) {
+				if (pos == data.size()) {
+					return {};
+				}
+				if ((data.size() - pos) < table_len) {
+					return std::unexpected(decomp_error_t::Truncated);
+				}
+				if (!build_xpress_table(table, data.subspan(pos, table_len))) {
+					return std::unexpected(decomp_error_t::Invalid);
+				}
+
+				xpress_bits_t bits{data, pos + table_len};
+				const auto block_end{out.length() + block_len};
+				while (out.length() < block_end) {
+					if (bits.overrun()) {
+						return std::unexpected(decomp_error_t::Truncated);
+					}
+					if (!out.reserve(2zu)) {
+						return std::unexpected(decomp_error_t::TooLarge);
+					}
+
+					const auto entry{table.fast[bits.peek(xpress_fast_bits)]};
+					std::uint32_t sym{};
+					/* A pair of literals can only be taken whole if they both fit in the block */
+					if (xpress_count(entry) == 2U && (block_end - out.length()) >= 2zu) {
+						auto* const dst{out.tail()};
+						dst[0] = static_cast<std::byte>(xpress_sym(entry));
+						dst[1] = static_cast<std::byte>(xpress_sym2(entry));
+						out.commit(2zu);
+						bits.consume(xpress_total(entry));
+						continue;
+					} else if (xpress_count(entry) != 0U) {
+						sym = xpress_sym(entry);
+						bits.consume(xpress_len(entry));
+					} else {
+						const auto slow{xpress_slow_symbol(table, bits)};
+						if (!slow) {
+							return std::unexpected(slow.error());
+						}
+						sym = *slow;
+					}
+
+					if (sym < 256U) {
+						*out.tail() = static_cast<std::byte>(sym);
+						out.commit(1zu);
+						continue;
+					}
+					if (sym == 256U && bits.exhausted()) {
+						return {};
+					}
+
+					sym -= 256U;
+					std::size_t length{sym & 0x0FU};
+					const auto offset_bits{sym >> 4U};
+					if (length == 15zu) {
+						const auto ext{bits.byte()};
+						if (!ext) {
+							return std::unexpected(ext.error());
+						}
+						length = *ext;
+
+						if (length == 255zu) {
+							const auto ext16{bits.word<std::uint16_t>()};
+							if (!ext16) {
+								return std::unexpected(ext16.error());
+							}
+							length = *ext16;
+
+							if (length == 0zu) {
+								const auto ext32{bits.word<std::uint32_t>()};
+								if (!ext32) {
+									return std::unexpected(ext32.error());
+								}
+								length = *ext32;
+							}
+							if (length < 15zu) {
+								return std::unexpected(decomp_error_t::Invalid);
+							}
+							length -= 15zu;
+						}
+						length += 15zu;
+					}
+					length += 3zu;
+
+					const std::size_t offset{bits.take(offset_bits) + (1U << offset_bits)};
+					if (offset > out.length()) {
+						return std::unexpected(decomp_error_t::Invalid);
+					}
+					if (length > max_output || !out.reserve(length + copy_slack)) {
+						return std::unexpected(decomp_error_t::TooLarge);
+					}
+					copy_match(out.tail(), offset, length);
+					out.commit(length);
+				}
+				pos = bits.position();
+			}
+		}
+
+		/* [MS-XCA] 2.5 LZNT1 compresses in chunks of up to 4KiB, each with a 16-bit header */
+		constexpr std::size_t lznt1_chunk_len{4_KiB};
+
+		/* The output is bounded by the number of chunks, and walking the chunk headers is cheap */
+		[[nodiscard]]
+		std::size_t lznt1_size_hint(const std::span<const std::byte> data) noexcept {
+			std::size_t pos{};
+			std::size_t chunks{};
+			while ((data.size() - pos) >= 2zu) {
+				const auto header{load<std::uint16_t, std::endian::little>(data.data() + pos)};
+				if (header == 0U) {
+					break;
+				}
+				pos += 2zu + (header & 0x0FFFU) + 1zu;
+				++chunks;
+				if (pos > data.size()) {
+					break;
+				}
+			}
+			return chunks * lznt1_chunk_len;
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unlznt1_chunk(output_t& out, const std::span<const std::byte> chunk) {
+			if (!out.reserve(lznt1_chunk_len + copy_slack)) {
+				return std::unexpected(decomp_error_t::TooLarge);
+			}
+			auto* const start{out.tail()};
+			auto* dst{start};
+			auto* const end{start + lznt1_chunk_len};
+
+			std::size_t pos{};
+			while (pos < chunk.size()) {
+				const auto flags{byte_at(chunk, pos++)};
+
+				/* No flags set is a run of 8 literals */
+				if (flags == 0U && (chunk.size() - pos) >= 8zu && (end - dst) >= 8) {
+					std::memcpy(dst, chunk.data() + pos, 8zu);
+					dst += 8;
+					pos += 8zu;
+					continue;
+				}
+
+				for (std::uint32_t bit{}; bit < 8U && pos < chunk.size(); ++bit) {
+					if ((flags & (1U << bit)) == 0U) {
+						if (dst == end) {
+							return std::unexpected(decomp_error_t::Invalid);
+						}
+						*dst++ = chunk[pos++];
+						continue;
+					}
+
+					if ((chunk.size() - pos) < 2zu) {
+						return std::unexpected(decomp_error_t::Truncated);
+					}
+					const auto token{load<std::uint16_t, std::endian::little>(chunk.data() + pos)};
+					pos += 2zu;
+
+					/* The split between offset and length bits depends on how far into the chunk we are */
+					const auto produced{static_cast<std::size_t>(dst - start)};
+					if (produced == 0zu) {
+						return std::unexpected(decomp_error_t::Invalid);
+					}
+					const auto offset_bits{std::max(4U, static_cast<std::uint32_t>(std::bit_width(produced - 1zu)))};
+					const auto length_bits{16U - offset_bits};
+					const std::size_t offset{static_cast<std::size_t>(token >> length_bits) + 1zu};
+					const std::size_t length{(token & ((1U << length_bits) - 1U)) + 3zu};
+
+					if (offset > produced || length > static_cast<std::size_t>(end - dst)) {
+						return std::unexpected(decomp_error_t::Invalid);
+					}
+					copy_match(dst, offset, length);
+					dst += length;
+				}
+			}
+
+			out.commit(static_cast<std::size_t>(dst - start));
+			return {};
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> unlznt1_into(output_t& out, const std::span<const std::byte> data) {
+			std::size_t pos{};
+			/* The input may just end rather than having a terminating empty chunk header */
+			while ((data.size() - pos) >= 2zu) {
+				const auto header{load<std::uint16_t, std::endian::little>(data.data() + pos)};
+				pos += 2zu;
+				if (header == 0U) {
+					return {};
+				}
+
+				const std::size_t chunk_len{(header & 0x0FFFU) + 1zu};
+				if ((data.size() - pos) < chunk_len) {
+					return std::unexpected(decomp_error_t::Truncated);
+				}
+				const auto chunk{data.subspan(pos, chunk_len)};
+				pos += chunk_len;
+
+				const auto chunk_start{out.length()};
+				if ((header & 0x8000U) != 0U) {
+					if (const auto res{unlznt1_chunk(out, chunk)}; !res) {
+						return res;
+					}
+				} else {
+					if (!out.reserve(chunk_len)) {
+						return std::unexpected(decomp_error_t::TooLarge);
+					}
+					std::memcpy(out.tail(), chunk.data(), chunk_len);
+					out.commit(chunk_len);
+				}
+
+				/* A chunk that comes up short is zero filled to the full 4KiB if there is another chunk after it */
+				const auto produced{out.length() - chunk_start};
+				if (produced < lznt1_chunk_len && (data.size() - pos) >= 2zu &&
+					load<std::uint16_t, std::endian::little>(data.data() + pos) != 0U) {
+					const auto fill{lznt1_chunk_len - produced};
+					if (!out.reserve(fill)) {
+						return std::unexpected(decomp_error_t::TooLarge);
+					}
+					std::memset(out.tail(), 0, fill);
+					out.commit(fill);
+				}
+			}
+			return {};
+		}
+	}
+
+	#if defined(PANKO_WITH_BROTLI)
+	/* decompress_brotli - Decompress bytearray slice with brotli */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_brotli(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		output_t out{data->size() * default_ratio};
+		if (const auto res{unbrotli_into(out, *data)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+	#endif /* PANKO_WITH_BROTLI */
+
+	/* decompress_bz2 - Decompress bytearray slice with bz2 */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_bz2(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		output_t out{data->size() * default_ratio};
+		if (const auto res{bunzip_into(out, *data)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	/* decompress_deflate - Decompress bytearray slice with zlib deflate */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_deflate(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		const auto window_bits{deflate_window_bits(*data)};
+		output_t out{deflate_size_hint(*data, window_bits)};
+		if (const auto res{inflate_into(out, *data, window_bits)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	/* decompress_lz4 - Decompress bytearray slice with lz4 */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lz4(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+		if (data->size() < LZ4F_HEADER_SIZE_MIN) {
+			return std::unexpected(decomp_error_t::Truncated);
+		}
+
+		auto& dctx{codec_state().lz4()};
+		LZ4F_resetDecompressionContext(&dctx);
+
+		/* Decode the frame header up front for the content size, `header_len` is updated to the length of it */
+		LZ4F_frameInfo_t info{};
+		auto header_len{data->size()};
+		if (LZ4F_isError(LZ4F_getFrameInfo(&dctx, &info, data->data(), &header_len)) != 0U) {
+			return std::unexpected(decomp_error_t::Invalid);
+		}
+		if (info.contentSize > max_output) {
+			return std::unexpected(decomp_error_t::TooLarge);
+		}
+
+		/* The content size is only a hint, a frame claiming more than LZ4 could ever produce has to prove it */
+		output_t out{
+			info.contentSize != 0U ?
+				static_cast<std::size_t>(std::min<std::uint64_t>(info.contentSize, data->size() * lz4_max_ratio)) :
+				data->size() * default_ratio
+		};
+		if (const auto res{unlz4_into(out, dctx, data->subspan(header_len))}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	/* decompress_lz77 - Decompress bytearray slice with lz77 */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lz77(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		output_t out{data->size() * default_ratio};
+		if (const auto res{unlz77_into(out, *data)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	/* decompress_lz77huff - Decompress bytearray slice with lz77+huffman */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lz77huff(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		output_t out{data->size() * default_ratio};
+		if (const auto res{unlz77huff_into(out, codec_state().xpress, *data)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	/* decompress_lzma - Decompress bytearray slice with lzma */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lzma(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		output_t out{lzma_size_hint(*data)};
+		if (const auto res{unlzma_alone_into(out, *data)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	/* decompress_lznt1 - Decompress bytearray slice with lznt1 */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_lznt1(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		output_t out{lznt1_size_hint(*data)};
+		if (const auto res{unlznt1_into(out, *data)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	#if defined(PANKO_WITH_SNAPPY)
+	/* decompress_snappy - Decompress bytearray slice with snappy */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_snappy(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		const auto* const src{reinterpret_cast<const char*>(data->data())};
+		std::size_t size{};
+		if (!snappy::GetUncompressedLength(src, data->size(), &size)) {
+			return std::unexpected(decomp_error_t::Invalid);
+		}
+		/* The best snappy can do is 64 bytes out of a 3 byte copy, so anything claiming more is lying */
+		if ((size / 22zu) > data->size()) {
+			return std::unexpected(decomp_error_t::Invalid);
+		}
+		if (size > max_output) {
+			return std::unexpected(decomp_error_t::TooLarge);
+		}
+
+		/* snappy always tells us the exact size up front, so there is no need to ever grow the output */
+		output_t out{size};
+		if (!snappy::RawUncompress(src, data->size(), reinterpret_cast<char*>(out.tail()))) {
+			return std::unexpected(decomp_error_t::Invalid);
+		}
+		out.commit(size);
+		return into_bytearray(out);
+	}
+	#endif /* PANKO_WITH_SNAPPY */
+
+	/* decompress_xz - Decompress bytearray slice with xz */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_xz(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		output_t out{data->size() * default_ratio};
+		if (const auto res{unxz_into(out, *data)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	/* decompress_zstd - Decompress bytearray slice with zstd */
+	std::expected<bytearray_t, decomp_error_t> bytearray_t::decompress_zstd(const std::size_t idx, const std::size_t len) {
+		const auto data{compressed_range(_backing_span, idx, len)};
+		if (!data) {
+			return std::unexpected(data.error());
+		}
+
+		auto& dctx{codec_state().zstd()};
+		const auto content_size{ZSTD_getFrameContentSize(data->data(), data->size())};
+		if (content_size == ZSTD_CONTENTSIZE_ERROR) {
+			return std::unexpected(decomp_error_t::Invalid);
+		}
+		if (content_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+			output_t out{data->size() * default_ratio};
+			if (const auto res{unzstd_into(out, dctx, *data)}; !res) {
+				return std::unexpected(res.error());
+			}
+			return into_bytearray(out);
+		}
+		if (content_size > max_output) {
+			return std::unexpected(decomp_error_t::TooLarge);
+		}
+
+		/* The content size is only a hint, a frame claiming more than zstd could ever produce has to prove it */
+		output_t out{static_cast<std::size_t>(std::min<std::uint64_t>(content_size, data->size() * zstd_max_ratio))};
+		/* The common case of one frame with its size in the header can be done in one shot */
+		if (out.room() >= content_size && ZSTD_findFrameCompressedSize(data->data(), data->size()) == data->size()) {
+			const auto res{ZSTD_decompressDCtx(&dctx, out.tail(), out.room(), data->data(), data->size())};
+			if (ZSTD_isError(res) != 0U || res != content_size) {
+				return std::unexpected(decomp_error_t::Invalid);
+			}
+			out.commit(res);
+			return into_bytearray(out);
+		}
+
+		if (const auto res{unzstd_into(out, dctx, *data)}; !res) {
+			return std::unexpected(res.error());
+		}
+		return into_bytearray(out);
+	}
+
+	/* == Streaming decompression == */
+
+	struct decompressor_t::state_t final {
+	private:
+		stream_codec_t _codec;
+		z_stream _inflate{};
+		bool _inflate_ready{false};
+		bz_stream _bz2{};
+		bool _bz2_ready{false};
+		lzma_stream _lzma = LZMA_STREAM_INIT;
+		ZSTD_DCtx* _zstd{nullptr};
+		LZ4F_dctx* _lz4{nullptr};
+#if defined(PANKO_WITH_BROTLI)
+		BrotliDecoderState* _brotli{nullptr};
+#endif
+		/* The start of a DEFLATE stream, held until there is enough of it to tell what wrapper it has */
+		std::array<std::byte, 2zu> _head{};
+		std::size_t _head_len{};
+
+		/* Make room for the codec to write to, at most one byte more than `allowance` so going over it shows */
+		[[nodiscard]]
+		static std::expected<std::size_t, decomp_error_t> room_for(output_t& out, const std::size_t allowance) {
+			if (out.length() > allowance || !out.ensure_room()) {
+				return std::unexpected(decomp_error_t::TooLarge);
+			}
+			return std::min(out.room(), (allowance - out.length()) + 1zu);
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> pump_inflate(
+			output_t& out, const std::span<const std::byte> data, const std::size_t allowance
+		) {
+			auto& strm{_inflate};
+			std::size_t fed{};
+			while (true) {
+				if (strm.avail_in == 0U) {
+					if (fed == data.size()) {
+						return {};
+					}
+					const auto chunk{clamp_u32(data.size() - fed)};
+					strm.next_in = reinterpret_cast<const Bytef*>(data.data() + fed);
+					strm.avail_in = chunk;
+					fed += chunk;
+				}
+				const auto room{room_for(out, allowance)};
+				if (!room) {
+					return std::unexpected(room.error());
+				}
+
+				const auto avail{clamp_u32(*room)};
+				strm.next_out = reinterpret_cast<Bytef*>(out.tail());
+				strm.avail_out = avail;
+				const auto res{inflate(&strm, Z_NO_FLUSH)};
+				out.commit(avail - strm.avail_out);
+
+				switch (res) {
+					case Z_STREAM_END: {
+						done = true;
+						return {};
+					}
+					case Z_OK:
+					case Z_BUF_ERROR: break;
+					case Z_MEM_ERROR: throw std::bad_alloc{};
+					default: return std::unexpected(decomp_error_t::Invalid);
+				}
+
+				/* Room left over with all of the input used up means we have to wait for the next fragment */
+				if (strm.avail_out != 0U && strm.avail_in == 0U && fed == data.size()) {
+					return {};
+				}
+			}
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> pump_bunzip(
+			output_t& out, const std::span<const std::byte> data, const std::size_t allowance
+		) {
+			auto& strm{_bz2};
+			std::size_t fed{};
+			while (true) {
+				if (strm.avail_in == 0U) {
+					if (fed == data.size()) {
+						return {};
+					}
+					const auto chunk{clamp_u32(data.size() - fed)};
+					/* libbzip2 never writes through `next_in`, it's just not const */
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+					strm.next_in = const_cast<char*>(reinterpret_cast<const char*>(data.data() + fed));
+					strm.avail_in = chunk;
+					fed += chunk;
+				}
+				const auto room{room_for(out, allowance)};
+				if (!room) {
+					return std::unexpected(room.error());
+				}
+
+				const auto avail{clamp_u32(*room)};
+				strm.next_out = reinterpret_cast<char*>(out.tail());
+				strm.avail_out = avail;
+				const auto res{BZ2_bzDecompress(&strm)};
+				out.commit(avail - strm.avail_out);
+
+				switch (res) {
+					case BZ_STREAM_END: {
+						done = true;
+						return {};
+					}
+					case BZ_OK: break;
+					case BZ_MEM_ERROR: throw std::bad_alloc{};
+					default: return std::unexpected(decomp_error_t::Invalid);
+				}
+
+				if (strm.avail_out != 0U && strm.avail_in == 0U && fed == data.size()) {
+					return {};
+				}
+			}
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> pump_lzma(
+			output_t& out, const std::span<const std::byte> data, const std::size_t allowance
+		) {
+			auto& strm{_lzma};
+			strm.next_in = reinterpret_cast<const std::uint8_t*>(data.data());
+			strm.avail_in = data.size();
+
+			while (true) {
+				const auto room{room_for(out, allowance)};
+				if (!room) {
+					return std::unexpected(room.error());
+				}
+
+				strm.next_out = reinterpret_cast<std::uint8_t*>(out.tail());
+				strm.avail_out = *room;
+				const auto res{lzma_code(&strm, LZMA_RUN)};
+				out.commit(*room - strm.avail_out);
+
+				switch (res) {
+					case LZMA_STREAM_END: {
+						done = true;
+						return {};
+					}
+					case LZMA_OK: break;
+					/* No progress is only possible once the input has run out */
+					case LZMA_BUF_ERROR: return {};
+					case LZMA_MEMLIMIT_ERROR: return std::unexpected(decomp_error_t::TooLarge);
+					case LZMA_MEM_ERROR: throw std::bad_alloc{};
+					default: return std::unexpected(decomp_error_t::Invalid);
+				}
+
+				if (strm.avail_out != 0U && strm.avail_in == 0U) {
+					return {};
+				}
+			}
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> pump_unzstd(
+			output_t& out, const std::span<const std::byte> data, const std::size_t allowance
+		) {
+			ZSTD_inBuffer input{data.data(), data.size(), 0zu};
+			while (true) {
+				const auto room{room_for(out, allowance)};
+				if (!room) {
+					return std::unexpected(room.error());
+				}
+
+				ZSTD_outBuffer output{out.tail(), *room, 0zu};
+				const auto res{ZSTD_decompressStream(_zstd, &output, &input)};
+				out.commit(output.pos);
+
+				if (ZSTD_isError(res) != 0U) {
+					return std::unexpected(decomp_error_t::Invalid);
+				}
+				/* A result of 0 is the end of a frame, and any input after it is the next one */
+				done = res == 0zu;
+				if (input.pos == input.size && (done || output.pos != output.size)) {
+					return {};
+				}
+			}
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> pump_unlz4(
+			output_t& out, const std::span<const std::byte> data, const std::size_t allowance
+		) {
+			std::size_t offset{};
+			while (true) {
+				const auto room{room_for(out, allowance)};
+				if (!room) {
+					return std::unexpected(room.error());
+				}
+
+				auto produced{*room};
+				auto consumed{data.size() - offset};
+				const auto res{LZ4F_decompress(_lz4, out.tail(), &produced, data.data() + offset, &consumed, nullptr)};
+				out.commit(produced);
+				offset += consumed;
+
+				if (LZ4F_isError(res) != 0U) {
+					return std::unexpected(decomp_error_t::Invalid);
+				}
+				/* A result of 0 is the end of a frame, and any input after it is the next one */
+				done = res == 0zu;
+				if (offset == data.size() && (done || produced != *room)) {
+					return {};
+				}
+			}
+		}
+
+#if defined(PANKO_WITH_BROTLI)
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> pump_unbrotli(
+			output_t& out, const std::span<const std::byte> data, const std::size_t allowance
+		) {
+			auto avail_in{data.size()};
+			auto* next_in{reinterpret_cast<const std::uint8_t*>(data.data())};
+			while (true) {
+				const auto room{room_for(out, allowance)};
+				if (!room) {
+					return std::unexpected(room.error());
+				}
+
+				auto avail_out{*room};
+				auto* next_out{reinterpret_cast<std::uint8_t*>(out.tail())};
+				const auto res{BrotliDecoderDecompressStream(_brotli, &avail_in, &next_in, &avail_out, &next_out, nullptr)};
+				out.commit(*room - avail_out);
+
+				switch (res) {
+					case BROTLI_DECODER_RESULT_SUCCESS: {
+						done = true;
+						return {};
+					}
+					case BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT: break;
+					case BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT: return {};
+					case BROTLI_DECODER_RESULT_ERROR:
+					default: return std::unexpected(decomp_error_t::Invalid);
+				}
+			}
+		}
+#endif
+
+		/* Once the first two bytes of a DEFLATE stream are in, set up the inflater for the wrapper it has */
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> start_inflate(const int window_bits) {
+			if (!_inflate_ready) {
+				if (inflateInit2(&_inflate, window_bits) != Z_OK) {
+					throw std::bad_alloc{};
+				}
+				_inflate_ready = true;
+				return {};
+			}
+			if (inflateReset2(&_inflate, window_bits) != Z_OK) {
+				return std::unexpected(decomp_error_t::Unspecified);
+			}
+			_inflate.avail_in = 0U;
+			return {};
+		}
+
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> pump_deflate(
+			output_t& out, std::span<const std::byte> data, const std::size_t allowance
+		) {
+			if (_head_len < _head.size()) {
+				const auto take{std::min(_head.size() - _head_len, data.size())};
+				std::memcpy(_head.data() + _head_len, data.data(), take);
+				_head_len += take;
+				data = data.subspan(take);
+				if (_head_len < _head.size()) {
+					return {};
+				}
+
+				if (const auto res{start_inflate(deflate_window_bits(_head))}; !res) {
+					return res;
+				}
+				if (const auto res{pump_inflate(out, _head, allowance)}; !res || done) {
+					return res;
+				}
+			}
+			return pump_inflate(out, data, allowance);
+		}
+	public:
+		decompress_limits_t limits;
+		std::size_t total_in{};
+		std::size_t total_out{};
+		bool done{false};
+		std::optional<decomp_error_t> error{std::nullopt};
+
+		state_t(const stream_codec_t codec, const decompress_limits_t lims) :
+			_codec{codec}, limits{lims}
+		{
+			start();
+		}
+
+		state_t(const state_t&) = delete;
+		state_t& operator=(const state_t&) = delete;
+		state_t(state_t&&) = delete;
+		state_t& operator=(state_t&&) = delete;
+
+		~state_t() noexcept {
+			if (_inflate_ready) {
+				inflateEnd(&_inflate);
+			}
+			if (_bz2_ready) {
+				BZ2_bzDecompressEnd(&_bz2);
+			}
+			lzma_end(&_lzma);
+			ZSTD_freeDCtx(_zstd);
+			if (_lz4 != nullptr) {
+				LZ4F_freeDecompressionContext(_lz4);
+			}
+#if defined(PANKO_WITH_BROTLI)
+			if (_brotli != nullptr) {
+				BrotliDecoderDestroyInstance(_brotli);
+			}
+#endif
+		}
+
+		/* Get the codec ready for the start of a stream, reusing whatever it already has where possible */
+		void start() {
+			total_in = 0zu;
+			total_out = 0zu;
+			done = false;
+			error = std::nullopt;
+			_head_len = 0zu;
+
+			const auto lzma_init = [this](const lzma_ret res) {
+				switch (res) {
+					case LZMA_OK: break;
+					case LZMA_MEM_ERROR: throw std::bad_alloc{};
+					default: error = decomp_error_t::Unspecified;
+				}
+			};
+
+			switch (_codec) {
+#if defined(PANKO_WITH_BROTLI)
+				case stream_codec_t::Brotli: {
+					/* There is no way to reset a brotli decoder, so it has to be rebuilt */
+					if (_brotli != nullptr) {
+						BrotliDecoderDestroyInstance(std::exchange(_brotli, nullptr));
+					}
+					_brotli = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+					if (_brotli == nullptr) {
+						throw std::bad_alloc{};
+					}
+					break;
+				}
+#endif
+				case stream_codec_t::Bz2: {
+					/* Likewise for libbzip2 */
+					if (std::exchange(_bz2_ready, false)) {
+						BZ2_bzDecompressEnd(&_bz2);
+					}
+					_bz2 = bz_stream{};
+					if (const auto res{BZ2_bzDecompressInit(&_bz2, 0, 0)}; res != BZ_OK) {
+						if (res == BZ_MEM_ERROR) {
+							throw std::bad_alloc{};
+						}
+						error = decomp_error_t::Unspecified;
+						break;
+					}
+					_bz2_ready = true;
+					break;
+				}
+				/* The inflater is set up once the wrapper is known */
+				case stream_codec_t::Deflate: break;
+				case stream_codec_t::Lz4: {
+					if (_lz4 == nullptr) {
+						if (LZ4F_isError(LZ4F_createDecompressionContext(&_lz4, LZ4F_VERSION)) != 0U) {
+							_lz4 = nullptr;
+							throw std::bad_alloc{};
+						}
+					} else {
+						LZ4F_resetDecompressionContext(_lz4);
+					}
+					break;
+				}
+				case stream_codec_t::Lzma: {
+					lzma_init(lzma_alone_decoder(&_lzma, lzma_memlimit));
+					break;
+				}
+				case stream_codec_t::Xz: {
+					lzma_init(lzma_stream_decoder(&_lzma, lzma_memlimit, 0U));
+					break;
+				}
+				case stream_codec_t::Zstd: {
+					if (_zstd == nullptr) {
+						_zstd = ZSTD_createDCtx();
+						if (_zstd == nullptr) {
+							throw std::bad_alloc{};
+						}
+					} else {
+						ZSTD_DCtx_reset(_zstd, ZSTD_reset_session_only);
+					}
+					break;
+				}
+			}
+		}
+
+		/* Zstandard and LZ4 streams can have any number of frames, so there is no telling where they end */
+		[[nodiscard]]
+		bool concatenates() const noexcept {
+			return _codec == stream_codec_t::Zstd || _codec == stream_codec_t::Lz4;
+		}
+
+		/* Decompress all of `data` into `out`, writing no more than `allowance` bytes */
+		[[nodiscard]]
+		std::expected<void, decomp_error_t> pump(
+			output_t& out, const std::span<const std::byte> data, const std::size_t allowance
+		) {
+			switch (_codec) {
+#if defined(PANKO_WITH_BROTLI)
+				case stream_codec_t::Brotli: return pump_unbrotli(out, data, allowance);
+#endif
+				case stream_codec_t::Bz2: return pump_bunzip(out, data, allowance);
+				case stream_codec_t::Deflate: return pump_deflate(out, data, allowance);
+				case stream_codec_t::Lz4: return pump_unlz4(out, data, allowance);
+				case stream_codec_t::Lzma:
+				case stream_codec_t::Xz: return pump_lzma(out, data, allowance);
+				case stream_codec_t::Zstd: return pump_unzstd(out, data, allowance);
+			}
+			return std::unexpected(decomp_error_t::Unspecified);
+		}
+
+		/* How much more output the limits allow, given the input fed so far */
+		[[nodiscard]]
+		std::size_t allowance() const noexcept {
+			auto allowed{limits.max_output - std::min(total_out, limits.max_output)};
+			if (limits.max_ratio != 0zu) {
+				const auto ratio_cap{
+					total_in > (std::numeric_limits<std::size_t>::max() / limits.max_ratio) ?
+						std::numeric_limits<std::size_t>::max() : total_in * limits.max_ratio
+				};
+				allowed = std::min(allowed, ratio_cap - std::min(total_out, ratio_cap));
+			}
+			return allowed;
+		}
+	};
+
+	decompressor_t::decompressor_t(const stream_codec_t codec, const decompress_limits_t limits) :
+		_state{std::make_unique<state_t>(codec, limits)}
+	{ }
+
+	decompressor_t::decompressor_t(decompressor_t&&) noexcept = default;
+	decompressor_t& decompressor_t::operator=(decompressor_t&&) noexcept = default;
+	decompressor_t::~decompressor_t() noexcept = default;
+
+	std::expected<bytearray_t, decomp_error_t> decompressor_t::feed(const std::span<const std::byte> fragment) {
+		auto& state{*_state};
+		if (state.error) {
+			return std::unexpected(*state.error);
+		}
+
+		state.total_in += fragment.size();
+		if (fragment.empty() || (state.done && !state.concatenates())) {
+			return std::expected<bytearray_t, decomp_error_t>{std::in_place};
+		}
+
+		const auto allowance{state.allowance()};
+		output_t out{std::min(fragment.size() * default_ratio, allowance)};
+		auto res{state.pump(out, fragment, allowance)};
+		state.total_out += out.length();
+		/* Room is given for one byte past the limit, so going over it can be told apart from ending right on it */
+		if (res && out.length() > allowance) {
+			res = std::unexpected(decomp_error_t::TooLarge);
+		}
+		if (!res) {
+			state.error = res.error();
+			return std::unexpected(res.error());
+		}
+
+		if (out.length() == 0zu) {
+			return std::expected<bytearray_t, decomp_error_t>{std::in_place};
+		}
+		return into_bytearray(out);
+	}
+
+	std::expected<void, decomp_error_t> decompressor_t::finish() const noexcept {
+		if (_state->error) {
+			return std::unexpected(*_state->error);
+		}
+		if (!_state->done) {
+			return std::unexpected(decomp_error_t::Truncated);
+		}
+		return {};
+	}
+
+	void decompressor_t::reset() {
+		_state->start();
+	}
+
+	bool decompressor_t::done() const noexcept {
+		return _state->done;
+	}
+
+	std::size_t decompressor_t::total_in() const noexcept {
+		return _state->total_in;
+	}
+
+	std::size_t decompressor_t::total_out() const noexcept {
+		return _state->total_out;
+	}
+}
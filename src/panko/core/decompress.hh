@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* decompress.hh - Incremental decompression of data that arrives in fragments */
+#pragma once
+#if !defined(PANKO_CORE_DECOMPRESS_HH)
+#define PANKO_CORE_DECOMPRESS_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <span>
+
+#include "panko/config.hh"
+#include "panko/internal/defs.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/errcodes.hh"
+
+namespace Panko::core {
+	using Panko::core::error_codes::decomp_error_t;
+
+	/*! \brief The compression formats `decompressor_t` can decode incrementally
+
+		These are the streaming formats of the `bytearray_t::decompress_*` methods, the MS-XCA formats and
+		snappy are block formats that need all of their input up front.
+	*/
+	enum struct stream_codec_t : std::uint8_t {
+#if defined(PANKO_WITH_BROTLI)
+		Brotli,
+#endif
+		Bz2,
+		/*! DEFLATE with a gzip, zlib, or no wrapper, detected from the first two bytes */
+		Deflate,
+		/*! LZ4 frame format, any number of frames */
+		Lz4,
+		/*! The legacy .lzma format */
+		Lzma,
+		Xz,
+		/*! Zstandard, any number of frames */
+		Zstd,
+	};
+
+	/*! \brief Bounds on how much a `decompressor_t` is allowed to produce
+
+		Both limits are checked as the output is produced, so a decompression bomb is stopped once it reaches
+		the limit, not after it has been fully inflated into memory.
+	*/
+	struct decompress_limits_t final {
+		/*! \brief The most output the whole stream may decompress to, 256MiB by default */
+		std::size_t max_output{256zu * 1024zu * 1024zu};
+		/*! \brief The most output allowed for each byte of input fed so far, or 0 for no limit */
+		std::size_t max_ratio{0zu};
+	};
+
+	/*! \struct Panko::core::decompressor_t
+		\brief Decompresses a stream that is fed in as a sequence of fragments
+
+		Rather than reassembling something like a TCP stream or a chunked HTTP body into one buffer and then
+		decompressing it, each fragment is fed in as it arrives and the output it decompresses to is handed
+		back straight away. The codec state is kept between calls, so fragments can be split anywhere.
+
+		Once an error has been returned the decompressor is stuck in that error until it is `reset()`.
+	*/
+	struct decompressor_t final {
+	private:
+		struct state_t;
+		std::unique_ptr<state_t> _state;
+	public:
+		/*! \brief Construct a decompressor for a new stream.
+
+			\param codec The compression format of the stream.
+			\param limits The bounds on the decompressed output.
+			\throws std::bad_alloc If the codec state could not be allocated.
+		*/
+		explicit decompressor_t(stream_codec_t codec, decompress_limits_t limits = {});
+
+		decompressor_t(const decompressor_t&) = delete;
+		decompressor_t& operator=(const decompressor_t&) = delete;
+
+		decompressor_t(decompressor_t&&) noexcept;
+		decompressor_t& operator=(decompressor_t&&) noexcept;
+
+		~decompressor_t() noexcept;
+
+		/*! \brief Feed the next fragment of the compressed stream.
+
+			All of `fragment` is consumed, and it does not need to outlive the call. Any input after the end of
+			the stream is ignored, apart from for Zstandard and LZ4 where it is taken to be the next frame.
+
+			\note
+			The returned `bytearray_t` owns it's buffer, and is empty if the fragment did not complete any
+			output, such as when it only held part of a header.
+
+			\param fragment The next fragment of compressed data.
+			\returns The data decompressed from this fragment, or the error the stream hit.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::expected<bytearray_t, decomp_error_t> feed(std::span<const std::byte> fragment);
+
+		/*! \brief Feed the next fragment of the compressed stream.
+
+			\see feed(std::span<const std::byte>)
+		*/
+		[[nodiscard]]
+		std::expected<bytearray_t, decomp_error_t> feed(const bytearray_t& fragment) {
+			return feed(std::span<const std::byte>{fragment.data(), fragment.length()});
+		}
+
+		/*! \brief Check that the stream was complete, once there is no more input to feed.
+
+			\returns Nothing if the end of the stream was reached, otherwise `decomp_error_t::Truncated` or the
+			error the stream hit.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::expected<void, decomp_error_t> finish() const noexcept;
+
+		/*! \brief Start over with a new stream of the same format and limits.
+
+			The codec state is reset rather than rebuilt where the codec allows it.
+		*/
+		PANKO_CLS_API void reset();
+
+		/*! \brief Returns if the end of the stream has been reached */
+		[[nodiscard]]
+		PANKO_CLS_API bool done() const noexcept;
+
+		/*! \brief Returns the number of compressed bytes fed in so far */
+		[[nodiscard]]
+		PANKO_CLS_API std::size_t total_in() const noexcept;
+
+		/*! \brief Returns the number of bytes decompressed so far */
+		[[nodiscard]]
+		PANKO_CLS_API std::size_t total_out() const noexcept;
+	};
+}
+
+#endif /* PANKO_CORE_DECOMPRESS_HH */
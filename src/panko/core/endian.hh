@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* endian.hh - Unaligned, endian-aware loads and stores */
+
+#pragma once
+#if !defined(PANKO_CORE_ENDIAN_HH)
+#define PANKO_CORE_ENDIAN_HH
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdfloat>
+#include <type_traits>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/integers.hh"
+
+namespace Panko::core {
+	using Panko::core::integers::is_intn_v;
+
+	/*! \brief The number of bytes a value of type `T` occupies on the wire.
+
+		For the odd-width `intN_t` types this is the number of whole bytes needed to hold `T::bits`,
+		for everything else it is just `sizeof(T)`.
+	*/
+	template<typename T>
+	constexpr inline std::size_t wire_size_v{[]() {
+		if constexpr (is_intn_v<T>) {
+			return (T::bits + 7zu) / 8zu;
+		} else {
+			return sizeof(T);
+		}
+	}()};
+
+	namespace _impl {
+		template<std::size_t len>
+		using uint_for = std::conditional_t<(len <= 1zu), std::uint8_t,
+			std::conditional_t<(len <= 2zu), std::uint16_t,
+			std::conditional_t<(len <= 4zu), std::uint32_t, std::uint64_t>>>;
+
+		/* Load `len` bytes into the low bytes of an unsigned integer, interpreted with `endian` */
+		template<std::size_t len, std::endian endian>
+		[[nodiscard, gnu::always_inline]]
+		inline uint_for<len> load_raw(const std::byte* const ptr) noexcept {
+			using U = uint_for<len>;
+			static_assert(len != 0zu && len <= sizeof(U), "Invalid load width");
+
+			U value{};
+			if constexpr (std::endian::native == std::endian::little) {
+				std::memcpy(&value, ptr, len);
+				if constexpr (endian == std::endian::big) {
+					value = std::byteswap(value);
+					if constexpr (len != sizeof(U)) {
+						value = U(value >> ((sizeof(U) - len) * 8zu));
+					}
+				}
+			} else {
+				std::memcpy(reinterpret_cast<std::byte*>(&value) + (sizeof(U) - len), ptr, len);
+				if constexpr (endian == std::endian::little) {
+					value = std::byteswap(value);
+					if constexpr (len != sizeof(U)) {
+						value = U(value >> ((sizeof(U) - len) * 8zu));
+					}
+				}
+			}
+			return value;
+		}
+
+		/* Store the low `len` bytes of `value` with `endian` */
+		template<std::size_t len, std::endian endian>
+		[[gnu::always_inline]]
+		inline void store_raw(std::byte* const ptr, uint_for<len> value) noexcept {
+			using U = uint_for<len>;
+			static_assert(len != 0zu && len <= sizeof(U), "Invalid store width");
+
+			if constexpr (endian != std::endian::native) {
+				value = std::byteswap(value);
+			}
+
+			/* Once in the wire byte order, little endian values start at the lowest address */
+			constexpr auto offset{(endian == std::endian::little) ? 0zu : sizeof(U) - len};
+			std::memcpy(ptr, reinterpret_cast<const std::byte*>(&value) + offset, len);
+		}
+	}
+
+	/*! \brief Load a value of type `T` from a possibly unaligned address.
+
+		This performs no bounds checking what so ever, the caller must ensure that at least `wire_size_v<T>`
+		bytes are readable from `ptr`.
+
+		\tparam T The type to load, integral, floating point, or one of the `intN_t` types.
+		\tparam endian The endian of the value in memory.
+		\param ptr The address to load from.
+	*/
+	template<typename T, std::endian endian>
+	[[nodiscard, gnu::always_inline]]
+	inline T load(const std::byte* const ptr) noexcept {
+		constexpr auto len{wire_size_v<T>};
+
+		if constexpr (is_intn_v<T>) {
+			return T{_impl::load_raw<len, endian>(ptr)};
+		} else if constexpr (std::is_floating_point_v<T>) {
+			return std::bit_cast<T>(_impl::load_raw<len, endian>(ptr));
+		} else if constexpr (std::is_enum_v<T>) {
+			return static_cast<T>(_impl::load_raw<len, endian>(ptr));
+		} else {
+			static_assert(std::is_integral_v<T>, "T must be an integral, floating point, enum, or intN_t type");
+			return static_cast<T>(_impl::load_raw<len, endian>(ptr));
+		}
+	}
+
+	/*! \brief Store a value of type `T` to a possibly unaligned address.
+
+		This performs no bounds checking what so ever, the caller must ensure that at least `wire_size_v<T>`
+		bytes are writable at `ptr`.
+
+		\tparam T The type to store, integral, floating point, or one of the `intN_t` types.
+		\tparam endian The endian to store the value in.
+		\param ptr The address to store to.
+		\param value The value to store.
+	*/
+	template<typename T, std::endian endian>
+	[[gnu::always_inline]]
+	inline void store(std::byte* const ptr, const T value) noexcept {
+		constexpr auto len{wire_size_v<T>};
+		using U = _impl::uint_for<len>;
+
+		if constexpr (is_intn_v<T>) {
+			using V = std::make_unsigned_t<typename T::v_type>;
+			_impl::store_raw<len, endian>(ptr, static_cast<U>(static_cast<V>(static_cast<typename T::v_type>(value)) & T::computed_mask));
+		} else if constexpr (std::is_floating_point_v<T>) {
+			_impl::store_raw<len, endian>(ptr, std::bit_cast<U>(value));
+		} else {
+			_impl::store_raw<len, endian>(ptr, static_cast<U>(value));
+		}
+	}
+}
+
+#endif /* PANKO_CORE_ENDIAN_HH */
@@ -34,6 +34,8 @@ namespace Panko::core::error_codes {
 				return "String is not valid for the given encoding"sv;
 			} case strdec_error_t::Malformed: {
 				return "String is malformed"sv;
+			} case strdec_error_t::Overrun: {
+				return "String overruns the end of the buffer"sv;
 			} case strdec_error_t::Unspecified:
 			default: {
 				return "Unspecified string decoding error"sv;
@@ -45,9 +47,64 @@ namespace Panko::core::error_codes {
 		switch (err) {
 			case decomp_error_t::Invalid: {
 				return "Input buffer is not valid compressed data"sv;
+			} case decomp_error_t::Truncated: {
+				return "Compressed data ends before the end of the stream"sv;
+			} case decomp_error_t::Overrun: {
+				return "Compressed data overruns the end of the buffer"sv;
+			} case decomp_error_t::TooLarge: {
+				return "Decompressed data exceeds the output size limit"sv;
 			} case decomp_error_t::Unspecified:
 			default: {
-				return "Unspecified string decoding error"sv;
+				return "Unspecified decompression error"sv;
+			}
+		}
+	}
+
+	const std::string_view read_error_message(read_error_t err) noexcept {
+		switch (err) {
+			case read_error_t::Truncated: {
+				return "Not enough data remaining in buffer"sv;
+			} case read_error_t::Malformed: {
+				return "Malformed encoding in buffer"sv;
+			} case read_error_t::Unspecified:
+			default: {
+				return "Unspecified buffer read error"sv;
+			}
+		}
+	}
+
+	const std::string_view so_error_message(so_error_t err) noexcept {
+		switch (err) {
+			case so_error_t::OpenFailed: {
+				return "Unable to load the dissector shared object"sv;
+			} case so_error_t::NoEntryPoint: {
+				return "Shared object does not export a dissector entry point"sv;
+			} case so_error_t::AbiMismatch: {
+				return "Dissector was built for a different dissector ABI version"sv;
+			} case so_error_t::Invalid: {
+				return "Dissector descriptor is invalid"sv;
+			} case so_error_t::InitFailed: {
+				return "Dissector failed to initialize"sv;
+			} case so_error_t::TooMany: {
+				return "Too many dissectors loaded"sv;
+			} case so_error_t::Unspecified:
+			default: {
+				return "Unspecified dissector loading error"sv;
+			}
+		}
+	}
+
+	const std::string_view field_error_message(field_error_t err) noexcept {
+		switch (err) {
+			case field_error_t::TypeMismatch: {
+				return "Field is already registered with a different type"sv;
+			} case field_error_t::InvalidName: {
+				return "Field name is empty"sv;
+			} case field_error_t::TooMany: {
+				return "Too many fields registered"sv;
+			} case field_error_t::Unspecified:
+			default: {
+				return "Unspecified field registration error"sv;
 			}
 		}
 	}
@@ -42,12 +42,53 @@ namespace Panko::core::error_codes {
 		\brief Possible data decompression errors
 	*/
 	enum struct decomp_error_t : std::uint8_t {
-		Invalid = 0x00U, /*!< The input buffer is invalid. */
+		Invalid   = 0x00U, /*!< The input buffer is invalid. */
+		Truncated = 0x01U, /*!< The compressed data ends before the end of the stream */
+		Overrun   = 0x02U, /*!< The compressed data overruns the buffer */
+		TooLarge  = 0x03U, /*!< The decompressed data exceeds the output size limit */
 		/* Ensure that the Unspecified error is always the last one, no matter the type */
 		// NOLINTNEXTLINE(cert-int09-c)
 		Unspecified = std::numeric_limits<std::underlying_type_t<decomp_error_t>>::max() /*!< Unspecified Error */
 	};
 
+	/*! \enum Panko::core::error_codes::read_error_t
+		\brief Possible buffer reading errors
+	*/
+	enum struct read_error_t : std::uint8_t {
+		Truncated = 0x00U, /*!< Not enough data remains in the buffer */
+		Malformed = 0x01U, /*!< The data is not a valid encoding of the value */
+		/* Ensure that the Unspecified error is always the last one, no matter the type */
+		// NOLINTNEXTLINE(cert-int09-c)
+		Unspecified = std::numeric_limits<std::underlying_type_t<read_error_t>>::max() /*!< Unspecified Error */
+	};
+
+	/*! \enum Panko::core::error_codes::so_error_t
+		\brief Possible native dissector loading errors
+	*/
+	enum struct so_error_t : std::uint8_t {
+		OpenFailed   = 0x00U, /*!< The shared object could not be loaded */
+		NoEntryPoint = 0x01U, /*!< The shared object does not export a dissector entry point */
+		AbiMismatch  = 0x02U, /*!< The dissector was built for a different dissector ABI version */
+		Invalid      = 0x03U, /*!< The dissector descriptor is missing required fields */
+		InitFailed   = 0x04U, /*!< The dissector failed to initialize */
+		TooMany      = 0x05U, /*!< There are no more dissector IDs left to assign */
+		/* Ensure that the Unspecified error is always the last one, no matter the type */
+		// NOLINTNEXTLINE(cert-int09-c)
+		Unspecified = std::numeric_limits<std::underlying_type_t<so_error_t>>::max() /*!< Unspecified Error */
+	};
+
+	/*! \enum Panko::core::error_codes::field_error_t
+		\brief Possible dissector field registration errors
+	*/
+	enum struct field_error_t : std::uint8_t {
+		TypeMismatch = 0x00U, /*!< The field is already registered with a different type */
+		InvalidName  = 0x01U, /*!< The field name is empty */
+		TooMany      = 0x02U, /*!< There are no more field IDs left to assign */
+		/* Ensure that the Unspecified error is always the last one, no matter the type */
+		// NOLINTNEXTLINE(cert-int09-c)
+		Unspecified = std::numeric_limits<std::underlying_type_t<field_error_t>>::max() /*!< Unspecified Error */
+	};
+
 	/*! \brief Return a human readable string describing the File I/O error.
 
 		This returns a non-localized string describing the meaning of the `file_error_t` if possible.
@@ -80,6 +121,39 @@ namespace Panko::core::error_codes {
 	*/
 	[[nodiscard]]
 	PANKO_API const std::string_view decomp_error_message(decomp_error_t err) noexcept;
+
+	/*! \brief Return a human readable string describing the buffer read error.
+
+		This returns a non-localized string describing the meaning of the `read_error_t` if possible.
+
+		For localization, this should be fed into the translation engine for the front-end.
+
+		\param err The error to describe.
+	*/
+	[[nodiscard]]
+	PANKO_API const std::string_view read_error_message(read_error_t err) noexcept;
+
+	/*! \brief Return a human readable string describing the native dissector loading error.
+
+		This returns a non-localized string describing the meaning of the `so_error_t` if possible.
+
+		For localization, this should be fed into the translation engine for the front-end.
+
+		\param err The error to describe.
+	*/
+	[[nodiscard]]
+	PANKO_API const std::string_view so_error_message(so_error_t err) noexcept;
+
+	/*! \brief Return a human readable string describing the field registration error.
+
+		This returns a non-localized string describing the meaning of the `field_error_t` if possible.
+
+		For localization, this should be fed into the translation engine for the front-end.
+
+		\param err The error to describe.
+	*/
+	[[nodiscard]]
+	PANKO_API const std::string_view field_error_message(field_error_t err) noexcept;
 }
 
 #endif /* PANKO_CORE_ERRCODES_HH */
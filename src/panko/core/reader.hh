@@ -0,0 +1,284 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* reader.hh - Checked-once, non-throwing read cursor over a `bytearray_t` */
+
+#pragma once
+#if !defined(PANKO_CORE_READER_HH)
+#define PANKO_CORE_READER_HH
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/endian.hh"
+#include "panko/core/errcodes.hh"
+
+namespace Panko::core {
+	using Panko::core::error_codes::read_error_t;
+
+	/*! \brief A non-owning, non-throwing read cursor over a `bytearray_t`.
+
+		Unlike `bytearray_t::at` and `bytearray_t::next`, the `reader_t` never throws. It is intended to
+		be used in dissectors where truncated and malformed data is the norm rather than the exception.
+
+		There are three tiers of access:
+		 * `require(len)` followed by the `*_unchecked` methods, the length of a whole header is
+		   validated once and then each field is read with no further bounds checks.
+		 * `next<T, endian>()` and friends, which bounds check each field and return a `std::expected`.
+		 * `next_or<T, endian>(fallback)` and friends, which return the fallback on truncation and set
+		   the sticky `truncated()` flag, which can then be checked once at the end of a run of reads.
+
+		Any failed bounds check sets the sticky `truncated()` flag, and once set all further checked
+		accesses fail.
+
+		\code{.cc}
+		reader_t rdr{buffer};
+		if (!rdr.require(8zu)) {
+			return;
+		}
+		const auto type{rdr.next_unchecked<std::uint16_t, std::endian::big>()};
+		const auto len{rdr.next_unchecked<std::uint16_t, std::endian::big>()};
+		const auto seq{rdr.next_unchecked<std::uint32_t, std::endian::big>()};
+		\endcode
+
+		\warning The `reader_t` does not hold a reference to the backing storage of the `bytearray_t`
+		it was constructed from, so the `bytearray_t` must outlive it.
+	*/
+	struct reader_t final {
+		using byte_t = std::byte;
+	private:
+		const byte_t* _data{nullptr};
+		std::size_t _length{};
+		std::size_t _offset{};
+		bool _truncated{false};
+	public:
+		constexpr reader_t() noexcept = default;
+
+		/*! \brief Construct a `reader_t` over the whole of a `bytearray_t` */
+		reader_t(const bytearray_t& buffer) noexcept :
+			_data{buffer.data()}, _length{buffer.length()}
+		{ }
+
+		/*! \brief Construct a `reader_t` over a span of bytes */
+		constexpr reader_t(const std::span<const byte_t> buffer) noexcept :
+			_data{buffer.data()}, _length{buffer.size()}
+		{ }
+
+		constexpr reader_t(const reader_t&) noexcept = default;
+		constexpr reader_t(reader_t&&) noexcept = default;
+		constexpr reader_t& operator=(const reader_t&) noexcept = default;
+		constexpr reader_t& operator=(reader_t&&) noexcept = default;
+		~reader_t() noexcept = default;
+
+		/*! \brief Returns the total length of the data this reader is over */
+		[[nodiscard]]
+		constexpr std::size_t length() const noexcept {
+			return _length;
+		}
+
+		/*! \brief Returns the current read offset */
+		[[nodiscard]]
+		constexpr std::size_t offset() const noexcept {
+			return _offset;
+		}
+
+		/*! \brief Returns the number of bytes remaining after the current read offset */
+		[[nodiscard]]
+		constexpr std::size_t remaining() const noexcept {
+			return _length - _offset;
+		}
+
+		/*! \brief Returns true if any bounds check on this reader has failed */
+		[[nodiscard]]
+		constexpr bool truncated() const noexcept {
+			return _truncated;
+		}
+
+		/*! \brief Returns true if no bounds check on this reader has failed */
+		[[nodiscard]]
+		constexpr bool ok() const noexcept {
+			return !_truncated;
+		}
+
+		[[nodiscard]]
+		constexpr explicit operator bool() const noexcept {
+			return ok();
+		}
+
+		/*! \brief Returns a span over the bytes remaining in the reader */
+		[[nodiscard]]
+		constexpr std::span<const byte_t> rest() const noexcept {
+			return {_data + _offset, remaining()};
+		}
+
+		/* == Checked once == */
+
+		/*! \brief Ensure at least `len` bytes are available from the current offset.
+
+			If this returns true, then `len` bytes worth of `*_unchecked` reads can be done safely. If it
+			returns false, then the sticky `truncated()` flag is set.
+
+			\param len The number of bytes needed.
+		*/
+		[[nodiscard]]
+		constexpr bool require(const std::size_t len) noexcept {
+			if (_truncated || remaining() < len) [[unlikely]] {
+				_truncated = true;
+				return false;
+			}
+			return true;
+		}
+
+		/*! \brief Read the next value of type `T` without any bounds checking.
+
+			\warning This must only be used after a successful call to `require` that covers this read.
+
+			\tparam T The type to extract.
+			\tparam endian The endian of the type to extract.
+		*/
+		template<typename T, std::endian endian>
+		[[nodiscard, gnu::always_inline]]
+		T next_unchecked() noexcept {
+			const auto value{load<T, endian>(_data + _offset)};
+			_offset += wire_size_v<T>;
+			return value;
+		}
+
+		/*! \brief Read a value of type `T` at `off` bytes past the current offset without any bounds
+			checking, and without advancing.
+
+			\warning This must only be used after a successful call to `require` that covers this read.
+
+			\tparam T The type to extract.
+			\tparam endian The endian of the type to extract.
+			\param off The offset past the current read offset.
+		*/
+		template<typename T, std::endian endian>
+		[[nodiscard, gnu::always_inline]]
+		T peek_unchecked(const std::size_t off = 0zu) const noexcept {
+			return load<T, endian>(_data + _offset + off);
+		}
+
+		/*! \brief Advance the read offset by `len` bytes without any bounds checking.
+
+			\warning This must only be used after a successful call to `require` that covers this skip.
+		*/
+		[[gnu::always_inline]]
+		constexpr void skip_unchecked(const std::size_t len) noexcept {
+			_offset += len;
+		}
+
+		/* == Checked per-access == */
+
+		/*! \brief Read the next value of type `T`.
+
+			\tparam T The type to extract.
+			\tparam endian The endian of the type to extract.
+			\returns The value, or `read_error_t::Truncated` if there is not enough data remaining.
+		*/
+		template<typename T, std::endian endian>
+		[[nodiscard]]
+		std::expected<T, read_error_t> next() noexcept {
+			if (!require(wire_size_v<T>)) [[unlikely]] {
+				return std::unexpected(read_error_t::Truncated);
+			}
+			return next_unchecked<T, endian>();
+		}
+
+		/*! \brief Read a value of type `T` at `off` bytes past the current offset without advancing.
+
+			As this does not modify the reader, a failed peek does not set the sticky `truncated()` flag.
+
+			\tparam T The type to extract.
+			\tparam endian The endian of the type to extract.
+			\param off The offset past the current read offset.
+			\returns The value, or `read_error_t::Truncated` if there is not enough data remaining.
+		*/
+		template<typename T, std::endian endian>
+		[[nodiscard]]
+		std::expected<T, read_error_t> peek(const std::size_t off = 0zu) const noexcept {
+			if (_truncated || off > remaining() || (remaining() - off) < wire_size_v<T>) [[unlikely]] {
+				return std::unexpected(read_error_t::Truncated);
+			}
+			return peek_unchecked<T, endian>(off);
+		}
+
+		/*! \brief Read the next value of type `T`, or return `fallback` if there is not enough data.
+
+			This is intended for runs of reads where the `truncated()` flag is checked once at the end.
+
+			\tparam T The type to extract.
+			\tparam endian The endian of the type to extract.
+			\param fallback The value returned when the read is out of bounds.
+		*/
+		template<typename T, std::endian endian>
+		[[nodiscard]]
+		T next_or(const T fallback = T{}) noexcept {
+			if (!require(wire_size_v<T>)) [[unlikely]] {
+				return fallback;
+			}
+			return next_unchecked<T, endian>();
+		}
+
+		/*! \brief Advance the read offset by `len` bytes.
+
+			\returns true if the skip was in bounds, false otherwise.
+		*/
+		constexpr bool skip(const std::size_t len) noexcept {
+			if (!require(len)) [[unlikely]] {
+				return false;
+			}
+			skip_unchecked(len);
+			return true;
+		}
+
+		/*! \brief Set the read offset to the absolute offset `off`.
+
+			\returns true if the offset is in bounds, false otherwise.
+		*/
+		constexpr bool seek(const std::size_t off) noexcept {
+			if (_truncated || off > _length) [[unlikely]] {
+				_truncated = true;
+				return false;
+			}
+			_offset = off;
+			return true;
+		}
+
+		/*! \brief Consume the next `len` bytes as a span.
+
+			\returns The span, or `read_error_t::Truncated` if there is not enough data remaining.
+		*/
+		[[nodiscard]]
+		constexpr std::expected<std::span<const byte_t>, read_error_t> bytes(const std::size_t len) noexcept {
+			if (!require(len)) [[unlikely]] {
+				return std::unexpected(read_error_t::Truncated);
+			}
+			const std::span<const byte_t> res{_data + _offset, len};
+			_offset += len;
+			return res;
+		}
+
+		/*! \brief Consume the next `len` bytes as a new `reader_t`.
+
+			This is the usual way to bound the reads of a length-prefixed structure, a truncation of the
+			sub-reader does not affect the parent.
+
+			\returns The sub-reader, or `read_error_t::Truncated` if there is not enough data remaining.
+		*/
+		[[nodiscard]]
+		constexpr std::expected<reader_t, read_error_t> sub(const std::size_t len) noexcept {
+			if (!require(len)) [[unlikely]] {
+				return std::unexpected(read_error_t::Truncated);
+			}
+			const reader_t res{std::span<const byte_t>{_data + _offset, len}};
+			_offset += len;
+			return res;
+		}
+	};
+}
+
+#endif /* PANKO_CORE_READER_HH */
@@ -0,0 +1,520 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* search.cc - Single and multi-pattern payload search */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+#include "panko/internal/cpu.hh"
+#include "panko/core/bytearray_chain.hh"
+#include "panko/core/search.hh"
+
+#if defined(PANKO_ARCH_X86_64)
+#	include <immintrin.h>
+#elif defined(PANKO_ARCH_AARCH64)
+#	include <arm_neon.h>
+#endif
+
+namespace Panko::core {
+	namespace {
+		/* == Single pattern == */
+
+		/*
+			The vector kernels are the "generic SIMD" algorithm from Mula, "SIMD-friendly algorithms for substring
+			searching" (2016). Each block of input is compared against the first byte of the pattern, and the block
+			`len - 1` bytes on against the last byte, only positions where both match are compared in full.
+
+			All of the kernels take a pattern of at least 2 bytes, and return `len` if there is no occurrence.
+		*/
+
+		[[nodiscard]]
+		std::size_t find_pattern_scalar(
+			const std::uint8_t* const data, const std::size_t len, const std::uint8_t* const pattern, const std::size_t pattern_len
+		) noexcept {
+			if (len < pattern_len) {
+				return len;
+			}
+
+			const auto last{pattern[pattern_len - 1zu]};
+			const auto* const end{data + (len - pattern_len) + 1zu};
+			for (auto* pos{data}; pos < end; ++pos) {
+				pos = static_cast<const std::uint8_t*>(std::memchr(pos, pattern[0], static_cast<std::size_t>(end - pos)));
+				if (pos == nullptr) {
+					break;
+				}
+				if (pos[pattern_len - 1zu] == last && std::memcmp(pos + 1, pattern + 1, pattern_len - 2zu) == 0) {
+					return static_cast<std::size_t>(pos - data);
+				}
+			}
+			return len;
+		}
+
+		/* Check the candidate positions in `mask`, with `stride` bits per byte, against the middle of the pattern */
+		template<std::size_t stride, typename M>
+		[[nodiscard, gnu::always_inline]]
+		inline std::size_t verify_candidates(
+			M mask, const std::uint8_t* const data, const std::uint8_t* const pattern, const std::size_t pattern_len
+		) noexcept {
+			while (mask != 0U) {
+				const auto offset{static_cast<std::size_t>(std::countr_zero(mask)) / stride};
+				if (std::memcmp(data + offset + 1zu, pattern + 1, pattern_len - 2zu) == 0) {
+					return offset;
+				}
+				mask &= mask - 1U;
+			}
+			return ~0zu;
+		}
+
+		/* == Multiple patterns == */
+
+		/* Bit `n % 8` for the high nibble `n` of a byte, for testing it against a row of the starting byte tables */
+		alignas(16) constexpr std::array<std::uint8_t, 16> high_nibble_bits{{
+			0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U,
+			0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U,
+		}};
+
+		/*
+			Finding the next byte that can start a pattern is the "truffle" byte set search from Hyperscan. The
+			set is held as two 16 entry tables indexed by the low nibble of the byte, one for bytes with the high
+			bit clear and one for bytes with it set, each entry being a bitmap of the remaining three bits of the
+			high nibble. A byte shuffle looks up both tables at once, as it zeroes any lane with the index's high
+			bit set, so this is exact for any set of bytes.
+
+			The kernels return `len` if none of the bytes are in the set.
+		*/
+
+		[[nodiscard]]
+		std::size_t skip_to_start_scalar(
+			const std::uint8_t* const data, const std::size_t len,
+			const std::array<std::uint8_t, 16>& low, const std::array<std::uint8_t, 16>& high
+		) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				const auto byte{data[idx]};
+				const auto& table{(byte & 0x80U) != 0U ? high : low};
+				if ((table[byte & 0x0FU] & high_nibble_bits[byte >> 4U]) != 0U) {
+					return idx;
+				}
+			}
+			return len;
+		}
+
+#if defined(PANKO_ARCH_X86_64)
+		/* SSE2 is part of the x86-64 baseline, so this needs no dispatch */
+		[[nodiscard]]
+		std::size_t find_pattern_sse2(
+			const std::uint8_t* const data, const std::size_t len, const std::uint8_t* const pattern, const std::size_t pattern_len
+		) noexcept {
+			const auto first{_mm_set1_epi8(static_cast<char>(pattern[0]))};
+			const auto last{_mm_set1_epi8(static_cast<char>(pattern[pattern_len - 1zu]))};
+			std::size_t idx{};
+
+			for (; len >= pattern_len && (len - pattern_len + 1zu - idx) >= 16zu; idx += 16zu) {
+				const auto block_first{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + idx))};
+				const auto block_last{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + idx + pattern_len - 1zu))};
+				const auto mask{static_cast<std::uint32_t>(_mm_movemask_epi8(
+					_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last))
+				))};
+				const auto found{verify_candidates<1zu>(mask, data + idx, pattern, pattern_len)};
+				if (found != ~0zu) {
+					return idx + found;
+				}
+			}
+
+			return idx + find_pattern_scalar(data + idx, len - idx, pattern, pattern_len);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t find_pattern_avx2(
+			const std::uint8_t* const data, const std::size_t len, const std::uint8_t* const pattern, const std::size_t pattern_len
+		) noexcept {
+			const auto first{_mm256_set1_epi8(static_cast<char>(pattern[0]))};
+			const auto last{_mm256_set1_epi8(static_cast<char>(pattern[pattern_len - 1zu]))};
+			std::size_t idx{};
+
+			for (; len >= pattern_len && (len - pattern_len + 1zu - idx) >= 32zu; idx += 32zu) {
+				const auto block_first{_mm256_loadu_si256(reinterpret_cast<const __m256i_u*>(data + idx))};
+				const auto block_last{_mm256_loadu_si256(reinterpret_cast<const __m256i_u*>(data + idx + pattern_len - 1zu))};
+				const auto mask{static_cast<std::uint32_t>(_mm256_movemask_epi8(
+					_mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last))
+				))};
+				const auto found{verify_candidates<1zu>(mask, data + idx, pattern, pattern_len)};
+				if (found != ~0zu) {
+					return idx + found;
+				}
+			}
+
+			return idx + find_pattern_sse2(data + idx, len - idx, pattern, pattern_len);
+		}
+
+		/* PSHUFB is SSSE3, which every CPU with SSE4.2 has */
+		PANKO_TARGET("sse4.2")
+		[[nodiscard]]
+		std::size_t skip_to_start_sse42(
+			const std::uint8_t* const data, const std::size_t len,
+			const std::array<std::uint8_t, 16>& low, const std::array<std::uint8_t, 16>& high
+		) noexcept {
+			const auto low_table{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(low.data()))};
+			const auto high_table{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(high.data()))};
+			const auto bits{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(high_nibble_bits.data()))};
+			const auto nibble{_mm_set1_epi8(0x0F)};
+			const auto high_bit{_mm_set1_epi8(static_cast<char>(0x80U))};
+			const auto zero{_mm_setzero_si128()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + idx))};
+				const auto rows{_mm_or_si128(
+					_mm_shuffle_epi8(low_table, input), _mm_shuffle_epi8(high_table, _mm_xor_si128(input, high_bit))
+				)};
+				const auto column{_mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(input, 4), nibble))};
+				const auto mask{
+					~static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(rows, column), zero))) & 0xFFFFU
+				};
+				if (mask != 0U) {
+					return idx + static_cast<std::size_t>(std::countr_zero(mask));
+				}
+			}
+
+			return idx + skip_to_start_scalar(data + idx, len - idx, low, high);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t skip_to_start_avx2(
+			const std::uint8_t* const data, const std::size_t len,
+			const std::array<std::uint8_t, 16>& low, const std::array<std::uint8_t, 16>& high
+		) noexcept {
+			const auto low_table{_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(low.data())))};
+			const auto high_table{_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(high.data())))};
+			const auto bits{_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(high_nibble_bits.data())))};
+			const auto nibble{_mm256_set1_epi8(0x0F)};
+			const auto high_bit{_mm256_set1_epi8(static_cast<char>(0x80U))};
+			const auto zero{_mm256_setzero_si256()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 32zu; idx += 32zu) {
+				const auto input{_mm256_loadu_si256(reinterpret_cast<const __m256i_u*>(data + idx))};
+				const auto rows{_mm256_or_si256(
+					_mm256_shuffle_epi8(low_table, input), _mm256_shuffle_epi8(high_table, _mm256_xor_si256(input, high_bit))
+				)};
+				const auto column{_mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble))};
+				const auto mask{
+					~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(rows, column), zero)))
+				};
+				if (mask != 0U) {
+					return idx + static_cast<std::size_t>(std::countr_zero(mask));
+				}
+			}
+
+			return idx + skip_to_start_sse42(data + idx, len - idx, low, high);
+		}
+#elif defined(PANKO_ARCH_AARCH64)
+		/* Narrow each byte of a comparison to a nibble to get a 64-bit mask */
+		[[nodiscard, gnu::always_inline]]
+		inline std::uint64_t neon_mask(const uint8x16_t matches) noexcept {
+			return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+		}
+
+		[[nodiscard]]
+		std::size_t find_pattern_neon(
+			const std::uint8_t* const data, const std::size_t len, const std::uint8_t* const pattern, const std::size_t pattern_len
+		) noexcept {
+			const auto first{vdupq_n_u8(pattern[0])};
+			const auto last{vdupq_n_u8(pattern[pattern_len - 1zu])};
+			std::size_t idx{};
+
+			for (; len >= pattern_len && (len - pattern_len + 1zu - idx) >= 16zu; idx += 16zu) {
+				const auto matches{vandq_u8(
+					vceqq_u8(vld1q_u8(data + idx), first), vceqq_u8(vld1q_u8(data + idx + pattern_len - 1zu), last)
+				)};
+				/* Keep one bit of each nibble, so clearing the lowest set bit moves on to the next candidate */
+				const auto mask{neon_mask(matches) & 0x8888'8888'8888'8888U};
+				const auto found{verify_candidates<4zu>(mask, data + idx, pattern, pattern_len)};
+				if (found != ~0zu) {
+					return idx + found;
+				}
+			}
+
+			return idx + find_pattern_scalar(data + idx, len - idx, pattern, pattern_len);
+		}
+
+		[[nodiscard]]
+		std::size_t skip_to_start_neon(
+			const std::uint8_t* const data, const std::size_t len,
+			const std::array<std::uint8_t, 16>& low, const std::array<std::uint8_t, 16>& high
+		) noexcept {
+			const auto low_table{vld1q_u8(low.data())};
+			const auto high_table{vld1q_u8(high.data())};
+			const auto bits{vld1q_u8(high_nibble_bits.data())};
+			/* TBL zeroes any lane with an index past the table, so keeping the high bit does the same as PSHUFB */
+			const auto index_mask{vdupq_n_u8(0x8FU)};
+			const auto high_bit{vdupq_n_u8(0x80U)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto input{vld1q_u8(data + idx)};
+				const auto rows{vorrq_u8(
+					vqtbl1q_u8(low_table, vandq_u8(input, index_mask)),
+					vqtbl1q_u8(high_table, vandq_u8(veorq_u8(input, high_bit), index_mask))
+				)};
+				const auto column{vqtbl1q_u8(bits, vshrq_n_u8(input, 4))};
+				const auto mask{neon_mask(vtstq_u8(rows, column))};
+				if (mask != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(mask)) / 4zu);
+				}
+			}
+
+			return idx + skip_to_start_scalar(data + idx, len - idx, low, high);
+		}
+#endif
+
+		[[nodiscard]]
+		auto select_skip_to_start() noexcept {
+#if defined(PANKO_ARCH_X86_64)
+			const auto& feat{Panko::internal::cpu::features()};
+			if (feat.avx2) {
+				return skip_to_start_avx2;
+			}
+			if (feat.sse42) {
+				return skip_to_start_sse42;
+			}
+#elif defined(PANKO_ARCH_AARCH64)
+			return skip_to_start_neon;
+#endif
+			return skip_to_start_scalar;
+		}
+
+		/*
+			The skip only pays off if it gets to skip a good run of bytes each time, once much more than an eighth
+			of all byte values can start a pattern the automaton is just as fast on its own.
+		*/
+		constexpr std::size_t prefilter_max_bytes{32zu};
+	}
+
+	/* == pattern_searcher_t == */
+
+	std::size_t pattern_searcher_t::find(const std::span<const std::byte> data, const std::size_t from) const noexcept {
+		static const auto impl{PANKO_SELECT_KERNEL(find_pattern)};
+
+		const auto pattern_len{_pattern.size()};
+		if (from > data.size() || (data.size() - from) < pattern_len) {
+			return npos;
+		}
+		if (pattern_len == 0zu) {
+			return from;
+		}
+
+		const auto* const haystack{reinterpret_cast<const std::uint8_t*>(data.data()) + from};
+		const auto len{data.size() - from};
+		std::size_t found{};
+		if (pattern_len == 1zu) {
+			const auto* const pos{std::memchr(haystack, std::to_integer<int>(_pattern[0]), len)};
+			found = pos == nullptr ? len : static_cast<std::size_t>(static_cast<const std::uint8_t*>(pos) - haystack);
+		} else {
+			found = impl(haystack, len, reinterpret_cast<const std::uint8_t*>(_pattern.data()), pattern_len);
+		}
+
+		return found == len ? npos : from + found;
+	}
+
+	std::size_t pattern_searcher_t::find(bytearray_chain_t& data, const std::size_t from) const {
+		const auto pattern_len{_pattern.size()};
+		if (from > data.length() || (data.length() - from) < pattern_len) {
+			return npos;
+		}
+		if (pattern_len == 0zu) {
+			return from;
+		}
+
+		/* Everything before `searched` has been ruled out as the start of an occurrence */
+		auto searched{from};
+		std::size_t fragment_start{};
+		for (std::size_t idx{}; idx < data.fragments(); ++idx) {
+			const auto& fragment{data.fragment(idx)};
+			const auto fragment_end{fragment_start + fragment.length()};
+
+			/* Occurrences entirely within this fragment */
+			if (searched < fragment_end) {
+				const auto local{searched - std::min(searched, fragment_start)};
+				const auto found{find(fragment, local)};
+				if (found != npos) {
+					return fragment_start + found;
+				}
+				searched = std::max(searched, (fragment_end + 1zu) - std::min(fragment_end + 1zu, pattern_len));
+			}
+
+			/* Occurrences that start in this fragment, or one before it, and straddle the boundary into the next */
+			if (searched < fragment_end && fragment_end < data.length()) {
+				const auto window_len{std::min(data.length() - searched, (fragment_end - searched) + pattern_len - 1zu)};
+				const auto window{data.contiguous(searched, window_len)};
+				const auto found{find(window)};
+				if (found != npos && found < (fragment_end - searched)) {
+					return searched + found;
+				}
+			}
+			searched = std::max(searched, fragment_end);
+			fragment_start = fragment_end;
+		}
+
+		return npos;
+	}
+
+	/* == multi_searcher_t == */
+
+	multi_searcher_t::multi_searcher_t(const std::span<const std::span<const std::byte>> patterns) {
+		compile(patterns);
+	}
+
+	multi_searcher_t::multi_searcher_t(const std::span<const std::string_view> patterns) {
+		std::vector<std::span<const std::byte>> bytes{};
+		bytes.reserve(patterns.size());
+		for (const auto& pattern : patterns) {
+			bytes.emplace_back(std::as_bytes(std::span{pattern}));
+		}
+		compile(bytes);
+	}
+
+	void multi_searcher_t::compile(const std::span<const std::span<const std::byte>> patterns) {
+		/* Give each byte used in a pattern its own column, with every other byte sharing column 0 */
+		std::array<bool, 256> used{};
+		std::array<bool, 256> starts{};
+		for (const auto& pattern : patterns) {
+			if (pattern.empty()) {
+				throw std::invalid_argument("multi_searcher_t patterns can not be empty");
+			}
+			starts[std::to_integer<std::size_t>(pattern[0])] = true;
+			for (const auto byte : pattern) {
+				used[std::to_integer<std::size_t>(byte)] = true;
+			}
+		}
+
+		_stride = 1zu;
+		for (std::size_t byte{}; byte < used.size(); ++byte) {
+			_classes[byte] = used[byte] ? static_cast<std::uint16_t>(_stride++) : std::uint16_t{};
+		}
+
+		/* Build the trie, with missing transitions left as `no_state` to be filled in from the failure links */
+		std::size_t total_len{};
+		for (const auto& pattern : patterns) {
+			total_len += pattern.size();
+		}
+		if ((total_len + 1zu) > ((match_flag - 1U) / _stride)) {
+			throw std::length_error("multi_searcher_t patterns are too large");
+		}
+
+		std::vector<std::uint32_t> next(_stride, no_state);
+		std::vector<std::vector<std::uint32_t>> ends(1zu);
+		_lengths.reserve(patterns.size());
+		for (std::size_t idx{}; idx < patterns.size(); ++idx) {
+			std::size_t state{};
+			for (const auto byte : patterns[idx]) {
+				const auto edge{(state * _stride) + _classes[std::to_integer<std::size_t>(byte)]};
+				if (next[edge] == no_state) {
+					next[edge] = static_cast<std::uint32_t>(ends.size());
+					ends.emplace_back();
+					next.resize(next.size() + _stride, no_state);
+				}
+				state = next[edge];
+			}
+			ends[state].push_back(static_cast<std::uint32_t>(idx));
+			_lengths.push_back(patterns[idx].size());
+		}
+
+		const auto state_count{ends.size()};
+		std::vector<std::uint32_t> failure(state_count, 0U);
+		_dictionary_links.assign(state_count, no_state);
+
+		/*
+			Breadth first, so the failure state of every state is complete by the time it is needed. The
+			transitions that aren't trie edges become the transition of the failure state, which is what turns
+			the automaton into a DFA.
+		*/
+		std::vector<std::uint32_t> queue{};
+		queue.reserve(state_count);
+		for (std::size_t cls{}; cls < _stride; ++cls) {
+			auto& edge{next[cls]};
+			if (edge == no_state) {
+				edge = 0U;
+			} else {
+				queue.push_back(edge);
+			}
+		}
+
+		for (std::size_t head{}; head < queue.size(); ++head) {
+			const auto state{queue[head]};
+			const auto fail{failure[state]};
+			_dictionary_links[state] = ends[fail].empty() ? _dictionary_links[fail] : fail;
+
+			for (std::size_t cls{}; cls < _stride; ++cls) {
+				auto& edge{next[(state * _stride) + cls]};
+				const auto fallback{next[(fail * _stride) + cls]};
+				if (edge == no_state) {
+					edge = fallback;
+				} else {
+					failure[edge] = fallback;
+					queue.push_back(edge);
+				}
+			}
+		}
+
+		/* Flatten the outputs, and pre-multiply and flag the transitions */
+		_output_start.resize(state_count + 1zu);
+		for (std::size_t state{}; state < state_count; ++state) {
+			_output_start[state] = static_cast<std::uint32_t>(_outputs.size());
+			_outputs.insert(_outputs.end(), ends[state].begin(), ends[state].end());
+		}
+		_output_start[state_count] = static_cast<std::uint32_t>(_outputs.size());
+
+		_transitions.resize(next.size());
+		for (std::size_t idx{}; idx < next.size(); ++idx) {
+			const auto target{next[idx]};
+			const auto matches{!ends[target].empty() || _dictionary_links[target] != no_state};
+			_transitions[idx] = (target * static_cast<std::uint32_t>(_stride)) | (matches ? match_flag : 0U);
+		}
+
+		for (std::size_t byte{}; byte < starts.size(); ++byte) {
+			if (starts[byte]) {
+				auto& table{(byte & 0x80U) != 0U ? _starts_high : _starts_low};
+				table[byte & 0x0FU] |= static_cast<std::uint8_t>(1U << ((byte >> 4U) & 0x07U));
+			}
+		}
+		_prefilter = static_cast<std::size_t>(std::count(starts.begin(), starts.end(), true)) <= prefilter_max_bytes;
+	}
+
+	std::size_t multi_searcher_t::advance(std::uint32_t& state, const std::span<const std::byte> data, std::size_t pos) const noexcept {
+		static const auto skip_to_start{select_skip_to_start()};
+
+		const auto* const input{reinterpret_cast<const std::uint8_t*>(data.data())};
+		const auto len{data.size()};
+		/* The state we stopped in last time still has the match flag set */
+		auto current{state & ~match_flag};
+
+		while (pos < len) {
+			if (current == 0U && _prefilter) {
+				pos += skip_to_start(input + pos, len - pos, _starts_low, _starts_high);
+				if (pos == len) {
+					break;
+				}
+			}
+
+			current = _transitions[current + _classes[input[pos]]];
+			if ((current & match_flag) != 0U) {
+				state = current;
+				return pos;
+			}
+			++pos;
+		}
+
+		state = current;
+		return len;
+	}
+}
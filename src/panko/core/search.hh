@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* search.hh - Single and multi-pattern payload search */
+#pragma once
+#if !defined(PANKO_CORE_SEARCH_HH)
+#define PANKO_CORE_SEARCH_HH
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/bytearray_chain.hh"
+
+namespace Panko::core {
+	/*! \struct Panko::core::pattern_searcher_t
+		\brief Finds occurrences of one byte pattern
+
+		Candidate positions are found a vector at a time by comparing against both the first and last byte of the
+		pattern, only positions where both match are compared in full. This rejects almost every position in
+		typical payloads without ever looking at the rest of the pattern.
+
+		The implementation is vectorized where possible (AVX2, SSE2, or NEON), and selected at runtime.
+	*/
+	struct pattern_searcher_t final {
+	private:
+		std::vector<std::byte> _pattern;
+	public:
+		static constexpr std::size_t npos{~0zu};
+
+		/*! \brief Construct a searcher for `pattern`, which is copied.
+
+			\param pattern The bytes to search for.
+		*/
+		explicit pattern_searcher_t(std::span<const std::byte> pattern) :
+			_pattern{pattern.begin(), pattern.end()}
+		{ }
+
+		/*! \brief Construct a searcher for the bytes of `pattern`, which is copied.
+
+			\param pattern The string to search for.
+		*/
+		explicit pattern_searcher_t(const std::string_view pattern) :
+			pattern_searcher_t{std::as_bytes(std::span{pattern})}
+		{ }
+
+		/*! \brief Returns the length of the pattern in bytes */
+		[[nodiscard]]
+		std::size_t length() const noexcept {
+			return _pattern.size();
+		}
+
+		/*! \brief Find the first occurrence of the pattern in `data` at or after `from`.
+
+			An empty pattern is found at `from`, as long as `from` is not past the end of `data`.
+
+			\param data The data to search.
+			\param from The offset into `data` to start searching from.
+			\returns The offset of the start of the occurrence, or `npos` if there is none.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::size_t find(std::span<const std::byte> data, std::size_t from = 0zu) const noexcept;
+
+		/*! \brief Find the first occurrence of the pattern in a `bytearray_t` at or after `from`.
+
+			\see find(std::span<const std::byte>, std::size_t)
+		*/
+		[[nodiscard]]
+		std::size_t find(const bytearray_t& data, const std::size_t from = 0zu) const noexcept {
+			return find(std::span<const std::byte>{data.data(), data.length()}, from);
+		}
+
+		/*! \brief Find the first occurrence of the pattern in a `bytearray_chain_t` at or after `from`.
+
+			Each fragment is searched in place, only the bytes either side of a fragment boundary are stitched
+			together to find the occurrences that straddle it.
+
+			\see find(std::span<const std::byte>, std::size_t)
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::size_t find(bytearray_chain_t& data, std::size_t from = 0zu) const;
+	};
+
+	/*! \brief An occurrence of one of the patterns of a `multi_searcher_t` */
+	struct search_match_t final {
+		/*! \brief The index of the pattern that was found, in the order they were given */
+		std::size_t pattern;
+		/*! \brief The offset of the first byte of the occurrence */
+		std::size_t offset;
+		/*! \brief The length of the occurrence in bytes */
+		std::size_t length;
+	};
+
+	/*! \struct Panko::core::multi_searcher_t
+		\brief Finds occurrences of any of a set of byte patterns in one pass
+
+		The patterns are compiled into an Aho-Corasick automaton, flattened out into a DFA so that each byte of
+		input is a single table lookup no matter how many patterns there are. Bytes that never appear in a
+		pattern share one column of the table, which keeps large pattern sets compact.
+
+		While the automaton is in its start state, input that can not begin any pattern is skipped a vector at a
+		time, as long as the patterns begin with few enough distinct bytes for that to pay off.
+
+		Every occurrence is reported, including those that overlap, in the order that they end.
+	*/
+	struct multi_searcher_t final {
+	private:
+		/* Set in a transition if the state it leads to has matches to report */
+		static constexpr std::uint32_t match_flag{1U << 31U};
+		static constexpr std::uint32_t no_state{~0U};
+
+		/* The columns of the transition table for each byte */
+		std::array<std::uint16_t, 256> _classes{};
+		std::size_t _stride{};
+		/* Indexed by state times the stride plus the byte class, the next state is likewise pre-multiplied */
+		std::vector<std::uint32_t> _transitions{};
+		/* The patterns that end in each state are `_outputs[_output_start[state]]` up to the next states start */
+		std::vector<std::uint32_t> _output_start{};
+		std::vector<std::uint32_t> _outputs{};
+		/* The nearest state along the failure links that has patterns ending in it */
+		std::vector<std::uint32_t> _dictionary_links{};
+		std::vector<std::size_t> _lengths{};
+
+		/* Nibble tables for the set of bytes that start a pattern, split on the high bit of the byte */
+		std::array<std::uint8_t, 16> _starts_low{};
+		std::array<std::uint8_t, 16> _starts_high{};
+		bool _prefilter{false};
+
+		void compile(std::span<const std::span<const std::byte>> patterns);
+
+		/* Run the automaton over `data` from `pos`, stopping after the first byte that leads to a state with matches */
+		[[nodiscard]]
+		PANKO_CLS_API std::size_t advance(std::uint32_t& state, std::span<const std::byte> data, std::size_t pos) const noexcept;
+
+		/* Report the patterns that end in `state` at the byte `end`, returns false if `on_match` asked to stop */
+		template<typename F>
+		[[nodiscard]]
+		bool report(const std::uint32_t state, const std::size_t end, F& on_match) const {
+			auto current{(state & ~match_flag) / static_cast<std::uint32_t>(_stride)};
+			if (_output_start[current] == _output_start[current + 1zu]) {
+				current = _dictionary_links[current];
+			}
+
+			for (; current != no_state; current = _dictionary_links[current]) {
+				for (auto out{_output_start[current]}; out < _output_start[current + 1zu]; ++out) {
+					const auto pattern{_outputs[out]};
+					const search_match_t match{pattern, (end + 1zu) - _lengths[pattern], _lengths[pattern]};
+					if constexpr (std::is_void_v<std::invoke_result_t<F&, const search_match_t&>>) {
+						on_match(match);
+					} else if (!on_match(match)) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		/* Scan `data` carrying the automaton state from whatever came before it, which started `base` bytes back */
+		template<typename F>
+		bool scan_from(std::uint32_t& state, const std::span<const std::byte> data, const std::size_t base, F& on_match) const {
+			std::size_t pos{};
+			while ((pos = advance(state, data, pos)) < data.size()) {
+				if (!report(state, base + pos, on_match)) {
+					return false;
+				}
+				++pos;
+			}
+			return true;
+		}
+	public:
+		/*! \brief Compile a set of patterns.
+
+			\param patterns The patterns to search for, which are not referenced after construction.
+			\throws std::invalid_argument If any pattern is empty.
+			\throws std::length_error If the patterns are too large for the automaton.
+		*/
+		PANKO_CLS_API explicit multi_searcher_t(std::span<const std::span<const std::byte>> patterns);
+
+		/*! \brief Compile a set of string patterns.
+
+			\see multi_searcher_t(std::span<const std::span<const std::byte>>)
+		*/
+		PANKO_CLS_API explicit multi_searcher_t(std::span<const std::string_view> patterns);
+
+		multi_searcher_t(const std::initializer_list<std::string_view> patterns) :
+			multi_searcher_t{std::span<const std::string_view>{patterns.begin(), patterns.size()}}
+		{ }
+
+		/*! \brief Returns the number of patterns */
+		[[nodiscard]]
+		std::size_t patterns() const noexcept {
+			return _lengths.size();
+		}
+
+		/*! \brief Returns the number of states in the compiled automaton */
+		[[nodiscard]]
+		std::size_t states() const noexcept {
+			return _output_start.size() - 1zu;
+		}
+
+		/*! \brief Report every occurrence of every pattern in `data`.
+
+			\code{.cc}
+			const multi_searcher_t iocs{"evil.example", "/bin/sh", "\x90\x90\x90\x90"};
+			iocs.scan(payload, [&](const search_match_t& match) {
+				flag(match.pattern, match.offset);
+			});
+			\endcode
+
+			\param data The data to search.
+			\param on_match Called with each `search_match_t`, it may return `false` to stop the scan.
+		*/
+		template<typename F>
+		void scan(const std::span<const std::byte> data, F&& on_match) const {
+			std::uint32_t state{};
+			scan_from(state, data, 0zu, on_match);
+		}
+
+		/*! \brief Report every occurrence of every pattern in a `bytearray_t`.
+
+			\see scan(std::span<const std::byte>, F&&)
+		*/
+		template<typename F>
+		void scan(const bytearray_t& data, F&& on_match) const {
+			scan(std::span<const std::byte>{data.data(), data.length()}, on_match);
+		}
+
+		/*! \brief Report every occurrence of every pattern in a `bytearray_chain_t`.
+
+			The automaton state is carried from one fragment into the next, so occurrences that straddle
+			fragment boundaries are found without stitching anything together. Offsets are into the whole chain.
+
+			\see scan(std::span<const std::byte>, F&&)
+		*/
+		template<typename F>
+		void scan(bytearray_chain_t& data, F&& on_match) const {
+			std::uint32_t state{};
+			std::size_t base{};
+			for (std::size_t idx{}; idx < data.fragments(); ++idx) {
+				const auto& fragment{data.fragment(idx)};
+				if (!scan_from(state, std::span<const std::byte>{fragment.data(), fragment.length()}, base, on_match)) {
+					return;
+				}
+				base += fragment.length();
+			}
+		}
+
+		/*! \brief Find the occurrence of any pattern that ends first in `data`.
+
+			\returns The match, or nothing if none of the patterns occur.
+		*/
+		template<typename Data>
+		[[nodiscard]]
+		std::optional<search_match_t> find_first(Data&& data) const {
+			std::optional<search_match_t> first{};
+			scan(data, [&](const search_match_t& match) {
+				first = match;
+				return false;
+			});
+			return first;
+		}
+	};
+}
+
+#endif /* PANKO_CORE_SEARCH_HH */
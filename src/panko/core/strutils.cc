@@ -1,15 +1,1294 @@
 // SPDX-License-Identifier: BSD-3-Clause
 /* strutils.cc - String extraction and encoding utils */
 
-
+#include <array>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <string_view>
 #include <limits>
 
 #include "panko/internal/defs.hh"
+#include "panko/internal/cpu.hh"
+#include "panko/internal/shiftjis_table.hh"
 #include "panko/core/strutils.hh"
 
+#if defined(PANKO_ARCH_X86_64)
+#	include <immintrin.h>
+#elif defined(PANKO_ARCH_AARCH64)
+#	include <arm_neon.h>
+#endif
+
 namespace Panko::core::strutils {
+	namespace {
+		/* == UTF-8 == */
+
+		/*
+			The vectorized UTF-8 validation is the "lookup" algorithm from Keiser and Lemire, "Validating UTF-8 In
+			Less Than One Instruction Per Byte" (2021). Each byte is classified against the byte before it with
+			three 16 entry nibble tables, the result of which is non-zero for any invalid two byte pair, with the
+			remaining 3 and 4 byte continuation requirements checked with saturating subtraction.
+
+			The vector kernels only tell us if a block contains an error, once one is found, or we run out of
+			whole blocks, we back up to the start of the code point spanning the block boundary and let the
+			scalar validator find the exact end of the valid prefix.
+		*/
+
+		constexpr std::uint8_t TOO_SHORT{1U << 0U};
+		constexpr std::uint8_t TOO_LONG{1U << 1U};
+		constexpr std::uint8_t OVERLONG_3{1U << 2U};
+		constexpr std::uint8_t TOO_LARGE{1U << 3U};
+		constexpr std::uint8_t SURROGATE{1U << 4U};
+		constexpr std::uint8_t OVERLONG_2{1U << 5U};
+		constexpr std::uint8_t TOO_LARGE_1000{1U << 6U};
+		constexpr std::uint8_t OVERLONG_4{1U << 6U};
+		constexpr std::uint8_t TWO_CONTS{1U << 7U};
+		constexpr std::uint8_t CARRY{TOO_SHORT | TOO_LONG | TWO_CONTS};
+
+		/* Indexed by the high nibble of the first byte */
+		[[maybe_unused]]
+		alignas(16) constexpr std::array<std::uint8_t, 16> utf8_byte_1_high{{
+			/* 0xxx ASCII */
+			TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+			TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+			/* 10xx continuation */
+			TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+			/* 1100 two byte lead */
+			TOO_SHORT | OVERLONG_2,
+			/* 1101 two byte lead */
+			TOO_SHORT,
+			/* 1110 three byte lead */
+			TOO_SHORT | OVERLONG_3 | SURROGATE,
+			/* 1111 four byte lead */
+			TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+		}};
+
+		/* Indexed by the low nibble of the first byte */
+		[[maybe_unused]]
+		alignas(16) constexpr std::array<std::uint8_t, 16> utf8_byte_1_low{{
+			/* 0000 */
+			CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+			/* 0001 */
+			CARRY | OVERLONG_2,
+			/* 001x */
+			CARRY,
+			CARRY,
+			/* 0100 */
+			CARRY | TOO_LARGE,
+			/* 0101 */
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			/* 011x */
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			/* 1xxx */
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			/* 1101 */
+			CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+		}};
+
+		/* Indexed by the high nibble of the second byte */
+		[[maybe_unused]]
+		alignas(16) constexpr std::array<std::uint8_t, 16> utf8_byte_2_high{{
+			/* 0xxx ASCII */
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+			/* 1000 */
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+			/* 1001 */
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+			/* 101x */
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE  | TOO_LARGE,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE  | TOO_LARGE,
+			/* 11xx lead */
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+		}};
+
+		/* The largest value each of the last three bytes of a block can have without needing a continuation */
+		[[maybe_unused]]
+		alignas(32) constexpr std::array<std::uint8_t, 32> utf8_incomplete_max{{
+			0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+			0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+			0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+			0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xEFU, 0xDFU, 0xBFU,
+		}};
+
+		[[nodiscard]]
+		std::size_t utf8_valid_prefix_scalar(const std::uint8_t* const data, const std::size_t len) noexcept {
+			constexpr std::uint64_t high_bits{0x8080'8080'8080'8080U};
+			std::size_t idx{};
+
+			while (idx < len) {
+				if ((len - idx) >= sizeof(std::uint64_t)) {
+					std::uint64_t word{};
+					std::memcpy(&word, data + idx, sizeof(word));
+					if ((word & high_bits) == 0U) {
+						idx += sizeof(word);
+						continue;
+					}
+				}
+
+				const auto lead{data[idx]};
+				if (lead < 0x80U) {
+					++idx;
+					continue;
+				}
+
+				std::size_t conts{};
+				std::uint8_t lower{0x80U};
+				std::uint8_t upper{0xBFU};
+
+				if (lead >= 0xC2U && lead <= 0xDFU) {
+					conts = 1zu;
+				} else if (lead >= 0xE0U && lead <= 0xEFU) {
+					conts = 2zu;
+					if (lead == 0xE0U) {
+						lower = 0xA0U;
+					} else if (lead == 0xEDU) {
+						upper = 0x9FU;
+					}
+				} else if (lead >= 0xF0U && lead <= 0xF4U) {
+					conts = 3zu;
+					if (lead == 0xF0U) {
+						lower = 0x90U;
+					} else if (lead == 0xF4U) {
+						upper = 0x8FU;
+					}
+				} else {
+					return idx;
+				}
+
+				if ((len - idx) <= conts) {
+					return idx;
+				}
+
+				if (data[idx + 1zu] < lower || data[idx + 1zu] > upper) {
+					return idx;
+				}
+
+				for (std::size_t cont{2zu}; cont <= conts; ++cont) {
+					if ((data[idx + cont] & 0xC0U) != 0x80U) {
+						return idx;
+					}
+				}
+
+				idx += conts + 1zu;
+			}
+
+			return idx;
+		}
+
+		/* Back up from `idx` to the start of the code point it is in, and validate the rest scalarly */
+		[[maybe_unused]]
+		[[nodiscard]]
+		std::size_t utf8_valid_prefix_resume(const std::uint8_t* const data, const std::size_t len, const std::size_t idx) noexcept {
+			auto start{idx};
+			/* Everything before `idx` is valid, so the last lead byte is at most 3 bytes back */
+			for (std::size_t back{1zu}; back <= 3zu && back <= idx; ++back) {
+				if ((data[idx - back] & 0xC0U) != 0x80U) {
+					start = idx - back;
+					break;
+				}
+			}
+			return start + utf8_valid_prefix_scalar(data + start, len - start);
+		}
+
+		/* == Null search == */
+
+		[[nodiscard]]
+		std::size_t find_nul_scalar(const std::uint8_t* const data, const std::size_t len) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				if (data[idx] == 0U) {
+					return idx;
+				}
+			}
+			return len;
+		}
+
+		/* == ASCII == */
+
+		[[nodiscard]]
+		std::size_t ascii_valid_prefix_scalar(const std::uint8_t* const data, const std::size_t len) noexcept {
+			constexpr std::uint64_t high_bits{0x8080'8080'8080'8080U};
+			std::size_t idx{};
+
+			/* Check a word at a time before narrowing down to the byte */
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				std::uint64_t word{};
+				std::memcpy(&word, data + idx, sizeof(word));
+				if ((word & high_bits) != 0U) {
+					break;
+				}
+			}
+
+			for (; idx < len; ++idx) {
+				if (data[idx] >= 0x80U) {
+					return idx;
+				}
+			}
+			return len;
+		}
+
+#if defined(PANKO_ARCH_X86_64)
+		/* == SSE4.2 == */
+
+		PANKO_TARGET("sse4.2")
+		[[nodiscard, gnu::always_inline]]
+		inline __m128i load_sse(const void* const ptr) noexcept {
+			return _mm_loadu_si128(static_cast<const __m128i_u*>(ptr));
+		}
+
+		PANKO_TARGET("sse4.2")
+		[[nodiscard, gnu::always_inline]]
+		inline __m128i utf8_check_sse42(const __m128i input, const __m128i prev) noexcept {
+			const auto nibble{_mm_set1_epi8(0x0F)};
+			const auto prev1{_mm_alignr_epi8(input, prev, 15)};
+
+			const auto byte_1_high{_mm_shuffle_epi8(
+				load_sse(utf8_byte_1_high.data()), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)
+			)};
+			const auto byte_1_low{_mm_shuffle_epi8(
+				load_sse(utf8_byte_1_low.data()), _mm_and_si128(prev1, nibble)
+			)};
+			const auto byte_2_high{_mm_shuffle_epi8(
+				load_sse(utf8_byte_2_high.data()), _mm_and_si128(_mm_srli_epi16(input, 4), nibble)
+			)};
+			const auto special{_mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high)};
+
+			const auto prev2{_mm_alignr_epi8(input, prev, 14)};
+			const auto prev3{_mm_alignr_epi8(input, prev, 13)};
+			const auto must_23{_mm_or_si128(
+				_mm_subs_epu8(prev2, _mm_set1_epi8(0x60)), _mm_subs_epu8(prev3, _mm_set1_epi8(0x70))
+			)};
+			const auto must_23_80{_mm_and_si128(must_23, _mm_set1_epi8(static_cast<char>(0x80)))};
+
+			return _mm_xor_si128(must_23_80, special);
+		}
+
+		PANKO_TARGET("sse4.2")
+		[[nodiscard]]
+		std::size_t utf8_valid_prefix_sse42(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto incomplete_max{load_sse(utf8_incomplete_max.data() + 16zu)};
+			auto prev{_mm_setzero_si128()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 64zu; idx += 64zu) {
+				const auto in0{load_sse(data + idx)};
+				const auto in1{load_sse(data + idx + 16zu)};
+				const auto in2{load_sse(data + idx + 32zu)};
+				const auto in3{load_sse(data + idx + 48zu)};
+
+				__m128i error{};
+				const auto any{_mm_or_si128(_mm_or_si128(in0, in1), _mm_or_si128(in2, in3))};
+				if (_mm_movemask_epi8(any) == 0) {
+					/* All ASCII, so the only possible error is a code point cut off at the end of the last block */
+					error = _mm_subs_epu8(prev, incomplete_max);
+				} else {
+					error = _mm_or_si128(
+						_mm_or_si128(utf8_check_sse42(in0, prev), utf8_check_sse42(in1, in0)),
+						_mm_or_si128(utf8_check_sse42(in2, in1), utf8_check_sse42(in3, in2))
+					);
+				}
+
+				if (!_mm_testz_si128(error, error)) {
+					break;
+				}
+				prev = in3;
+			}
+
+			return utf8_valid_prefix_resume(data, len, idx);
+		}
+
+		/* SSE2 is part of the x86-64 baseline, so this needs no dispatch */
+		[[nodiscard]]
+		std::size_t find_nul_sse2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto zero{_mm_setzero_si128()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + idx))};
+				const auto mask{static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(input, zero)))};
+				if (mask != 0U) {
+					return idx + static_cast<std::size_t>(std::countr_zero(mask));
+				}
+			}
+
+			return idx + find_nul_scalar(data + idx, len - idx);
+		}
+
+		[[nodiscard]]
+		std::size_t ascii_valid_prefix_sse2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto mask{static_cast<std::uint32_t>(
+					_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + idx)))
+				)};
+				if (mask != 0U) {
+					return idx + static_cast<std::size_t>(std::countr_zero(mask));
+				}
+			}
+
+			return idx + ascii_valid_prefix_scalar(data + idx, len - idx);
+		}
+
+		/* == AVX2 == */
+
+		PANKO_TARGET("avx2")
+		[[nodiscard, gnu::always_inline]]
+		inline __m256i load_avx2(const void* const ptr) noexcept {
+			return _mm256_loadu_si256(static_cast<const __m256i_u*>(ptr));
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard, gnu::always_inline]]
+		inline __m256i load_avx2_table(const std::array<std::uint8_t, 16>& table) noexcept {
+			return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(table.data())));
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard, gnu::always_inline]]
+		inline __m256i utf8_check_avx2(const __m256i input, const __m256i prev) noexcept {
+			const auto nibble{_mm256_set1_epi8(0x0F)};
+			/* The upper lane of `prev` and the lower lane of `input`, so we can shift across the lane boundary */
+			const auto shifted{_mm256_permute2x128_si256(prev, input, 0x21)};
+			const auto prev1{_mm256_alignr_epi8(input, shifted, 15)};
+
+			const auto byte_1_high{_mm256_shuffle_epi8(
+				load_avx2_table(utf8_byte_1_high), _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)
+			)};
+			const auto byte_1_low{_mm256_shuffle_epi8(
+				load_avx2_table(utf8_byte_1_low), _mm256_and_si256(prev1, nibble)
+			)};
+			const auto byte_2_high{_mm256_shuffle_epi8(
+				load_avx2_table(utf8_byte_2_high), _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)
+			)};
+			const auto special{_mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high)};
+
+			const auto prev2{_mm256_alignr_epi8(input, shifted, 14)};
+			const auto prev3{_mm256_alignr_epi8(input, shifted, 13)};
+			const auto must_23{_mm256_or_si256(
+				_mm256_subs_epu8(prev2, _mm256_set1_epi8(0x60)), _mm256_subs_epu8(prev3, _mm256_set1_epi8(0x70))
+			)};
+			const auto must_23_80{_mm256_and_si256(must_23, _mm256_set1_epi8(static_cast<char>(0x80)))};
+
+			return _mm256_xor_si256(must_23_80, special);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t utf8_valid_prefix_avx2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto incomplete_max{load_avx2(utf8_incomplete_max.data())};
+			auto prev{_mm256_setzero_si256()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 64zu; idx += 64zu) {
+				const auto in0{load_avx2(data + idx)};
+				const auto in1{load_avx2(data + idx + 32zu)};
+
+				__m256i error{};
+				if (_mm256_movemask_epi8(_mm256_or_si256(in0, in1)) == 0) {
+					/* All ASCII, so the only possible error is a code point cut off at the end of the last block */
+					error = _mm256_subs_epu8(prev, incomplete_max);
+				} else {
+					error = _mm256_or_si256(utf8_check_avx2(in0, prev), utf8_check_avx2(in1, in0));
+				}
+
+				if (!_mm256_testz_si256(error, error)) {
+					break;
+				}
+				prev = in1;
+			}
+
+			return utf8_valid_prefix_resume(data, len, idx);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t find_nul_avx2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto zero{_mm256_setzero_si256()};
+			std::size_t idx{};
+
+			/* Check 64 bytes per iteration, only working out which half the null is in once one is found */
+			for (; (len - idx) >= 64zu; idx += 64zu) {
+				const auto low{_mm256_cmpeq_epi8(load_avx2(data + idx), zero)};
+				const auto high{_mm256_cmpeq_epi8(load_avx2(data + idx + 32zu), zero)};
+				const auto any{_mm256_or_si256(low, high)};
+				if (!_mm256_testz_si256(any, any)) {
+					const auto mask{
+						static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(low))) |
+						(static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(high))) << 32U)
+					};
+					return idx + static_cast<std::size_t>(std::countr_zero(mask));
+				}
+			}
+
+			for (; (len - idx) >= 32zu; idx += 32zu) {
+				const auto mask{static_cast<std::uint32_t>(
+					_mm256_movemask_epi8(_mm256_cmpeq_epi8(load_avx2(data + idx), zero))
+				)};
+				if (mask != 0U) {
+					return idx + static_cast<std::size_t>(std::countr_zero(mask));
+				}
+			}
+
+			return idx + find_nul_sse2(data + idx, len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t ascii_valid_prefix_avx2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 64zu; idx += 64zu) {
+				const auto low{load_avx2(data + idx)};
+				const auto high{load_avx2(data + idx + 32zu)};
+				if (_mm256_movemask_epi8(_mm256_or_si256(low, high)) != 0) {
+					const auto mask{
+						static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(low))) |
+						(static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(high))) << 32U)
+					};
+					return idx + static_cast<std::size_t>(std::countr_zero(mask));
+				}
+			}
+
+			return idx + ascii_valid_prefix_sse2(data + idx, len - idx);
+		}
+#elif defined(PANKO_ARCH_AARCH64)
+		/* == NEON == */
+
+		[[nodiscard, gnu::always_inline]]
+		inline uint8x16_t utf8_check_neon(const uint8x16_t input, const uint8x16_t prev) noexcept {
+			const auto nibble{vdupq_n_u8(0x0FU)};
+			const auto prev1{vextq_u8(prev, input, 15)};
+
+			const auto byte_1_high{vqtbl1q_u8(vld1q_u8(utf8_byte_1_high.data()), vshrq_n_u8(prev1, 4))};
+			const auto byte_1_low{vqtbl1q_u8(vld1q_u8(utf8_byte_1_low.data()), vandq_u8(prev1, nibble))};
+			const auto byte_2_high{vqtbl1q_u8(vld1q_u8(utf8_byte_2_high.data()), vshrq_n_u8(input, 4))};
+			const auto special{vandq_u8(vandq_u8(byte_1_high, byte_1_low), byte_2_high)};
+
+			const auto prev2{vextq_u8(prev, input, 14)};
+			const auto prev3{vextq_u8(prev, input, 13)};
+			const auto must_23{vorrq_u8(
+				vqsubq_u8(prev2, vdupq_n_u8(0x60U)), vqsubq_u8(prev3, vdupq_n_u8(0x70U))
+			)};
+			const auto must_23_80{vandq_u8(must_23, vdupq_n_u8(0x80U))};
+
+			return veorq_u8(must_23_80, special);
+		}
+
+		[[nodiscard]]
+		std::size_t utf8_valid_prefix_neon(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto incomplete_max{vld1q_u8(utf8_incomplete_max.data() + 16zu)};
+			auto prev{vdupq_n_u8(0U)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 64zu; idx += 64zu) {
+				const auto in0{vld1q_u8(data + idx)};
+				const auto in1{vld1q_u8(data + idx + 16zu)};
+				const auto in2{vld1q_u8(data + idx + 32zu)};
+				const auto in3{vld1q_u8(data + idx + 48zu)};
+
+				uint8x16_t error{};
+				const auto any{vorrq_u8(vorrq_u8(in0, in1), vorrq_u8(in2, in3))};
+				if (vmaxvq_u8(any) < 0x80U) {
+					/* All ASCII, so the only possible error is a code point cut off at the end of the last block */
+					error = vqsubq_u8(prev, incomplete_max);
+				} else {
+					error = vorrq_u8(
+						vorrq_u8(utf8_check_neon(in0, prev), utf8_check_neon(in1, in0)),
+						vorrq_u8(utf8_check_neon(in2, in1), utf8_check_neon(in3, in2))
+					);
+				}
+
+				if (vmaxvq_u8(error) != 0U) {
+					break;
+				}
+				prev = in3;
+			}
+
+			return utf8_valid_prefix_resume(data, len, idx);
+		}
+
+		[[nodiscard]]
+		std::size_t find_nul_neon(const std::uint8_t* const data, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto matches{vceqzq_u8(vld1q_u8(data + idx))};
+				/* Narrow each byte of the comparison to a nibble to get a 64-bit mask */
+				const auto mask{vget_lane_u64(
+					vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0
+				)};
+				if (mask != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(mask)) / 4zu);
+				}
+			}
+
+			return idx + find_nul_scalar(data + idx, len - idx);
+		}
+
+		[[nodiscard]]
+		std::size_t ascii_valid_prefix_neon(const std::uint8_t* const data, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 64zu; idx += 64zu) {
+				const auto input{vld1q_u8_x4(data + idx)};
+				const auto any{vorrq_u8(vorrq_u8(input.val[0], input.val[1]), vorrq_u8(input.val[2], input.val[3]))};
+				if (vmaxvq_u8(any) >= 0x80U) {
+					break;
+				}
+			}
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto high{vcltzq_s8(vreinterpretq_s8_u8(vld1q_u8(data + idx)))};
+				const auto mask{vget_lane_u64(
+					vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(high), 4)), 0
+				)};
+				if (mask != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(mask)) / 4zu);
+				}
+			}
+
+			return idx + ascii_valid_prefix_scalar(data + idx, len - idx);
+		}
+#endif
+
+		/* == UTF-16 and UTF-32 == */
+
+		[[nodiscard]]
+		constexpr bool is_surrogate(const std::uint32_t unit) noexcept {
+			return (unit & 0xFFFF'F800U) == 0xD800U;
+		}
+
+		[[nodiscard]]
+		constexpr bool is_invalid_utf32(const std::uint32_t unit) noexcept {
+			return unit > 0x0010'FFFFU || is_surrogate(unit);
+		}
+
+		[[nodiscard]]
+		std::size_t find_surrogate_scalar(const char16_t* const data, const std::size_t len) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				if (is_surrogate(data[idx])) {
+					return idx;
+				}
+			}
+			return len;
+		}
+
+		[[nodiscard]]
+		std::size_t find_invalid_utf32_scalar(const char32_t* const data, const std::size_t len) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				if (is_invalid_utf32(data[idx])) {
+					return idx;
+				}
+			}
+			return len;
+		}
+
+		void byteswap16_scalar(char16_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				std::uint16_t unit{};
+				std::memcpy(&unit, src + (idx * 2zu), sizeof(unit));
+				dst[idx] = static_cast<char16_t>(std::byteswap(unit));
+			}
+		}
+
+		void byteswap32_scalar(char32_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				std::uint32_t unit{};
+				std::memcpy(&unit, src + (idx * 4zu), sizeof(unit));
+				dst[idx] = static_cast<char32_t>(std::byteswap(unit));
+			}
+		}
+
+		template<typename T>
+		[[nodiscard]]
+		std::size_t find_nul_unit_scalar(const std::uint8_t* const data, const std::size_t len) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				T unit{};
+				std::memcpy(&unit, data + (idx * sizeof(T)), sizeof(T));
+				if (unit == 0U) {
+					return idx;
+				}
+			}
+			return len;
+		}
+
+#if defined(PANKO_ARCH_X86_64)
+		/* SSE2 is part of the x86-64 baseline, so the SSE2 kernels need no dispatch */
+
+		[[nodiscard]]
+		std::size_t find_surrogate_sse2(const char16_t* const data, const std::size_t len) noexcept {
+			const auto mask{_mm_set1_epi16(static_cast<short>(0xF800U))};
+			const auto surrogate{_mm_set1_epi16(static_cast<short>(0xD800U))};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + idx))};
+				const auto found{static_cast<std::uint32_t>(
+					_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(input, mask), surrogate))
+				)};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 2zu);
+				}
+			}
+
+			return idx + find_surrogate_scalar(data + idx, len - idx);
+		}
+
+		[[nodiscard]]
+		std::size_t find_invalid_utf32_sse2(const char32_t* const data, const std::size_t len) noexcept {
+			/* There is no unsigned compare, so bias both sides into the signed range */
+			const auto bias{_mm_set1_epi32(static_cast<int>(0x8000'0000U))};
+			const auto max{_mm_set1_epi32(static_cast<int>(0x8010'FFFFU))};
+			const auto mask{_mm_set1_epi32(static_cast<int>(0xFFFF'F800U))};
+			const auto surrogate{_mm_set1_epi32(0xD800)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 4zu; idx += 4zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + idx))};
+				const auto invalid{_mm_or_si128(
+					_mm_cmpgt_epi32(_mm_xor_si128(input, bias), max),
+					_mm_cmpeq_epi32(_mm_and_si128(input, mask), surrogate)
+				)};
+				const auto found{static_cast<std::uint32_t>(_mm_movemask_epi8(invalid))};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 4zu);
+				}
+			}
+
+			return idx + find_invalid_utf32_scalar(data + idx, len - idx);
+		}
+
+		void byteswap16_sse2(char16_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(src + (idx * 2zu)))};
+				const auto swapped{_mm_or_si128(_mm_slli_epi16(input, 8), _mm_srli_epi16(input, 8))};
+				_mm_storeu_si128(reinterpret_cast<__m128i_u*>(dst + idx), swapped);
+			}
+
+			byteswap16_scalar(dst + idx, src + (idx * 2zu), len - idx);
+		}
+
+		void byteswap32_sse2(char32_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 4zu; idx += 4zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(src + (idx * 4zu)))};
+				/* Swap the 16-bit halves of each 32-bit lane, then the bytes of each 16-bit half */
+				const auto halves{_mm_shufflehi_epi16(_mm_shufflelo_epi16(input, 0xB1), 0xB1)};
+				const auto swapped{_mm_or_si128(_mm_slli_epi16(halves, 8), _mm_srli_epi16(halves, 8))};
+				_mm_storeu_si128(reinterpret_cast<__m128i_u*>(dst + idx), swapped);
+			}
+
+			byteswap32_scalar(dst + idx, src + (idx * 4zu), len - idx);
+		}
+
+		[[nodiscard]]
+		std::size_t find_nul16_sse2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto zero{_mm_setzero_si128()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + (idx * 2zu)))};
+				const auto found{static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(input, zero)))};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 2zu);
+				}
+			}
+
+			return idx + find_nul_unit_scalar<std::uint16_t>(data + (idx * 2zu), len - idx);
+		}
+
+		[[nodiscard]]
+		std::size_t find_nul32_sse2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto zero{_mm_setzero_si128()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 4zu; idx += 4zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(data + (idx * 4zu)))};
+				const auto found{static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi32(input, zero)))};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 4zu);
+				}
+			}
+
+			return idx + find_nul_unit_scalar<std::uint32_t>(data + (idx * 4zu), len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t find_surrogate_avx2(const char16_t* const data, const std::size_t len) noexcept {
+			const auto mask{_mm256_set1_epi16(static_cast<short>(0xF800U))};
+			const auto surrogate{_mm256_set1_epi16(static_cast<short>(0xD800U))};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto input{load_avx2(data + idx)};
+				const auto found{static_cast<std::uint32_t>(
+					_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(input, mask), surrogate))
+				)};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 2zu);
+				}
+			}
+
+			return idx + find_surrogate_sse2(data + idx, len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t find_invalid_utf32_avx2(const char32_t* const data, const std::size_t len) noexcept {
+			const auto bias{_mm256_set1_epi32(static_cast<int>(0x8000'0000U))};
+			const auto max{_mm256_set1_epi32(static_cast<int>(0x8010'FFFFU))};
+			const auto mask{_mm256_set1_epi32(static_cast<int>(0xFFFF'F800U))};
+			const auto surrogate{_mm256_set1_epi32(0xD800)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto input{load_avx2(data + idx)};
+				const auto invalid{_mm256_or_si256(
+					_mm256_cmpgt_epi32(_mm256_xor_si256(input, bias), max),
+					_mm256_cmpeq_epi32(_mm256_and_si256(input, mask), surrogate)
+				)};
+				const auto found{static_cast<std::uint32_t>(_mm256_movemask_epi8(invalid))};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 4zu);
+				}
+			}
+
+			return idx + find_invalid_utf32_sse2(data + idx, len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		void byteswap16_avx2(char16_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			const auto shuffle{_mm256_setr_epi8(
+				1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+				1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+			)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto swapped{_mm256_shuffle_epi8(load_avx2(src + (idx * 2zu)), shuffle)};
+				_mm256_storeu_si256(reinterpret_cast<__m256i_u*>(dst + idx), swapped);
+			}
+
+			byteswap16_sse2(dst + idx, src + (idx * 2zu), len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		void byteswap32_avx2(char32_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			const auto shuffle{_mm256_setr_epi8(
+				3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+				3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+			)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto swapped{_mm256_shuffle_epi8(load_avx2(src + (idx * 4zu)), shuffle)};
+				_mm256_storeu_si256(reinterpret_cast<__m256i_u*>(dst + idx), swapped);
+			}
+
+			byteswap32_sse2(dst + idx, src + (idx * 4zu), len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t find_nul16_avx2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto zero{_mm256_setzero_si256()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto found{static_cast<std::uint32_t>(
+					_mm256_movemask_epi8(_mm256_cmpeq_epi16(load_avx2(data + (idx * 2zu)), zero))
+				)};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 2zu);
+				}
+			}
+
+			return idx + find_nul16_sse2(data + (idx * 2zu), len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t find_nul32_avx2(const std::uint8_t* const data, const std::size_t len) noexcept {
+			const auto zero{_mm256_setzero_si256()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto found{static_cast<std::uint32_t>(
+					_mm256_movemask_epi8(_mm256_cmpeq_epi32(load_avx2(data + (idx * 4zu)), zero))
+				)};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 4zu);
+				}
+			}
+
+			return idx + find_nul32_sse2(data + (idx * 4zu), len - idx);
+		}
+#elif defined(PANKO_ARCH_AARCH64)
+		/* Narrow a vector of 16-bit comparison results into a 64-bit mask with one byte per lane */
+		[[nodiscard, gnu::always_inline]]
+		inline std::uint64_t lane_mask16(const uint16x8_t matches) noexcept {
+			return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(matches)), 0);
+		}
+
+		/* Narrow a vector of 32-bit comparison results into a 64-bit mask with two bytes per lane */
+		[[nodiscard, gnu::always_inline]]
+		inline std::uint64_t lane_mask32(const uint32x4_t matches) noexcept {
+			return vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(matches)), 0);
+		}
+
+		[[nodiscard]]
+		std::size_t find_surrogate_neon(const char16_t* const data, const std::size_t len) noexcept {
+			const auto mask{vdupq_n_u16(0xF800U)};
+			const auto surrogate{vdupq_n_u16(0xD800U)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto input{vld1q_u16(reinterpret_cast<const std::uint16_t*>(data + idx))};
+				const auto found{lane_mask16(vceqq_u16(vandq_u16(input, mask), surrogate))};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 8zu);
+				}
+			}
+
+			return idx + find_surrogate_scalar(data + idx, len - idx);
+		}
+
+		[[nodiscard]]
+		std::size_t find_invalid_utf32_neon(const char32_t* const data, const std::size_t len) noexcept {
+			const auto max{vdupq_n_u32(0x0010'FFFFU)};
+			const auto mask{vdupq_n_u32(0xFFFF'F800U)};
+			const auto surrogate{vdupq_n_u32(0xD800U)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 4zu; idx += 4zu) {
+				const auto input{vld1q_u32(reinterpret_cast<const std::uint32_t*>(data + idx))};
+				const auto found{lane_mask32(vorrq_u32(
+					vcgtq_u32(input, max), vceqq_u32(vandq_u32(input, mask), surrogate)
+				))};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 16zu);
+				}
+			}
+
+			return idx + find_invalid_utf32_scalar(data + idx, len - idx);
+		}
+
+		void byteswap16_neon(char16_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto swapped{vrev16q_u8(vld1q_u8(src + (idx * 2zu)))};
+				vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + idx), swapped);
+			}
+
+			byteswap16_scalar(dst + idx, src + (idx * 2zu), len - idx);
+		}
+
+		void byteswap32_neon(char32_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 4zu; idx += 4zu) {
+				const auto swapped{vrev32q_u8(vld1q_u8(src + (idx * 4zu)))};
+				vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + idx), swapped);
+			}
+
+			byteswap32_scalar(dst + idx, src + (idx * 4zu), len - idx);
+		}
+
+		[[nodiscard]]
+		std::size_t find_nul16_neon(const std::uint8_t* const data, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 8zu; idx += 8zu) {
+				const auto input{vreinterpretq_u16_u8(vld1q_u8(data + (idx * 2zu)))};
+				const auto found{lane_mask16(vceqzq_u16(input))};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 8zu);
+				}
+			}
+
+			return idx + find_nul_unit_scalar<std::uint16_t>(data + (idx * 2zu), len - idx);
+		}
+
+		[[nodiscard]]
+		std::size_t find_nul32_neon(const std::uint8_t* const data, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 4zu; idx += 4zu) {
+				const auto input{vreinterpretq_u32_u8(vld1q_u8(data + (idx * 4zu)))};
+				const auto found{lane_mask32(vceqzq_u32(input))};
+				if (found != 0U) {
+					return idx + (static_cast<std::size_t>(std::countr_zero(found)) / 16zu);
+				}
+			}
+
+			return idx + find_nul_unit_scalar<std::uint32_t>(data + (idx * 4zu), len - idx);
+		}
+#endif
+
+		/* == EBCDIC == */
+
+		/* IBM code page 037 to ISO-8859-1, CP037 covers all of Latin-1 so every byte has a mapping */
+		alignas(64) constexpr std::array<std::uint8_t, 256> cp037_to_latin1{{
+			0x00U, 0x01U, 0x02U, 0x03U, 0x9CU, 0x09U, 0x86U, 0x7FU, 0x97U, 0x8DU, 0x8EU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU,
+			0x10U, 0x11U, 0x12U, 0x13U, 0x9DU, 0x85U, 0x08U, 0x87U, 0x18U, 0x19U, 0x92U, 0x8FU, 0x1CU, 0x1DU, 0x1EU, 0x1FU,
+			0x80U, 0x81U, 0x82U, 0x83U, 0x84U, 0x0AU, 0x17U, 0x1BU, 0x88U, 0x89U, 0x8AU, 0x8BU, 0x8CU, 0x05U, 0x06U, 0x07U,
+			0x90U, 0x91U, 0x16U, 0x93U, 0x94U, 0x95U, 0x96U, 0x04U, 0x98U, 0x99U, 0x9AU, 0x9BU, 0x14U, 0x15U, 0x9EU, 0x1AU,
+			0x20U, 0xA0U, 0xE2U, 0xE4U, 0xE0U, 0xE1U, 0xE3U, 0xE5U, 0xE7U, 0xF1U, 0xA2U, 0x2EU, 0x3CU, 0x28U, 0x2BU, 0x7CU,
+			0x26U, 0xE9U, 0xEAU, 0xEBU, 0xE8U, 0xEDU, 0xEEU, 0xEFU, 0xECU, 0xDFU, 0x21U, 0x24U, 0x2AU, 0x29U, 0x3BU, 0xACU,
+			0x2DU, 0x2FU, 0xC2U, 0xC4U, 0xC0U, 0xC1U, 0xC3U, 0xC5U, 0xC7U, 0xD1U, 0xA6U, 0x2CU, 0x25U, 0x5FU, 0x3EU, 0x3FU,
+			0xF8U, 0xC9U, 0xCAU, 0xCBU, 0xC8U, 0xCDU, 0xCEU, 0xCFU, 0xCCU, 0x60U, 0x3AU, 0x23U, 0x40U, 0x27U, 0x3DU, 0x22U,
+			0xD8U, 0x61U, 0x62U, 0x63U, 0x64U, 0x65U, 0x66U, 0x67U, 0x68U, 0x69U, 0xABU, 0xBBU, 0xF0U, 0xFDU, 0xFEU, 0xB1U,
+			0xB0U, 0x6AU, 0x6BU, 0x6CU, 0x6DU, 0x6EU, 0x6FU, 0x70U, 0x71U, 0x72U, 0xAAU, 0xBAU, 0xE6U, 0xB8U, 0xC6U, 0xA4U,
+			0xB5U, 0x7EU, 0x73U, 0x74U, 0x75U, 0x76U, 0x77U, 0x78U, 0x79U, 0x7AU, 0xA1U, 0xBFU, 0xD0U, 0xDDU, 0xDEU, 0xAEU,
+			0x5EU, 0xA3U, 0xA5U, 0xB7U, 0xA9U, 0xA7U, 0xB6U, 0xBCU, 0xBDU, 0xBEU, 0x5BU, 0x5DU, 0xAFU, 0xA8U, 0xB4U, 0xD7U,
+			0x7BU, 0x41U, 0x42U, 0x43U, 0x44U, 0x45U, 0x46U, 0x47U, 0x48U, 0x49U, 0xADU, 0xF4U, 0xF6U, 0xF2U, 0xF3U, 0xF5U,
+			0x7DU, 0x4AU, 0x4BU, 0x4CU, 0x4DU, 0x4EU, 0x4FU, 0x50U, 0x51U, 0x52U, 0xB9U, 0xFBU, 0xFCU, 0xF9U, 0xFAU, 0xFFU,
+			0x5CU, 0xF7U, 0x53U, 0x54U, 0x55U, 0x56U, 0x57U, 0x58U, 0x59U, 0x5AU, 0xB2U, 0xD4U, 0xD6U, 0xD2U, 0xD3U, 0xD5U,
+			0x30U, 0x31U, 0x32U, 0x33U, 0x34U, 0x35U, 0x36U, 0x37U, 0x38U, 0x39U, 0xB3U, 0xDBU, 0xDCU, 0xD9U, 0xDAU, 0x9FU,
+		}};
+
+		void ebcdic_to_latin1_scalar(std::uint8_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				dst[idx] = cp037_to_latin1[src[idx]];
+			}
+		}
+
+#if defined(PANKO_ARCH_X86_64)
+		/*
+			There is no 256 entry byte shuffle before AVX-512 VBMI, so the table is split into 16 rows of 16 and
+			each row is looked up with `vpshufb` by the low nibble. The high nibble selects the row by way of the
+			index being biased so that only bytes in the current row keep bit 7 clear, the rest of the lanes are
+			zeroed by the shuffle and the rows are OR'd together.
+		*/
+		PANKO_TARGET("avx2")
+		void ebcdic_to_latin1_avx2(std::uint8_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			const auto bias{_mm256_set1_epi8(0x70)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 32zu; idx += 32zu) {
+				const auto input{load_avx2(src + idx)};
+				auto result{_mm256_setzero_si256()};
+				for (std::size_t row{}; row < 16zu; ++row) {
+					const auto table{_mm256_broadcastsi128_si256(
+						_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(cp037_to_latin1.data() + (row * 16zu)))
+					)};
+					const auto index{_mm256_adds_epu8(
+						_mm256_xor_si256(input, _mm256_set1_epi8(static_cast<char>(row << 4U))), bias
+					)};
+					result = _mm256_or_si256(result, _mm256_shuffle_epi8(table, index));
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i_u*>(dst + idx), result);
+			}
+
+			ebcdic_to_latin1_scalar(dst + idx, src + idx, len - idx);
+		}
+#elif defined(PANKO_ARCH_AARCH64)
+		/* `tbl`/`tbx` can look up 64 bytes at a time, so the whole table is only four lookups */
+		void ebcdic_to_latin1_neon(std::uint8_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			const auto table_0{vld1q_u8_x4(cp037_to_latin1.data())};
+			const auto table_1{vld1q_u8_x4(cp037_to_latin1.data() + 64zu)};
+			const auto table_2{vld1q_u8_x4(cp037_to_latin1.data() + 128zu)};
+			const auto table_3{vld1q_u8_x4(cp037_to_latin1.data() + 192zu)};
+			const auto step{vdupq_n_u8(64U)};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				auto input{vld1q_u8(src + idx)};
+				auto result{vqtbl4q_u8(table_0, input)};
+				input = vsubq_u8(input, step);
+				result = vqtbx4q_u8(result, table_1, input);
+				input = vsubq_u8(input, step);
+				result = vqtbx4q_u8(result, table_2, input);
+				input = vsubq_u8(input, step);
+				result = vqtbx4q_u8(result, table_3, input);
+				vst1q_u8(dst + idx, result);
+			}
+
+			ebcdic_to_latin1_scalar(dst + idx, src + idx, len - idx);
+		}
+#endif
+
+		[[nodiscard]]
+		auto select_ebcdic_to_latin1() noexcept {
+#if defined(PANKO_ARCH_X86_64)
+			if (Panko::internal::cpu::features().avx2) {
+				return ebcdic_to_latin1_avx2;
+			}
+#elif defined(PANKO_ARCH_AARCH64)
+			return ebcdic_to_latin1_neon;
+#endif
+			return ebcdic_to_latin1_scalar;
+		}
+
+		/* == Shift-JIS == */
+
+		/* Widen the leading run of ASCII in `src` into `dst`, returning the length of the run */
+		[[nodiscard]]
+		std::size_t widen_ascii_scalar(wchar_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			for (std::size_t idx{}; idx < len; ++idx) {
+				if (src[idx] >= 0x80U) {
+					return idx;
+				}
+				dst[idx] = static_cast<wchar_t>(src[idx]);
+			}
+			return len;
+		}
+
+		/* Map a Shift-JIS lead byte to its row in the double byte table, or `shiftjis::rows` if it is not one */
+		[[nodiscard]]
+		constexpr std::size_t shiftjis_row(const std::uint8_t lead) noexcept {
+			if (lead >= 0x81U && lead <= 0x9FU) {
+				return lead - 0x81U;
+			}
+			if (lead >= 0xE0U && lead <= 0xEFU) {
+				return lead - 0xC1U;
+			}
+			return internal::shiftjis::rows;
+		}
+
+		/* Map a Shift-JIS trail byte to its column in the double byte table, or `shiftjis::cols` if it is not one */
+		[[nodiscard]]
+		constexpr std::size_t shiftjis_col(const std::uint8_t trail) noexcept {
+			if (trail >= 0x40U && trail <= 0x7EU) {
+				return trail - 0x40U;
+			}
+			if (trail >= 0x80U && trail <= 0xFCU) {
+				return trail - 0x41U;
+			}
+			return internal::shiftjis::cols;
+		}
+
+#if defined(PANKO_ARCH_X86_64)
+		[[nodiscard]]
+		std::size_t widen_ascii_sse2(wchar_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			const auto zero{_mm_setzero_si128()};
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(src + idx))};
+				if (_mm_movemask_epi8(input) != 0) {
+					break;
+				}
+
+				auto* const out{reinterpret_cast<__m128i_u*>(dst + idx)};
+				const auto low{_mm_unpacklo_epi8(input, zero)};
+				const auto high{_mm_unpackhi_epi8(input, zero)};
+				if constexpr (sizeof(wchar_t) == 2zu) {
+					_mm_storeu_si128(out, low);
+					_mm_storeu_si128(out + 1, high);
+				} else {
+					_mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+					_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+					_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+					_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+				}
+			}
+
+			return idx + widen_ascii_scalar(dst + idx, src + idx, len - idx);
+		}
+
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t widen_ascii_avx2(wchar_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 32zu; idx += 32zu) {
+				if (_mm256_movemask_epi8(load_avx2(src + idx)) != 0) {
+					break;
+				}
+
+				auto* const out{reinterpret_cast<__m256i_u*>(dst + idx)};
+				if constexpr (sizeof(wchar_t) == 2zu) {
+					for (std::size_t part{}; part < 2zu; ++part) {
+						const auto input{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(src + idx + (part * 16zu)))};
+						_mm256_storeu_si256(out + part, _mm256_cvtepu8_epi16(input));
+					}
+				} else {
+					for (std::size_t part{}; part < 4zu; ++part) {
+						const auto input{_mm_loadl_epi64(reinterpret_cast<const __m128i_u*>(src + idx + (part * 8zu)))};
+						_mm256_storeu_si256(out + part, _mm256_cvtepu8_epi32(input));
+					}
+				}
+			}
+
+			return idx + widen_ascii_sse2(dst + idx, src + idx, len - idx);
+		}
+#elif defined(PANKO_ARCH_AARCH64)
+		[[nodiscard]]
+		std::size_t widen_ascii_neon(wchar_t* const dst, const std::uint8_t* const src, const std::size_t len) noexcept {
+			std::size_t idx{};
+
+			for (; (len - idx) >= 16zu; idx += 16zu) {
+				const auto input{vld1q_u8(src + idx)};
+				if (vmaxvq_u8(input) >= 0x80U) {
+					break;
+				}
+
+				const auto low{vmovl_u8(vget_low_u8(input))};
+				const auto high{vmovl_u8(vget_high_u8(input))};
+				if constexpr (sizeof(wchar_t) == 2zu) {
+					auto* const out{reinterpret_cast<std::uint16_t*>(dst + idx)};
+					vst1q_u16(out, low);
+					vst1q_u16(out + 8, high);
+				} else {
+					auto* const out{reinterpret_cast<std::uint32_t*>(dst + idx)};
+					vst1q_u32(out, vmovl_u16(vget_low_u16(low)));
+					vst1q_u32(out + 4, vmovl_u16(vget_high_u16(low)));
+					vst1q_u32(out + 8, vmovl_u16(vget_low_u16(high)));
+					vst1q_u32(out + 12, vmovl_u16(vget_high_u16(high)));
+				}
+			}
+
+			return idx + widen_ascii_scalar(dst + idx, src + idx, len - idx);
+		}
+#endif
+
+		[[nodiscard]]
+		auto select_utf8_valid_prefix() noexcept {
+#if defined(PANKO_ARCH_X86_64)
+			const auto& feat{Panko::internal::cpu::features()};
+			if (feat.avx2) {
+				return utf8_valid_prefix_avx2;
+			}
+			if (feat.sse42) {
+				return utf8_valid_prefix_sse42;
+			}
+#elif defined(PANKO_ARCH_AARCH64)
+			return utf8_valid_prefix_neon;
+#endif
+			return utf8_valid_prefix_scalar;
+		}
+	}
+
+	std::size_t utf8_valid_prefix(const std::span<const std::byte> data) noexcept {
+		static const auto impl{select_utf8_valid_prefix()};
+		return impl(reinterpret_cast<const std::uint8_t*>(data.data()), data.size());
+	}
+
+	std::size_t ascii_valid_prefix(const std::span<const std::byte> data) noexcept {
+		static const auto impl{PANKO_SELECT_KERNEL(ascii_valid_prefix)};
+		return impl(reinterpret_cast<const std::uint8_t*>(data.data()), data.size());
+	}
+
+	std::size_t find_nul(const std::span<const std::byte> data) noexcept {
+		static const auto impl{PANKO_SELECT_KERNEL(find_nul)};
+		return impl(reinterpret_cast<const std::uint8_t*>(data.data()), data.size());
+	}
+
+	std::size_t utf16_valid_prefix(const std::span<const char16_t> data) noexcept {
+		static const auto find_surrogate{PANKO_SELECT_KERNEL(find_surrogate)};
+		const auto len{data.size()};
+		std::size_t idx{};
+
+		while (idx < len) {
+			idx += find_surrogate(data.data() + idx, len - idx);
+			if (idx == len) {
+				break;
+			}
+
+			/* Only a high surrogate followed by a low surrogate is valid */
+			if (data[idx] >= 0xDC00U || (idx + 1zu) == len || (data[idx + 1zu] & 0xFC00U) != 0xDC00U) {
+				return idx;
+			}
+			idx += 2zu;
+		}
+
+		return idx;
+	}
+
+	std::size_t utf32_valid_prefix(const std::span<const char32_t> data) noexcept {
+		static const auto impl{PANKO_SELECT_KERNEL(find_invalid_utf32)};
+		return impl(data.data(), data.size());
+	}
+
+	void utf16_from_bytes(const std::span<char16_t> dst, const std::span<const std::byte> src, const std::endian endian) noexcept {
+		static const auto byteswap{PANKO_SELECT_KERNEL(byteswap16)};
+		if (endian == std::endian::native) {
+			std::memcpy(dst.data(), src.data(), dst.size_bytes());
+		} else {
+			byteswap(dst.data(), reinterpret_cast<const std::uint8_t*>(src.data()), dst.size());
+		}
+	}
+
+	void utf32_from_bytes(const std::span<char32_t> dst, const std::span<const std::byte> src, const std::endian endian) noexcept {
+		static const auto byteswap{PANKO_SELECT_KERNEL(byteswap32)};
+		if (endian == std::endian::native) {
+			std::memcpy(dst.data(), src.data(), dst.size_bytes());
+		} else {
+			byteswap(dst.data(), reinterpret_cast<const std::uint8_t*>(src.data()), dst.size());
+		}
+	}
+
+	std::size_t find_nul16(const std::span<const std::byte> data) noexcept {
+		static const auto impl{PANKO_SELECT_KERNEL(find_nul16)};
+		return impl(reinterpret_cast<const std::uint8_t*>(data.data()), data.size() / 2zu);
+	}
+
+	std::size_t find_nul32(const std::span<const std::byte> data) noexcept {
+		static const auto impl{PANKO_SELECT_KERNEL(find_nul32)};
+		return impl(reinterpret_cast<const std::uint8_t*>(data.data()), data.size() / 4zu);
+	}
+
+	void ebcdic_to_latin1(const std::span<char> dst, const std::span<const std::byte> src) noexcept {
+		static const auto impl{select_ebcdic_to_latin1()};
+		impl(reinterpret_cast<std::uint8_t*>(dst.data()), reinterpret_cast<const std::uint8_t*>(src.data()), src.size());
+	}
+
+	std::size_t shiftjis_to_wide(const std::span<wchar_t> dst, const std::span<const std::byte> src) noexcept {
+		static const auto widen_ascii{PANKO_SELECT_KERNEL(widen_ascii)};
+		const auto* const data{reinterpret_cast<const std::uint8_t*>(src.data())};
+		const auto len{src.size()};
+		std::size_t in{};
+		std::size_t out{};
+
+		while (in < len) {
+			if (data[in] < 0x80U) {
+				const auto run{widen_ascii(dst.data() + out, data + in, len - in)};
+				in += run;
+				out += run;
+				continue;
+			}
+
+			const auto lead{data[in]};
+			/* Half-width katakana */
+			if (lead >= 0xA1U && lead <= 0xDFU) {
+				dst[out++] = static_cast<wchar_t>(0xFF61U + (lead - 0xA1U));
+				++in;
+				continue;
+			}
+
+			const auto row{shiftjis_row(lead)};
+			if (row == internal::shiftjis::rows || (in + 1zu) == len) {
+				break;
+			}
+			const auto col{shiftjis_col(data[in + 1zu])};
+			if (col == internal::shiftjis::cols) {
+				break;
+			}
+			const auto code_point{internal::shiftjis::double_byte[(row * internal::shiftjis::cols) + col]};
+			if (code_point == 0U) {
+				break;
+			}
 
+			dst[out++] = static_cast<wchar_t>(code_point);
+			in += 2zu;
+		}
 
+		return out;
+	}
 }
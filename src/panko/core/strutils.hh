@@ -5,7 +5,10 @@
 #if !defined(PANKO_CORE_STRUTILS_HH)
 #define PANKO_CORE_STRUTILS_HH
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string_view>
 #include <limits>
 
@@ -13,6 +16,120 @@
 
 namespace Panko::core::strutils {
 
+	/*! \brief Find the length of the longest prefix of `data` that is well-formed UTF-8.
+
+		Well-formed here is as defined by the Unicode standard, Table 3-7, so overlong encodings, surrogates,
+		code points above U+10FFFF, and sequences truncated by the end of `data` all end the prefix.
+
+		The implementation is vectorized where possible (AVX2, SSE4.2, or NEON), and selected at runtime.
+
+		\param data The data to validate.
+		\returns The length in bytes of the valid prefix, equal to `data.size()` if all of `data` is valid.
+	*/
+	[[nodiscard]]
+	PANKO_API std::size_t utf8_valid_prefix(std::span<const std::byte> data) noexcept;
+
+	/*! \brief Check if all of `data` is well-formed UTF-8. */
+	[[nodiscard]]
+	inline bool utf8_valid(const std::span<const std::byte> data) noexcept {
+		return utf8_valid_prefix(data) == data.size();
+	}
+
+	/*! \brief Find the length of the longest prefix of `data` that is 7-bit ASCII, that is all bytes are 0x00-0x7F.
+
+		\param data The data to validate.
+		\returns The length of the valid prefix, equal to `data.size()` if all of `data` is valid.
+	*/
+	[[nodiscard]]
+	PANKO_API std::size_t ascii_valid_prefix(std::span<const std::byte> data) noexcept;
+
+	/*! \brief Check if all of `data` is 7-bit ASCII. */
+	[[nodiscard]]
+	inline bool ascii_valid(const std::span<const std::byte> data) noexcept {
+		return ascii_valid_prefix(data) == data.size();
+	}
+
+	/*! \brief Find the offset of the first null byte in `data`.
+
+		\param data The data to search.
+		\returns The offset of the first null byte, or `data.size()` if there is none.
+	*/
+	[[nodiscard]]
+	PANKO_API std::size_t find_nul(std::span<const std::byte> data) noexcept;
+
+	/*! \brief Find the length of the longest prefix of `data` that is well-formed UTF-16.
+
+		Any unpaired surrogate, including a high surrogate cut off by the end of `data`, ends the prefix.
+
+		\param data The native endian UTF-16 code units to validate.
+		\returns The length in code units of the valid prefix.
+	*/
+	[[nodiscard]]
+	PANKO_API std::size_t utf16_valid_prefix(std::span<const char16_t> data) noexcept;
+
+	/*! \brief Find the length of the longest prefix of `data` that is well-formed UTF-32.
+
+		Surrogates and code points above U+10FFFF end the prefix.
+
+		\param data The native endian UTF-32 code units to validate.
+		\returns The length in code units of the valid prefix.
+	*/
+	[[nodiscard]]
+	PANKO_API std::size_t utf32_valid_prefix(std::span<const char32_t> data) noexcept;
+
+	/*! \brief Load `dst.size()` UTF-16 code units of the given endian from `src` into native endian.
+
+		\param dst The code units to write.
+		\param src The raw code units, must be at least `dst.size_bytes()` long.
+		\param endian The endian of the code units in `src`.
+	*/
+	PANKO_API void utf16_from_bytes(std::span<char16_t> dst, std::span<const std::byte> src, std::endian endian) noexcept;
+
+	/*! \brief Load `dst.size()` UTF-32 code units of the given endian from `src` into native endian.
+
+		\param dst The code units to write.
+		\param src The raw code units, must be at least `dst.size_bytes()` long.
+		\param endian The endian of the code units in `src`.
+	*/
+	PANKO_API void utf32_from_bytes(std::span<char32_t> dst, std::span<const std::byte> src, std::endian endian) noexcept;
+
+	/*! \brief Find the first 16-bit null code unit in `data`.
+
+		\param data The data to search, any trailing odd byte is ignored.
+		\returns The index in code units of the first null code unit, or `data.size() / 2` if there is none.
+	*/
+	[[nodiscard]]
+	PANKO_API std::size_t find_nul16(std::span<const std::byte> data) noexcept;
+
+	/*! \brief Find the first 32-bit null code unit in `data`.
+
+		\param data The data to search, any trailing partial code unit is ignored.
+		\returns The index in code units of the first null code unit, or `data.size() / 4` if there is none.
+	*/
+	[[nodiscard]]
+	PANKO_API std::size_t find_nul32(std::span<const std::byte> data) noexcept;
+
+	/*! \brief Decode IBM code page 037 EBCDIC into ISO-8859-1.
+
+		Every EBCDIC byte has a Latin-1 equivalent, so this can not fail and `dst` is always `src.size()` long.
+
+		\param dst The decoded string, must be at least `src.size()` long.
+		\param src The EBCDIC string to decode.
+	*/
+	PANKO_API void ebcdic_to_latin1(std::span<char> dst, std::span<const std::byte> src) noexcept;
+
+	/*! \brief Decode the longest valid prefix of a Shift-JIS string into wide characters.
+
+		Single byte ASCII and half-width katakana, and double byte JIS X 0208 characters are decoded, decoding
+		stops at the first byte that does not start a valid character, or at a double byte character that is
+		cut off by the end of `src`.
+
+		\param dst The decoded string, must be at least `src.size()` long.
+		\param src The Shift-JIS string to decode.
+		\returns The number of wide characters written to `dst`.
+	*/
+	[[nodiscard]]
+	PANKO_API std::size_t shiftjis_to_wide(std::span<wchar_t> dst, std::span<const std::byte> src) noexcept;
 
 }
 
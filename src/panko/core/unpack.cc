@@ -0,0 +1,402 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* unpack.cc - Bulk unpacking of packed odd-width integer arrays */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "panko/internal/defs.hh"
+#include "panko/internal/cpu.hh"
+#include "panko/core/unpack.hh"
+
+#if defined(PANKO_ARCH_X86_64)
+#	include <immintrin.h>
+#elif defined(PANKO_ARCH_AARCH64)
+#	include <arm_neon.h>
+#endif
+
+namespace Panko::core::_impl {
+	namespace {
+		/*
+			How to unpack one 16 byte vector worth of values with a byte shuffle, a shift, and a mask.
+
+			Widths that are a whole number of bytes are shuffled into their lanes in native byte order. Widths that
+			are a whole number of nibbles come in pairs that fill whole bytes, so the bytes each one of the pair
+			straddles are shuffled into its lane, and then the even and odd lanes are shifted down by different
+			amounts to line up the value. Either way the lanes are then masked down to just the value and sign
+			extended if need be.
+
+			The masks are stored as the bytes of each lane so that they can be loaded directly, which assumes
+			that vectors are little endian.
+		*/
+		struct layout_t final {
+			/* If there is no layout for this width then it is only ever unpacked by the scalar path */
+			bool valid;
+			/* Values per vector */
+			std::size_t values;
+			/* Bytes of input per vector */
+			std::size_t consumed;
+			std::array<std::uint8_t, 16> shuffle;
+			/* All ones in the bytes of the even lanes */
+			std::array<std::uint8_t, 16> even;
+			std::uint32_t shift_even;
+			std::uint32_t shift_odd;
+			/* Per lane right shifts for NEON, which shifts right by a negative amount */
+			std::array<std::uint8_t, 16> neg_shifts;
+			std::array<std::uint8_t, 16> mask;
+			/* The sign bit of each value if it is to be sign extended, otherwise zero */
+			std::array<std::uint8_t, 16> sign;
+			std::uint64_t sign_bit;
+		};
+
+		/* Set each lane of `lanes` to `value`, byte by byte */
+		constexpr void fill_lanes(std::array<std::uint8_t, 16>& lanes, const std::size_t lane, const std::uint64_t value) noexcept {
+			for (std::size_t idx{}; idx < lanes.size(); ++idx) {
+				lanes[idx] = static_cast<std::uint8_t>(value >> ((idx % lane) * 8zu));
+			}
+		}
+
+		[[nodiscard]]
+		constexpr layout_t make_layout(
+			const std::size_t bits, const std::size_t lane, const std::endian endian, const bool sign
+		) noexcept {
+			layout_t layout{};
+			const auto big{endian == std::endian::big};
+			const auto lane_bits{lane * 8zu};
+
+			layout.values = 16zu / lane;
+			layout.sign_bit = (sign && bits < lane_bits) ? 1ULL << (bits - 1zu) : 0U;
+			fill_lanes(layout.mask, lane, ~0ULL >> (64zu - bits));
+			fill_lanes(layout.sign, lane, layout.sign_bit);
+			layout.shuffle.fill(0x80U);
+			for (std::size_t idx{}; idx < layout.even.size(); ++idx) {
+				layout.even[idx] = ((idx / lane) % 2zu) == 0zu ? 0xFFU : 0x00U;
+			}
+
+			if ((bits % 8zu) == 0zu) {
+				const auto width{bits / 8zu};
+				layout.consumed = layout.values * width;
+				for (std::size_t value{}; value < layout.values; ++value) {
+					for (std::size_t byte{}; byte < width; ++byte) {
+						layout.shuffle[(value * lane) + byte] = static_cast<std::uint8_t>(
+							(value * width) + (big ? (width - 1zu - byte) : byte)
+						);
+					}
+				}
+				layout.valid = true;
+			} else if ((bits % 4zu) == 0zu) {
+				/* Each pair of values fills `group` bytes, and each value straddles `span` of them */
+				const auto group{bits / 4zu};
+				const auto span{(bits + 7zu) / 8zu};
+				if (span > lane) {
+					return layout;
+				}
+
+				layout.consumed = (layout.values / 2zu) * group;
+				for (std::size_t pair{}; pair < (layout.values / 2zu); ++pair) {
+					const auto base{pair * group};
+					for (std::size_t byte{}; byte < span; ++byte) {
+						layout.shuffle[(pair * 2zu * lane) + byte] = static_cast<std::uint8_t>(
+							base + (big ? (span - 1zu - byte) : byte)
+						);
+						layout.shuffle[(((pair * 2zu) + 1zu) * lane) + byte] = static_cast<std::uint8_t>(
+							base + (big ? (group - 1zu - byte) : ((group - span) + byte))
+						);
+					}
+				}
+				/* Big endian puts the first value in the high bits of the group, little endian in the low bits */
+				layout.shift_even = static_cast<std::uint32_t>(big ? (span * 8zu) - bits : 0zu);
+				layout.shift_odd = static_cast<std::uint32_t>(big ? 0zu : bits - ((group - span) * 8zu));
+				layout.valid = true;
+			}
+
+			for (std::size_t idx{}; idx < layout.neg_shifts.size(); ++idx) {
+				const auto shift{((idx / lane) % 2zu) == 0zu ? layout.shift_even : layout.shift_odd};
+				layout.neg_shifts[idx] = static_cast<std::uint8_t>((0U - std::uint64_t{shift}) >> ((idx % lane) * 8zu));
+			}
+			return layout;
+		}
+
+		/* The classic packings, to make sure the layouts are right */
+		static_assert(make_layout(24zu, 4zu, std::endian::big, false).shuffle[0] == 2U);
+		static_assert(make_layout(24zu, 4zu, std::endian::big, false).consumed == 12zu);
+		static_assert(make_layout(12zu, 2zu, std::endian::big, false).shuffle[2] == 2U);
+		static_assert(make_layout(12zu, 2zu, std::endian::big, false).shift_even == 4U);
+		static_assert(make_layout(20zu, 4zu, std::endian::little, false).shift_odd == 4U);
+		static_assert(!make_layout(10zu, 2zu, std::endian::big, false).valid);
+
+		/* Unpack values `first` up to `count` a bit at a time */
+		template<typename L>
+		void unpack_scalar(
+			const std::span<const std::byte> src, L* const dst, const std::size_t first, const std::size_t count,
+			const std::size_t bits, const std::endian endian, const std::uint64_t sign_bit
+		) noexcept {
+			const auto big{endian == std::endian::big};
+
+			for (auto idx{first}; idx < count; ++idx) {
+				std::uint64_t value{};
+				if ((bits % 8zu) == 0zu) {
+					const auto width{bits / 8zu};
+					const auto* const ptr{src.data() + (idx * width)};
+					for (std::size_t byte{}; byte < width; ++byte) {
+						value = (value << 8U) | std::to_integer<std::uint64_t>(ptr[big ? byte : (width - 1zu - byte)]);
+					}
+				} else {
+					auto pos{idx * bits};
+					auto need{bits};
+					while (need != 0zu) {
+						const auto byte{std::to_integer<std::uint64_t>(src[pos / 8zu])};
+						const auto used{pos % 8zu};
+						const auto take{std::min(8zu - used, need)};
+						const auto chunk_mask{(1ULL << take) - 1U};
+						if (big) {
+							value = (value << take) | ((byte >> ((8zu - used) - take)) & chunk_mask);
+						} else {
+							value |= ((byte >> used) & chunk_mask) << (bits - need);
+						}
+						need -= take;
+						pos += take;
+					}
+				}
+
+				dst[idx] = static_cast<L>((value ^ sign_bit) - sign_bit);
+			}
+		}
+
+		/* Unpack whole vectors of values, returning how many were unpacked */
+		using kernel_t = std::size_t (*)(
+			const layout_t& layout, const std::byte* src, std::size_t len, std::byte* dst, std::size_t count
+		) noexcept;
+
+#if defined(PANKO_ARCH_X86_64)
+		[[nodiscard]]
+		inline __m128i load_lanes(const void* const ptr) noexcept {
+			return _mm_loadu_si128(static_cast<const __m128i_u*>(ptr));
+		}
+
+		template<std::size_t lane>
+		[[nodiscard]]
+		inline __m128i srl_lanes(const __m128i values, const __m128i shift) noexcept {
+			if constexpr (lane == 2zu) {
+				return _mm_srl_epi16(values, shift);
+			} else if constexpr (lane == 4zu) {
+				return _mm_srl_epi32(values, shift);
+			} else {
+				return _mm_srl_epi64(values, shift);
+			}
+		}
+
+		template<std::size_t lane>
+		[[nodiscard]]
+		inline __m128i sub_lanes(const __m128i lhs, const __m128i rhs) noexcept {
+			if constexpr (lane == 2zu) {
+				return _mm_sub_epi16(lhs, rhs);
+			} else if constexpr (lane == 4zu) {
+				return _mm_sub_epi32(lhs, rhs);
+			} else {
+				return _mm_sub_epi64(lhs, rhs);
+			}
+		}
+
+		/* PSHUFB is SSSE3, which every CPU with SSE4.2 has */
+		template<std::size_t lane>
+		PANKO_TARGET("sse4.2")
+		[[nodiscard]]
+		std::size_t unpack_sse42(
+			const layout_t& layout, const std::byte* const src, const std::size_t len, std::byte* const dst,
+			const std::size_t count
+		) noexcept {
+			const auto shuffle{load_lanes(layout.shuffle.data())};
+			const auto even{load_lanes(layout.even.data())};
+			const auto mask{load_lanes(layout.mask.data())};
+			const auto sign{load_lanes(layout.sign.data())};
+			const auto shift_even{_mm_cvtsi32_si128(static_cast<int>(layout.shift_even))};
+			const auto shift_odd{_mm_cvtsi32_si128(static_cast<int>(layout.shift_odd))};
+			std::size_t done{};
+			std::size_t offset{};
+
+			for (; (count - done) >= layout.values && (len - offset) >= 16zu; done += layout.values, offset += layout.consumed) {
+				const auto gathered{_mm_shuffle_epi8(load_lanes(src + offset), shuffle)};
+				auto values{_mm_or_si128(
+					_mm_and_si128(even, srl_lanes<lane>(gathered, shift_even)),
+					_mm_andnot_si128(even, srl_lanes<lane>(gathered, shift_odd))
+				)};
+				values = _mm_and_si128(values, mask);
+				values = sub_lanes<lane>(_mm_xor_si128(values, sign), sign);
+				_mm_storeu_si128(reinterpret_cast<__m128i_u*>(dst + (done * lane)), values);
+			}
+
+			return done;
+		}
+
+		template<std::size_t lane>
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		inline __m256i srl_lanes(const __m256i values, const __m128i shift) noexcept {
+			if constexpr (lane == 2zu) {
+				return _mm256_srl_epi16(values, shift);
+			} else if constexpr (lane == 4zu) {
+				return _mm256_srl_epi32(values, shift);
+			} else {
+				return _mm256_srl_epi64(values, shift);
+			}
+		}
+
+		template<std::size_t lane>
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		inline __m256i sub_lanes(const __m256i lhs, const __m256i rhs) noexcept {
+			if constexpr (lane == 2zu) {
+				return _mm256_sub_epi16(lhs, rhs);
+			} else if constexpr (lane == 4zu) {
+				return _mm256_sub_epi32(lhs, rhs);
+			} else {
+				return _mm256_sub_epi64(lhs, rhs);
+			}
+		}
+
+		/* VPSHUFB only shuffles within each 128-bit half, so each half is loaded with one vector worth of input */
+		template<std::size_t lane>
+		PANKO_TARGET("avx2")
+		[[nodiscard]]
+		std::size_t unpack_avx2(
+			const layout_t& layout, const std::byte* const src, const std::size_t len, std::byte* const dst,
+			const std::size_t count
+		) noexcept {
+			const auto shuffle{_mm256_broadcastsi128_si256(load_lanes(layout.shuffle.data()))};
+			const auto even{_mm256_broadcastsi128_si256(load_lanes(layout.even.data()))};
+			const auto mask{_mm256_broadcastsi128_si256(load_lanes(layout.mask.data()))};
+			const auto sign{_mm256_broadcastsi128_si256(load_lanes(layout.sign.data()))};
+			const auto shift_even{_mm_cvtsi32_si128(static_cast<int>(layout.shift_even))};
+			const auto shift_odd{_mm_cvtsi32_si128(static_cast<int>(layout.shift_odd))};
+			const auto step{layout.values * 2zu};
+			std::size_t done{};
+			std::size_t offset{};
+
+			for (; (count - done) >= step && (len - offset) >= (layout.consumed + 16zu); done += step, offset += layout.consumed * 2zu) {
+				const auto input{_mm256_inserti128_si256(
+					_mm256_castsi128_si256(load_lanes(src + offset)), load_lanes(src + offset + layout.consumed), 1
+				)};
+				const auto gathered{_mm256_shuffle_epi8(input, shuffle)};
+				auto values{_mm256_or_si256(
+					_mm256_and_si256(even, srl_lanes<lane>(gathered, shift_even)),
+					_mm256_andnot_si256(even, srl_lanes<lane>(gathered, shift_odd))
+				)};
+				values = _mm256_and_si256(values, mask);
+				values = sub_lanes<lane>(_mm256_xor_si256(values, sign), sign);
+				_mm256_storeu_si256(reinterpret_cast<__m256i_u*>(dst + (done * lane)), values);
+			}
+
+			return done + unpack_sse42<lane>(layout, src + offset, len - offset, dst + (done * lane), count - done);
+		}
+#elif defined(PANKO_ARCH_AARCH64)
+		template<std::size_t lane>
+		[[nodiscard]]
+		uint8x16_t shift_lanes(const uint8x16_t values, const uint8x16_t shifts) noexcept {
+			if constexpr (lane == 2zu) {
+				return vreinterpretq_u8_u16(vshlq_u16(vreinterpretq_u16_u8(values), vreinterpretq_s16_u8(shifts)));
+			} else if constexpr (lane == 4zu) {
+				return vreinterpretq_u8_u32(vshlq_u32(vreinterpretq_u32_u8(values), vreinterpretq_s32_u8(shifts)));
+			} else {
+				return vreinterpretq_u8_u64(vshlq_u64(vreinterpretq_u64_u8(values), vreinterpretq_s64_u8(shifts)));
+			}
+		}
+
+		template<std::size_t lane>
+		[[nodiscard]]
+		uint8x16_t sub_lanes(const uint8x16_t lhs, const uint8x16_t rhs) noexcept {
+			if constexpr (lane == 2zu) {
+				return vreinterpretq_u8_u16(vsubq_u16(vreinterpretq_u16_u8(lhs), vreinterpretq_u16_u8(rhs)));
+			} else if constexpr (lane == 4zu) {
+				return vreinterpretq_u8_u32(vsubq_u32(vreinterpretq_u32_u8(lhs), vreinterpretq_u32_u8(rhs)));
+			} else {
+				return vreinterpretq_u8_u64(vsubq_u64(vreinterpretq_u64_u8(lhs), vreinterpretq_u64_u8(rhs)));
+			}
+		}
+
+		/* TBL gives zero for out of range indices, so the 0x80 shuffle entries clear bytes just like PSHUFB */
+		template<std::size_t lane>
+		[[nodiscard]]
+		std::size_t unpack_neon(
+			const layout_t& layout, const std::byte* const src, const std::size_t len, std::byte* const dst,
+			const std::size_t count
+		) noexcept {
+			const auto shuffle{vld1q_u8(layout.shuffle.data())};
+			const auto shifts{vld1q_u8(layout.neg_shifts.data())};
+			const auto mask{vld1q_u8(layout.mask.data())};
+			const auto sign{vld1q_u8(layout.sign.data())};
+			const auto* const input{reinterpret_cast<const std::uint8_t*>(src)};
+			auto* const output{reinterpret_cast<std::uint8_t*>(dst)};
+			std::size_t done{};
+			std::size_t offset{};
+
+			for (; (count - done) >= layout.values && (len - offset) >= 16zu; done += layout.values, offset += layout.consumed) {
+				const auto gathered{vqtbl1q_u8(vld1q_u8(input + offset), shuffle)};
+				auto values{vandq_u8(shift_lanes<lane>(gathered, shifts), mask)};
+				values = sub_lanes<lane>(veorq_u8(values, sign), sign);
+				vst1q_u8(output + (done * lane), values);
+			}
+
+			return done;
+		}
+#endif
+
+		template<std::size_t lane>
+		[[nodiscard]]
+		kernel_t select_unpack() noexcept {
+#if defined(PANKO_ARCH_X86_64)
+			const auto& feat{Panko::internal::cpu::features()};
+			if (feat.avx2) {
+				return unpack_avx2<lane>;
+			}
+			if (feat.sse42) {
+				return unpack_sse42<lane>;
+			}
+#elif defined(PANKO_ARCH_AARCH64)
+			if constexpr (std::endian::native == std::endian::little) {
+				return unpack_neon<lane>;
+			}
+#endif
+			return nullptr;
+		}
+
+		template<typename L>
+		void unpack_lanes(
+			const std::span<const std::byte> src, L* const dst, const std::size_t count, const std::size_t bits,
+			const std::endian endian, const bool sign
+		) noexcept {
+			static const auto kernel{select_unpack<sizeof(L)>()};
+			const auto layout{make_layout(bits, sizeof(L), endian, sign)};
+
+			std::size_t done{};
+			if (kernel != nullptr && layout.valid) {
+				done = kernel(layout, src.data(), src.size(), reinterpret_cast<std::byte*>(dst), count);
+			}
+			unpack_scalar(src, dst, done, count, bits, endian, layout.sign_bit);
+		}
+	}
+
+	void unpack_into(
+		const std::span<const std::byte> src, std::uint16_t* const dst, const std::size_t count, const std::size_t bits,
+		const std::endian endian, const bool sign
+	) noexcept {
+		unpack_lanes(src, dst, count, bits, endian, sign);
+	}
+
+	void unpack_into(
+		const std::span<const std::byte> src, std::uint32_t* const dst, const std::size_t count, const std::size_t bits,
+		const std::endian endian, const bool sign
+	) noexcept {
+		unpack_lanes(src, dst, count, bits, endian, sign);
+	}
+
+	void unpack_into(
+		const std::span<const std::byte> src, std::uint64_t* const dst, const std::size_t count, const std::size_t bits,
+		const std::endian endian, const bool sign
+	) noexcept {
+		unpack_lanes(src, dst, count, bits, endian, sign);
+	}
+}
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* unpack.hh - Bulk unpacking of packed odd-width integer arrays */
+
+#pragma once
+#if !defined(PANKO_CORE_UNPACK_HH)
+#define PANKO_CORE_UNPACK_HH
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/integers.hh"
+
+namespace Panko::core {
+	namespace _impl {
+		/* Unpack `count` values of `bits` bits from `src` into `dst`, which must have room for them all */
+		PANKO_API void unpack_into(
+			std::span<const std::byte> src, std::uint16_t* dst, std::size_t count, std::size_t bits, std::endian endian,
+			bool sign
+		) noexcept;
+		PANKO_API void unpack_into(
+			std::span<const std::byte> src, std::uint32_t* dst, std::size_t count, std::size_t bits, std::endian endian,
+			bool sign
+		) noexcept;
+		PANKO_API void unpack_into(
+			std::span<const std::byte> src, std::uint64_t* dst, std::size_t count, std::size_t bits, std::endian endian,
+			bool sign
+		) noexcept;
+	}
+
+	/*! \brief The native type that a packed `T` is unpacked into.
+
+		This is `T::v_type` for the odd-width `intN_t` types, and `T` itself for everything else.
+	*/
+	template<typename T>
+	struct unpacked final {
+		using type = T;
+	};
+
+	template<typename T, std::size_t bits>
+	struct unpacked<integers::intN_t<T, bits>> final {
+		using type = T;
+	};
+
+	template<typename T>
+	using unpacked_t = typename unpacked<T>::type;
+
+	/*! \brief The number of bits a packed `T` occupies */
+	template<typename T>
+	constexpr inline std::size_t packed_bits_v{[]() {
+		if constexpr (integers::is_intn_v<T>) {
+			return T::bits;
+		} else {
+			return sizeof(T) * 8zu;
+		}
+	}()};
+
+	/*! \brief Unpack an array of `bits` wide integers packed back to back into native integers.
+
+		The values are read as one continuous bit stream, most significant bit first for big endian and least
+		significant bit first for little endian. For widths that are a whole number of bytes this is just an
+		array of `bits / 8` byte integers, and otherwise it is the usual packing, such as two 12-bit values to
+		every 3 bytes.
+
+		If `U` is signed, the values are sign extended from `bits` wide.
+
+		The implementation is vectorized where possible (AVX2, SSE4.2, or NEON), and selected at runtime.
+
+		\code{.cc}
+		std::array<std::uint16_t, 64> samples{};
+		const auto count{unpack_bits<12zu, std::endian::big>(payload, std::span{samples})};
+		\endcode
+
+		\tparam bits The width of each packed value.
+		\tparam endian The endian of the packed values.
+		\param src The packed data.
+		\param dst Where to unpack the values to.
+		\returns The number of values unpacked, which is as many as fit in both `src` and `dst`.
+	*/
+	template<std::size_t bits, std::endian endian, typename U, std::size_t extent>
+	std::size_t unpack_bits(const std::span<const std::byte> src, const std::span<U, extent> dst) noexcept {
+		static_assert(std::is_integral_v<U> && !std::is_same_v<U, bool>, "U must be an integral type");
+		static_assert(sizeof(U) >= 2zu && sizeof(U) <= 8zu, "U must be a 16, 32, or 64-bit integer");
+		static_assert(bits != 0zu && bits <= (sizeof(U) * 8zu), "The packed values must fit in U");
+
+		const auto count{std::min(dst.size(), (src.size() * 8zu) / bits)};
+		if (count != 0zu) {
+			/* Signed and unsigned integers of the same width may alias each other */
+			using lane_t = std::make_unsigned_t<U>;
+			_impl::unpack_into(
+				src, reinterpret_cast<lane_t*>(dst.data()), count, bits, endian, std::is_signed_v<U>
+			);
+		}
+		return count;
+	}
+
+	/*! \brief Unpack an array of packed `T`s, such as `int24_t`, into their native type.
+
+		\code{.cc}
+		std::vector<std::int32_t> pcm(frames);
+		unpack<int24_t, std::endian::little>(payload, std::span{pcm});
+		\endcode
+
+		\see unpack_bits
+		\tparam T The packed type, an integral or `intN_t` type.
+		\tparam endian The endian of the packed values.
+	*/
+	template<typename T, std::endian endian>
+	std::size_t unpack(const std::span<const std::byte> src, const std::span<unpacked_t<T>> dst) noexcept {
+		return unpack_bits<packed_bits_v<T>, endian>(src, dst);
+	}
+}
+
+#endif /* PANKO_CORE_UNPACK_HH */
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* dispatch.cc - Dissector handoff tables */
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include "panko/dissectors/dispatch.hh"
+
+namespace Panko::dissectors {
+	using Panko::support::so_loader_t;
+
+	namespace {
+		template<typename K>
+		[[nodiscard]]
+		std::optional<K> key_from(const std::uint32_t value) noexcept {
+			using underlying_t = typename std::conditional_t<std::is_enum_v<K>, std::underlying_type<K>, std::type_identity<K>>::type;
+			if (value > std::numeric_limits<underlying_t>::max()) {
+				return std::nullopt;
+			}
+			const auto key{static_cast<K>(value)};
+			if (dispatch_key_t<K>::slot(key) == dispatch_key_t<K>::invalid_slot) {
+				return std::nullopt;
+			}
+			return key;
+		}
+
+		template<typename K>
+		[[nodiscard]]
+		bool add_key(dispatch_table_t<K>& table, const dissector_id_t id, const std::uint32_t value) noexcept {
+			const auto key{key_from<K>(value)};
+			if (!key) {
+				return false;
+			}
+			static_cast<void>(table.set(*key, id));
+			return true;
+		}
+
+		/* Mark the key as pending, unless a loaded dissector already has it */
+		template<typename K>
+		[[nodiscard]]
+		bool add_pending(dispatch_table_t<K>& table, const std::uint32_t value) noexcept {
+			const auto key{key_from<K>(value)};
+			if (!key || table[*key] != no_dissector) {
+				return false;
+			}
+			static_cast<void>(table.set(*key, pending_dissector));
+			return true;
+		}
+
+		template<typename K>
+		void set_resolver(dispatch_table_t<K>& table, so_loader_t& loader, const registration_kind_t kind) {
+			table.set_resolver([&loader, kind](const K key) {
+				return loader.resolve(kind, static_cast<std::uint32_t>(key)).value_or(no_dissector);
+			});
+		}
+	}
+
+	bool dispatch_tables_t::add(const dissector_id_t id, const registration_t& registration) {
+		switch (registration.kind) {
+			case registration_kind_t::LinkType:
+				return add_key(linktype, id, registration.value);
+			case registration_kind_t::EtherType:
+				return add_key(ethertype, id, registration.value);
+			case registration_kind_t::IpProto:
+				return add_key(ip_proto, id, registration.value);
+			case registration_kind_t::TcpPort:
+				return add_key(tcp_port, id, registration.value);
+			case registration_kind_t::UdpPort:
+				return add_key(udp_port, id, registration.value);
+			case registration_kind_t::Heuristic:
+				switch (static_cast<registration_kind_t>(registration.value)) {
+					case registration_kind_t::LinkType:
+						linktype.add_heuristic(id);
+						return true;
+					case registration_kind_t::EtherType:
+						ethertype.add_heuristic(id);
+						return true;
+					case registration_kind_t::IpProto:
+						ip_proto.add_heuristic(id);
+						return true;
+					case registration_kind_t::TcpPort:
+						tcp_port.add_heuristic(id);
+						return true;
+					case registration_kind_t::UdpPort:
+						udp_port.add_heuristic(id);
+						return true;
+					case registration_kind_t::Heuristic:
+						return false;
+				}
+				return false;
+		}
+		return false;
+	}
+
+	std::size_t dispatch_tables_t::add(const dissector_id_t id, const std::span<const registration_t> registrations) {
+		std::size_t added{};
+		for (const auto& registration : registrations) {
+			if (add(id, registration)) {
+				++added;
+			}
+		}
+		return added;
+	}
+
+	std::size_t dispatch_tables_t::add(so_loader_t& loader) {
+		/* Load the heuristic dissectors first, so they are registered along with everything else loaded */
+		constexpr std::array<registration_kind_t, 5> kinds{{
+			registration_kind_t::LinkType, registration_kind_t::EtherType, registration_kind_t::IpProto,
+			registration_kind_t::TcpPort, registration_kind_t::UdpPort,
+		}};
+		for (const auto kind : kinds) {
+			static_cast<void>(loader.resolve_all(registration_kind_t::Heuristic, static_cast<std::uint32_t>(kind)));
+		}
+
+		std::size_t added{};
+		for (std::size_t id{}; id < loader.size(); ++id) {
+			const auto dissector{static_cast<dissector_id_t>(id)};
+			added += add(dissector, loader.registrations(dissector));
+		}
+
+		for (const auto& registration : loader.unloaded_registrations()) {
+			bool pending{false};
+			switch (registration.kind) {
+				case registration_kind_t::LinkType:
+					pending = add_pending(linktype, registration.value);
+					break;
+				case registration_kind_t::EtherType:
+					pending = add_pending(ethertype, registration.value);
+					break;
+				case registration_kind_t::IpProto:
+					pending = add_pending(ip_proto, registration.value);
+					break;
+				case registration_kind_t::TcpPort:
+					pending = add_pending(tcp_port, registration.value);
+					break;
+				case registration_kind_t::UdpPort:
+					pending = add_pending(udp_port, registration.value);
+					break;
+				case registration_kind_t::Heuristic:
+					break;
+			}
+			if (pending) {
+				++added;
+			}
+		}
+
+		set_resolver(linktype, loader, registration_kind_t::LinkType);
+		set_resolver(ethertype, loader, registration_kind_t::EtherType);
+		set_resolver(ip_proto, loader, registration_kind_t::IpProto);
+		set_resolver(tcp_port, loader, registration_kind_t::TcpPort);
+		set_resolver(udp_port, loader, registration_kind_t::UdpPort);
+		return added;
+	}
+}
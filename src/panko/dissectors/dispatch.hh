@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* dispatch.hh - Dissector handoff tables */
+
+#pragma once
+#if !defined(PANKO_DISSECTORS_DISPATCH_HH)
+#define PANKO_DISSECTORS_DISPATCH_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+#include "panko/capture/linktype.hh"
+#include "panko/support/so_loader.hh"
+
+namespace Panko::dissectors {
+	using Panko::capture::linktype_t;
+	using Panko::support::dissector_id_t;
+	using Panko::support::registration_kind_t;
+	using Panko::support::registration_t;
+
+	/*! \brief The `dissector_id_t` of an empty dispatch table entry */
+	constexpr inline dissector_id_t no_dissector{std::numeric_limits<dissector_id_t>::max()};
+	/*! \brief The `dissector_id_t` of a dispatch table entry whose dissector has been indexed but not loaded */
+	constexpr inline dissector_id_t pending_dissector{no_dissector - 1U};
+	static_assert(
+		pending_dissector == Panko::support::max_dissectors,
+		"The loader must never hand out the IDs of no_dissector or pending_dissector"
+	);
+
+	/*! \brief How the keys of a `dispatch_table_t` map to its slots */
+	template<typename K>
+	struct dispatch_key_t;
+
+	template<>
+	struct dispatch_key_t<std::uint8_t> final {
+		constexpr static std::size_t slots{1zu << 8U};
+		constexpr static std::size_t invalid_slot{slots};
+
+		[[nodiscard]]
+		constexpr static std::size_t slot(const std::uint8_t key) noexcept {
+			return key;
+		}
+	};
+
+	template<>
+	struct dispatch_key_t<std::uint16_t> final {
+		constexpr static std::size_t slots{1zu << 16U};
+		constexpr static std::size_t invalid_slot{slots};
+
+		[[nodiscard]]
+		constexpr static std::size_t slot(const std::uint16_t key) noexcept {
+			return key;
+		}
+	};
+
+	template<>
+	struct dispatch_key_t<linktype_t> final {
+		/* The last slot is for unassigned LINKTYPEs and is never set */
+		constexpr static std::size_t slots{Panko::capture::linktype_slots + 1zu};
+		constexpr static std::size_t invalid_slot{Panko::capture::linktype_slots};
+
+		[[nodiscard]]
+		constexpr static std::size_t slot(const linktype_t key) noexcept {
+			return Panko::capture::linktype_slot(key);
+		}
+	};
+
+	/*! \brief A direct-indexed handoff table, the way a dissector picks the dissector for its payload.
+
+		Every possible key has its own slot holding the `dissector_id_t` registered for it, so a lookup is a
+		single indexed load, with no hashing or comparisons. For 16-bit keys this is 128KiB per table, which
+		is a fair trade for something done several times per packet.
+
+		When nothing is registered for a key, the table falls back to its heuristic dissectors in the order
+		they were added, and then to its default dissector.
+
+		A key can also be registered as `pending_dissector`, for a dissector that is known but not loaded yet.
+		The first dispatch on that key asks the table's resolver for the dissector and patches the entry with
+		the result, so from then on it costs the same as any other key. As this writes to the table, dispatching
+		from several threads at once is only safe once nothing is pending.
+
+		\tparam K The type of the key, `std::uint8_t`, `std::uint16_t` or `linktype_t`.
+	*/
+	template<typename K>
+	struct dispatch_table_t final {
+		using key_type = K;
+		using traits_type = dispatch_key_t<K>;
+		/*! \brief Loads the dissector for a `pending_dissector` key, returning `no_dissector` if it can't */
+		using resolve_fn = std::function<dissector_id_t(K)>;
+	private:
+		std::vector<dissector_id_t> _entries;
+		std::vector<dissector_id_t> _heuristics{};
+		dissector_id_t _default{no_dissector};
+		resolve_fn _resolve{};
+
+		/* Look up `key`, resolving it if it is pending, a key that fails to resolve is not tried again */
+		[[nodiscard]]
+		dissector_id_t lookup(const K key) {
+			auto& entry{_entries[traits_type::slot(key)]};
+			if (entry == pending_dissector) [[unlikely]] {
+				entry = _resolve ? _resolve(key) : no_dissector;
+			}
+			return entry;
+		}
+	public:
+		dispatch_table_t() : _entries(traits_type::slots, no_dissector) { }
+
+		/*! \brief Register `id` for `key`, replacing whatever was there.
+
+			\returns The dissector that was registered for `key`, or `no_dissector`.
+		*/
+		dissector_id_t set(const K key, const dissector_id_t id) noexcept {
+			const auto slot{traits_type::slot(key)};
+			if (slot == traits_type::invalid_slot) {
+				return no_dissector;
+			}
+			return std::exchange(_entries[slot], id);
+		}
+
+		/*! \brief Remove whatever is registered for `key`, returning it */
+		dissector_id_t remove(const K key) noexcept {
+			return set(key, no_dissector);
+		}
+
+		/*! \brief Returns the dissector registered for `key`, or `no_dissector`, without any fallback.
+
+			This does not resolve the key, so it may also be `pending_dissector`.
+		*/
+		[[nodiscard]]
+		dissector_id_t operator[](const K key) const noexcept {
+			return _entries[traits_type::slot(key)];
+		}
+
+		/*! \brief Set the dissector to use when nothing else matches, `no_dissector` to have none */
+		void set_default(const dissector_id_t id) noexcept {
+			_default = id;
+		}
+
+		[[nodiscard]]
+		dissector_id_t default_dissector() const noexcept {
+			return _default;
+		}
+
+		/*! \brief Set what loads the dissectors for keys registered as `pending_dissector` */
+		void set_resolver(resolve_fn resolve) {
+			_resolve = std::move(resolve);
+		}
+
+		/*! \brief Add `id` to the end of the heuristic chain, if it is not already in it */
+		void add_heuristic(const dissector_id_t id) {
+			if (std::ranges::find(_heuristics, id) == _heuristics.end()) {
+				_heuristics.push_back(id);
+			}
+		}
+
+		/*! \brief Remove `id` from the heuristic chain */
+		void remove_heuristic(const dissector_id_t id) noexcept {
+			const auto removed{std::ranges::remove(_heuristics, id)};
+			_heuristics.erase(removed.begin(), removed.end());
+		}
+
+		/*! \brief Replace the heuristic chain, which is tried in order */
+		void set_heuristics(const std::span<const dissector_id_t> ids) {
+			_heuristics.assign(ids.begin(), ids.end());
+		}
+
+		[[nodiscard]]
+		std::span<const dissector_id_t> heuristics() const noexcept {
+			return _heuristics;
+		}
+
+		/*! \brief Pick the dissector for `key`.
+
+			\param key The key to look up, which is resolved first if it is pending.
+			\param accept Called with each heuristic dissector in turn when nothing is registered for `key`,
+			returning true if it accepts the payload.
+			\returns The dissector registered for `key`, else the first heuristic dissector to accept the
+			payload, else the default dissector, which may be `no_dissector`.
+		*/
+		template<typename F>
+		[[nodiscard]]
+		dissector_id_t dispatch(const K key, F&& accept) {
+			if (const auto id{lookup(key)}; id != no_dissector) [[likely]] {
+				return id;
+			}
+			return fallback(std::forward<F>(accept));
+		}
+
+		/*! \brief Pick the dissector for a pair of keys, such as the source and destination ports.
+
+			The lower key is tried first, as it is the more likely to be a well known port, then the higher,
+			and then the heuristic and default fallbacks as with a single key.
+		*/
+		template<typename F>
+		[[nodiscard]]
+		dissector_id_t dispatch(const K first, const K second, F&& accept) {
+			const auto [low, high]{std::minmax(first, second)};
+			if (const auto id{lookup(low)}; id != no_dissector) [[likely]] {
+				return id;
+			}
+			if (const auto id{lookup(high)}; id != no_dissector) {
+				return id;
+			}
+			return fallback(std::forward<F>(accept));
+		}
+
+		/*! \brief Returns the first heuristic dissector that `accept`s the payload, else the default */
+		template<typename F>
+		[[nodiscard]]
+		dissector_id_t fallback(F&& accept) const {
+			static_assert(std::is_invocable_r_v<bool, F&, dissector_id_t>, "accept must be callable as bool(dissector_id_t)");
+			for (const auto id : _heuristics) {
+				if (accept(id)) {
+					return id;
+				}
+			}
+			return _default;
+		}
+	};
+
+	/*! \brief The handoff tables for each kind of `registration_t` */
+	struct dispatch_tables_t final {
+		dispatch_table_t<linktype_t> linktype{};
+		dispatch_table_t<std::uint16_t> ethertype{};
+		dispatch_table_t<std::uint8_t> ip_proto{};
+		dispatch_table_t<std::uint16_t> tcp_port{};
+		dispatch_table_t<std::uint16_t> udp_port{};
+
+		/*! \brief Register `id` under `registration`.
+
+			A heuristic registration adds `id` to the heuristic chain of the table named by its value.
+
+			\returns false if the registration is not valid for its table, such as a port over 65535.
+		*/
+		PANKO_CLS_API bool add(dissector_id_t id, const registration_t& registration);
+
+		/*! \brief Register `id` under each of `registrations`, returning the number that were valid */
+		PANKO_CLS_API std::size_t add(dissector_id_t id, std::span<const registration_t> registrations);
+
+		/*! \brief Register every dissector `loader` knows about, returning the number of registrations made.
+
+			Dissectors that are loaded are registered as with `add(id, registrations)`. The keys of the
+			dissectors `loader` has only indexed are registered as `pending_dissector` where nothing else is,
+			and each table resolves them through `loader` on first use. Heuristic dissectors are loaded now,
+			as they may be needed for any payload.
+
+			The tables keep a reference to `loader`, which must outlive them.
+		*/
+		PANKO_CLS_API std::size_t add(Panko::support::so_loader_t& loader);
+	};
+}
+
+#endif /* PANKO_DISSECTORS_DISPATCH_HH */
@@ -0,0 +1,295 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* engine.hh - Parallel per-flow dissection engine */
+
+#pragma once
+#if !defined(PANKO_DISSECTORS_ENGINE_HH)
+#define PANKO_DISSECTORS_ENGINE_HH
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+
+namespace Panko::dissectors {
+	/*! \brief Runs jobs on a set of workers by flow, delivering the results in the order the jobs were submitted.
+
+		Every job of a flow goes to the same worker, so each worker owns the state of its flows outright, such as
+		their reassembly buffers and conversation data, and never needs a lock to touch it. The results come back
+		in whatever order the workers finish them, and are put back into submission order through a reorder
+		window before being handed to the sink, so the output is identical to running everything on one thread.
+
+		Only the thread that owns the engine may call `submit`, `drain` and `finish`, which is also the only
+		thread that the sink is ever called on.
+
+		\code{.cc}
+		flow_engine_t<packet_t, dissector_worker_t> engine{
+			std::thread::hardware_concurrency(), [&](std::size_t) { return dissector_worker_t{tables}; }
+		};
+		for (auto& packet : capture) {
+			const auto flow{flow_hash(packet)};
+			engine.submit(flow, std::move(packet), write_result);
+		}
+		engine.finish(write_result);
+		\endcode
+
+		\tparam Job The type of the jobs, such as a packet and its metadata.
+		\tparam Worker The type of the workers, called as `Result worker(Job&)` on its own thread, and holding
+		the state of the flows it is given.
+	*/
+	template<typename Job, typename Worker>
+	struct flow_engine_t final {
+		using result_type = std::invoke_result_t<Worker&, Job&>;
+		static_assert(!std::is_void_v<result_type>, "Workers must return a result");
+		static_assert(std::is_move_constructible_v<Job>, "Jobs must be move constructible");
+	private:
+		/* Keeps the two sides of a queue from sharing a cache line */
+		constexpr static std::size_t line_size{64zu};
+
+		struct item_t final {
+			std::uint64_t seq;
+			std::optional<Job> job;
+		};
+
+		/* A single producer, single consumer queue feeding a worker */
+		struct queue_t final {
+			std::unique_ptr<item_t[]> items;
+			alignas(line_size) std::atomic<std::uint64_t> tail{};
+			/* Bumped after every push and on stopping, for the worker to sleep on */
+			std::atomic<std::uint32_t> wake{};
+			std::atomic<bool> stop{};
+		};
+
+		struct slot_t final {
+			std::atomic<bool> ready{};
+			std::optional<result_type> result{};
+			std::exception_ptr error{};
+		};
+
+		std::size_t _window;
+		std::size_t _mask;
+		std::unique_ptr<slot_t[]> _slots;
+		std::vector<Worker> _workers{};
+		std::unique_ptr<queue_t[]> _queues{};
+		std::vector<std::thread> _threads{};
+		std::uint64_t _next{};
+		std::uint64_t _delivered{};
+
+		void run(const std::size_t idx) noexcept {
+			auto& queue{_queues[idx]};
+			auto& worker{_workers[idx]};
+			std::uint64_t head{};
+
+			while (true) {
+				/* Read the wake count before the tail, so a push between the two still wakes the wait */
+				const auto wake{queue.wake.load(std::memory_order_acquire)};
+				const auto tail{queue.tail.load(std::memory_order_acquire)};
+				if (head == tail) {
+					if (queue.stop.load(std::memory_order_acquire)) {
+						return;
+					}
+					queue.wake.wait(wake, std::memory_order_acquire);
+					continue;
+				}
+
+				for (; head != tail; ++head) {
+					auto& item{queue.items[head & _mask]};
+					auto job{std::move(*item.job)};
+					item.job.reset();
+					complete(item.seq, worker, job);
+				}
+			}
+		}
+
+		void complete(const std::uint64_t seq, Worker& worker, Job& job) noexcept {
+			auto& slot{_slots[seq & _mask]};
+			try {
+				slot.result.emplace(worker(job));
+			} catch (...) {
+				slot.error = std::current_exception();
+			}
+			slot.ready.store(true, std::memory_order_release);
+			slot.ready.notify_one();
+		}
+
+		/* Hand the next result to `sink`, waiting for it if `wait` is set */
+		template<typename Sink>
+		bool deliver(Sink& sink, const bool wait) {
+			auto& slot{_slots[_delivered & _mask]};
+			if (!slot.ready.load(std::memory_order_acquire)) {
+				if (!wait) {
+					return false;
+				}
+				slot.ready.wait(false, std::memory_order_acquire);
+			}
+
+			const auto seq{_delivered++};
+			slot.ready.store(false, std::memory_order_relaxed);
+			if (slot.error) {
+				std::rethrow_exception(std::exchange(slot.error, nullptr));
+			}
+			auto result{std::move(*slot.result)};
+			slot.result.reset();
+			sink(seq, std::move(result));
+			return true;
+		}
+
+		void stop() noexcept {
+			for (std::size_t idx{}; idx < _threads.size(); ++idx) {
+				auto& queue{_queues[idx]};
+				queue.stop.store(true, std::memory_order_release);
+				queue.wake.fetch_add(1U, std::memory_order_release);
+				queue.wake.notify_one();
+			}
+			for (auto& thread : _threads) {
+				thread.join();
+			}
+			_threads.clear();
+		}
+	public:
+		/*! \brief Start an engine with `workers` worker threads.
+
+			\param workers The number of worker threads, 0 runs every job on the calling thread as it is submitted.
+			\param make Called as `make(idx)` for each worker to construct it, once, even when `workers` is 0.
+			\param window The most jobs that can be in flight at once, rounded up to a power of two. A larger
+			window rides out more imbalance between flows, at the cost of holding more results.
+		*/
+		template<typename Factory>
+		flow_engine_t(const std::size_t workers, Factory&& make, const std::size_t window = 4096zu) :
+			_window{std::bit_ceil(std::max(window, 2zu))}, _mask{_window - 1zu},
+			_slots{std::make_unique<slot_t[]>(_window)}
+		{
+			const auto count{std::max(workers, 1zu)};
+			_workers.reserve(count);
+			for (std::size_t idx{}; idx < count; ++idx) {
+				_workers.emplace_back(make(idx));
+			}
+
+			if (workers == 0zu) {
+				return;
+			}
+
+			_queues = std::make_unique<queue_t[]>(workers);
+			for (std::size_t idx{}; idx < workers; ++idx) {
+				_queues[idx].items = std::make_unique<item_t[]>(_window);
+			}
+			try {
+				_threads.reserve(workers);
+				for (std::size_t idx{}; idx < workers; ++idx) {
+					_threads.emplace_back(&flow_engine_t::run, this, idx);
+				}
+			} catch (...) {
+				stop();
+				throw;
+			}
+		}
+
+		flow_engine_t(const flow_engine_t&) = delete;
+		flow_engine_t& operator=(const flow_engine_t&) = delete;
+		flow_engine_t(flow_engine_t&&) = delete;
+		flow_engine_t& operator=(flow_engine_t&&) = delete;
+
+		/*! \brief Stops the workers, any results that were not delivered are discarded */
+		~flow_engine_t() noexcept {
+			stop();
+		}
+
+		/*! \brief Returns the number of worker threads, 0 if jobs are run on the calling thread */
+		[[nodiscard]]
+		std::size_t threads() const noexcept {
+			return _threads.size();
+		}
+
+		/*! \brief Returns the worker that the jobs of `flow` are given to */
+		[[nodiscard]]
+		std::size_t worker_for(const std::uint64_t flow) const noexcept {
+			/* Mix the hash, then map it onto the workers with a multiply rather than a divide */
+			const auto mixed{(flow * 0x9E37'79B9'7F4A'7C15ULL) >> 32U};
+			return static_cast<std::size_t>((mixed * _workers.size()) >> 32U);
+		}
+
+		/*! \brief Returns worker `idx`, which must not be used while there are jobs in flight */
+		[[nodiscard]]
+		Worker& worker(const std::size_t idx) noexcept {
+			return _workers[idx];
+		}
+
+		/*! \brief Returns the number of jobs submitted but not yet delivered */
+		[[nodiscard]]
+		std::size_t in_flight() const noexcept {
+			return static_cast<std::size_t>(_next - _delivered);
+		}
+
+		/*! \brief Submit a job for `flow`, delivering any results that are ready to `sink`.
+
+			If the reorder window is full, this waits for the oldest job to finish and delivers it first.
+
+			\param flow A hash identifying the flow of the job, every job of a flow must have the same hash.
+			\param job The job to run, which is always queued, even if delivering an earlier one throws.
+			\param sink Called as `sink(seq, result)` for each result in submission order, `seq` counting up from 0.
+			\throws Anything a worker threw for the job being delivered.
+		*/
+		template<typename Sink>
+		void submit(const std::uint64_t flow, Job job, Sink&& sink) {
+			/* Hold on to an error from making room until the job is queued, so it is not lost with it */
+			std::exception_ptr error{};
+			while (in_flight() >= _window) {
+				try {
+					static_cast<void>(deliver(sink, true));
+				} catch (...) {
+					error = std::current_exception();
+				}
+			}
+
+			const auto seq{_next++};
+			const auto idx{worker_for(flow)};
+			if (_threads.empty()) {
+				complete(seq, _workers[idx], job);
+			} else {
+				auto& queue{_queues[idx]};
+				const auto tail{queue.tail.load(std::memory_order_relaxed)};
+				auto& item{queue.items[tail & _mask]};
+				item.seq = seq;
+				item.job.emplace(std::move(job));
+				queue.tail.store(tail + 1U, std::memory_order_release);
+				queue.wake.fetch_add(1U, std::memory_order_release);
+				queue.wake.notify_one();
+			}
+
+			if (error) {
+				std::rethrow_exception(error);
+			}
+			drain(sink);
+		}
+
+		/*! \brief Deliver every result that is ready without waiting, returning the number delivered */
+		template<typename Sink>
+		std::size_t drain(Sink&& sink) {
+			std::size_t delivered{};
+			while (_delivered != _next && deliver(sink, false)) {
+				++delivered;
+			}
+			return delivered;
+		}
+
+		/*! \brief Wait for every job in flight and deliver all of their results */
+		template<typename Sink>
+		void finish(Sink&& sink) {
+			while (_delivered != _next) {
+				static_cast<void>(deliver(sink, true));
+			}
+		}
+	};
+}
+
+#endif /* PANKO_DISSECTORS_ENGINE_HH */
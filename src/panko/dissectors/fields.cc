@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* fields.cc - Dissector field registration */
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "panko/dissectors/fields.hh"
+
+namespace Panko::dissectors {
+	std::expected<field_id_t, field_error_t> field_registry_t::add(
+		const std::string_view name, const std::string_view description, const field_type_t type,
+		const field_id_t parent
+	) {
+		if (name.empty()) {
+			return std::unexpected(field_error_t::InvalidName);
+		}
+
+		if (const auto existing{find(name)}; existing) {
+			if (_fields[*existing].type != type) {
+				return std::unexpected(field_error_t::TypeMismatch);
+			}
+			return *existing;
+		}
+
+		/* `no_field` is never handed out */
+		if (_fields.size() >= no_field) {
+			return std::unexpected(field_error_t::TooMany);
+		}
+
+		const auto id{static_cast<field_id_t>(_fields.size())};
+		_fields.push_back({std::string{name}, std::string{description}, type, parent});
+		try {
+			_names.emplace(_fields.back().name, id);
+		} catch (...) {
+			_fields.pop_back();
+			throw;
+		}
+		return id;
+	}
+
+	std::optional<field_id_t> field_registry_t::find(const std::string_view name) const {
+		const auto field{_names.find(std::string{name})};
+		if (field == _names.end()) {
+			return std::nullopt;
+		}
+		return field->second;
+	}
+
+	field_set_t field_registry_t::with_parents(const std::span<const field_id_t> fields) const {
+		field_set_t set{};
+		for (auto field : fields) {
+			/* Stop at anything already in the set, its parents are too */
+			while (field < _fields.size() && !set.contains(field)) {
+				set.insert(field);
+				field = _fields[field].parent;
+			}
+		}
+		return set;
+	}
+}
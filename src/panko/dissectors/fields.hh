@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* fields.hh - Dissector field registration */
+
+#pragma once
+#if !defined(PANKO_DISSECTORS_FIELDS_HH)
+#define PANKO_DISSECTORS_FIELDS_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/errcodes.hh"
+
+namespace Panko::dissectors {
+	using Panko::core::error_codes::field_error_t;
+
+	/*! \brief The interned ID of a registered field, its index into the `field_registry_t` */
+	using field_id_t = std::uint16_t;
+
+	/*! \brief The `field_id_t` of nothing, such as the root of a `proto_tree_t` */
+	constexpr inline field_id_t no_field{std::numeric_limits<field_id_t>::max()};
+
+	/*! \enum Panko::dissectors::field_type_t
+		\brief The type of the value of a field
+	*/
+	enum struct field_type_t : std::uint8_t {
+		None     = 0x00U, /*!< No value, a protocol or a subtree */
+		Boolean  = 0x01U, /*!< A boolean, stored inline */
+		Unsigned = 0x02U, /*!< An unsigned integer of up to 64 bits, stored inline */
+		Signed   = 0x03U, /*!< A signed integer of up to 64 bits, stored inline */
+		Float    = 0x04U, /*!< A double, stored inline */
+		IPv4     = 0x05U, /*!< An IPv4 address, stored inline in host byte order */
+		Bytes    = 0x06U, /*!< The bytes the field covers in the packet */
+		String   = 0x07U, /*!< A string, the bytes the field covers in the packet */
+		IPv6     = 0x08U, /*!< An IPv6 address, the bytes the field covers in the packet */
+		Ether    = 0x09U, /*!< An Ethernet MAC address, the bytes the field covers in the packet */
+	};
+
+	/*! \brief Returns true if the value of a field of type `type` is stored inline in its node */
+	[[nodiscard]]
+	constexpr bool is_inline(const field_type_t type) noexcept {
+		return type >= field_type_t::Boolean && type <= field_type_t::IPv4;
+	}
+
+	/*! \brief The description of a registered field */
+	struct field_desc_t final {
+		/*! \brief The filter name of the field, such as `ip.src` */
+		std::string name;
+		/*! \brief A short human readable description, such as `Source Address` */
+		std::string description;
+		field_type_t type;
+		/*! \brief The field this one is nested under, such as the protocol, or `no_field` */
+		field_id_t parent;
+	};
+
+	/*! \brief A set of `field_id_t`s, such as the fields a filter or the columns of a view need.
+
+		This is a bitmap indexed by field ID, so checking whether a field is in the set is a single bit test.
+	*/
+	struct field_set_t final {
+	private:
+		std::vector<std::uint64_t> _bits{};
+		std::size_t _count{};
+	public:
+		field_set_t() noexcept = default;
+
+		field_set_t(const std::initializer_list<field_id_t> fields) {
+			for (const auto field : fields) {
+				insert(field);
+			}
+		}
+
+		/*! \brief Add `field` to the set */
+		void insert(const field_id_t field) {
+			const auto word{field / 64zu};
+			if (word >= _bits.size()) {
+				_bits.resize(word + 1zu);
+			}
+			const auto bit{std::uint64_t{1U} << (field % 64zu)};
+			if ((_bits[word] & bit) == 0U) {
+				_bits[word] |= bit;
+				++_count;
+			}
+		}
+
+		[[nodiscard]]
+		bool contains(const field_id_t field) const noexcept {
+			const auto word{field / 64zu};
+			return word < _bits.size() && ((_bits[word] >> (field % 64zu)) & 1U) != 0U;
+		}
+
+		/*! \brief Returns the number of fields in the set */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return _count;
+		}
+
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return _count == 0zu;
+		}
+
+		void clear() noexcept {
+			_bits.clear();
+			_count = 0zu;
+		}
+	};
+
+	/*! \brief Interns field names to `field_id_t`s.
+
+		Fields are registered once, when a dissector is set up, and from then on they are only referred to by
+		their ID, which indexes straight into the registry. Nothing on the per-packet path ever compares or
+		hashes a field name.
+	*/
+	struct field_registry_t final {
+	private:
+		std::vector<field_desc_t> _fields{};
+		std::unordered_map<std::string, field_id_t> _names{};
+	public:
+		field_registry_t() noexcept = default;
+
+		/*! \brief Register a field, or return the ID of the field already registered under `name`.
+
+			\param name The filter name of the field.
+			\param description A short human readable description of the field.
+			\param type The type of the value of the field.
+			\param parent The field this one is nested under, if any.
+			\returns The ID of the field, or why it could not be registered.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::expected<field_id_t, field_error_t> add(
+			std::string_view name, std::string_view description, field_type_t type, field_id_t parent = no_field
+		);
+
+		/*! \brief Returns the ID of the field called `name`, this is for registration and filter compilation */
+		[[nodiscard]]
+		PANKO_CLS_API std::optional<field_id_t> find(std::string_view name) const;
+
+		/*! \brief Returns the set of `fields` along with every field they are nested under.
+
+			A tree built for this set has the protocols and subtrees the fields are found in, as well as the
+			fields themselves. Fields that are not registered are ignored.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API field_set_t with_parents(std::span<const field_id_t> fields) const;
+
+		/*! \brief Returns the number of registered fields */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return _fields.size();
+		}
+
+		/*! \brief Returns the description of the field `id`, which must be registered */
+		[[nodiscard]]
+		const field_desc_t& operator[](const field_id_t id) const noexcept {
+			return _fields[id];
+		}
+	};
+}
+
+#endif /* PANKO_DISSECTORS_FIELDS_HH */
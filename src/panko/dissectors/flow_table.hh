@@ -0,0 +1,578 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* flow_table.hh - Flow / conversation table */
+
+#pragma once
+#if !defined(PANKO_DISSECTORS_FLOW_TABLE_HH)
+#define PANKO_DISSECTORS_FLOW_TABLE_HH
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "panko/internal/defs.hh"
+#include "panko/internal/cpu.hh"
+
+#if defined(PANKO_ARCH_X86_64)
+#	include <emmintrin.h>
+#elif defined(PANKO_ARCH_AARCH64)
+#	include <arm_neon.h>
+#endif
+
+namespace Panko::dissectors {
+	/*! \brief Which way a packet is going relative to its `flow_key_t` */
+	enum struct flow_direction_t : std::uint8_t {
+		Forward = 0x00U, /*!< From the lower address and port to the higher */
+		Reverse = 0x01U, /*!< From the higher address and port to the lower */
+	};
+
+	/*! \brief A direction agnostic flow key, a normalized 5-tuple along with its VLANs and tunnel.
+
+		Both directions of a conversation have the same key, as the endpoints are stored lower first. IPv4
+		addresses are stored as IPv4-mapped IPv6 addresses. Every byte of the key is meaningful, there is no
+		padding, so keys can be hashed and compared as plain memory.
+	*/
+	struct flow_key_t final {
+		using address_t = std::array<std::uint8_t, 16>;
+
+		address_t addr_lo;
+		address_t addr_hi;
+		std::uint16_t port_lo;
+		std::uint16_t port_hi;
+		/*! \brief The tunnel the flow is in, such as a VXLAN VNI, GRE key or GTP TEID, or 0 */
+		std::uint32_t tunnel;
+		/*! \brief The outer and inner VLAN IDs, or 0 */
+		std::uint16_t vlan_outer;
+		std::uint16_t vlan_inner;
+		/*! \brief The IP protocol number */
+		std::uint8_t proto;
+		std::uint8_t reserved0;
+		std::uint16_t reserved1;
+
+		/*! \brief Returns `addr` as an IPv4-mapped IPv6 address */
+		[[nodiscard]]
+		static constexpr address_t ipv4(const std::uint32_t addr) noexcept {
+			return {{
+				0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0xFFU, 0xFFU,
+				static_cast<std::uint8_t>(addr >> 24U), static_cast<std::uint8_t>(addr >> 16U),
+				static_cast<std::uint8_t>(addr >> 8U), static_cast<std::uint8_t>(addr)
+			}};
+		}
+
+		/*! \brief Build the key of a packet, and which way the packet is going.
+
+			\param src The source address, see `ipv4` for IPv4.
+			\param dst The destination address.
+			\param src_port The source port, or 0 for protocols without ports.
+			\param dst_port The destination port, or 0.
+			\param proto The IP protocol number.
+			\param vlan_outer The outer VLAN ID, or 0.
+			\param vlan_inner The inner VLAN ID, or 0.
+			\param tunnel The tunnel ID, or 0.
+		*/
+		[[nodiscard]]
+		static constexpr std::pair<flow_key_t, flow_direction_t> make(
+			const address_t& src, const address_t& dst, const std::uint16_t src_port, const std::uint16_t dst_port,
+			const std::uint8_t proto, const std::uint16_t vlan_outer = 0U, const std::uint16_t vlan_inner = 0U,
+			const std::uint32_t tunnel = 0U
+		) noexcept {
+			const bool forward{(src < dst) || (src == dst && src_port <= dst_port)};
+			if (forward) {
+				return {
+					{src, dst, src_port, dst_port, tunnel, vlan_outer, vlan_inner, proto, 0U, 0U},
+					flow_direction_t::Forward
+				};
+			}
+			return {
+				{dst, src, dst_port, src_port, tunnel, vlan_outer, vlan_inner, proto, 0U, 0U},
+				flow_direction_t::Reverse
+			};
+		}
+
+		/*! \brief Returns the 64-bit hash of the key */
+		[[nodiscard]]
+		std::uint64_t hash() const noexcept {
+			std::array<std::uint64_t, sizeof(flow_key_t) / sizeof(std::uint64_t)> words{};
+			std::memcpy(words.data(), this, sizeof(flow_key_t));
+
+			std::uint64_t hash{0x243F'6A88'85A3'08D3ULL};
+			for (const auto word : words) {
+				hash = (hash ^ word) * 0x9E37'79B9'7F4A'7C15ULL;
+				hash ^= hash >> 29U;
+			}
+			return hash * 0xBF58'476D'1CE4'E5B9ULL;
+		}
+
+		[[nodiscard]]
+		bool operator==(const flow_key_t& other) const noexcept {
+			return std::memcmp(this, &other, sizeof(flow_key_t)) == 0;
+		}
+	};
+
+	static_assert(sizeof(flow_key_t) == 48zu, "flow_key_t must have no padding");
+	static_assert(std::is_trivially_copyable_v<flow_key_t>);
+
+	/*! \brief The counters kept for every flow, inline in its table entry */
+	struct flow_stats_t final {
+		std::uint64_t packets;
+		std::uint64_t bytes;
+		/*! \brief The timestamps of the first and last packets of the flow */
+		std::int64_t first_seen;
+		std::int64_t last_seen;
+
+		/*! \brief Count a packet of `len` bytes seen at `timestamp` */
+		void touch(const std::int64_t timestamp, const std::uint64_t len) noexcept {
+			if (packets == 0U) {
+				first_seen = timestamp;
+			}
+			++packets;
+			bytes += len;
+			last_seen = std::max(last_seen, timestamp);
+		}
+	};
+
+	namespace _impl {
+		/* Each slot of a flow table has a control byte, which is one of these or the low 7 bits of its hash */
+		constexpr std::uint8_t ctrl_empty{0x80U};
+		constexpr std::uint8_t ctrl_deleted{0xFEU};
+
+		/* A group of control bytes that are all checked at once, the table is probed a group at a time */
+		struct group_t final {
+			constexpr static std::size_t width{16zu};
+
+#if defined(PANKO_ARCH_X86_64)
+			__m128i ctrl;
+
+			explicit group_t(const std::uint8_t* const pos) noexcept :
+				ctrl{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(pos))}
+			{ }
+
+			/* Returns a mask of the slots with the control byte `tag` */
+			[[nodiscard]]
+			std::uint32_t match(const std::uint8_t tag) const noexcept {
+				const auto tags{_mm_set1_epi8(static_cast<char>(tag))};
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(tags, ctrl)));
+			}
+
+			/* Returns a mask of the slots that are empty or deleted, which are the ones with the top bit set */
+			[[nodiscard]]
+			std::uint32_t match_free() const noexcept {
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl));
+			}
+#elif defined(PANKO_ARCH_AARCH64)
+			uint8x16_t ctrl;
+
+			explicit group_t(const std::uint8_t* const pos) noexcept : ctrl{vld1q_u8(pos)} { }
+
+			[[nodiscard]]
+			static std::uint32_t movemask(const uint8x16_t bytes) noexcept {
+				const std::array<std::uint8_t, 8> weights{{1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U}};
+				const auto top{vshrq_n_u8(bytes, 7)};
+				const auto weight{vld1_u8(weights.data())};
+				const auto lo{vaddv_u8(vmul_u8(vget_low_u8(top), weight))};
+				const auto hi{vaddv_u8(vmul_u8(vget_high_u8(top), weight))};
+				return std::uint32_t{lo} | (std::uint32_t{hi} << 8U);
+			}
+
+			[[nodiscard]]
+			std::uint32_t match(const std::uint8_t tag) const noexcept {
+				return movemask(vceqq_u8(ctrl, vdupq_n_u8(tag)));
+			}
+
+			[[nodiscard]]
+			std::uint32_t match_free() const noexcept {
+				return movemask(ctrl);
+			}
+#else
+			std::array<std::uint8_t, width> ctrl;
+
+			explicit group_t(const std::uint8_t* const pos) noexcept : ctrl{} {
+				std::memcpy(ctrl.data(), pos, width);
+			}
+
+			[[nodiscard]]
+			std::uint32_t match(const std::uint8_t tag) const noexcept {
+				std::uint32_t mask{};
+				for (std::size_t idx{}; idx < width; ++idx) {
+					mask |= std::uint32_t{ctrl[idx] == tag} << idx;
+				}
+				return mask;
+			}
+
+			[[nodiscard]]
+			std::uint32_t match_free() const noexcept {
+				std::uint32_t mask{};
+				for (std::size_t idx{}; idx < width; ++idx) {
+					mask |= std::uint32_t{(ctrl[idx] & 0x80U) != 0U} << idx;
+				}
+				return mask;
+			}
+#endif
+
+			/* Returns a mask of the slots that are empty */
+			[[nodiscard]]
+			std::uint32_t match_empty() const noexcept {
+				return match(ctrl_empty);
+			}
+		};
+	}
+
+	/*! \brief A table of flows and their state, keyed by `flow_key_t`.
+
+		This is an open addressing hash table in the style of Abseil's Swiss tables. Each slot has a control
+		byte holding 7 bits of the hash of its key, and the table is probed 16 control bytes at a time with
+		SIMD compares, so a lookup normally touches one group of control bytes and one entry. The hot
+		per-flow counters are stored inline in the entry alongside the key.
+
+		When the table needs to grow, the new table is allocated and the entries are moved over a few groups
+		at a time by each following insert or erase, rather than all at once, so no single packet pays for
+		rehashing tens of millions of flows.
+
+		\warning Entries move when the table grows, so references to them are only valid until the next
+		call that can insert or erase.
+
+		\tparam V The type of the per-flow state stored alongside the key and counters.
+	*/
+	template<typename V>
+	struct flow_table_t final {
+		/*! \brief A flow in the table */
+		struct entry_t final {
+			flow_key_t key;
+			flow_stats_t stats;
+			V value;
+		};
+
+		using group_t = _impl::group_t;
+		/*! \brief The number of groups moved to the new table by each insert or erase while growing */
+		constexpr static std::size_t migrate_groups{2zu};
+	private:
+		struct storage_t final {
+			std::unique_ptr<std::uint8_t[]> ctrl{};
+			entry_t* slots{};
+			/* The number of groups is always a power of two */
+			std::size_t groups{};
+			std::size_t size{};
+			std::size_t deleted{};
+
+			storage_t() noexcept = default;
+
+			explicit storage_t(const std::size_t group_count) :
+				ctrl{std::make_unique_for_overwrite<std::uint8_t[]>(group_count * group_t::width)},
+				slots{std::allocator<entry_t>{}.allocate(group_count * group_t::width)},
+				groups{group_count}
+			{
+				std::fill_n(ctrl.get(), capacity(), _impl::ctrl_empty);
+			}
+
+			storage_t(const storage_t&) = delete;
+			storage_t& operator=(const storage_t&) = delete;
+
+			storage_t(storage_t&& other) noexcept :
+				ctrl{std::move(other.ctrl)}, slots{std::exchange(other.slots, nullptr)},
+				groups{std::exchange(other.groups, 0zu)}, size{std::exchange(other.size, 0zu)},
+				deleted{std::exchange(other.deleted, 0zu)}
+			{ }
+
+			storage_t& operator=(storage_t&& other) noexcept {
+				if (&other != this) {
+					release();
+					ctrl = std::move(other.ctrl);
+					slots = std::exchange(other.slots, nullptr);
+					groups = std::exchange(other.groups, 0zu);
+					size = std::exchange(other.size, 0zu);
+					deleted = std::exchange(other.deleted, 0zu);
+				}
+				return *this;
+			}
+
+			~storage_t() noexcept {
+				release();
+			}
+
+			void release() noexcept {
+				if (slots == nullptr) {
+					return;
+				}
+				for (std::size_t idx{}; idx < capacity(); ++idx) {
+					if ((ctrl[idx] & 0x80U) == 0U) {
+						std::destroy_at(slots + idx);
+					}
+				}
+				std::allocator<entry_t>{}.deallocate(slots, capacity());
+				slots = nullptr;
+				ctrl.reset();
+				groups = size = deleted = 0zu;
+			}
+
+			[[nodiscard]]
+			std::size_t capacity() const noexcept {
+				return groups * group_t::width;
+			}
+
+			/* Returns the slot holding `key`, or `capacity()` if it is not in the table */
+			[[nodiscard]]
+			std::size_t find(const flow_key_t& key, const std::uint64_t hash) const noexcept {
+				if (groups == 0zu) {
+					return capacity();
+				}
+				const auto tag{static_cast<std::uint8_t>(hash & 0x7FU)};
+				auto group{static_cast<std::size_t>(hash >> 7U) & (groups - 1zu)};
+				for (std::size_t step{1zu}; step <= groups; ++step) {
+					const auto base{group * group_t::width};
+					const group_t ctrl_group{ctrl.get() + base};
+					for (auto matches{ctrl_group.match(tag)}; matches != 0U; matches &= matches - 1U) {
+						const auto slot{base + static_cast<std::size_t>(std::countr_zero(matches))};
+						if (slots[slot].key == key) [[likely]] {
+							return slot;
+						}
+					}
+					if (ctrl_group.match_empty() != 0U) [[likely]] {
+						return capacity();
+					}
+					/* Triangular probing visits every group when the number of groups is a power of two */
+					group = (group + step) & (groups - 1zu);
+				}
+				return capacity();
+			}
+
+			/* Returns a free slot for a key with `hash`, the table must have one */
+			[[nodiscard]]
+			std::size_t find_free(const std::uint64_t hash) const noexcept {
+				auto group{static_cast<std::size_t>(hash >> 7U) & (groups - 1zu)};
+				for (std::size_t step{1zu};; ++step) {
+					const auto base{group * group_t::width};
+					const auto free{group_t{ctrl.get() + base}.match_free()};
+					if (free != 0U) {
+						return base + static_cast<std::size_t>(std::countr_zero(free));
+					}
+					group = (group + step) & (groups - 1zu);
+				}
+			}
+
+			/* Move `entry` into a free slot, which the caller has made sure there is */
+			entry_t& place(entry_t&& entry, const std::uint64_t hash) noexcept(std::is_nothrow_move_constructible_v<entry_t>) {
+				const auto slot{find_free(hash)};
+				auto* const placed{std::construct_at(slots + slot, std::move(entry))};
+				if (ctrl[slot] == _impl::ctrl_deleted) {
+					--deleted;
+				}
+				ctrl[slot] = static_cast<std::uint8_t>(hash & 0x7FU);
+				++size;
+				return *placed;
+			}
+
+			void erase(const std::size_t slot) noexcept {
+				std::destroy_at(slots + slot);
+				/* If the group still has an empty slot, no probe has ever gone past it, so no tombstone is needed */
+				const auto base{slot - (slot % group_t::width)};
+				if (group_t{ctrl.get() + base}.match_empty() != 0U) {
+					ctrl[slot] = _impl::ctrl_empty;
+				} else {
+					ctrl[slot] = _impl::ctrl_deleted;
+					++deleted;
+				}
+				--size;
+			}
+
+			/* A table is full at 7/8ths of its slots being used or deleted */
+			[[nodiscard]]
+			bool full() const noexcept {
+				return (size + deleted) >= (capacity() - (capacity() / 8zu));
+			}
+		};
+
+		storage_t _table{};
+		/* The table being migrated from while growing, and the next group of it to move */
+		storage_t _old{};
+		std::size_t _migrated{};
+
+		/* Move the next `count` groups of the old table into the new one */
+		void migrate(const std::size_t count) {
+			const auto end{std::min(_old.groups, _migrated + count)};
+			for (; _migrated < end; ++_migrated) {
+				const auto base{_migrated * group_t::width};
+				for (std::size_t slot{base}; slot < base + group_t::width; ++slot) {
+					if ((_old.ctrl[slot] & 0x80U) != 0U) {
+						continue;
+					}
+					auto& entry{_old.slots[slot]};
+					static_cast<void>(_table.place(std::move(entry), entry.key.hash()));
+					_old.erase(slot);
+				}
+			}
+			if (_migrated == _old.groups) {
+				_old.release();
+				_migrated = 0zu;
+			}
+		}
+
+		/* Make sure there is room for one more entry, starting to grow the table if there is not */
+		void reserve_one() {
+			if (_table.groups != 0zu && !_table.full()) {
+				return;
+			}
+			/* Finishing off a previous migration early only happens if the table is being filled very quickly */
+			if (_old.groups != 0zu) {
+				migrate(_old.groups);
+			}
+
+			/* A table that is mostly tombstones is rebuilt at the same size rather than grown */
+			auto groups{std::max(_table.groups, 1zu)};
+			if (_table.size >= (_table.capacity() / 2zu) || _table.groups == 0zu) {
+				groups = (_table.groups == 0zu) ? 1zu : _table.groups * 2zu;
+			}
+			_old = std::exchange(_table, storage_t{groups});
+			_migrated = 0zu;
+			if (_old.groups == 0zu) {
+				return;
+			}
+			/* Moving the first groups right away guarantees room, as the new table is never fuller than the old */
+			migrate(migrate_groups);
+		}
+	public:
+		flow_table_t() noexcept = default;
+
+		/*! \brief Construct a table with room for about `flows` flows before it has to grow */
+		explicit flow_table_t(const std::size_t flows) :
+			_table{std::bit_ceil(std::max((flows + (flows / 7zu)) / group_t::width, 1zu))}
+		{ }
+
+		flow_table_t(const flow_table_t&) = delete;
+		flow_table_t& operator=(const flow_table_t&) = delete;
+		flow_table_t(flow_table_t&&) noexcept = default;
+		flow_table_t& operator=(flow_table_t&&) noexcept = default;
+
+		/*! \brief Returns the number of flows in the table */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return _table.size + _old.size;
+		}
+
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return size() == 0zu;
+		}
+
+		/*! \brief Returns the number of slots in the table, not counting a table being migrated from */
+		[[nodiscard]]
+		std::size_t capacity() const noexcept {
+			return _table.capacity();
+		}
+
+		/*! \brief Returns true if the table is part way through growing */
+		[[nodiscard]]
+		bool migrating() const noexcept {
+			return _old.groups != 0zu;
+		}
+
+		/*! \brief Returns the flow for `key`, or null if it is not in the table */
+		[[nodiscard]]
+		entry_t* find(const flow_key_t& key) noexcept {
+			const auto hash{key.hash()};
+			if (const auto slot{_table.find(key, hash)}; slot != _table.capacity()) {
+				return _table.slots + slot;
+			}
+			if (const auto slot{_old.find(key, hash)}; slot != _old.capacity()) {
+				return _old.slots + slot;
+			}
+			return nullptr;
+		}
+
+		[[nodiscard]]
+		const entry_t* find(const flow_key_t& key) const noexcept {
+			return const_cast<flow_table_t*>(this)->find(key);
+		}
+
+		/*! \brief Returns the flow for `key`, adding it with a value initialized `V` if it is not in the table.
+
+			\returns The flow, and true if it was added.
+		*/
+		std::pair<entry_t&, bool> try_emplace(const flow_key_t& key) {
+			const auto hash{key.hash()};
+			if (const auto slot{_table.find(key, hash)}; slot != _table.capacity()) [[likely]] {
+				return {_table.slots[slot], false};
+			}
+
+			if (_old.groups != 0zu) {
+				if (const auto slot{_old.find(key, hash)}; slot != _old.capacity()) {
+					/* The flow is active, so move it over now rather than waiting for its group */
+					auto& entry{_table.place(std::move(_old.slots[slot]), hash)};
+					_old.erase(slot);
+					migrate(migrate_groups);
+					return {entry, false};
+				}
+				migrate(migrate_groups);
+			}
+
+			reserve_one();
+			return {_table.place(entry_t{key, {}, V{}}, hash), true};
+		}
+
+		/*! \brief Remove the flow for `key`, returning true if it was in the table */
+		bool erase(const flow_key_t& key) {
+			const auto hash{key.hash()};
+			bool erased{false};
+			if (const auto slot{_table.find(key, hash)}; slot != _table.capacity()) {
+				_table.erase(slot);
+				erased = true;
+			} else if (const auto old_slot{_old.find(key, hash)}; old_slot != _old.capacity()) {
+				_old.erase(old_slot);
+				erased = true;
+			}
+			if (_old.groups != 0zu) {
+				migrate(migrate_groups);
+			}
+			return erased;
+		}
+
+		/*! \brief Call `func` with every flow in the table, in no particular order */
+		template<typename F>
+		void for_each(F&& func) {
+			for (auto* const table : {&_table, &_old}) {
+				for (std::size_t slot{}; slot < table->capacity(); ++slot) {
+					if ((table->ctrl[slot] & 0x80U) == 0U) {
+						func(table->slots[slot]);
+					}
+				}
+			}
+		}
+
+		/*! \brief Remove every flow for which `pred` returns true, returning the number removed */
+		template<typename F>
+		std::size_t erase_if(F&& pred) {
+			std::size_t erased{};
+			for (auto* const table : {&_table, &_old}) {
+				for (std::size_t slot{}; slot < table->capacity(); ++slot) {
+					if ((table->ctrl[slot] & 0x80U) == 0U && pred(table->slots[slot])) {
+						table->erase(slot);
+						++erased;
+					}
+				}
+			}
+			return erased;
+		}
+
+		/*! \brief Remove every flow, keeping the memory */
+		void clear() noexcept {
+			_old.release();
+			_migrated = 0zu;
+			for (std::size_t slot{}; slot < _table.capacity(); ++slot) {
+				if ((_table.ctrl[slot] & 0x80U) == 0U) {
+					std::destroy_at(_table.slots + slot);
+				}
+				_table.ctrl[slot] = _impl::ctrl_empty;
+			}
+			_table.size = 0zu;
+			_table.deleted = 0zu;
+		}
+	};
+}
+
+#endif /* PANKO_DISSECTORS_FLOW_TABLE_HH */
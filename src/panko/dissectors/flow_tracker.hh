@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* flow_tracker.hh - Bounded memory flow tracking with idle eviction */
+
+#pragma once
+#if !defined(PANKO_DISSECTORS_FLOW_TRACKER_HH)
+#define PANKO_DISSECTORS_FLOW_TRACKER_HH
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+#include "panko/dissectors/flow_table.hh"
+
+namespace Panko::dissectors {
+	/*! \brief Why a flow was evicted from a `flow_tracker_t` */
+	enum struct evict_reason_t : std::uint8_t {
+		Idle   = 0x00U, /*!< No packets were seen for the flow's protocol timeout */
+		Closed = 0x01U, /*!< The flow was closed, such as with a TCP FIN or RST, and its closing timeout passed */
+		Budget = 0x02U, /*!< The memory budget was exceeded */
+		Flush  = 0x03U, /*!< Every flow was flushed, such as at the end of a capture */
+	};
+
+	/*! \brief The configuration of a `flow_tracker_t`, all times are in nanoseconds */
+	struct flow_tracker_config_t final {
+		/*! \brief The resolution of the timer wheel, timeouts fire up to one tick late */
+		std::int64_t tick{1'000'000'000};
+		/*! \brief The number of ticks the timer wheel spans, longer timeouts are just checked again */
+		std::size_t wheel_slots{4096zu};
+		/*! \brief The most memory, in bytes, the flows may account for before the oldest are evicted */
+		std::size_t memory_budget{std::numeric_limits<std::size_t>::max()};
+		/*! \brief The idle timeouts by protocol */
+		std::int64_t default_timeout{60'000'000'000};
+		std::int64_t tcp_timeout{600'000'000'000};
+		std::int64_t udp_timeout{60'000'000'000};
+		/*! \brief How long a closed flow is kept for, to catch any stragglers */
+		std::int64_t closing_timeout{10'000'000'000};
+	};
+
+	/*! \brief The state a `flow_tracker_t` keeps for each flow, around the analyzer's own state */
+	template<typename V>
+	struct tracked_flow_t final {
+		V value;
+		/*! \brief The idle timeout of the flow */
+		std::int64_t timeout;
+		/*! \brief The tick of the flow's live timer, any other timers for it are stale */
+		std::int64_t timer_tick;
+		/*! \brief The memory accounted to the flow, on top of its table entry */
+		std::size_t memory;
+		bool closed;
+	};
+
+	/*! \brief Tracks flows by `flow_key_t`, evicting them when they go idle or memory runs short.
+
+		Every flow has a single timer in a timer wheel, which is not touched by packets of the flow at all.
+		Instead, when the timer fires, the flow's last seen time is checked and the timer is pushed back if it
+		has seen packets since, so tracking a packet costs nothing beyond the flow lookup. The wheel only spans
+		a limited number of ticks, timeouts beyond that are rescheduled the same way when they come around.
+
+		When the memory accounted to the flows goes over the budget, the flows closest to timing out are
+		evicted first. As their timeouts are from their last packet, this is least recently used order,
+		weighted by their protocol timeouts so long lived protocols are kept over short lived ones. Flows are
+		evicted in batches, down to a sixteenth under the budget, so picking them is rarely paid for.
+
+		The eviction callback is called with each flow before it is removed, so analyzers can flush whatever
+		they have for it. It must not call back into the tracker.
+
+		\tparam V The type of the analyzer's per-flow state.
+	*/
+	template<typename V>
+	struct flow_tracker_t final {
+		using table_type = flow_table_t<tracked_flow_t<V>>;
+		using entry_t = typename table_type::entry_t;
+		using evict_fn = std::function<void(entry_t&, evict_reason_t)>;
+
+		/*! \brief The memory each flow accounts for before anything is charged to it */
+		constexpr static std::size_t flow_memory{sizeof(entry_t) + sizeof(flow_key_t) + sizeof(std::int64_t)};
+	private:
+		struct wheel_timer_t final {
+			flow_key_t key;
+			std::int64_t tick;
+		};
+
+		struct candidate_t final {
+			std::int64_t deadline;
+			flow_key_t key;
+		};
+
+		flow_tracker_config_t _config;
+		evict_fn _on_evict;
+		table_type _flows{};
+		std::array<std::int64_t, 256> _timeouts{};
+		std::vector<std::vector<wheel_timer_t>> _wheel;
+		std::vector<wheel_timer_t> _scratch{};
+		std::vector<candidate_t> _candidates{};
+		std::int64_t _tick{std::numeric_limits<std::int64_t>::min()};
+		std::size_t _memory{};
+
+		[[nodiscard]]
+		std::int64_t tick_of(const std::int64_t timestamp) const noexcept {
+			/* Round towards negative infinity so ticks stay ordered around 0 */
+			const auto tick{timestamp / _config.tick};
+			return (timestamp < 0 && (timestamp % _config.tick) != 0) ? tick - 1 : tick;
+		}
+
+		/* The first tick to start after the flow's deadline, so a timeout fires late rather than early */
+		[[nodiscard]]
+		std::int64_t deadline_tick(const entry_t& entry) const noexcept {
+			return tick_of(entry.stats.last_seen + entry.value.timeout) + 1;
+		}
+
+		[[nodiscard]]
+		std::vector<wheel_timer_t>& slot(const std::int64_t tick) noexcept {
+			const auto slots{static_cast<std::int64_t>(_wheel.size())};
+			return _wheel[static_cast<std::size_t>(((tick % slots) + slots) % slots)];
+		}
+
+		/* (Re)schedule the timer of `entry` for `tick`, clamped to the span of the wheel */
+		void schedule(entry_t& entry, const std::int64_t tick) {
+			const auto span{static_cast<std::int64_t>(_wheel.size()) - 1};
+			const auto when{std::clamp(tick, _tick + 1, _tick + span)};
+			entry.value.timer_tick = when;
+			slot(when).push_back({entry.key, when});
+		}
+
+		void evict(entry_t& entry, const evict_reason_t reason) {
+			if (_on_evict) {
+				_on_evict(entry, reason);
+			}
+			_memory -= flow_memory + entry.value.memory;
+			const auto key{entry.key};
+			static_cast<void>(_flows.erase(key));
+		}
+
+		/* Run the timers in the slot of `tick`, evicting the flows that are due by `now` and pushing back the rest */
+		void run_slot(const std::int64_t tick, const std::int64_t now) {
+			auto& timers{slot(tick)};
+			if (timers.empty()) {
+				return;
+			}
+			_scratch.clear();
+			std::swap(_scratch, timers);
+
+			for (const auto& timer : _scratch) {
+				auto* const entry{_flows.find(timer.key)};
+				if (entry == nullptr || entry->value.timer_tick != timer.tick) {
+					continue;
+				}
+
+				const auto deadline{deadline_tick(*entry)};
+				if (deadline <= now) {
+					evict(*entry, entry->value.closed ? evict_reason_t::Closed : evict_reason_t::Idle);
+				} else {
+					schedule(*entry, deadline);
+				}
+			}
+			_scratch.clear();
+		}
+
+		[[nodiscard]]
+		bool over_budget(const std::size_t extra) const noexcept {
+			return _memory + extra > _config.memory_budget;
+		}
+
+		/*
+			Evict the flows closest to timing out until `extra` more bytes fit in the budget. This goes down to a
+			low watermark, a sixteenth under the budget, so the scan over the flows to pick them is only paid for
+			once in a while rather than for every new flow.
+		*/
+		void enforce_budget(const std::size_t extra) {
+			const auto slack{_config.memory_budget / 16zu};
+			const auto target{_config.memory_budget - slack};
+			while (over_budget(extra) && !_flows.empty()) {
+				/* Enough flows to get down to the watermark even if none of them have been charged anything */
+				const auto excess{(_memory + extra) - std::min(_memory + extra, target)};
+				const auto count{std::min(excess / flow_memory + 1zu, _flows.size())};
+
+				/* Keep the `count` earliest deadlines in a max heap */
+				const auto later{[](const candidate_t& lhs, const candidate_t& rhs) noexcept {
+					return lhs.deadline < rhs.deadline;
+				}};
+				_candidates.clear();
+				_flows.for_each([&](const entry_t& entry) {
+					const candidate_t candidate{entry.stats.last_seen + entry.value.timeout, entry.key};
+					if (_candidates.size() < count) {
+						_candidates.push_back(candidate);
+						std::push_heap(_candidates.begin(), _candidates.end(), later);
+					} else if (candidate.deadline < _candidates.front().deadline) {
+						std::pop_heap(_candidates.begin(), _candidates.end(), later);
+						_candidates.back() = candidate;
+						std::push_heap(_candidates.begin(), _candidates.end(), later);
+					}
+				});
+				std::sort_heap(_candidates.begin(), _candidates.end(), later);
+
+				for (const auto& candidate : _candidates) {
+					if (_memory + extra <= target) {
+						break;
+					}
+					if (auto* const entry{_flows.find(candidate.key)}; entry != nullptr) {
+						evict(*entry, evict_reason_t::Budget);
+					}
+				}
+			}
+			_candidates.clear();
+		}
+
+	public:
+		/*! \brief Construct a tracker.
+
+			\param config The timeouts and limits to use.
+			\param on_evict Called with each flow as it is evicted, may be empty.
+		*/
+		explicit flow_tracker_t(const flow_tracker_config_t& config = {}, evict_fn on_evict = {}) :
+			_config{config}, _on_evict{std::move(on_evict)},
+			_wheel(std::max(config.wheel_slots, 2zu))
+		{
+			_config.tick = std::max<std::int64_t>(_config.tick, 1);
+			_timeouts.fill(_config.default_timeout);
+			_timeouts[6] = _config.tcp_timeout;
+			_timeouts[17] = _config.udp_timeout;
+		}
+
+		flow_tracker_t(const flow_tracker_t&) = delete;
+		flow_tracker_t& operator=(const flow_tracker_t&) = delete;
+
+		/*! \brief Set the idle timeout of new flows of IP protocol `proto` */
+		void set_timeout(const std::uint8_t proto, const std::int64_t timeout) noexcept {
+			_timeouts[proto] = timeout;
+		}
+
+		/*! \brief Returns the number of flows being tracked */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return _flows.size();
+		}
+
+		/*! \brief Returns the memory accounted to the flows, in bytes */
+		[[nodiscard]]
+		std::size_t memory() const noexcept {
+			return _memory;
+		}
+
+		/*! \brief Returns the flow for `key`, or null if it is not being tracked */
+		[[nodiscard]]
+		entry_t* find(const flow_key_t& key) noexcept {
+			return _flows.find(key);
+		}
+
+		/*! \brief Track a packet of `len` bytes for the flow `key` seen at `timestamp`.
+
+			This first evicts anything that has timed out by `timestamp`, and anything needed to stay within
+			the memory budget if a new flow has to be added.
+
+			\returns The flow, which is only valid until the next call that can evict, and true if it is new.
+		*/
+		std::pair<entry_t&, bool> track(const flow_key_t& key, const std::int64_t timestamp, const std::uint64_t len) {
+			advance(timestamp);
+
+			if (_flows.find(key) == nullptr) {
+				enforce_budget(flow_memory);
+			}
+			auto [entry, added]{_flows.try_emplace(key)};
+			if (added) {
+				entry.value.timeout = _timeouts[key.proto];
+				entry.value.timer_tick = std::numeric_limits<std::int64_t>::min();
+				entry.value.memory = 0zu;
+				entry.value.closed = false;
+				_memory += flow_memory;
+				entry.stats.touch(timestamp, len);
+				schedule(entry, deadline_tick(entry));
+			} else {
+				entry.stats.touch(timestamp, len);
+			}
+			return {entry, added};
+		}
+
+		/*! \brief Mark `entry` as closed, so it is evicted after the closing timeout rather than its idle one */
+		void close(entry_t& entry) {
+			if (entry.value.closed) {
+				return;
+			}
+			entry.value.closed = true;
+			entry.value.timeout = std::min(entry.value.timeout, _config.closing_timeout);
+			/* The live timer may be far later than the closing timeout, so it is replaced */
+			const auto deadline{deadline_tick(entry)};
+			if (deadline < entry.value.timer_tick) {
+				schedule(entry, deadline);
+			}
+		}
+
+		/*! \brief Account `bytes` more, or fewer, bytes of memory to `entry`, such as for reassembly buffers.
+
+			The budget is enforced the next time a new flow is tracked.
+		*/
+		void charge(entry_t& entry, const std::ptrdiff_t bytes) noexcept {
+			if (bytes < 0) {
+				const auto released{std::min(entry.value.memory, static_cast<std::size_t>(-bytes))};
+				entry.value.memory -= released;
+				_memory -= released;
+			} else {
+				entry.value.memory += static_cast<std::size_t>(bytes);
+				_memory += static_cast<std::size_t>(bytes);
+			}
+		}
+
+		/*! \brief Evict every flow that has timed out by `now` */
+		void advance(const std::int64_t now) {
+			const auto target{tick_of(now)};
+			if (_tick == std::numeric_limits<std::int64_t>::min()) {
+				_tick = target;
+				return;
+			}
+			if (target <= _tick) {
+				return;
+			}
+
+			/* A jump of more than a whole turn only needs to visit each slot once */
+			const auto slots{static_cast<std::int64_t>(_wheel.size())};
+			const auto steps{std::min(target - _tick, slots)};
+			const auto first{_tick + 1};
+			_tick = target;
+			for (std::int64_t step{}; step < steps; ++step) {
+				run_slot(first + step, target);
+			}
+		}
+
+		/*! \brief Evict every flow, such as at the end of a capture */
+		void flush() {
+			if (_on_evict) {
+				_flows.for_each([this](entry_t& entry) { _on_evict(entry, evict_reason_t::Flush); });
+			}
+			_flows.clear();
+			for (auto& timers : _wheel) {
+				timers.clear();
+			}
+			_memory = 0zu;
+		}
+	};
+}
+
+#endif /* PANKO_DISSECTORS_FLOW_TRACKER_HH */
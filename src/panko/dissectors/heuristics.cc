@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* heuristics.cc - Heuristic dissector scheduling */
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "panko/dissectors/heuristics.hh"
+
+namespace Panko::dissectors {
+	heuristic_scheduler_t::heuristic_scheduler_t(
+		const std::span<const dissector_id_t> heuristics, const std::size_t flow_slots
+	) :
+		_flows(std::bit_ceil(std::max(flow_slots, 2zu)), flow_slot_t{0U, no_dissector}),
+		_flow_shift{static_cast<std::uint32_t>(64 - std::countr_zero(_flows.size()))}
+	{
+		_candidates.reserve(heuristics.size());
+		/* Stagger the first samples, so the clock is not read for every candidate on the same packet */
+		for (const auto id : heuristics) {
+			const auto offset{static_cast<std::uint32_t>(_candidates.size() % sample_interval)};
+			_candidates.push_back({id, {}, 1U + offset});
+		}
+	}
+
+	void heuristic_scheduler_t::forget_all() noexcept {
+		std::ranges::fill(_flows, flow_slot_t{0U, no_dissector});
+	}
+
+	void heuristic_scheduler_t::reorder() noexcept {
+		_until_reorder = reorder_interval;
+
+		/* Candidates with no cost samples yet are assumed to cost as much as the average one */
+		double total_cost{};
+		std::size_t costed{};
+		for (auto& candidate : _candidates) {
+			auto& stats{candidate.stats};
+			if (stats.attempts >= decay_threshold) {
+				stats.attempts /= 2U;
+				stats.hits /= 2U;
+				stats.reject_ns /= 2U;
+				stats.reject_samples /= 2U;
+			}
+			if (stats.reject_samples != 0U) {
+				total_cost += stats.reject_cost();
+				++costed;
+			}
+		}
+		const auto mean_cost{(costed == 0zu) ? 1.0 : total_cost / static_cast<double>(costed)};
+
+		/*
+			Trying the candidates in descending order of their chance of accepting over the cost of trying them
+			minimizes the expected time to find the match. The chance is smoothed so that candidates that have
+			not been tried much are neither written off nor favoured.
+		*/
+		const auto score{[mean_cost](const candidate_t& candidate) {
+			const auto& stats{candidate.stats};
+			const auto chance{
+				(static_cast<double>(stats.hits) + 1.0) / (static_cast<double>(stats.attempts) + 2.0)
+			};
+			const auto cost{(stats.reject_samples == 0U) ? mean_cost : stats.reject_cost()};
+			return chance / std::max(cost, 1.0);
+		}};
+		std::ranges::stable_sort(_candidates, [&score](const candidate_t& lhs, const candidate_t& rhs) {
+			return score(lhs) > score(rhs);
+		});
+	}
+}
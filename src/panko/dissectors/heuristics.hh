@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* heuristics.hh - Heuristic dissector scheduling */
+
+#pragma once
+#if !defined(PANKO_DISSECTORS_HEURISTICS_HH)
+#define PANKO_DISSECTORS_HEURISTICS_HH
+
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "panko/internal/defs.hh"
+#include "panko/dissectors/dispatch.hh"
+
+namespace Panko::dissectors {
+	/*! \brief What a `heuristic_scheduler_t` has learned about a single heuristic dissector */
+	struct heuristic_stats_t final {
+		/*! \brief The number of times the heuristic was tried, and the number of times it accepted */
+		std::uint64_t attempts;
+		std::uint64_t hits;
+		/*! \brief The total time spent in sampled rejections, and the number of samples */
+		std::uint64_t reject_ns;
+		std::uint64_t reject_samples;
+
+		/*! \brief Returns the fraction of attempts that were accepted */
+		[[nodiscard]]
+		double hit_rate() const noexcept {
+			return (attempts == 0U) ? 0.0 : static_cast<double>(hits) / static_cast<double>(attempts);
+		}
+
+		/*! \brief Returns the mean time a rejection takes, in nanoseconds */
+		[[nodiscard]]
+		double reject_cost() const noexcept {
+			return (reject_samples == 0U) ? 0.0 : static_cast<double>(reject_ns) / static_cast<double>(reject_samples);
+		}
+	};
+
+	/*! \brief Runs the heuristic chain of a dispatch table, learning the best order to try it in.
+
+		Each heuristic is tried in order until one accepts, and the candidates are periodically reordered by
+		how likely they are to accept for the time they take to reject, so the cheapest likely match is tried
+		first. The statistics decay over time, so the order follows changes in the traffic.
+
+		The winning heuristic is also cached for the flow the packet belongs to, so later packets of the same
+		conversation go straight to it. The flow cache is direct mapped, so a flow can be evicted by another
+		that hashes to the same slot, which only means its next packet runs the heuristics again. A flow that
+		no heuristic accepts is not cached, as it may just have not got to anything recognizable yet.
+
+		The scheduler is not thread safe, each dissection thread should have its own.
+	*/
+	struct heuristic_scheduler_t final {
+		/*! \brief The number of attempts between each reordering of the candidates */
+		constexpr static std::uint32_t reorder_interval{1024U};
+		/*! \brief How often the cost of a rejection is sampled, reading the clock for every one is not free */
+		constexpr static std::uint32_t sample_interval{16U};
+		/*! \brief The number of attempts at which the statistics of a candidate are halved */
+		constexpr static std::uint64_t decay_threshold{1U << 16U};
+	private:
+		struct candidate_t final {
+			dissector_id_t id;
+			heuristic_stats_t stats;
+			/* Counted per candidate, a shared count would only ever land on the same places in the chain */
+			std::uint32_t until_sample;
+		};
+
+		struct flow_slot_t final {
+			std::uint64_t flow;
+			dissector_id_t id;
+		};
+
+		std::vector<candidate_t> _candidates{};
+		std::vector<flow_slot_t> _flows;
+		std::uint32_t _flow_shift;
+		std::uint32_t _until_reorder{reorder_interval};
+
+		[[nodiscard]]
+		flow_slot_t& flow_slot(const std::uint64_t flow) noexcept {
+			/* Fibonacci hashing, so flow keys that only differ in their low bits still spread out */
+			return _flows[static_cast<std::size_t>((flow * 0x9E37'79B9'7F4A'7C15ULL) >> _flow_shift)];
+		}
+
+		template<typename F>
+		[[nodiscard]]
+		bool attempt(candidate_t& candidate, F& accept) {
+			++candidate.stats.attempts;
+			if (--candidate.until_sample != 0U) [[likely]] {
+				const bool accepted{accept(candidate.id)};
+				candidate.stats.hits += accepted ? 1U : 0U;
+				return accepted;
+			}
+
+			candidate.until_sample = sample_interval;
+			const auto start{std::chrono::steady_clock::now()};
+			const bool accepted{accept(candidate.id)};
+			if (accepted) {
+				++candidate.stats.hits;
+			} else {
+				const auto taken{std::chrono::steady_clock::now() - start};
+				candidate.stats.reject_ns += static_cast<std::uint64_t>(
+					std::chrono::duration_cast<std::chrono::nanoseconds>(taken).count()
+				);
+				++candidate.stats.reject_samples;
+			}
+			return accepted;
+		}
+	public:
+		/*! \brief Schedule the heuristics in `heuristics`, which starts as the order they are tried in.
+
+			\param heuristics The heuristic chain, normally the `heuristics()` of a `dispatch_table_t`.
+			\param flow_slots The number of flows to remember the winning heuristic of, rounded up to a power
+			of two.
+		*/
+		PANKO_CLS_API explicit heuristic_scheduler_t(
+			std::span<const dissector_id_t> heuristics, std::size_t flow_slots = 4096zu
+		);
+
+		/*! \brief Pick the heuristic dissector for a packet of `flow`.
+
+			\param flow A hash identifying the conversation the packet belongs to.
+			\param accept Called with each heuristic dissector to try, returning true if it accepts the payload.
+			\returns The dissector cached for `flow`, else the first heuristic to accept, else `no_dissector`.
+		*/
+		template<typename F>
+		[[nodiscard]]
+		dissector_id_t select(const std::uint64_t flow, F&& accept) {
+			static_assert(std::is_invocable_r_v<bool, F&, dissector_id_t>, "accept must be callable as bool(dissector_id_t)");
+
+			auto& slot{flow_slot(flow)};
+			if (slot.id != no_dissector && slot.flow == flow) [[likely]] {
+				return slot.id;
+			}
+
+			if (--_until_reorder == 0U) [[unlikely]] {
+				reorder();
+			}
+
+			for (auto& candidate : _candidates) {
+				if (attempt(candidate, accept)) {
+					slot = {flow, candidate.id};
+					return candidate.id;
+				}
+			}
+			return no_dissector;
+		}
+
+		/*! \brief Forget the cached heuristic for `flow`, such as when the flow ends */
+		void forget(const std::uint64_t flow) noexcept {
+			auto& slot{flow_slot(flow)};
+			if (slot.flow == flow) {
+				slot.id = no_dissector;
+			}
+		}
+
+		/*! \brief Forget the cached heuristic of every flow */
+		PANKO_CLS_API void forget_all() noexcept;
+
+		/*! \brief Reorder the candidates by their learned hit rate and rejection cost.
+
+			This is done automatically every `reorder_interval` attempts.
+		*/
+		PANKO_CLS_API void reorder() noexcept;
+
+		/*! \brief Returns the number of candidates */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return _candidates.size();
+		}
+
+		/*! \brief Returns the `idx`th candidate in the current order */
+		[[nodiscard]]
+		dissector_id_t operator[](const std::size_t idx) const noexcept {
+			return _candidates[idx].id;
+		}
+
+		/*! \brief Returns the statistics of the `idx`th candidate in the current order */
+		[[nodiscard]]
+		const heuristic_stats_t& stats(const std::size_t idx) const noexcept {
+			return _candidates[idx].stats;
+		}
+	};
+}
+
+#endif /* PANKO_DISSECTORS_HEURISTICS_HH */
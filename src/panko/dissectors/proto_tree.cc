@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* proto_tree.cc - Arena allocated dissection result tree */
+
+#include "panko/dissectors/proto_tree.hh"
+
+namespace Panko::dissectors {
+	namespace {
+		[[nodiscard]]
+		const proto_node_t* find_in(const proto_node_t& parent, const field_id_t field) noexcept {
+			for (const auto& child : parent.children()) {
+				if (child.field == field) {
+					return &child;
+				}
+				if (const auto* const found{find_in(child, field)}; found != nullptr) {
+					return found;
+				}
+			}
+			return nullptr;
+		}
+	}
+
+	const proto_node_t* proto_tree_t::find(const field_id_t field) const noexcept {
+		return find_in(*_root, field);
+	}
+}
@@ -0,0 +1,308 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* proto_tree.hh - Arena allocated dissection result tree */
+
+#pragma once
+#if !defined(PANKO_DISSECTORS_PROTO_TREE_HH)
+#define PANKO_DISSECTORS_PROTO_TREE_HH
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <span>
+#include <type_traits>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/arena.hh"
+#include "panko/dissectors/fields.hh"
+
+namespace Panko::dissectors {
+	using Panko::core::arena_t;
+
+	/*! \brief A single node of a `proto_tree_t`, a field and where it is in the packet.
+
+		Nodes are all the same size and refer to their field by ID. Values that fit in 64 bits are stored
+		inline, everything else is the bytes the node covers in the packet, so nodes never own any memory.
+	*/
+	struct proto_node_t final {
+		proto_node_t* first_child;
+		proto_node_t* last_child;
+		proto_node_t* next_sibling;
+		/*! \brief The inline value, see the `as_` accessors */
+		std::uint64_t value;
+		/*! \brief The bytes of the packet the node covers */
+		std::uint32_t offset;
+		std::uint32_t length;
+		field_id_t field;
+
+		[[nodiscard]]
+		std::uint64_t as_unsigned() const noexcept {
+			return value;
+		}
+
+		[[nodiscard]]
+		std::int64_t as_signed() const noexcept {
+			return std::bit_cast<std::int64_t>(value);
+		}
+
+		[[nodiscard]]
+		double as_float() const noexcept {
+			return std::bit_cast<double>(value);
+		}
+
+		[[nodiscard]]
+		bool as_bool() const noexcept {
+			return value != 0U;
+		}
+
+		/*! \brief A forward range over the children of a node */
+		struct children_t final {
+			struct iterator final {
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = const proto_node_t;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const proto_node_t*;
+				using reference = const proto_node_t&;
+
+				const proto_node_t* node;
+
+				[[nodiscard]]
+				reference operator*() const noexcept {
+					return *node;
+				}
+
+				[[nodiscard]]
+				pointer operator->() const noexcept {
+					return node;
+				}
+
+				iterator& operator++() noexcept {
+					node = node->next_sibling;
+					return *this;
+				}
+
+				iterator operator++(int) noexcept {
+					auto prev{*this};
+					node = node->next_sibling;
+					return prev;
+				}
+
+				[[nodiscard]]
+				bool operator==(const iterator& other) const noexcept = default;
+			};
+
+			const proto_node_t* first;
+
+			[[nodiscard]]
+			iterator begin() const noexcept {
+				return {first};
+			}
+
+			[[nodiscard]]
+			iterator end() const noexcept {
+				return {nullptr};
+			}
+		};
+
+		[[nodiscard]]
+		children_t children() const noexcept {
+			return {first_child};
+		}
+	};
+
+	static_assert(std::is_trivially_destructible_v<proto_node_t>, "proto_node_t must be arena allocatable");
+	static_assert(sizeof(proto_node_t) <= 48zu, "proto_node_t should stay small, there are a lot of them");
+
+	/*! \brief The result of dissecting a packet, a tree of `proto_node_t`s allocated from an `arena_t`.
+
+		The tree does not own its nodes, the arena does, so all of the trees built from an arena are
+		released together in O(1) by resetting it, once per packet or once per batch of packets. The tree
+		also refers into the packet rather than copying any of it, so the arena and the packet must both
+		outlive it.
+
+		\code{.cc}
+		arena_t arena{};
+		for (auto& packet : batch) {
+			proto_tree_t tree{arena, packet};
+			auto& ip{tree.add(tree.root(), ip_proto, 14U, 20U)};
+			tree.add_unsigned(ip, ip_ttl, 22U, 1U, ttl);
+			...
+		}
+		arena.reset();
+		\endcode
+
+		A tree can also be built for a `field_set_t` of the fields that are actually needed, in which case
+		`add` skips everything else. Skipped fields hand back a sink node, so dissectors don't need to check
+		the interest set themselves, and anything wanted beneath a skipped field is added to the root
+		instead. Dissectors should still check `wants` before decoding or formatting a value that is costly
+		to produce, and can skip building anything at all when `building` is false, while still parsing as
+		much as they need to hand off to the next dissector.
+	*/
+	struct proto_tree_t final {
+	private:
+		arena_t& _arena;
+		std::span<const std::byte> _packet;
+		const field_set_t* _interest;
+		proto_node_t* _root;
+		/* What skipped fields are added as, it never has any children linked to it */
+		proto_node_t _sink{nullptr, nullptr, nullptr, 0U, 0U, 0U, no_field};
+		std::size_t _size{};
+	public:
+		/*! \brief Start a new, empty tree for `packet` in `arena` */
+		proto_tree_t(arena_t& arena, const std::span<const std::byte> packet) :
+			proto_tree_t{arena, packet, nullptr}
+		{ }
+
+		/*! \brief Start a new, empty tree for `packet` in `arena`, that only holds the fields in `interest`.
+
+			\param arena The arena to allocate the nodes from.
+			\param packet The packet the tree is for.
+			\param interest The fields wanted, normally from `field_registry_t::with_parents`, or null for all.
+		*/
+		proto_tree_t(arena_t& arena, const std::span<const std::byte> packet, const field_set_t* const interest) :
+			_arena{arena}, _packet{packet}, _interest{interest},
+			_root{new(arena.allocate(sizeof(proto_node_t), alignof(proto_node_t))) proto_node_t{
+				nullptr, nullptr, nullptr, 0U, 0U, static_cast<std::uint32_t>(packet.size()), no_field
+			}}
+		{ }
+
+		proto_tree_t(const proto_tree_t&) = delete;
+		proto_tree_t& operator=(const proto_tree_t&) = delete;
+
+		/*! \brief Returns the root of the tree, which covers the whole packet and has no field */
+		[[nodiscard]]
+		proto_node_t& root() noexcept {
+			return *_root;
+		}
+
+		[[nodiscard]]
+		const proto_node_t& root() const noexcept {
+			return *_root;
+		}
+
+		/*! \brief Returns the number of nodes in the tree, not counting the root */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return _size;
+		}
+
+		/*! \brief Returns true if `field` will be added to the tree rather than skipped */
+		[[nodiscard]]
+		bool wants(const field_id_t field) const noexcept {
+			return _interest == nullptr || _interest->contains(field);
+		}
+
+		/*! \brief Returns false if nothing at all will be added to the tree */
+		[[nodiscard]]
+		bool building() const noexcept {
+			return _interest == nullptr || !_interest->empty();
+		}
+
+		/*! \brief Returns true if `node` is a real node and not a skipped field */
+		[[nodiscard]]
+		bool kept(const proto_node_t& node) const noexcept {
+			return &node != &_sink;
+		}
+
+		/*! \brief Returns the packet the tree is for */
+		[[nodiscard]]
+		std::span<const std::byte> packet() const noexcept {
+			return _packet;
+		}
+
+		/*! \brief Append a node for `field` as the last child of `parent`.
+
+			This is for fields with no value or whose value is the bytes they cover.
+
+			\param parent The node to add the new node under.
+			\param field The field of the new node.
+			\param offset The offset into the packet of the bytes the field covers.
+			\param length The number of bytes the field covers.
+			\param value The inline value of the node.
+			\returns The new node, which can have children added to it, or the sink if `field` is not wanted.
+			\throws std::bad_alloc If the arena could not allocate a new block.
+		*/
+		proto_node_t& add(
+			proto_node_t& parent, const field_id_t field, const std::uint32_t offset, const std::uint32_t length,
+			const std::uint64_t value = 0U
+		) {
+			if (!wants(field)) {
+				return _sink;
+			}
+			auto& owner{kept(parent) ? parent : *_root};
+
+			auto* const node{new(_arena.allocate(sizeof(proto_node_t), alignof(proto_node_t))) proto_node_t{
+				nullptr, nullptr, nullptr, value, offset, length, field
+			}};
+			if (owner.last_child == nullptr) {
+				owner.first_child = node;
+			} else {
+				owner.last_child->next_sibling = node;
+			}
+			owner.last_child = node;
+			++_size;
+			return *node;
+		}
+
+		proto_node_t& add_unsigned(
+			proto_node_t& parent, const field_id_t field, const std::uint32_t offset, const std::uint32_t length,
+			const std::uint64_t value
+		) {
+			return add(parent, field, offset, length, value);
+		}
+
+		proto_node_t& add_signed(
+			proto_node_t& parent, const field_id_t field, const std::uint32_t offset, const std::uint32_t length,
+			const std::int64_t value
+		) {
+			return add(parent, field, offset, length, std::bit_cast<std::uint64_t>(value));
+		}
+
+		proto_node_t& add_float(
+			proto_node_t& parent, const field_id_t field, const std::uint32_t offset, const std::uint32_t length,
+			const double value
+		) {
+			return add(parent, field, offset, length, std::bit_cast<std::uint64_t>(value));
+		}
+
+		proto_node_t& add_bool(
+			proto_node_t& parent, const field_id_t field, const std::uint32_t offset, const std::uint32_t length,
+			const bool value
+		) {
+			return add(parent, field, offset, length, value ? 1U : 0U);
+		}
+
+		/*! \brief Returns the bytes of the packet `node` covers, which are empty if it is out of range */
+		[[nodiscard]]
+		std::span<const std::byte> bytes(const proto_node_t& node) const noexcept {
+			if (node.offset > _packet.size() || (_packet.size() - node.offset) < node.length) {
+				return {};
+			}
+			return _packet.subspan(node.offset, node.length);
+		}
+
+		/*! \brief Call `func` with each node of the tree in depth first order, not including the root.
+
+			\param func Called as `func(node, depth)`, where the children of the root have a depth of 0.
+		*/
+		template<typename F>
+		void visit(F&& func) const {
+			visit(*_root, 0zu, func);
+		}
+
+		/*! \brief Returns the first node for `field` in depth first order, or null if there is none */
+		[[nodiscard]]
+		PANKO_CLS_API const proto_node_t* find(field_id_t field) const noexcept;
+	private:
+		template<typename F>
+		static void visit(const proto_node_t& parent, const std::size_t depth, F& func) {
+			for (const auto& child : parent.children()) {
+				func(child, depth);
+				visit(child, depth + 1zu, func);
+			}
+		}
+	};
+}
+
+#endif /* PANKO_DISSECTORS_PROTO_TREE_HH */
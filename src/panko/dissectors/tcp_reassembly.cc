@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* tcp_reassembly.cc - Zero-copy TCP stream reassembly */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "panko/dissectors/tcp_reassembly.hh"
+
+namespace Panko::dissectors {
+	void tcp_stream_t::deliver(bytearray_t& segment, const std::size_t idx, const std::size_t len) {
+		if (!_open) {
+			_ready.push_back({bytearray_chain_t{}, _next, std::exchange(_missing, 0U)});
+			_open = true;
+		}
+
+		auto& chain{_ready.back().data};
+		if (idx == 0zu && len == segment.length()) {
+			chain.append(segment);
+		} else {
+			auto piece{segment.slice(idx, idx + len - 1zu)};
+			chain.append(piece);
+		}
+		_next += len;
+		_stats.delivered += len;
+	}
+
+	void tcp_stream_t::buffer(
+		bytearray_t& segment, const std::size_t idx, const std::size_t len, const std::uint64_t offset,
+		const bool in_order
+	) {
+		/* Data that is in order is drained straight away, so it never counts against the limit */
+		if (!in_order && !_config.lossy && (_buffered + len) > _config.max_buffered) {
+			_stats.dropped += len;
+			return;
+		}
+
+		_pending.emplace(offset, std::unique_ptr<bytearray_t>{new bytearray_t(segment.slice(idx, idx + len - 1zu))});
+		_buffered += len;
+	}
+
+	void tcp_stream_t::drain() {
+		while (!_pending.empty()) {
+			const auto entry{_pending.begin()};
+			if (entry->first > _next) {
+				return;
+			}
+
+			auto& segment{*entry->second};
+			const auto len{segment.length()};
+			const auto skipped{static_cast<std::size_t>(_next - entry->first)};
+			_buffered -= len;
+			if (skipped < len) {
+				deliver(segment, skipped, len - skipped);
+			}
+			_pending.erase(entry);
+		}
+	}
+
+	void tcp_stream_t::skip(const std::uint64_t offset) {
+		const auto target{_pending.empty() ? offset : _pending.begin()->first};
+		if (target > _next) {
+			const auto gap{target - _next};
+			_stats.missing += gap;
+			_missing += gap;
+			_next = target;
+			_open = false;
+		}
+		drain();
+	}
+
+	void tcp_stream_t::syn(const std::uint32_t seq) noexcept {
+		if (_synced) {
+			return;
+		}
+		/* The SYN takes up a sequence number of its own */
+		_synced = true;
+		_base = seq + 1U;
+	}
+
+	void tcp_stream_t::push(const std::uint32_t seq, bytearray_t& payload, const bool fin) {
+		if (!_synced) {
+			_synced = true;
+			_base = seq;
+		}
+
+		const auto len{payload.length()};
+		const auto start{offset_of(seq)};
+		const auto end{start + static_cast<std::int64_t>(len)};
+		if (fin && !_fin && end >= 0) {
+			_fin = static_cast<std::uint64_t>(end);
+		}
+		if (len == 0zu) {
+			return;
+		}
+
+		/* Trim off anything that was already delivered */
+		const auto next{static_cast<std::int64_t>(_next)};
+		if (end <= next) {
+			_stats.duplicate += len;
+			return;
+		}
+		auto idx{static_cast<std::size_t>(std::max<std::int64_t>(next - start, 0))};
+		_stats.duplicate += idx;
+		auto offset{static_cast<std::uint64_t>(start) + idx};
+		const auto last{static_cast<std::uint64_t>(end)};
+
+		if (offset == _next && _pending.empty()) {
+			deliver(payload, idx, len - idx);
+			return;
+		}
+		const auto in_order{offset == _next};
+		if (!in_order) {
+			++_stats.out_of_order;
+		}
+
+		/*
+			Fill in only the parts of the segment that are not already buffered, walking the buffered segments
+			it overlaps, starting with the one that may run into it from before.
+		*/
+		auto entry{_pending.upper_bound(offset)};
+		if (entry != _pending.begin()) {
+			const auto prev{std::prev(entry)};
+			const auto prev_end{prev->first + prev->second->length()};
+			if (prev_end > offset) {
+				const auto covered{std::min(prev_end, last) - offset};
+				_stats.duplicate += covered;
+				idx += covered;
+				offset += covered;
+			}
+		}
+		while (offset < last) {
+			const auto gap_end{entry == _pending.end() ? last : std::min(entry->first, last)};
+			if (gap_end > offset) {
+				buffer(payload, idx, static_cast<std::size_t>(gap_end - offset), offset, in_order);
+				idx += gap_end - offset;
+				offset = gap_end;
+			}
+			if (entry == _pending.end() || offset >= last) {
+				break;
+			}
+
+			const auto entry_end{std::min(entry->first + entry->second->length(), last)};
+			_stats.duplicate += entry_end - offset;
+			idx += entry_end - offset;
+			offset = entry_end;
+			++entry;
+		}
+
+		drain();
+		/* Deliver what you have rather than going over the limit */
+		while (_config.lossy && _buffered > _config.max_buffered) {
+			skip(_next);
+		}
+	}
+
+	std::optional<tcp_data_t> tcp_stream_t::take() {
+		if (_ready.empty()) {
+			return std::nullopt;
+		}
+		/* Anything delivered after this is a new run */
+		if (_ready.size() == 1zu) {
+			_open = false;
+		}
+		auto data{std::move(_ready.front())};
+		_ready.pop_front();
+		return data;
+	}
+
+	void tcp_stream_t::flush() {
+		while (!_pending.empty()) {
+			skip(_next);
+		}
+	}
+}
@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* tcp_reassembly.hh - Zero-copy TCP stream reassembly */
+
+#pragma once
+#if !defined(PANKO_DISSECTORS_TCP_REASSEMBLY_HH)
+#define PANKO_DISSECTORS_TCP_REASSEMBLY_HH
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <optional>
+
+#include "panko/internal/defs.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/bytearray_chain.hh"
+#include "panko/dissectors/flow_table.hh"
+
+namespace Panko::dissectors {
+	using Panko::core::bytearray_t;
+	using Panko::core::bytearray_chain_t;
+
+	/*! \brief The limits and behaviour of a `tcp_stream_t` */
+	struct tcp_reassembly_config_t final {
+		/*! \brief The most out of order data, in bytes, held for a stream waiting on a hole to be filled */
+		std::size_t max_buffered{1024zu * 1024zu};
+		/*! \brief Deliver what you have, skipping holes rather than holding data back when the buffer fills.
+
+			This is for lossy captures where the missing segments were never captured and never will be.
+			Without it, segments that do not fit are dropped, waiting for the hole to be filled.
+		*/
+		bool lossy{false};
+	};
+
+	/*! \brief A run of contiguous stream data ready for the next dissector */
+	struct tcp_data_t final {
+		/*! \brief The data, a chain of slices of the segments it was reassembled from */
+		bytearray_chain_t data;
+		/*! \brief The offset into the stream of the first byte, counting from the first byte after the SYN */
+		std::uint64_t offset;
+		/*! \brief The number of bytes skipped just before this data, which were never seen */
+		std::uint64_t missing;
+	};
+
+	/*! \brief Counters of what happened to the segments of a stream */
+	struct tcp_stream_stats_t final {
+		/*! \brief Bytes handed on in order */
+		std::uint64_t delivered;
+		/*! \brief Bytes that had already been delivered or were already buffered, and were dropped */
+		std::uint64_t duplicate;
+		/*! \brief Bytes dropped as there was no room to buffer them */
+		std::uint64_t dropped;
+		/*! \brief Bytes skipped over as missing, when delivering what there is */
+		std::uint64_t missing;
+		/*! \brief Segments that arrived ahead of a hole */
+		std::uint64_t out_of_order;
+	};
+
+	/*! \brief Reassembles one direction of a TCP connection into contiguous data, without copying it.
+
+		Segments are held as slices of the `bytearray_t`s they came in, and handed on as `bytearray_chain_t`s of
+		those slices, so no payload byte is ever copied. Owning buffers are kept alive by the slices, non-owning
+		ones must outlive both the stream and the data taken from it.
+
+		Sequence numbers are unwrapped into 64-bit offsets into the stream, relative to where the stream was
+		picked up, so wraparound is handled without any special cases, and sequence numbers more than 2GiB
+		before the next expected byte are taken to be from the past.
+
+		Segments that arrive out of order are held in an ordered map of non-overlapping intervals keyed by their
+		stream offset. Where a segment overlaps data already delivered or already buffered, the first copy to
+		arrive wins and only the new parts of the segment are kept, so retransmissions cost nothing more than
+		the lookup.
+
+		\code{.cc}
+		stream.push(seq, payload, flags.fin);
+		while (auto data{stream.take()}) {
+			next_dissector(data->data, data->offset);
+		}
+		\endcode
+	*/
+	struct tcp_stream_t final {
+	private:
+		tcp_reassembly_config_t _config;
+		bool _synced{false};
+		/* The sequence number of offset 0 into the stream */
+		std::uint32_t _base{};
+		/* The offset into the stream of the next byte to be delivered */
+		std::uint64_t _next{};
+		std::optional<std::uint64_t> _fin{};
+		/* The out of order segments by offset into the stream, they never overlap */
+		std::map<std::uint64_t, std::unique_ptr<bytearray_t>> _pending{};
+		std::size_t _buffered{};
+		std::deque<tcp_data_t> _ready{};
+		/* Whether data can still be appended to the last of `_ready`, rather than there being a gap */
+		bool _open{false};
+		std::uint64_t _missing{};
+		tcp_stream_stats_t _stats{};
+
+		/* Unwrap `seq` into an offset into the stream, it may be before the start of the stream */
+		[[nodiscard]]
+		std::int64_t offset_of(const std::uint32_t seq) const noexcept {
+			const auto expected{static_cast<std::uint32_t>(_base + static_cast<std::uint32_t>(_next))};
+			return static_cast<std::int64_t>(_next) + static_cast<std::int32_t>(seq - expected);
+		}
+
+		/* Hand on `len` bytes of `segment` from `idx`, which start at `_next` */
+		PANKO_CLS_API void deliver(bytearray_t& segment, std::size_t idx, std::size_t len);
+		/*
+			Buffer the `len` bytes of `segment` from `idx`, which start at `offset`, where there is nothing yet.
+			`in_order` is set if the segment they are from starts at `_next`, so they will be drained right away.
+		*/
+		PANKO_CLS_API void buffer(
+			bytearray_t& segment, std::size_t idx, std::size_t len, std::uint64_t offset, bool in_order
+		);
+		/* Deliver everything that is now contiguous from the out of order segments */
+		PANKO_CLS_API void drain();
+		/* Skip ahead over the hole to the first out of order segment, or to `offset` if there are none */
+		PANKO_CLS_API void skip(std::uint64_t offset);
+	public:
+		explicit tcp_stream_t(const tcp_reassembly_config_t& config = {}) noexcept :
+			_config{config}
+		{ }
+
+		tcp_stream_t(const tcp_stream_t&) = delete;
+		tcp_stream_t& operator=(const tcp_stream_t&) = delete;
+		tcp_stream_t(tcp_stream_t&&) noexcept = default;
+		tcp_stream_t& operator=(tcp_stream_t&&) noexcept = default;
+
+		/*! \brief Start the stream from a SYN with the sequence number `seq`, a SYN seen again is ignored */
+		PANKO_CLS_API void syn(std::uint32_t seq) noexcept;
+
+		/*! \brief Add a segment to the stream.
+
+			If no SYN was seen, the stream is picked up from the first segment pushed.
+
+			\param seq The sequence number of the segment.
+			\param payload The payload of the segment, which is sliced rather than copied.
+			\param fin Whether the segment has the FIN flag set, which ends the stream after its payload.
+		*/
+		PANKO_CLS_API void push(std::uint32_t seq, bytearray_t& payload, bool fin = false);
+
+		/*! \brief Take the next run of contiguous data, if there is any */
+		[[nodiscard]]
+		PANKO_CLS_API std::optional<tcp_data_t> take();
+
+		/*! \brief Deliver what you have, skipping every hole, such as when the flow ends or is evicted */
+		PANKO_CLS_API void flush();
+
+		/*! \brief Returns the offset into the stream of the next byte to be delivered */
+		[[nodiscard]]
+		std::uint64_t next() const noexcept {
+			return _next;
+		}
+
+		/*! \brief Returns the bytes of out of order data being held, waiting on a hole to be filled */
+		[[nodiscard]]
+		std::size_t buffered() const noexcept {
+			return _buffered;
+		}
+
+		/*! \brief Returns the number of out of order segments being held */
+		[[nodiscard]]
+		std::size_t segments() const noexcept {
+			return _pending.size();
+		}
+
+		/*! \brief Returns true if everything up to the FIN has been delivered */
+		[[nodiscard]]
+		bool finished() const noexcept {
+			return _fin.has_value() && _next >= *_fin;
+		}
+
+		[[nodiscard]]
+		const tcp_stream_stats_t& stats() const noexcept {
+			return _stats;
+		}
+	};
+
+	/*! \brief Both directions of a TCP connection, indexed by the `flow_direction_t` of their segments */
+	struct tcp_streams_t final {
+		std::array<tcp_stream_t, 2> streams;
+
+		explicit tcp_streams_t(const tcp_reassembly_config_t& config = {}) noexcept :
+			streams{{tcp_stream_t{config}, tcp_stream_t{config}}}
+		{ }
+
+		[[nodiscard]]
+		tcp_stream_t& operator[](const flow_direction_t direction) noexcept {
+			return streams[static_cast<std::size_t>(direction)];
+		}
+
+		/*! \brief Returns the out of order data held by both directions, for charging to a `flow_tracker_t` */
+		[[nodiscard]]
+		std::size_t buffered() const noexcept {
+			return streams[0].buffered() + streams[1].buffered();
+		}
+	};
+}
+
+#endif /* PANKO_DISSECTORS_TCP_REASSEMBLY_HH */
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* cpu.hh - Target architecture and runtime CPU feature detection */
+#pragma once
+#if !defined(PANKO_INTERNAL_CPU_HH)
+#define PANKO_INTERNAL_CPU_HH
+
+#if defined(__linux__) && defined(__aarch64__)
+#	include <sys/auxv.h>
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+
+#if defined(__x86_64__) || defined(_M_X64)
+#	define PANKO_ARCH_X86_64 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#	define PANKO_ARCH_AARCH64 1
+#endif
+
+/* Allows a single function to be compiled for an ISA extension the rest of the build does not assume */
+#if (defined(__GNUC__) || defined(__clang__)) && defined(PANKO_ARCH_X86_64)
+#	define PANKO_TARGET(ISA) __attribute__((target(ISA)))
+#	define PANKO_HAS_TARGET_DISPATCH 1
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(PANKO_ARCH_AARCH64)
+/* AArch64 features are detected from the hwcaps rather than `__builtin_cpu_supports` */
+#	define PANKO_TARGET(ISA) __attribute__((target(ISA)))
+#else
+#	define PANKO_TARGET(ISA)
+#endif
+
+/* Pick the best of the baseline vectorized kernels, which are AVX2 or SSE2 on x86-64 and NEON on AArch64 */
+#if defined(PANKO_ARCH_X86_64)
+#	define PANKO_SELECT_KERNEL(NAME) (Panko::internal::cpu::features().avx2 ? NAME ## _avx2 : NAME ## _sse2)
+#elif defined(PANKO_ARCH_AARCH64)
+#	define PANKO_SELECT_KERNEL(NAME) (NAME ## _neon)
+#else
+#	define PANKO_SELECT_KERNEL(NAME) (NAME ## _scalar)
+#endif
+
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+namespace Panko::internal::cpu {
+	/*! \brief ISA extensions available on the CPU we are running on */
+	struct features_t final {
+		bool sse42{false};
+		bool avx2{false};
+		bool pclmul{false};
+		bool bmi2{false};
+		bool neon{false};
+		bool arm_crc32{false};
+		bool arm_pmull{false};
+	};
+
+	namespace _impl {
+		[[nodiscard]]
+		inline features_t detect() noexcept {
+			features_t feat{};
+#if defined(PANKO_HAS_TARGET_DISPATCH)
+			__builtin_cpu_init();
+			feat.sse42  = __builtin_cpu_supports("sse4.2");
+			feat.avx2   = __builtin_cpu_supports("avx2");
+			feat.pclmul = __builtin_cpu_supports("pclmul");
+			feat.bmi2   = __builtin_cpu_supports("bmi2");
+#elif defined(PANKO_ARCH_AARCH64)
+			/* NEON/ASIMD is mandatory on AArch64 */
+			feat.neon = true;
+#	if defined(__linux__)
+			const auto hwcap{getauxval(AT_HWCAP)};
+			feat.arm_crc32 = (hwcap & HWCAP_CRC32) != 0U;
+			feat.arm_pmull = (hwcap & HWCAP_PMULL) != 0U;
+#	elif defined(__APPLE__)
+			feat.arm_crc32 = true;
+			feat.arm_pmull = true;
+#	endif
+#endif
+			return feat;
+		}
+	}
+
+	/*! \brief Returns the ISA extensions of the running CPU, detected once on first use */
+	[[nodiscard]]
+	inline const features_t& features() noexcept {
+		static const features_t feat{_impl::detect()};
+		return feat;
+	}
+}
+
+#endif /* PANKO_INTERNAL_CPU_HH */
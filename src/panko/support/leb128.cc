@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* leb128.cc - Bulk LEB128 decoding */
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "panko/internal/defs.hh"
+#include "panko/internal/cpu.hh"
+#include "panko/core/endian.hh"
+#include "panko/support/leb128.hh"
+
+#if defined(PANKO_ARCH_X86_64)
+#	include <immintrin.h>
+#elif defined(PANKO_ARCH_AARCH64)
+#	include <arm_neon.h>
+#endif
+
+using Panko::core::load;
+
+namespace Panko::support {
+	namespace {
+		/* The bytes of a window, each of the values that end in it is gathered with an 8 byte load from its start */
+		constexpr std::size_t window_size{16zu};
+		constexpr std::size_t window_slack{window_size + sizeof(std::uint64_t)};
+
+		/* Pack the low 7 bits of each of the first `len` bytes of a little endian word together, up to 8 bytes */
+		[[nodiscard]]
+		constexpr std::uint64_t compact(std::uint64_t word, const std::size_t len) noexcept {
+			if (len < 8zu) {
+				word &= (1ULL << (len * 8zu)) - 1U;
+			}
+			word &= 0x7F7F'7F7F'7F7F'7F7FULL;
+			word = ((word & 0x7F00'7F00'7F00'7F00ULL) >> 1U) | (word & 0x007F'007F'007F'007FULL);
+			word = ((word & 0x3FFF'0000'3FFF'0000ULL) >> 2U) | (word & 0x0000'3FFF'0000'3FFFULL);
+			word = ((word & 0x0FFF'FFFF'0000'0000ULL) >> 4U) | (word & 0x0000'0000'0FFF'FFFFULL);
+			return word;
+		}
+
+#if defined(PANKO_ARCH_X86_64)
+		/* SSE2 is part of the x86-64 baseline, so this needs no runtime dispatch */
+		struct simd_t final {
+			[[nodiscard]]
+			static std::uint32_t continuations(const std::byte* const src) noexcept {
+				const auto bytes{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(src))};
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+			}
+
+			template<typename L>
+			static void widen(const std::byte* const src, L* const dst) noexcept {
+				const auto zero{_mm_setzero_si128()};
+				const auto bytes{_mm_loadu_si128(reinterpret_cast<const __m128i_u*>(src))};
+				const auto lo{_mm_unpacklo_epi8(bytes, zero)};
+				const auto hi{_mm_unpackhi_epi8(bytes, zero)};
+				auto* const out{reinterpret_cast<__m128i_u*>(dst)};
+				store<L>(out, _mm_unpacklo_epi16(lo, zero), 0zu);
+				store<L>(out, _mm_unpackhi_epi16(lo, zero), 1zu);
+				store<L>(out, _mm_unpacklo_epi16(hi, zero), 2zu);
+				store<L>(out, _mm_unpackhi_epi16(hi, zero), 3zu);
+			}
+		private:
+			/* Store the `idx`th group of four widened values */
+			template<typename L>
+			static void store(__m128i_u* const out, const __m128i words, const std::size_t idx) noexcept {
+				if constexpr (sizeof(L) == 4zu) {
+					_mm_storeu_si128(out + idx, words);
+				} else {
+					const auto zero{_mm_setzero_si128()};
+					_mm_storeu_si128(out + (idx * 2zu), _mm_unpacklo_epi32(words, zero));
+					_mm_storeu_si128(out + (idx * 2zu) + 1zu, _mm_unpackhi_epi32(words, zero));
+				}
+			}
+		};
+#	define PANKO_LEB128_WINDOWS 1
+#elif defined(PANKO_ARCH_AARCH64)
+		/* NEON is mandatory on AArch64, so this needs no runtime dispatch */
+		struct simd_t final {
+			[[nodiscard]]
+			static std::uint32_t continuations(const std::byte* const src) noexcept {
+				static constexpr std::array<std::uint8_t, 8> weights{{1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U}};
+				const auto top{vshrq_n_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(src)), 7)};
+				const auto weight{vld1_u8(weights.data())};
+				const auto lo{vaddv_u8(vmul_u8(vget_low_u8(top), weight))};
+				const auto hi{vaddv_u8(vmul_u8(vget_high_u8(top), weight))};
+				return std::uint32_t{lo} | (std::uint32_t{hi} << 8U);
+			}
+
+			template<typename L>
+			static void widen(const std::byte* const src, L* const dst) noexcept {
+				const auto bytes{vld1q_u8(reinterpret_cast<const std::uint8_t*>(src))};
+				const std::array<uint16x8_t, 2> halves{{vmovl_u8(vget_low_u8(bytes)), vmovl_u8(vget_high_u8(bytes))}};
+
+				for (std::size_t idx{}; idx < halves.size(); ++idx) {
+					const std::array<uint32x4_t, 2> words{{
+						vmovl_u16(vget_low_u16(halves[idx])), vmovl_u16(vget_high_u16(halves[idx]))
+					}};
+					for (std::size_t word{}; word < words.size(); ++word) {
+						auto* const out{dst + (idx * 8zu) + (word * 4zu)};
+						if constexpr (sizeof(L) == 4zu) {
+							vst1q_u32(out, words[word]);
+						} else {
+							vst1q_u64(out, vmovl_u32(vget_low_u32(words[word])));
+							vst1q_u64(out + 2zu, vmovl_u32(vget_high_u32(words[word])));
+						}
+					}
+				}
+			}
+		};
+#	define PANKO_LEB128_WINDOWS 1
+#endif
+
+#if defined(PANKO_LEB128_WINDOWS)
+		/*
+			Decode as many values as possible a window at a time, stopping at anything that is not a valid `L`.
+
+			The clear continuation bits of the window mark where each value ends, so the values that end in it
+			can be found with a count of trailing zeros each, and a window with no continuation bits set at all
+			is 16 single byte values that can be widened straight into `dst`.
+		*/
+		template<typename L>
+		[[nodiscard]]
+		varint_run_t decode_windows(
+			const std::byte* const src, const std::size_t len, L* const dst, const std::size_t count
+		) noexcept {
+			constexpr auto max_size{leb128_max_size_v<L>};
+			constexpr auto last_bits{(sizeof(L) * 8zu) - ((max_size - 1zu) * 7zu)};
+			varint_run_t run{};
+
+			while ((len - run.length) >= window_slack && run.count < count) {
+				const auto* const window{src + run.length};
+				const auto more{simd_t::continuations(window)};
+				if (more == 0U && (count - run.count) >= window_size) {
+					simd_t::widen(window, dst + run.count);
+					run.count += window_size;
+					run.length += window_size;
+					continue;
+				}
+
+				auto ends{~more & 0xFFFFU};
+				/* The window is all continuations, so whatever starts here is too long */
+				if (ends == 0U) [[unlikely]] {
+					return run;
+				}
+
+				std::size_t start{};
+				for (; ends != 0U && run.count < count; ends &= ends - 1U) {
+					const auto end{static_cast<std::size_t>(std::countr_zero(ends))};
+					const auto size{end - start + 1zu};
+					if (size > max_size) [[unlikely]] {
+						return run;
+					}
+					const auto last{std::to_integer<std::uint8_t>(window[end])};
+					if (size == max_size && (last >> last_bits) != 0U) [[unlikely]] {
+						return run;
+					}
+
+					auto value{compact(load<std::uint64_t, std::endian::little>(window + start), size)};
+					if constexpr (max_size > 8zu) {
+						/* The 9th and 10th bytes of a 64-bit value hold bits 56 through 63 */
+						if (size > 8zu) {
+							value |= std::to_integer<std::uint64_t>(window[start + 8zu] & std::byte{0x7FU}) << 56U;
+						}
+						if (size > 9zu) {
+							value |= std::uint64_t{last} << 63U;
+						}
+					}
+
+					dst[run.count++] = static_cast<L>(value);
+					run.length += size;
+					start = end + 1zu;
+				}
+			}
+			return run;
+		}
+#endif
+
+		template<typename L>
+		[[nodiscard]]
+		varint_run_t decode_run(const std::span<const std::byte> src, const std::span<L> dst) noexcept {
+			varint_run_t run{};
+#if defined(PANKO_LEB128_WINDOWS)
+			run = decode_windows(src.data(), src.size(), dst.data(), dst.size());
+#endif
+			/* Finish off whatever is too close to the end of `src` for a whole window */
+			while (run.count < dst.size()) {
+				const auto value{leb128_decode<L>(src.subspan(run.length))};
+				if (!value) {
+					break;
+				}
+				dst[run.count++] = value->value;
+				run.length += value->length;
+			}
+			return run;
+		}
+	}
+
+	varint_run_t leb128_decode_run(const std::span<const std::byte> src, const std::span<std::uint32_t> dst) noexcept {
+		return decode_run(src, dst);
+	}
+
+	varint_run_t leb128_decode_run(const std::span<const std::byte> src, const std::span<std::uint64_t> dst) noexcept {
+		return decode_run(src, dst);
+	}
+}
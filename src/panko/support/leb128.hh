@@ -1,17 +1,297 @@
 // SPDX-License-Identifier: BSD-3-Clause
-/* leb128.hh - LEB128 Encode/decode */
+/* leb128.hh - LEB128 and QUIC varint Encode/decode */
 
 #pragma once
 #if !defined(PANKO_SUPPORT_LEB128_HH)
 #define PANKO_SUPPORT_LEB128_HH
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <expected>
+#include <span>
 #include <vector>
 #include <type_traits>
 
+#include "panko/internal/defs.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/errcodes.hh"
 #include "panko/core/types.hh"
 
 namespace Panko::support {
+	using Panko::core::error_codes::read_error_t;
+
+	/*! \brief A decoded variable length integer and the number of bytes it was encoded in */
+	template<typename T>
+	struct varint_t final {
+		T value;
+		std::size_t length;
+	};
+
+	/*! \brief The result of decoding a run of variable length integers */
+	struct varint_run_t final {
+		/*! \brief The number of values decoded */
+		std::size_t count;
+		/*! \brief The number of bytes those values were encoded in */
+		std::size_t length;
+	};
+
+	/*! \brief The most bytes a LEB128 encoded `T` can take */
+	template<typename T>
+	constexpr inline std::size_t leb128_max_size_v{((sizeof(T) * 8zu) + 6zu) / 7zu};
+
+	namespace _impl {
+		/* Encode into `dst` if it is not null, returning the encoded length or 0 if it is longer than `len` */
+		template<typename T>
+		[[nodiscard]]
+		constexpr std::size_t leb128_write(const T value, std::byte* const dst, const std::size_t len) noexcept {
+			using U = std::make_unsigned_t<T>;
+			using V = Panko::core::types::promoted_type_t<U>;
+			using W = std::conditional_t<std::is_signed_v<T>, std::make_signed_t<V>, V>;
+
+			auto num{static_cast<W>(value)};
+			for (std::size_t idx{}; idx < len; ++idx) {
+				auto byte{static_cast<std::uint8_t>(static_cast<V>(num) & 0x7FU)};
+				/* An arithmetic shift for signed values, so they end once only sign bits are left */
+				num >>= 7U;
+
+				bool has_more{};
+				if constexpr (std::is_signed_v<T>) {
+					has_more = !((num == 0 && (byte & 0x40U) == 0U) || (num == -1 && (byte & 0x40U) != 0U));
+				} else {
+					has_more = num != 0U;
+				}
+
+				if (has_more) {
+					byte |= 0x80U;
+				}
+				if (dst != nullptr) {
+					dst[idx] = std::byte{byte};
+				}
+				if (!has_more) {
+					return idx + 1zu;
+				}
+			}
+			return 0zu;
+		}
+	}
+
+	/*! \brief Returns the number of bytes `value` takes LEB128 encoded */
+	template<typename T>
+	[[nodiscard]]
+	constexpr std::enable_if_t<std::is_integral_v<T>, std::size_t> leb128_size(const T value) noexcept {
+		return _impl::leb128_write(value, nullptr, leb128_max_size_v<T>);
+	}
+
+	/*! \brief LEB128 encode `value` into a caller provided buffer.
+
+		Signed types are encoded as SLEB128, and unsigned types as ULEB128.
+
+		\param value The value to encode.
+		\param dst The buffer to encode into, `leb128_max_size_v<T>` bytes is always enough.
+		\returns The number of bytes written, or 0 if `dst` is too small, in which case its contents are unspecified.
+	*/
+	template<typename T>
+	[[nodiscard]]
+	constexpr std::enable_if_t<std::is_integral_v<T>, std::size_t>
+	leb128_encode(const T value, const std::span<std::byte> dst) noexcept {
+		return _impl::leb128_write(value, dst.data(), dst.size());
+	}
+
+	/*! \brief Decode a LEB128 encoded `T` from the start of `bytes`.
+
+		Signed types are decoded as SLEB128, and unsigned types as ULEB128.
+
+		Like WebAssembly, encodings may be padded out with redundant bytes up to `leb128_max_size_v<T>` bytes,
+		but no further, and the unused bits of a maximal length encoding must be zero, or the sign bits for
+		signed types.
+
+		\param bytes The bytes to decode from, which may extend past the end of the value.
+		\returns The value and the number of bytes it took, `read_error_t::Truncated` if `bytes` ends before the
+		value does, or `read_error_t::Malformed` if the encoding is too long or does not fit in `T`.
+	*/
+	template<typename T>
+	[[nodiscard]]
+	constexpr std::enable_if_t<std::is_integral_v<T>, std::expected<varint_t<T>, read_error_t>>
+	leb128_decode(const std::span<const std::byte> bytes) noexcept {
+		using U = std::make_unsigned_t<T>;
+		using V = Panko::core::types::promoted_type_t<U>;
+
+		constexpr auto bits{sizeof(T) * 8zu};
+		constexpr auto max_size{leb128_max_size_v<T>};
+		/* The number of bits of `T` that are left for the last byte of a maximal length encoding */
+		constexpr auto last_bits{bits - ((max_size - 1zu) * 7zu)};
+
+		V enc{};
+		const auto limit{std::min(bytes.size(), max_size)};
+		for (std::size_t idx{}; idx < limit; ++idx) {
+			const auto byte{std::to_integer<std::uint8_t>(bytes[idx])};
+			const auto payload{static_cast<std::uint8_t>(byte & 0x7FU)};
+
+			if (idx == (max_size - 1zu)) {
+				if ((byte & 0x80U) != 0U) [[unlikely]] {
+					return std::unexpected(read_error_t::Malformed);
+				}
+				if constexpr (std::is_signed_v<T>) {
+					const auto rest{payload >> (last_bits - 1zu)};
+					if (rest != 0U && rest != (0x7FU >> (last_bits - 1zu))) [[unlikely]] {
+						return std::unexpected(read_error_t::Malformed);
+					}
+				} else {
+					if ((payload >> last_bits) != 0U) [[unlikely]] {
+						return std::unexpected(read_error_t::Malformed);
+					}
+				}
+			}
+
+			const auto shift{idx * 7zu};
+			enc |= V{payload} << shift;
+			if ((byte & 0x80U) == 0U) {
+				if constexpr (std::is_signed_v<T>) {
+					if ((shift + 7zu) < bits && (payload & 0x40U) != 0U) {
+						enc |= ~V{} << (shift + 7zu);
+					}
+				}
+				return varint_t<T>{static_cast<T>(enc), idx + 1zu};
+			}
+		}
+		/* A maximal length encoding that is still going is caught above, so we must have run out of bytes */
+		return std::unexpected(read_error_t::Truncated);
+	}
+
+	/*! \brief Decode a LEB128 encoded `T` from offset `idx` into `buffer`
+
+		\see leb128_decode
+	*/
+	template<typename T>
+	[[nodiscard]]
+	std::enable_if_t<std::is_integral_v<T>, std::expected<varint_t<T>, read_error_t>>
+	leb128_decode(const Panko::core::bytearray_t& buffer, const std::size_t idx = 0zu) noexcept {
+		if (idx > buffer.length()) [[unlikely]] {
+			return std::unexpected(read_error_t::Truncated);
+		}
+		return leb128_decode<T>(std::span<const std::byte>{buffer.data() + idx, buffer.length() - idx});
+	}
+
+	/*! \brief Decode a run of back to back ULEB128 values, such as a protobuf packed repeated field.
+
+		The continuation bits of 16 bytes at a time are gathered into a mask with a single vector compare,
+		which gives where every value in those 16 bytes ends, and a run of 16 single byte values is just
+		widened into `dst`.
+
+		Decoding stops at the end of `src`, once `dst` is full, or at the first value that is truncated or
+		malformed, which can then be decoded with `leb128_decode` to find out why.
+
+		\param src The encoded values.
+		\param dst Where to decode the values to.
+		\returns The number of values decoded and the number of bytes they took.
+	*/
+	PANKO_API varint_run_t leb128_decode_run(std::span<const std::byte> src, std::span<std::uint32_t> dst) noexcept;
+	PANKO_API varint_run_t leb128_decode_run(std::span<const std::byte> src, std::span<std::uint64_t> dst) noexcept;
+
+	/*! \brief ZigZag encode a signed value, as protobuf does for `sint32` and `sint64` */
+	template<typename T>
+	[[nodiscard]]
+	constexpr std::enable_if_t<std::is_integral_v<T> && std::is_signed_v<T>, std::make_unsigned_t<T>>
+	zigzag_encode(const T value) noexcept {
+		using U = std::make_unsigned_t<T>;
+		/* 0, -1, 1, -2, 2, ... become 0, 1, 2, 3, 4, ... */
+		const auto sign{static_cast<U>(value < 0 ? ~U{} : U{})};
+		return static_cast<U>(static_cast<U>(static_cast<U>(value) << 1U) ^ sign);
+	}
+
+	/*! \brief ZigZag decode a value back into a signed value */
+	template<typename T>
+	[[nodiscard]]
+	constexpr std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T>, std::make_signed_t<T>>
+	zigzag_decode(const T value) noexcept {
+		const auto sign{static_cast<T>((value & 1U) != 0U ? ~T{} : T{})};
+		return static_cast<std::make_signed_t<T>>(static_cast<T>(value >> 1U) ^ sign);
+	}
+
+	/* == QUIC Variable-Length Integers (RFC 9000 16) == */
+
+	/*! \brief The largest value that can be encoded as a QUIC varint */
+	constexpr inline std::uint64_t quic_varint_max{(1ULL << 62U) - 1U};
+
+	/*! \brief Returns the number of bytes the shortest QUIC varint encoding of `value` takes, or 0 if it is too large */
+	[[nodiscard]]
+	constexpr std::size_t quic_varint_size(const std::uint64_t value) noexcept {
+		if (value <= 0x3FU) {
+			return 1zu;
+		} else if (value <= 0x3FFFU) {
+			return 2zu;
+		} else if (value <= 0x3FFF'FFFFU) {
+			return 4zu;
+		} else if (value <= quic_varint_max) {
+			return 8zu;
+		}
+		return 0zu;
+	}
+
+	/*! \brief Encode `value` as a QUIC varint in the shortest form into a caller provided buffer.
+
+		\returns The number of bytes written, or 0 if `dst` is too small or `value` is larger than `quic_varint_max`.
+	*/
+	[[nodiscard]]
+	constexpr std::size_t quic_varint_encode(const std::uint64_t value, const std::span<std::byte> dst) noexcept {
+		const auto size{quic_varint_size(value)};
+		if (size == 0zu || dst.size() < size) [[unlikely]] {
+			return 0zu;
+		}
+
+		for (std::size_t idx{}; idx < size; ++idx) {
+			dst[idx] = std::byte{static_cast<std::uint8_t>(value >> ((size - idx - 1zu) * 8zu))};
+		}
+		/* The top two bits are the log2 of the length */
+		dst[0] |= std::byte{static_cast<std::uint8_t>(std::countr_zero(size) << 6U)};
+		return size;
+	}
+
+	/*! \brief Decode a QUIC varint from the start of `bytes`.
+
+		QUIC allows values to be encoded in more bytes than needed, so this does not reject them. Where the
+		shortest encoding is required, such as for frame types, compare the length with `quic_varint_size`.
+
+		\returns The value and the number of bytes it took, or `read_error_t::Truncated`.
+	*/
+	[[nodiscard]]
+	constexpr std::expected<varint_t<std::uint64_t>, read_error_t> quic_varint_decode(
+		const std::span<const std::byte> bytes
+	) noexcept {
+		if (bytes.empty()) [[unlikely]] {
+			return std::unexpected(read_error_t::Truncated);
+		}
+
+		const auto first{std::to_integer<std::uint8_t>(bytes[0])};
+		const auto size{1zu << (first >> 6U)};
+		if (bytes.size() < size) [[unlikely]] {
+			return std::unexpected(read_error_t::Truncated);
+		}
+
+		std::uint64_t value{first & 0x3FU};
+		for (std::size_t idx{1zu}; idx < size; ++idx) {
+			value = (value << 8U) | std::to_integer<std::uint64_t>(bytes[idx]);
+		}
+		return varint_t<std::uint64_t>{value, size};
+	}
+
+	/*! \brief Decode a QUIC varint from offset `idx` into `buffer`
+
+		\see quic_varint_decode
+	*/
+	[[nodiscard]]
+	inline std::expected<varint_t<std::uint64_t>, read_error_t> quic_varint_decode(
+		const Panko::core::bytearray_t& buffer, const std::size_t idx = 0zu
+	) noexcept {
+		if (idx > buffer.length()) [[unlikely]] {
+			return std::unexpected(read_error_t::Truncated);
+		}
+		return quic_varint_decode(std::span<const std::byte>{buffer.data() + idx, buffer.length() - idx});
+	}
+
+	/* == Allocating Encode/Decode == */
 
 	template<typename T>
 	[[nodiscard]]
@@ -1,11 +1,499 @@
 // SPDX-License-Identifier: BSD-3-Clause
 /* so_loader.cc - Dissector shared object loader */
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <future>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#	include <windows.h>
+#else
+#	include <dlfcn.h>
+#endif
+
 #include "panko/config.hh"
 #include "panko/internal/defs.hh"
 
+#include "panko/support/paths.hh"
 #include "panko/support/so_loader.hh"
 
 namespace Panko::support {
+	using namespace std::literals::string_view_literals;
+
+	namespace {
+		/* Bumped whenever the layout of the cache file changes, a cache of any other version is ignored */
+		constexpr auto cache_header{"panko-so-cache 1"sv};
+
+		/* A shared object found while scanning the dissector directories */
+		struct candidate_t final {
+			fs::path path;
+			std::uintmax_t file_size;
+			std::int64_t file_time;
+		};
+
+		[[nodiscard]]
+		void* open_so(const fs::path& path) noexcept {
+#if defined(_WIN32)
+			return static_cast<void*>(LoadLibraryW(path.c_str()));
+#else
+			return dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+		}
+
+		void close_so(void* const handle) noexcept {
+#if defined(_WIN32)
+			FreeLibrary(static_cast<HMODULE>(handle));
+#else
+			dlclose(handle);
+#endif
+		}
+
+		[[nodiscard]]
+		dissector_entry_fn find_entry(void* const handle) noexcept {
+			/* `dissector_entry_symbol` is a view of a string literal so it is NUL terminated */
+#if defined(_WIN32)
+			const auto symbol{GetProcAddress(static_cast<HMODULE>(handle), dissector_entry_symbol.data())};
+#else
+			auto* const symbol{dlsym(handle, dissector_entry_symbol.data())};
+#endif
+			return reinterpret_cast<dissector_entry_fn>(symbol);
+		}
+
+		[[nodiscard]]
+		bool is_shared_object(const fs::path& path) noexcept {
+#if defined(_WIN32)
+			return path.extension() == ".dll"sv;
+#elif defined(__APPLE__)
+			return path.extension() == ".dylib"sv || path.extension() == ".so"sv;
+#else
+			return path.extension() == ".so"sv;
+#endif
+		}
+
+		[[nodiscard]]
+		std::vector<candidate_t> scan_dir(const fs::path& dir) {
+			std::vector<candidate_t> found{};
+
+			std::error_code iter_err{};
+			for (fs::directory_iterator entry{dir, iter_err}, end{}; !iter_err && entry != end; entry.increment(iter_err)) {
+				std::error_code err{};
+				if (!entry->is_regular_file(err) || !is_shared_object(entry->path())) {
+					continue;
+				}
+
+				const auto file_size{entry->file_size(err)};
+				if (err) {
+					continue;
+				}
+				const auto file_time{entry->last_write_time(err)};
+				if (err) {
+					continue;
+				}
+
+				found.emplace_back(entry->path(), file_size, static_cast<std::int64_t>(file_time.time_since_epoch().count()));
+			}
+
+			return found;
+		}
+
+		/*
+			Find every shared object in `dirs`, sorted by path.
+
+			Directory scanning is all I/O, so each directory is done on its own thread. Loading is serialized by
+			the dynamic linker anyway, so it is done in path order by the caller, which also makes the IDs the
+			same from run to run.
+		*/
+		[[nodiscard]]
+		std::vector<candidate_t> scan_dirs(const std::span<const fs::path> dirs) {
+			std::vector<candidate_t> candidates{};
+
+			std::vector<std::future<std::vector<candidate_t>>> scans{};
+			scans.reserve(dirs.size());
+			for (const auto& dir : dirs) {
+				try {
+					scans.push_back(std::async(std::launch::async, scan_dir, dir));
+				} catch (const std::system_error&) {
+					auto found{scan_dir(dir)};
+					candidates.insert(candidates.end(), found.begin(), found.end());
+				}
+			}
+			for (auto& scan : scans) {
+				auto found{scan.get()};
+				candidates.insert(candidates.end(), found.begin(), found.end());
+			}
+
+			std::ranges::sort(candidates, {}, &candidate_t::path);
+			const auto dupes{std::ranges::unique(candidates, {}, &candidate_t::path)};
+			candidates.erase(dupes.begin(), dupes.end());
+			return candidates;
+		}
+
+		/* Split off everything up to the next tab */
+		[[nodiscard]]
+		std::string_view next_field(std::string_view& line) noexcept {
+			const auto end{line.find('\t')};
+			const auto field{line.substr(0zu, end)};
+			line.remove_prefix((end == std::string_view::npos) ? line.size() : end + 1zu);
+			return field;
+		}
+
+		template<typename T>
+		[[nodiscard]]
+		bool parse_int(const std::string_view str, T& value) noexcept {
+			const auto res{std::from_chars(str.data(), str.data() + str.size(), value)};
+			return res.ec == std::errc{} && res.ptr == (str.data() + str.size());
+		}
+
+		/* The registrations are stored as a comma separated list of `kind:value` pairs */
+		[[nodiscard]]
+		bool parse_registrations(std::string_view str, std::vector<registration_t>& registrations) {
+			while (!str.empty()) {
+				const auto end{str.find(',')};
+				const auto pair{str.substr(0zu, end)};
+				str.remove_prefix((end == std::string_view::npos) ? str.size() : end + 1zu);
+
+				const auto split{pair.find(':')};
+				if (split == std::string_view::npos) {
+					return false;
+				}
+
+				std::uint8_t kind{};
+				std::uint32_t value{};
+				if (!parse_int(pair.substr(0zu, split), kind) || !parse_int(pair.substr(split + 1zu), value)) {
+					return false;
+				}
+				registrations.push_back({static_cast<registration_kind_t>(kind), value});
+			}
+			return true;
+		}
+
+		[[nodiscard]]
+		bool storable(const std::string_view str) noexcept {
+			return str.find_first_of("\t\n"sv) == std::string_view::npos;
+		}
+	}
+
+	/* == so_cache_t == */
+
+	so_cache_t so_cache_t::load(const fs::path& file) noexcept {
+		so_cache_t cache{};
+		try {
+			std::ifstream stream{file};
+			std::string line{};
+			if (!stream || !std::getline(stream, line) || line != cache_header) {
+				return cache;
+			}
+
+			/* abi, size, time, name, registrations, and then the path, the rest of the line as is */
+			while (std::getline(stream, line)) {
+				std::string_view fields{line};
+				so_manifest_t manifest{};
+				const auto abi_version{next_field(fields)};
+				const auto file_size{next_field(fields)};
+				const auto file_time{next_field(fields)};
+				manifest.name = next_field(fields);
+				const auto registrations{next_field(fields)};
+
+				if (
+					fields.empty() ||
+					!parse_int(abi_version, manifest.abi_version) ||
+					!parse_int(file_size, manifest.file_size) ||
+					!parse_int(file_time, manifest.file_time) ||
+					!parse_registrations(registrations, manifest.registrations)
+				) {
+					continue;
+				}
+				cache._manifests.insert_or_assign(std::string{fields}, std::move(manifest));
+			}
+		} catch (...) {
+			return so_cache_t{};
+		}
+		return cache;
+	}
+
+	fs::path so_cache_t::default_path() {
+		return paths::CACHE_DIR / "native_dissectors.cache"sv;
+	}
+
+	bool so_cache_t::save(const fs::path& file) noexcept {
+		if (!_dirty) {
+			return true;
+		}
+
+		try {
+			std::error_code err{};
+			fs::create_directories(file.parent_path(), err);
+
+			/* Write it out to the side and then move it over the old one, so a reader never sees half a cache */
+			auto tmp{file};
+			tmp += ".tmp"sv;
+			{
+				std::ofstream stream{tmp, std::ios::trunc};
+				stream << cache_header << '\n';
+				for (const auto& [path, manifest] : _manifests) {
+					if (!storable(path) || !storable(manifest.name)) {
+						continue;
+					}
+
+					stream << manifest.abi_version << '\t' << manifest.file_size << '\t' << manifest.file_time << '\t';
+					stream << manifest.name << '\t';
+					for (std::size_t idx{}; idx < manifest.registrations.size(); ++idx) {
+						const auto& reg{manifest.registrations[idx]};
+						stream << ((idx != 0zu) ? ","sv : ""sv) << static_cast<std::uint32_t>(reg.kind) << ':' << reg.value;
+					}
+					stream << '\t' << path << '\n';
+				}
+
+				if (!stream.flush()) {
+					fs::remove(tmp, err);
+					return false;
+				}
+			}
+
+			fs::rename(tmp, file, err);
+			if (err) {
+				fs::remove(tmp, err);
+				return false;
+			}
+		} catch (...) {
+			return false;
+		}
+
+		_dirty = false;
+		return true;
+	}
+
+	const so_manifest_t* so_cache_t::find(
+		const fs::path& path, const std::uintmax_t file_size, const std::int64_t file_time
+	) const noexcept {
+		const auto manifest{_manifests.find(path.string())};
+		if (manifest == _manifests.end()) {
+			return nullptr;
+		}
+		if (manifest->second.file_size != file_size || manifest->second.file_time != file_time) {
+			return nullptr;
+		}
+		return &manifest->second;
+	}
+
+	void so_cache_t::store(const fs::path& path, so_manifest_t manifest) {
+		_manifests.insert_or_assign(path.string(), std::move(manifest));
+		_dirty = true;
+	}
+
+	/* == so_loader_t == */
+
+	so_loader_t::~so_loader_t() noexcept {
+		/* Unload in the reverse order to loading, in case any dissector depends on one loaded before it */
+		for (auto plugin{_plugins.rbegin()}; plugin != _plugins.rend(); ++plugin) {
+			if (plugin->fini != nullptr) {
+				plugin->fini();
+			}
+			close_so(plugin->handle);
+		}
+	}
+
+	std::expected<dissector_id_t, so_error_t> so_loader_t::load(
+		const fs::path& path, so_manifest_t* const manifest
+	) noexcept {
+		if (_dispatch.size() >= max_dissectors) [[unlikely]] {
+			return std::unexpected(so_error_t::TooMany);
+		}
+
+		auto* const handle{open_so(path)};
+		if (handle == nullptr) {
+			return std::unexpected(so_error_t::OpenFailed);
+		}
+
+		const auto fail{[handle](const so_error_t err) {
+			close_so(handle);
+			return std::unexpected(err);
+		}};
+
+		const auto entry{find_entry(handle)};
+		if (entry == nullptr) {
+			return fail(so_error_t::NoEntryPoint);
+		}
+
+		/* Check the ABI version before anything else, the rest of the descriptor may not even be this shape */
+		const auto* const desc{entry()};
+		if (desc == nullptr) {
+			return fail(so_error_t::Invalid);
+		}
+		if (manifest != nullptr) {
+			manifest->abi_version = desc->abi_version;
+		}
+		if (desc->abi_version != dissector_abi_version) {
+			return fail(so_error_t::AbiMismatch);
+		}
+		if (
+			desc->size < sizeof(dissector_descriptor_t) || desc->name == nullptr || desc->dissect == nullptr ||
+			(desc->registrations == nullptr && desc->registration_count != 0zu)
+		) {
+			return fail(so_error_t::Invalid);
+		}
+
+		const std::span<const registration_t> registrations{desc->registrations, desc->registration_count};
+		try {
+			if (manifest != nullptr) {
+				manifest->name = desc->name;
+				manifest->registrations.assign(registrations.begin(), registrations.end());
+			}
+			_dispatch.reserve(_dispatch.size() + 1zu);
+			_plugins.reserve(_plugins.size() + 1zu);
+			_registrations.reserve(_registrations.size() + 1zu);
+
+			/* Everything that can throw is done before `init`, so that a dissector is never left half set up */
+			_plugins.push_back({
+				path, std::string{desc->name}, std::string{(desc->description != nullptr) ? desc->description : ""},
+				handle, desc->fini
+			});
+		} catch (...) {
+			return fail(so_error_t::Unspecified);
+		}
+
+		if (desc->init != nullptr && !desc->init()) {
+			_plugins.pop_back();
+			return fail(so_error_t::InitFailed);
+		}
+
+		const auto id{static_cast<dissector_id_t>(_dispatch.size())};
+		_dispatch.push_back({desc->dissect, desc->heuristic});
+		_registrations.push_back(registrations);
+
+		/* Failing to index a dissector only means it can't be found by `resolve`, it still loaded fine */
+		try {
+			for (const auto& reg : registrations) {
+				_keys[key(reg.kind, reg.value)].loaded.push_back(id);
+			}
+		} catch (...) { }
+		return id;
+	}
+
+	std::expected<dissector_id_t, so_error_t> so_loader_t::load(const fs::path& path) noexcept {
+		return load(path, nullptr);
+	}
+
+	std::size_t so_loader_t::load_dirs(const std::span<const fs::path> dirs, so_cache_t* const cache) {
+		const auto candidates{scan_dirs(dirs)};
+
+		std::size_t loaded{};
+		for (const auto& candidate : candidates) {
+			const so_manifest_t* known{};
+			if (cache != nullptr) {
+				known = cache->find(candidate.path, candidate.file_size, candidate.file_time);
+				if (known != nullptr && known->abi_version != dissector_abi_version) {
+					continue;
+				}
+			}
+
+			so_manifest_t manifest{candidate.file_size, candidate.file_time, 0U, {}, {}};
+			if (load(candidate.path, &manifest)) {
+				++loaded;
+			}
+			/* Only things with a descriptor are worth remembering, anything else might just not be built yet */
+			if (cache != nullptr && known == nullptr && manifest.abi_version != 0U) {
+				cache->store(candidate.path, std::move(manifest));
+			}
+		}
+
+		return loaded;
+	}
+
+	std::size_t so_loader_t::load_installed(so_cache_t* const cache) {
+		const std::array<fs::path, 2> dirs{{paths::SO_DISSECTORS_SYS, paths::SO_DISSECTORS_LOCAL}};
+		return load_dirs(dirs, cache);
+	}
+
+	std::size_t so_loader_t::index_dirs(const std::span<const fs::path> dirs, so_cache_t& cache) {
+		const auto candidates{scan_dirs(dirs)};
+
+		std::size_t indexed{};
+		for (const auto& candidate : candidates) {
+			const auto* const known{cache.find(candidate.path, candidate.file_size, candidate.file_time)};
+			if (known == nullptr) {
+				so_manifest_t manifest{candidate.file_size, candidate.file_time, 0U, {}, {}};
+				if (load(candidate.path, &manifest)) {
+					++indexed;
+				}
+				if (manifest.abi_version != 0U) {
+					cache.store(candidate.path, std::move(manifest));
+				}
+				continue;
+			}
+
+			if (known->abi_version != dissector_abi_version) {
+				continue;
+			}
+			const auto pending{_pending.size()};
+			_pending.push_back({candidate.path, false});
+			for (const auto& reg : known->registrations) {
+				_keys[key(reg.kind, reg.value)].pending.push_back(pending);
+			}
+			++indexed;
+		}
+
+		return indexed;
+	}
+
+	std::size_t so_loader_t::index_installed(so_cache_t& cache) {
+		const std::array<fs::path, 2> dirs{{paths::SO_DISSECTORS_SYS, paths::SO_DISSECTORS_LOCAL}};
+		return index_dirs(dirs, cache);
+	}
+
+	std::span<const dissector_id_t> so_loader_t::resolve_all(
+		const registration_kind_t kind, const std::uint32_t value
+	) {
+		const auto entry_key{key(kind, value)};
+		auto entry{_keys.find(entry_key)};
+		if (entry == _keys.end()) {
+			return {};
+		}
+
+		if (!entry->second.pending.empty()) {
+			/* Loading adds to `_keys`, which can rehash it, so take the pending list out first */
+			const auto pending{std::exchange(entry->second.pending, {})};
+			for (const auto idx : pending) {
+				auto& plugin{_pending[idx]};
+				if (plugin.attempted) {
+					continue;
+				}
+				plugin.attempted = true;
+				/* A successful load indexes the dissector under all of its keys, including this one */
+				static_cast<void>(load(plugin.path, nullptr));
+			}
+			entry = _keys.find(entry_key);
+		}
+
+		return entry->second.loaded;
+	}
+
+	std::vector<registration_t> so_loader_t::unloaded_registrations() const {
+		std::vector<registration_t> registrations{};
+		for (const auto& [entry_key, entry] : _keys) {
+			const auto unloaded{std::ranges::any_of(entry.pending, [this](const std::size_t idx) {
+				return !_pending[idx].attempted;
+			})};
+			if (unloaded) {
+				registrations.push_back({
+					static_cast<registration_kind_t>(entry_key >> 32U), static_cast<std::uint32_t>(entry_key)
+				});
+			}
+		}
+		return registrations;
+	}
 
+	std::optional<dissector_id_t> so_loader_t::find(const std::string_view name) const noexcept {
+		for (std::size_t idx{}; idx < _plugins.size(); ++idx) {
+			if (_plugins[idx].name == name) {
+				return static_cast<dissector_id_t>(idx);
+			}
+		}
+		return std::nullopt;
+	}
 }
@@ -5,13 +5,367 @@
 #if !defined(PANKO_SUPPORT_SO_LOADER_HH)
 #define PANKO_SUPPORT_SO_LOADER_HH
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <type_traits>
 
+#include "panko/internal/defs.hh"
+#include "panko/core/errcodes.hh"
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+
+/* Marks the dissector entry point of a native dissector so the loader can find it */
+#if defined(_WIN32)
+#	define PANKO_DISSECTOR_EXPORT extern "C" __declspec(dllexport)
+#else
+#	define PANKO_DISSECTOR_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+// NOLINTEND(cppcoreguidelines-macro-usage)
 
 namespace Panko::support {
+	namespace fs = std::filesystem;
+
+	using Panko::core::error_codes::so_error_t;
+
+	/* == Native Dissector ABI == */
+
+	/*! \brief The version of the native dissector ABI this build of Panko implements.
+
+		This is bumped whenever `dissector_descriptor_t` or any of the types it refers to change in a way that
+		is not backwards compatible, dissectors built for any other version are refused.
+	*/
+	constexpr inline std::uint32_t dissector_abi_version{1U};
+
+	/*! \brief The name of the function every native dissector must export with `PANKO_DISSECTOR_EXPORT` */
+	constexpr inline std::string_view dissector_entry_symbol{"panko_dissector_entry"};
+
+	/*! \enum Panko::support::registration_kind_t
+		\brief The dispatch tables a native dissector can register itself in
+	*/
+	enum struct registration_kind_t : std::uint8_t {
+		LinkType  = 0x00U, /*!< A capture LINKTYPE */
+		EtherType = 0x01U, /*!< An Ethernet EtherType */
+		IpProto   = 0x02U, /*!< An IP protocol number */
+		TcpPort   = 0x03U, /*!< A TCP port */
+		UdpPort   = 0x04U, /*!< A UDP port */
+		Heuristic = 0x05U, /*!< A heuristic on the table of the `registration_kind_t` in the value */
+	};
+
+	/*! \brief A single key a native dissector is registered under */
+	struct registration_t final {
+		registration_kind_t kind;
+		std::uint32_t value;
+	};
+
+	extern "C" {
+		/*! \brief Dissect `len` bytes at `data`, returning the number of bytes consumed */
+		using dissect_fn = std::size_t (*)(const std::uint8_t* data, std::size_t len, void* ctx);
+		/*! \brief Returns true if the `len` bytes at `data` look like they are for this dissector */
+		using heuristic_fn = bool (*)(const std::uint8_t* data, std::size_t len);
+
+		/*! \brief The description of a native dissector, returned by its entry point.
+
+			The descriptor and everything it points to must stay valid for as long as the dissector is loaded,
+			which in practice means it should be a `static` or `constexpr` object.
+
+			\code{.cc}
+			constexpr static std::array<registration_t, 1> registrations{{
+				{ registration_kind_t::TcpPort, 5683U },
+			}};
+
+			constexpr static dissector_descriptor_t descriptor{
+				.abi_version        = dissector_abi_version,
+				.size               = sizeof(dissector_descriptor_t),
+				.name               = "coap",
+				.description        = "Constrained Application Protocol",
+				.registrations      = registrations.data(),
+				.registration_count = registrations.size(),
+				.init               = nullptr,
+				.fini               = nullptr,
+				.dissect            = dissect_coap,
+				.heuristic          = nullptr,
+			};
+
+			PANKO_DISSECTOR_EXPORT const dissector_descriptor_t* panko_dissector_entry() {
+				return &descriptor;
+			}
+			\endcode
+		*/
+		struct dissector_descriptor_t final {
+			/*! \brief Must be `dissector_abi_version` */
+			std::uint32_t abi_version;
+			/*! \brief Must be `sizeof(dissector_descriptor_t)` */
+			std::uint32_t size;
+			/*! \brief The unique short name of the dissector */
+			const char* name;
+			/*! \brief A short human readable description of the dissector, optional */
+			const char* description;
+			/*! \brief The keys the dissector registers itself under, optional */
+			const registration_t* registrations;
+			std::size_t registration_count;
+			/*! \brief Called once after loading, the dissector is unloaded if it returns false, optional */
+			bool (*init)();
+			/*! \brief Called once before unloading, optional */
+			void (*fini)();
+			/*! \brief The dissector itself */
+			dissect_fn dissect;
+			/*! \brief The heuristic for the dissector, optional */
+			heuristic_fn heuristic;
+		};
+
+		/*! \brief The type of `dissector_entry_symbol` */
+		using dissector_entry_fn = const dissector_descriptor_t* (*)();
+	}
+
+	/* == Loader == */
+
+	/*! \brief The ID of a loaded native dissector, its index into the dispatch table */
+	using dissector_id_t = std::uint16_t;
+
+	/*! \brief The most native dissectors that can be loaded, the last two IDs are kept back for the dispatch tables */
+	constexpr inline std::size_t max_dissectors{std::size_t{std::numeric_limits<dissector_id_t>::max()} - 1zu};
+
+	/*! \brief An entry in the native dissector dispatch table, the entry points of a single dissector */
+	struct dissector_slot_t final {
+		dissect_fn dissect;
+		heuristic_fn heuristic;
+	};
+
+	/*! \brief What is known about a native dissector without loading it */
+	struct so_manifest_t final {
+		/*! \brief The size and modification time of the shared object, used to tell when it has changed */
+		std::uintmax_t file_size;
+		std::int64_t file_time;
+		/*! \brief The ABI version the dissector was built for */
+		std::uint32_t abi_version;
+		std::string name;
+		std::vector<registration_t> registrations;
+	};
+
+	/*! \brief A cache of `so_manifest_t`s keyed by the path of the shared object.
+
+		This lets `so_loader_t::load_dirs` skip dissectors that are known to be incompatible without loading
+		them, and holds the registrations of every dissector for lazy loading.
+	*/
+	struct so_cache_t final {
+	private:
+		std::unordered_map<std::string, so_manifest_t> _manifests{};
+		bool _dirty{false};
+	public:
+		so_cache_t() noexcept = default;
+
+		/*! \brief Load a cache from `file`, any problems with it just give an empty cache */
+		[[nodiscard]]
+		PANKO_CLS_API static so_cache_t load(const fs::path& file) noexcept;
+
+		/*! \brief Returns the default cache file, under `paths::CACHE_DIR` */
+		[[nodiscard]]
+		PANKO_CLS_API static fs::path default_path();
+
+		/*! \brief Save the cache to `file` if it has changed since it was loaded.
+
+			\returns true if the cache was written or did not need to be, otherwise false.
+		*/
+		PANKO_CLS_API bool save(const fs::path& file) noexcept;
+
+		/*! \brief Returns the manifest for `path` if there is one and it is for the same file size and time */
+		[[nodiscard]]
+		PANKO_CLS_API const so_manifest_t* find(
+			const fs::path& path, std::uintmax_t file_size, std::int64_t file_time
+		) const noexcept;
+
+		/*! \brief Add or replace the manifest for `path` */
+		PANKO_CLS_API void store(const fs::path& path, so_manifest_t manifest);
+
+		/*! \brief Returns all of the manifests in the cache */
+		[[nodiscard]]
+		const std::unordered_map<std::string, so_manifest_t>& manifests() const noexcept {
+			return _manifests;
+		}
+
+		[[nodiscard]]
+		bool dirty() const noexcept {
+			return _dirty;
+		}
+	};
+
+	/*! \brief Loads native dissectors and holds their dispatch table.
+
+		When a dissector is loaded, its entry points are resolved once and copied into a flat table indexed
+		by its `dissector_id_t`, so dispatching to it is a single indexed load with no symbol lookups or name
+		comparisons. The metadata for each dissector is kept separately, so the table stays dense.
+
+		Dissectors can also be loaded lazily, `index_dirs` only loads the dissectors the `so_cache_t` does
+		not know about yet, and everything else is loaded the first time `resolve` is asked for one of the
+		keys it registered under. A run that only sees a handful of protocols then only pays for loading
+		those dissectors.
+
+		The loader owns the shared objects, and unloads them when it is destroyed, so the loader must
+		outlive any use of the dispatch table.
+	*/
+	struct so_loader_t final {
+		/*! \brief A loaded native dissector */
+		struct plugin_t final {
+			fs::path path;
+			std::string name;
+			std::string description;
+			void* handle;
+			void (*fini)();
+		};
+	private:
+		std::vector<dissector_slot_t> _dispatch{};
+		std::vector<plugin_t> _plugins{};
+		std::vector<std::span<const registration_t>> _registrations{};
+
+		/* A dissector the cache knows about that has not been loaded yet */
+		struct pending_t final {
+			fs::path path;
+			bool attempted;
+		};
+
+		/* The dissectors registered under a single key */
+		struct key_entry_t final {
+			std::vector<std::size_t> pending;
+			std::vector<dissector_id_t> loaded;
+		};
+
+		std::vector<pending_t> _pending{};
+		std::unordered_map<std::uint64_t, key_entry_t> _keys{};
+
+		[[nodiscard]]
+		static constexpr std::uint64_t key(const registration_kind_t kind, const std::uint32_t value) noexcept {
+			return (std::uint64_t{static_cast<std::uint8_t>(kind)} << 32U) | value;
+		}
+
+		[[nodiscard]]
+		std::expected<dissector_id_t, so_error_t> load(const fs::path& path, so_manifest_t* manifest) noexcept;
+	public:
+		so_loader_t() noexcept = default;
+
+		so_loader_t(const so_loader_t&) = delete;
+		so_loader_t& operator=(const so_loader_t&) = delete;
+
+		so_loader_t(so_loader_t&&) noexcept = default;
+		so_loader_t& operator=(so_loader_t&&) = delete;
+
+		PANKO_CLS_API ~so_loader_t() noexcept;
+
+		/*! \brief Load the native dissector at `path`.
+
+			\returns The ID of the dissector, or why it could not be loaded.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::expected<dissector_id_t, so_error_t> load(const fs::path& path) noexcept;
+
+		/*! \brief Load every native dissector in `dirs`.
+
+			The directories are scanned in parallel, and the dissectors are then loaded in path order so that
+			their IDs are stable from run to run. Dissectors that fail to load are skipped.
+
+			\param dirs The directories to search, ones that do not exist are ignored.
+			\param cache If not null, dissectors the cache knows are for another ABI version are skipped without
+			loading them, and the cache is updated with the manifest of everything else.
+			\returns The number of dissectors loaded.
+		*/
+		PANKO_CLS_API std::size_t load_dirs(std::span<const fs::path> dirs, so_cache_t* cache = nullptr);
+
+		/*! \brief Load every native dissector in `paths::SO_DISSECTORS_SYS` and `paths::SO_DISSECTORS_LOCAL` */
+		PANKO_CLS_API std::size_t load_installed(so_cache_t* cache = nullptr);
+
+		/*! \brief Index every native dissector in `dirs` for lazy loading.
+
+			Dissectors with a manifest in `cache` are not loaded, only their registrations are recorded so
+			`resolve` can load them when they are first needed. Anything the cache does not know about yet is
+			loaded straight away to find out what it registers, and is added to the cache.
+
+			\param dirs The directories to search, ones that do not exist are ignored.
+			\param cache The manifest cache, which should be saved afterwards if it is `dirty()`.
+			\returns The number of dissectors available, loaded or not.
+		*/
+		PANKO_CLS_API std::size_t index_dirs(std::span<const fs::path> dirs, so_cache_t& cache);
+
+		/*! \brief Index every native dissector in `paths::SO_DISSECTORS_SYS` and `paths::SO_DISSECTORS_LOCAL` */
+		PANKO_CLS_API std::size_t index_installed(so_cache_t& cache);
+
+		/*! \brief Returns every dissector registered under `value` in the `kind` table, loading them if needed.
+
+			Heuristic dissectors are found with a `kind` of `registration_kind_t::Heuristic` and a `value` of the
+			table they are heuristics for. Dissectors that fail to load are left out, and are not tried again.
+
+			The result is only valid until the next call that loads a dissector, it is meant for filling in the
+			dispatch tables of the dissection engine, not for use per packet.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::span<const dissector_id_t> resolve_all(registration_kind_t kind, std::uint32_t value);
+
+		/*! \brief Returns the first dissector registered under `value` in the `kind` table, loading it if needed */
+		[[nodiscard]]
+		std::optional<dissector_id_t> resolve(const registration_kind_t kind, const std::uint32_t value) {
+			const auto found{resolve_all(kind, value)};
+			if (found.empty()) {
+				return std::nullopt;
+			}
+			return found.front();
+		}
+
+		/*! \brief Returns the number of indexed dissectors that have not been loaded yet */
+		[[nodiscard]]
+		std::size_t unloaded() const noexcept {
+			return static_cast<std::size_t>(std::ranges::count(_pending, false, &pending_t::attempted));
+		}
+
+		/*! \brief Returns the keys that indexed dissectors which have not been loaded yet registered under.
+
+			These are the keys that `resolve` would load a dissector for, so the dispatch tables can defer to it.
+		*/
+		[[nodiscard]]
+		PANKO_CLS_API std::vector<registration_t> unloaded_registrations() const;
+
+		/*! \brief Returns the ID of the dissector called `name`, this is for registration and not per packet */
+		[[nodiscard]]
+		PANKO_CLS_API std::optional<dissector_id_t> find(std::string_view name) const noexcept;
+
+		/*! \brief Returns the number of loaded dissectors */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return _dispatch.size();
+		}
+
+		/*! \brief Returns the whole dispatch table */
+		[[nodiscard]]
+		std::span<const dissector_slot_t> dispatch() const noexcept {
+			return _dispatch;
+		}
+
+		/*! \brief Returns the dispatch table entry of the dissector `id`, which must be loaded */
+		[[nodiscard]]
+		const dissector_slot_t& operator[](const dissector_id_t id) const noexcept {
+			return _dispatch[id];
+		}
+
+		/*! \brief Returns the metadata of the dissector `id`, which must be loaded */
+		[[nodiscard]]
+		const plugin_t& plugin(const dissector_id_t id) const noexcept {
+			return _plugins[id];
+		}
 
+		/*! \brief Returns the keys the dissector `id` registered itself under, which must be loaded */
+		[[nodiscard]]
+		std::span<const registration_t> registrations(const dissector_id_t id) const noexcept {
+			return _registrations[id];
+		}
+	};
 }
 
 #endif /* PANKO_SUPPORT_SO_LOADER_HH */
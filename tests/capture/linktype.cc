@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* linktype.cc - LINKTYPE table test harness */
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/capture/linktype.hh"
+
+using namespace std::literals::string_view_literals;
+
+using Panko::capture::is_private;
+using Panko::capture::linktype_description;
+using Panko::capture::linktype_name;
+using Panko::capture::linktype_public_slots;
+using Panko::capture::linktype_slot;
+using Panko::capture::linktype_slots;
+using Panko::capture::linktype_t;
+using Panko::capture::linktype_table_t;
+
+constexpr static linktype_table_t<std::uint8_t> handlers{
+	{ linktype_t::ETHERNET,        1U },
+	{ linktype_t::RAW,             2U },
+	{ linktype_t::PRIVATE_USE_001, 3U },
+};
+
+TEST_CASE("linktype - is_private") {
+	CHECK_FALSE(is_private(linktype_t::ETHERNET));
+	CHECK(is_private(linktype_t::PRIVATE_USE_BEG));
+	CHECK(is_private(linktype_t::PRIVATE_USE_267));
+	CHECK(is_private(linktype_t::PRIVATE_USE_END));
+}
+
+TEST_CASE("linktype - slots") {
+	static_assert(linktype_slot(linktype_t::BSD_LOOPBACK) == 0zu);
+	static_assert(linktype_slot(linktype_t::PRIVATE_USE_BEG) == linktype_public_slots);
+	static_assert(linktype_slot(linktype_t::PRIVATE_USE_END) == (linktype_slots - 1zu));
+
+	/* Every assigned value has a slot of its own */
+	CHECK_EQ(linktype_slot(static_cast<linktype_t>(linktype_public_slots - 1zu)), linktype_public_slots - 1zu);
+	CHECK_EQ(linktype_slot(static_cast<linktype_t>(linktype_public_slots)), linktype_slots);
+	CHECK_EQ(linktype_slot(static_cast<linktype_t>(0x8000U)), linktype_slots);
+}
+
+TEST_CASE("linktype - tables") {
+	static_assert(handlers[linktype_t::ETHERNET] == 1U);
+	static_assert(handlers[linktype_t::PRIVATE_USE_001] == 3U);
+
+	CHECK_EQ(handlers[linktype_t::RAW], 2U);
+	CHECK_EQ(handlers[linktype_t::PPP], 0U);
+	CHECK_EQ(handlers[static_cast<linktype_t>(0x8000U)], 0U);
+
+	linktype_table_t<int> table{};
+	CHECK(table.set(linktype_t::IEEE802_11_RADIOTAP, 42));
+	CHECK_FALSE(table.set(static_cast<linktype_t>(0x8000U), 7));
+	CHECK_EQ(table[linktype_t::IEEE802_11_RADIOTAP], 42);
+	CHECK_EQ(table[static_cast<linktype_t>(0x8000U)], 0);
+}
+
+TEST_CASE("linktype - names") {
+	CHECK_EQ(linktype_name(linktype_t::ETHERNET), "ETHERNET"sv);
+	CHECK_EQ(linktype_description(linktype_t::ETHERNET), "IEEE 802.3 Ethernet"sv);
+	CHECK_EQ(linktype_name(linktype_t::BSD_LOOPBACK), "BSD_LOOPBACK"sv);
+	CHECK_EQ(linktype_description(linktype_t::IEEE802_11_RADIOTAP), "Radiotap header, followed by an 802.11 header"sv);
+	CHECK_EQ(linktype_name(linktype_t::PRIVATE_USE_END), "PRIVATE_USE_534"sv);
+	CHECK_EQ(linktype_description(linktype_t::PRIVATE_USE_BEG), "Reserved for private use #0"sv);
+
+	/* Unassigned values are empty */
+	CHECK(linktype_name(static_cast<linktype_t>(60U)).empty());
+	CHECK(linktype_description(static_cast<linktype_t>(0x8000U)).empty());
+}
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* arena.cc - arena_t test harness */
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/core/arena.hh"
+
+using Panko::core::arena_t;
+
+TEST_CASE("arena_t - allocate") {
+	arena_t arena{256zu};
+	CHECK_EQ(arena.capacity(), 0zu);
+
+	const auto bytes{arena.allocate<std::uint8_t>(3zu)};
+	CHECK_EQ(bytes.size(), 3zu);
+	CHECK_EQ(arena.capacity(), 256zu);
+
+	/* Allocations are aligned to their type */
+	const auto words{arena.allocate<std::uint64_t>(4zu)};
+	CHECK_EQ(reinterpret_cast<std::uintptr_t>(words.data()) % alignof(std::uint64_t), 0U);
+	CHECK(static_cast<const void*>(words.data()) > static_cast<const void*>(bytes.data()));
+
+	/* Allocations larger than a block get a block of their own */
+	const auto big{arena.allocate<std::byte>(1024zu)};
+	CHECK_EQ(big.size(), 1024zu);
+	CHECK(arena.capacity() >= 1280zu);
+
+	CHECK_THROWS_AS((void)arena.allocate<std::uint64_t>(~0zu / 4zu), std::bad_alloc);
+}
+
+TEST_CASE("arena_t - reset") {
+	arena_t arena{256zu};
+
+	const auto first{arena.allocate<std::byte>(200zu)};
+	(void)arena.allocate<std::byte>(200zu);
+	const auto capacity{arena.capacity()};
+
+	/* Blocks are reused after a reset rather than allocating new ones */
+	arena.reset();
+	const auto again{arena.allocate<std::byte>(200zu)};
+	CHECK_EQ(again.data(), first.data());
+	(void)arena.allocate<std::byte>(200zu);
+	CHECK_EQ(arena.capacity(), capacity);
+
+	arena.release();
+	CHECK_EQ(arena.capacity(), 0zu);
+	CHECK_EQ(arena.allocate<std::byte>(8zu).size(), 8zu);
+}
+
+TEST_CASE("arena_t - move") {
+	arena_t arena{};
+	const auto data{arena.allocate<std::uint32_t>(4zu)};
+	data[0] = 0xDEADBEEFU;
+
+	arena_t moved{std::move(arena)};
+	CHECK_EQ(moved.capacity(), 4096zu);
+	CHECK_EQ(data[0], 0xDEADBEEFU);
+}
@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* bit_reader.cc - bit_reader_t test harness */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/core/bit_reader.hh"
+#include "panko/core/bitfield.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/errcodes.hh"
+
+using Panko::core::bit_reader_t;
+using Panko::core::bitfield_t;
+using Panko::core::bit_t;
+using Panko::core::bits_t;
+using Panko::core::bytearray_t;
+using Panko::core::lsb_bit_reader_t;
+using Panko::core::per_variant_t;
+using Panko::core::error_codes::read_error_t;
+
+namespace {
+	[[nodiscard]]
+	std::vector<std::uint8_t> noise(const std::size_t len, std::uint32_t seed) {
+		std::vector<std::uint8_t> data(len);
+		for (auto& byte : data) {
+			seed ^= seed << 13U;
+			seed ^= seed >> 17U;
+			seed ^= seed << 5U;
+			byte = static_cast<std::uint8_t>(seed >> 24U);
+		}
+		return data;
+	}
+
+	/* Read `bits` bits from bit `pos` onwards one bit at a time */
+	[[nodiscard]]
+	std::uint64_t reference(const std::vector<std::uint8_t>& data, const std::size_t pos, const std::size_t bits, const bool msb) {
+		std::uint64_t value{};
+		for (std::size_t bit{}; bit < bits; ++bit) {
+			const auto at{pos + bit};
+			if (msb) {
+				value = (value << 1U) | ((std::uint64_t{data[at / 8zu]} >> (7zu - (at % 8zu))) & 1U);
+			} else {
+				value |= ((std::uint64_t{data[at / 8zu]} >> (at % 8zu)) & 1U) << bit;
+			}
+		}
+		return value;
+	}
+
+	enum struct flags_t : std::uint8_t {
+		Low,
+		Middle,
+		High,
+	};
+}
+
+TEST_CASE("bit_reader_t - Empty") {
+	bit_reader_t rdr{};
+
+	CHECK_EQ(rdr.length(), 0zu);
+	CHECK_EQ(rdr.bits_remaining(), 0zu);
+	CHECK(rdr.ok());
+
+	const auto res{rdr.read<1zu>()};
+	REQUIRE(!res.has_value());
+	CHECK_EQ(res.error(), read_error_t::Truncated);
+	CHECK(rdr.truncated());
+}
+
+TEST_CASE("bit_reader_t - MSB first") {
+	const std::array<std::uint8_t, 4> data{{0b1011'0011U, 0b0111'1100U, 0xFFU, 0x01U}};
+	bit_reader_t rdr{std::as_bytes(std::span{data})};
+
+	CHECK_EQ(rdr.length(), 32zu);
+	CHECK_EQ(rdr.read<1zu>(), 1U);
+	CHECK_EQ(rdr.read<3zu>(), 0b011U);
+	CHECK_EQ(rdr.peek<6zu>(), 0b0011'01U);
+	CHECK_EQ(rdr.read<6zu>(), 0b0011'01U);
+	CHECK_EQ(rdr.bit_offset(), 10zu);
+	CHECK_FALSE(rdr.byte_aligned());
+	CHECK_EQ(rdr.read_signed<3zu>(), std::int8_t{-1});
+
+	rdr.align();
+	CHECK(rdr.byte_aligned());
+	CHECK_EQ(rdr.bit_offset(), 16zu);
+	CHECK_EQ(rdr.rest().size(), 2zu);
+	CHECK_EQ(rdr.read<16zu>(), 0xFF01U);
+	CHECK_EQ(rdr.bits_remaining(), 0zu);
+	CHECK(rdr.ok());
+}
+
+TEST_CASE("bit_reader_t - LSB first") {
+	const std::array<std::uint8_t, 3> data{{0b1011'0011U, 0b0101'1100U, 0xA5U}};
+	lsb_bit_reader_t rdr{std::as_bytes(std::span{data})};
+
+	CHECK_EQ(rdr.read<1zu>(), 1U);
+	CHECK_EQ(rdr.read<3zu>(), 0b001U);
+	CHECK_EQ(rdr.read<6zu>(), 0b00'1011U);
+	CHECK_EQ(rdr.read<14zu>(), 0b1010'0101'0101'11U);
+	CHECK(rdr.ok());
+}
+
+TEST_CASE("bit_reader_t - Against a bit at a time reference") {
+	auto data{noise(256zu, 0xC0FFEEU)};
+	bytearray_t buff{data};
+
+	for (const auto msb : {true, false}) {
+		for (std::size_t width{1zu}; width <= 64zu; ++width) {
+			bit_reader_t msb_rdr{buff};
+			lsb_bit_reader_t lsb_rdr{buff};
+			/* Start off at an odd offset so the fields straddle bytes every which way */
+			REQUIRE(msb_rdr.skip(width % 7zu));
+			REQUIRE(lsb_rdr.skip(width % 7zu));
+
+			for (auto pos{width % 7zu}; (pos + width) <= (data.size() * 8zu); pos += width) {
+				const auto value{msb ? msb_rdr.read(width) : lsb_rdr.read(width)};
+				REQUIRE(value.has_value());
+				CHECK_EQ(*value, reference(data, pos, width, msb));
+			}
+		}
+	}
+
+	/* Compile time widths on either side of a refill */
+	bit_reader_t rdr{buff};
+	CHECK_EQ(rdr.read<5zu>(), reference(data, 0zu, 5zu, true));
+	CHECK_EQ(rdr.read<56zu>(), reference(data, 5zu, 56zu, true));
+	CHECK_EQ(rdr.read<64zu>(), reference(data, 61zu, 64zu, true));
+	CHECK_EQ(rdr.read<57zu>(), reference(data, 125zu, 57zu, true));
+	CHECK_EQ(rdr.bit_offset(), 182zu);
+}
+
+TEST_CASE("bit_reader_t - Truncation") {
+	const std::array<std::uint8_t, 2> data{{0xABU, 0xCDU}};
+	bit_reader_t rdr{std::as_bytes(std::span{data})};
+
+	CHECK_EQ(rdr.read<12zu>(), 0xABCU);
+	/* A failed peek doesn't set the flag */
+	CHECK_FALSE(rdr.peek<5zu>().has_value());
+	CHECK(rdr.ok());
+
+	CHECK_EQ(rdr.read_or<5zu>(0x1FU), 0x1FU);
+	CHECK(rdr.truncated());
+	CHECK_FALSE(static_cast<bool>(rdr));
+	/* Once truncated, everything fails even if it would otherwise fit */
+	CHECK_FALSE(rdr.read<1zu>().has_value());
+	CHECK_FALSE(rdr.skip(1zu));
+	CHECK_EQ(rdr.bit_offset(), 12zu);
+}
+
+TEST_CASE("bit_reader_t - skip") {
+	auto data{noise(64zu, 0xBEEFU)};
+	bytearray_t buff{data};
+
+	for (const auto first : {0zu, 3zu, 8zu, 61zu, 100zu, 301zu}) {
+		bit_reader_t rdr{buff};
+		REQUIRE(rdr.read(7zu).has_value());
+		REQUIRE(rdr.skip(first));
+		CHECK_EQ(rdr.bit_offset(), 7zu + first);
+		CHECK_EQ(rdr.read(9zu), reference(data, 7zu + first, 9zu, true));
+	}
+
+	bit_reader_t rdr{buff};
+	CHECK(rdr.skip(512zu));
+	CHECK(rdr.ok());
+	CHECK_FALSE(rdr.skip(1zu));
+	CHECK(rdr.truncated());
+}
+
+TEST_CASE("bit_reader_t - bitfield_t") {
+	using field_t = bitfield_t<std::uint8_t, flags_t, bit_t<0zu>, bits_t<1zu, 3zu>, bits_t<4zu, 7zu>>;
+
+	const std::array<std::uint8_t, 2> data{{0x0AU, 0xC5U}};
+	bit_reader_t rdr{std::as_bytes(std::span{data})};
+	REQUIRE(rdr.skip(4zu));
+
+	auto field{rdr.read_field<field_t>()};
+	REQUIRE(field.has_value());
+	CHECK_EQ(field->get<flags_t::Low>(), 0U);
+	CHECK_EQ(field->get<flags_t::Middle>(), 0b110U);
+	CHECK_EQ(field->get<flags_t::High>(), 0xAU);
+}
+
+TEST_CASE("bit_reader_t - Exp-Golomb") {
+	/* 1 | 010 | 011 | 00100 | 00101 | 0001000 | 0 then padding: ue 0 1 2 3 4 7 */
+	const std::array<std::uint8_t, 4> data{{0b1010'0110U, 0b0100'0010U, 0b1000'1000U, 0b0000'0000U}};
+	bit_reader_t rdr{std::as_bytes(std::span{data})};
+
+	CHECK_EQ(rdr.read_ue(), 0U);
+	CHECK_EQ(rdr.read_ue(), 1U);
+	CHECK_EQ(rdr.read_ue(), 2U);
+	CHECK_EQ(rdr.read_ue(), 3U);
+	CHECK_EQ(rdr.read_ue(), 4U);
+	CHECK_EQ(rdr.read_ue(), 7U);
+	CHECK_EQ(rdr.bit_offset(), 24zu);
+	/* Nothing but zeros to the end */
+	CHECK_EQ(rdr.read_ue().error(), read_error_t::Truncated);
+	CHECK(rdr.truncated());
+
+	/* ue 1 2 3 4 as se is 1 -1 2 -2 */
+	bit_reader_t signed_rdr{std::as_bytes(std::span{data})};
+	REQUIRE(signed_rdr.skip(1zu));
+	CHECK_EQ(signed_rdr.read_se(), 1);
+	CHECK_EQ(signed_rdr.read_se(), -1);
+	CHECK_EQ(signed_rdr.read_se(), 2);
+	CHECK_EQ(signed_rdr.read_se(), -2);
+
+	/* The largest value there is, and one past it */
+	std::array<std::uint8_t, 9> largest{};
+	largest[4] = 0xFFU;
+	largest[5] = 0xFFU;
+	largest[6] = 0xFFU;
+	largest[7] = 0xFFU;
+	bit_reader_t large_rdr{std::as_bytes(std::span{largest})};
+	REQUIRE(large_rdr.skip(1zu));
+	CHECK_EQ(large_rdr.read_ue(), 0xFFFF'FFFEU);
+
+	const std::array<std::uint8_t, 9> overlong{};
+	bit_reader_t overlong_rdr{std::as_bytes(std::span{overlong})};
+	CHECK_EQ(overlong_rdr.read_ue().error(), read_error_t::Malformed);
+}
+
+TEST_CASE("bit_reader_t - ASN.1 PER") {
+	SUBCASE("Constrained whole numbers") {
+		/* 3 bits of 5 in 0..7, then in ALIGNED a 0..255 is an aligned octet, and 0..65535 two of them */
+		const std::array<std::uint8_t, 5> data{{0b1010'0000U, 0x7FU, 0x12U, 0x34U, 0xFFU}};
+
+		bit_reader_t aligned{std::as_bytes(std::span{data})};
+		CHECK_EQ(aligned.read_per_constrained(10U, 17U), 15U);
+		CHECK_EQ(aligned.read_per_constrained(0U, 255U), 0x7FU);
+		CHECK_EQ(aligned.read_per_constrained(0U, 65535U), 0x1234U);
+		CHECK_EQ(aligned.read_per_constrained(7U, 7U), 7U);
+		CHECK_EQ(aligned.bit_offset(), 32zu);
+
+		bit_reader_t unaligned{std::as_bytes(std::span{data})};
+		CHECK_EQ(unaligned.read_per_constrained<per_variant_t::Unaligned>(10U, 17U), 15U);
+		CHECK_EQ(unaligned.read_per_constrained<per_variant_t::Unaligned>(0U, 255U), 0b0000'0011U);
+		CHECK_EQ(unaligned.bit_offset(), 11zu);
+
+		/* 5 in a range of 5 values is out of range, as is an empty range */
+		bit_reader_t bad{std::as_bytes(std::span{data})};
+		CHECK_EQ(bad.read_per_constrained(0U, 4U).error(), read_error_t::Malformed);
+		CHECK_EQ(bad.read_per_constrained(4U, 3U).error(), read_error_t::Malformed);
+	}
+
+	SUBCASE("Indefinite length constrained whole numbers") {
+		/* 0..2^24-1 needs up to 3 octets, so a 2 bit length of 1..3, then the aligned octets */
+		const std::array<std::uint8_t, 3> data{{0b0100'0000U, 0x01U, 0x02U}};
+		bit_reader_t rdr{std::as_bytes(std::span{data})};
+		CHECK_EQ(rdr.read_per_constrained(0U, 0xFF'FFFFU), 0x0102U);
+		CHECK(rdr.ok());
+	}
+
+	SUBCASE("Length determinants") {
+		const std::array<std::uint8_t, 6> data{{0x80U, 0x05U, 0x81U, 0x02U, 0xC2U, 0xC7U}};
+		bit_reader_t rdr{std::as_bytes(std::span{data})};
+		REQUIRE(rdr.skip(1zu));
+
+		/* The first is aligned up past the first bit */
+		const auto first{rdr.read_per_length()};
+		REQUIRE(first.has_value());
+		CHECK_EQ(first->length, 5zu);
+		CHECK_FALSE(first->fragment);
+
+		const auto second{rdr.read_per_length()};
+		REQUIRE(second.has_value());
+		CHECK_EQ(second->length, 0x102zu);
+
+		const auto fragment{rdr.read_per_length()};
+		REQUIRE(fragment.has_value());
+		CHECK_EQ(fragment->length, 32768zu);
+		CHECK(fragment->fragment);
+
+		CHECK_EQ(rdr.read_per_length().error(), read_error_t::Malformed);
+	}
+
+	SUBCASE("Normally small numbers") {
+		/* 0 000101, then 1 and a one octet length of 1 and 0xAB aligned up */
+		const std::array<std::uint8_t, 3> data{{0b0000'1011U, 0x01U, 0xABU}};
+		bit_reader_t rdr{std::as_bytes(std::span{data})};
+		CHECK_EQ(rdr.read_per_normally_small(), 5U);
+		CHECK_EQ(rdr.read_per_normally_small(), 0xABU);
+		CHECK_EQ(rdr.bits_remaining(), 0zu);
+	}
+}
@@ -8,9 +8,13 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <initializer_list>
 #include <memory>
+#include <optional>
 #include <ranges>
+#include <stdexcept>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <spdlog/spdlog.h>
@@ -33,6 +37,8 @@ int main(int argc, char** argv) {
 }
 
 using Panko::core::bytearray_t;
+using Panko::core::error_codes::strdec_error_t;
+using Panko::core::error_codes::decomp_error_t;
 
 TEST_CASE("bytearray_t - ") { }
 
@@ -247,456 +253,1790 @@ TEST_CASE("bytearray_t - slices") {
 	}
 
 	CHECK_EQ(e, 144);
+
+	/* Strings transcoded from a temporary slice are allocated from the arena of the buffer it was sliced from */
+	std::vector<std::uint8_t> text{ 0x00U, 0x48U, 0x00U, 0x69U, 0x00U, 0x21U, 0xC8U, 0x85U, };
+	bytearray_t text_buff{text};
+	const auto utf16{text_buff.slice(0zu, 5zu).string_utf16be(0zu, 6zu)};
+	const auto ebcdic{text_buff.slice(6zu, 7zu)[0zu, 1zu].string_ebcdic(0zu, 2zu)};
+	REQUIRE(utf16.has_value());
+	REQUIRE(ebcdic.has_value());
+	CHECK(*utf16 == std::u16string_view{u"Hi!"});
+	CHECK(*ebcdic == std::string_view{"He"});
+
+	/* And that arena is kept alive by the slices taken from it */
+	std::optional<bytearray_t> parent{std::in_place, text};
+	auto orphan{parent->slice(0zu, 5zu)};
+	parent.reset();
+	const auto orphaned{orphan.string_utf16be(0zu, 6zu)};
+	REQUIRE(orphaned.has_value());
+	CHECK(*orphaned == std::u16string_view{u"Hi!"});
 }
 
 TEST_CASE("bytearray_t - at<T, endian>(idx)") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{};
+	vec.resize(16zu);
+
+	std::generate(vec.begin(), vec.end(), [n = 0] () mutable { return n++; });
+
+	bytearray_t buff{vec};
+
+	CHECK_EQ((buff.at<std::uint8_t, std::endian::big>(0zu)), 0x00U);
+	CHECK_EQ((buff.at<std::uint16_t, std::endian::big>(1zu)), 0x0102U);
+	CHECK_EQ((buff.at<std::uint16_t, std::endian::little>(1zu)), 0x0201U);
+	CHECK_EQ((buff.at<std::uint32_t, std::endian::big>(4zu)), 0x04050607U);
+	CHECK_EQ((buff.at<std::uint64_t, std::endian::little>(8zu)), 0x0F0E0D0C0B0A0908U);
+	CHECK_EQ(std::uint32_t(buff.at<Panko::core::integers::uint24_t, std::endian::big>(13zu)), 0x0D0E0FU);
+
+	CHECK_THROWS_AS((void)(buff.at<std::uint32_t, std::endian::big>(13zu)), std::out_of_range);
+	CHECK_THROWS_AS((void)(buff.at<std::uint8_t, std::endian::big>(16zu)), std::out_of_range);
+	CHECK_THROWS_AS((void)(buff.at<std::uint8_t, std::endian::big>(~0zu)), std::out_of_range);
+
+	auto slice{buff.slice(8zu, 11zu)};
+	CHECK_EQ((slice.at<std::uint32_t, std::endian::big>(0zu)), 0x08090A0BU);
+	CHECK_THROWS_AS((void)(slice.at<std::uint16_t, std::endian::big>(3zu)), std::out_of_range);
 }
 
 TEST_CASE("bytearray_t - next<T, endian>") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{};
+	vec.resize(8zu);
+
+	std::generate(vec.begin(), vec.end(), [n = 0] () mutable { return n++; });
+
+	bytearray_t buff{vec};
+
+	CHECK_EQ((buff.next<std::uint16_t, std::endian::big>()), 0x0001U);
+	CHECK_EQ((buff.next<std::uint8_t, std::endian::big>()), 0x02U);
+	CHECK_EQ(std::uint32_t(buff.next<Panko::core::integers::uint24_t, std::endian::little>()), 0x050403U);
+	CHECK_THROWS_AS((void)(buff.next<std::uint32_t, std::endian::big>()), std::out_of_range);
+	CHECK_EQ((buff.next<std::uint16_t, std::endian::big>()), 0x0607U);
+	CHECK_THROWS_AS((void)(buff.next<std::uint8_t, std::endian::big>()), std::out_of_range);
 }
 
 TEST_CASE("bytearray_t - string_ascii") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x48U, 0x69U, 0x00U, 0xFFU, 0x0AU, };
+	bytearray_t buff{vec};
+
+	/* Every byte is valid, and the result is a view directly into the buffer */
+	const auto str{buff.string_ascii(0zu, 5zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == std::string_view{"Hi\x00\xFF\n", 5zu});
+	CHECK_EQ(static_cast<const void*>(str->data()), static_cast<const void*>(vec.data()));
+
+	CHECK(buff.string_ascii(5zu, 0zu).has_value());
+	CHECK_EQ(buff.string_ascii(3zu, 3zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x48U, 0xE9U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii_zp(0zu, 4zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "H\xE9");
 }
 
 TEST_CASE("bytearray_t - string_ascii_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x48U, 0x69U, 0x00U, 0x61U, 0x62U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	const auto limited{buff.string_ascii_zt(3zu, 2zu)};
+	REQUIRE(limited.has_value());
+	CHECK(*limited == "ab");
+
+	CHECK_EQ(buff.string_ascii_zt(3zu).error(), strdec_error_t::Overrun);
+
+	/* Long enough to go through the vectorized path */
+	std::vector<std::uint8_t> big(200zu, 0x61U);
+	big[150zu] = 0x00U;
+	bytearray_t big_buff{big};
+	const auto big_str{big_buff.string_ascii_zt(0zu)};
+	REQUIRE(big_str.has_value());
+	CHECK_EQ(big_str->size(), 150zu);
 }
 
 TEST_CASE("bytearray_t - string_ascii_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x48U, 0xE9U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "H\xE9");
 }
 
 TEST_CASE("bytearray_t - string_ascii_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x02U, 0x48U, 0xE9U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "H\xE9");
+
+	CHECK_EQ(buff.string_ascii_lp16(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x48U, 0xE9U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii_lp24(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "H\xE9");
+
+	CHECK_EQ(buff.string_ascii_lp24(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x02U, 0x48U, 0xE9U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii_lp32(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "H\xE9");
+
+	CHECK_EQ(buff.string_ascii_lp32(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x48U, 0xE9U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii_lp64(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "H\xE9");
+
+	CHECK_EQ(buff.string_ascii_lp64(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x48U, 0xE9U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "H\xE9");
 }
 
 TEST_CASE("bytearray_t - string_ascii7") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x48U, 0x69U, 0x00U, 0x7FU, 0x80U, 0x41U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7(0zu, 4zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == std::string_view{"Hi\x00\x7F", 4zu});
+	CHECK_EQ(static_cast<const void*>(str->data()), static_cast<const void*>(vec.data()));
+
+	/* Stops before the first byte out of range */
+	const auto prefix{buff.string_ascii7(0zu, 6zu)};
+	REQUIRE(prefix.has_value());
+	CHECK_EQ(prefix->size(), 4zu);
+
+	CHECK_EQ(buff.string_ascii7(4zu, 2zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(buff.string_ascii7(4zu, 3zu).error(), strdec_error_t::Overrun);
+
+	/* Long enough to go through the vectorized path */
+	std::vector<std::uint8_t> big(300zu, 0x61U);
+	big[257zu] = 0xC3U;
+	bytearray_t big_buff{big};
+	const auto big_str{big_buff.string_ascii7(0zu, big.size())};
+	REQUIRE(big_str.has_value());
+	CHECK_EQ(big_str->size(), 257zu);
 }
 
 TEST_CASE("bytearray_t - string_ascii7_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x48U, 0x69U, 0x00U, 0x80U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7_zp(0zu, 4zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
 }
 
 TEST_CASE("bytearray_t - string_ascii7_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x48U, 0x69U, 0x00U, 0x61U, 0xFFU, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	/* A byte out of range before the terminator ends the string */
+	const auto prefix{buff.string_ascii7_zt(3zu)};
+	REQUIRE(prefix.has_value());
+	CHECK(*prefix == "a");
 }
 
 TEST_CASE("bytearray_t - string_ascii7_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x48U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
 }
 
 TEST_CASE("bytearray_t - string_ascii7_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x02U, 0x48U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	CHECK_EQ(buff.string_ascii7_lp16(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii7_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x48U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7_lp24(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	CHECK_EQ(buff.string_ascii7_lp24(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii7_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x02U, 0x48U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7_lp32(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	CHECK_EQ(buff.string_ascii7_lp32(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii7_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x48U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7_lp64(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	CHECK_EQ(buff.string_ascii7_lp64(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ascii7_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x48U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ascii7_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
 }
 
 TEST_CASE("bytearray_t - string_ebcdic") {
-	/* TODO(aki): Implement & Test */
+	/* "Hello é" in CP037 */
+	std::vector<std::uint8_t> vec{ 0xC8U, 0x85U, 0x93U, 0x93U, 0x96U, 0x40U, 0x51U, 0x00U, 0x25U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic(0zu, 7zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hello \xE9");
+
+	/* Control characters and nulls are decoded too */
+	const auto ctrl{buff.string_ebcdic(6zu, 3zu)};
+	REQUIRE(ctrl.has_value());
+	CHECK(*ctrl == std::string_view{"\xE9\x00\x0A", 3zu});
+
+	CHECK_EQ(buff.string_ebcdic(6zu, 4zu).error(), strdec_error_t::Overrun);
+
+	/* Long enough to go through the vectorized path, covering every byte value */
+	std::vector<std::uint8_t> every(300zu);
+	for (std::size_t idx{}; idx < every.size(); ++idx) {
+		every[idx] = static_cast<std::uint8_t>(idx);
+	}
+	bytearray_t every_buff{every};
+	const auto every_str{every_buff.string_ebcdic(0zu, every.size())};
+	REQUIRE(every_str.has_value());
+	CHECK_EQ(every_str->size(), every.size());
+	CHECK_EQ(static_cast<std::uint8_t>((*every_str)[0xC1U]), 0x41U);
+	CHECK_EQ(static_cast<std::uint8_t>((*every_str)[0xF0U]), 0x30U);
+	CHECK_EQ(static_cast<std::uint8_t>((*every_str)[0x5AU]), 0x21U);
+	CHECK_EQ(static_cast<std::uint8_t>((*every_str)[0xFFU]), 0x9FU);
+	for (std::size_t idx{256zu}; idx < every.size(); ++idx) {
+		CHECK_EQ((*every_str)[idx], (*every_str)[idx - 256zu]);
+	}
 }
 
 TEST_CASE("bytearray_t - string_ebcdic_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0xC8U, 0x89U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic_zp(0zu, 4zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
 }
 
 TEST_CASE("bytearray_t - string_ebcdic_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0xC8U, 0x89U, 0x00U, 0x81U, 0x82U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	const auto limited{buff.string_ebcdic_zt(3zu, 2zu)};
+	REQUIRE(limited.has_value());
+	CHECK(*limited == "ab");
+
+	CHECK_EQ(buff.string_ebcdic_zt(3zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ebcdic_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0xC8U, 0x89U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
 }
 
 TEST_CASE("bytearray_t - string_ebcdic_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x02U, 0xC8U, 0x89U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	CHECK_EQ(buff.string_ebcdic_lp16(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ebcdic_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0xC8U, 0x89U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic_lp24(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	CHECK_EQ(buff.string_ebcdic_lp24(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ebcdic_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x02U, 0xC8U, 0x89U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic_lp32(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	CHECK_EQ(buff.string_ebcdic_lp32(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ebcdic_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xC8U, 0x89U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic_lp64(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
+
+	CHECK_EQ(buff.string_ebcdic_lp64(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_ebcdic_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0xC8U, 0x89U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_ebcdic_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == "Hi");
 }
 
 TEST_CASE("bytearray_t - string_utf8") {
-	/* TODO(aki): Implement & Test */
+	/* "héllo €" followed by a lone continuation byte */
+	std::vector<std::uint8_t> vec{
+		0x68U, 0xC3U, 0xA9U, 0x6CU, 0x6CU, 0x6FU, 0x20U, 0xE2U, 0x82U, 0xACU, 0x80U, 0x41U,
+	};
+	bytearray_t buff{vec};
+
+	const auto full{buff.string_utf8(0zu, 10zu)};
+	REQUIRE(full.has_value());
+	CHECK(*full == u8"h\u00E9llo \u20AC");
+	CHECK_EQ(static_cast<const void*>(full->data()), static_cast<const void*>(vec.data()));
+
+	/* Stops before the invalid continuation byte */
+	const auto prefix{buff.string_utf8(0zu, 12zu)};
+	REQUIRE(prefix.has_value());
+	CHECK_EQ(prefix->size(), 10zu);
+
+	/* Stops before a code point cut off by the length */
+	const auto cut{buff.string_utf8(0zu, 9zu)};
+	REQUIRE(cut.has_value());
+	CHECK_EQ(cut->size(), 7zu);
+
+	CHECK_EQ(buff.string_utf8(10zu, 2zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(buff.string_utf8(8zu, 8zu).error(), strdec_error_t::Overrun);
+	CHECK_EQ(buff.string_utf8(13zu, 0zu).error(), strdec_error_t::Overrun);
+	CHECK(buff.string_utf8(12zu, 0zu).has_value());
+
+	/* Overlong encodings and surrogates are not valid */
+	std::vector<std::uint8_t> bad{ 0xC0U, 0xAFU, 0xEDU, 0xA0U, 0x80U, 0xF4U, 0x90U, 0x80U, 0x80U, };
+	bytearray_t bad_buff{bad};
+	CHECK_EQ(bad_buff.string_utf8(0zu, 2zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(bad_buff.string_utf8(2zu, 3zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(bad_buff.string_utf8(5zu, 4zu).error(), strdec_error_t::Invalid);
+
+	/* Long enough to go through the vectorized path */
+	std::vector<std::uint8_t> big{};
+	for (std::size_t idx{}; idx < 100zu; ++idx) {
+		big.insert(big.end(), { 0xF0U, 0x9FU, 0x90U, 0x9FU, 0x61U });
+	}
+	big[403zu] = 0x41U;
+	bytearray_t big_buff{big};
+	const auto big_str{big_buff.string_utf8(0zu, big.size())};
+	REQUIRE(big_str.has_value());
+	CHECK_EQ(big_str->size(), 400zu);
 }
 
 TEST_CASE("bytearray_t - string_utf8_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x68U, 0xC3U, 0xA9U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf8_zp(0zu, 8zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u8"h\u00E9");
+
+	const auto empty{buff.string_utf8_zp(3zu, 5zu)};
+	REQUIRE(empty.has_value());
+	CHECK(empty->empty());
+
+	CHECK_EQ(buff.string_utf8_zp(0zu, 9zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf8_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x68U, 0xC3U, 0xA9U, 0x00U, 0x61U, 0x62U, 0x63U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf8_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u8"h\u00E9");
+
+	const auto limited{buff.string_utf8_zt(4zu, 2zu)};
+	REQUIRE(limited.has_value());
+	CHECK(*limited == u8"ab");
+
+	CHECK_EQ(buff.string_utf8_zt(4zu).error(), strdec_error_t::Overrun);
+	CHECK_EQ(buff.string_utf8_zt(4zu, 8zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf8_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x03U, 0x68U, 0xC3U, 0xA9U, 0x05U, 0x61U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf8_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u8"h\u00E9");
+
+	CHECK_EQ(buff.string_utf8_lp8(4zu).error(), strdec_error_t::Overrun);
+	CHECK_EQ(buff.string_utf8_lp8(6zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf8_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x02U, 0x68U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf8_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u8"hi");
+
+	CHECK_EQ(buff.string_utf8_lp16(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf8_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x68U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf8_lp24(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u8"hi");
+
+	CHECK_EQ(buff.string_utf8_lp24(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf8_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x02U, 0x68U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf8_lp32(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u8"hi");
+
+	CHECK_EQ(buff.string_utf8_lp32(0zu, std::endian::little).error(), strdec_error_t::Overrun);
+	CHECK_EQ(buff.string_utf8_lp32(3zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf8_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x68U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf8_lp64(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u8"hi");
+
+	CHECK_EQ(buff.string_utf8_lp64(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf8_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{};
+	vec.resize(130zu, 0x61U);
+	vec[0] = 0x80U;
+	vec[1] = 0x01U;
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf8_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK_EQ(str->size(), 128zu);
+
+	std::vector<std::uint8_t> overlong{ 0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x00U, };
+	bytearray_t overlong_buff{overlong};
+	CHECK_EQ(overlong_buff.string_utf8_leb128(0zu).error(), strdec_error_t::Malformed);
+
+	std::vector<std::uint8_t> truncated{ 0x80U, 0x80U, };
+	bytearray_t truncated_buff{truncated};
+	CHECK_EQ(truncated_buff.string_utf8_leb128(0zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{
+		0xFFU, 0xFEU, 0x68U, 0x00U, 0xE9U, 0x00U,
+		0xFEU, 0xFFU, 0x00U, 0x68U, 0x00U, 0xE9U,
+		0x68U, 0x00U, 0xE9U, 0x00U,
+	};
+	bytearray_t buff{vec};
+
+	const auto le{buff.string_utf16_bom(0zu, 6zu)};
+	REQUIRE(le.has_value());
+	CHECK(*le == u"h\u00E9");
+
+	const auto be{buff.string_utf16_bom(6zu, 6zu)};
+	REQUIRE(be.has_value());
+	CHECK(*be == u"h\u00E9");
+
+	/* The byte-order-mark is required */
+	CHECK_EQ(buff.string_utf16_bom(12zu, 4zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(buff.string_utf16_bom(12zu, 6zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0xFEU, 0xFFU, 0x00U, 0x68U, 0x00U, 0x69U, 0x00U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16_bom_zp(0zu, 10zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0xFFU, 0xFEU, 0x68U, 0x00U, 0x69U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16_bom_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x03U, 0xFEU, 0xFFU, 0x00U, 0x68U, 0x00U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16_bom_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x02U, 0xFFU, 0xFEU, 0x68U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16_bom_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"h");
+
+	CHECK_EQ(buff.string_utf16_bom_lp16(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0xFFU, 0xFEU, 0x68U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16_bom_lp24(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"h");
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x02U, 0xFFU, 0xFEU, 0x68U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16_bom_lp32(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"h");
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFEU, 0x68U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16_bom_lp64(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"h");
 }
 
 TEST_CASE("bytearray_t - string_utf16_bom_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0xFEU, 0xFFU, 0x00U, 0x68U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16_bom_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"h");
 }
 
 TEST_CASE("bytearray_t - string_utf16le") {
-	/* TODO(aki): Implement & Test */
+	/* "hé" followed by U+1F41F as a surrogate pair, then an unpaired low surrogate */
+	std::vector<std::uint8_t> vec{
+		0x00U, 0x68U, 0x00U, 0xE9U, 0x00U, 0x3DU, 0xD8U, 0x1FU, 0xDCU, 0x1FU, 0xDCU, 0x41U, 0x00U,
+	};
+	bytearray_t buff{vec};
+
+	const auto full{buff.string_utf16le(1zu, 8zu)};
+	REQUIRE(full.has_value());
+	CHECK(*full == u"h\u00E9\U0001F41F");
+
+	/* Stops before the unpaired low surrogate */
+	const auto prefix{buff.string_utf16le(1zu, 12zu)};
+	REQUIRE(prefix.has_value());
+	CHECK_EQ(prefix->size(), 4zu);
+
+	/* Stops before a surrogate pair cut off by the length */
+	const auto cut{buff.string_utf16le(1zu, 6zu)};
+	REQUIRE(cut.has_value());
+	CHECK_EQ(cut->size(), 2zu);
+
+	CHECK_EQ(buff.string_utf16le(9zu, 4zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(buff.string_utf16le(9zu, 6zu).error(), strdec_error_t::Overrun);
+
+	/* Aligned native endian strings are not copied, everything else is */
+	if constexpr (std::endian::native == std::endian::little) {
+		const auto aligned{buff.string_utf16le(2zu, 4zu)};
+		REQUIRE(aligned.has_value());
+		CHECK_EQ(static_cast<const void*>(aligned->data()), static_cast<const void*>(vec.data() + 2zu));
+	}
+	CHECK(static_cast<const void*>(full->data()) != static_cast<const void*>(vec.data() + 1zu));
 }
 
 TEST_CASE("bytearray_t - string_utf16le_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x68U, 0x00U, 0x69U, 0x00U, 0x00U, 0x00U, 0x6AU, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16le_zp(0zu, 8zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
+
+	/* A null byte that is only half of a code unit does not end the string */
+	std::vector<std::uint8_t> half{ 0x00U, 0x01U, 0x68U, 0x00U, };
+	bytearray_t half_buff{half};
+	const auto half_str{half_buff.string_utf16le_zp(0zu, 4zu)};
+	REQUIRE(half_str.has_value());
+	CHECK(*half_str == u"\u0100h");
+
+	CHECK_EQ(buff.string_utf16le_zp(0zu, 10zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf16le_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x68U, 0x00U, 0x69U, 0x00U, 0x00U, 0x00U, 0x61U, 0x00U, 0x62U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16le_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
+
+	const auto limited{buff.string_utf16le_zt(6zu, 1zu)};
+	REQUIRE(limited.has_value());
+	CHECK(*limited == u"a");
+
+	CHECK_EQ(buff.string_utf16le_zt(6zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf16le_lp8") {
-	/* TODO(aki): Implement & Test */
+	/* The length is in code units, not bytes */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x68U, 0x00U, 0x69U, 0x00U, 0x03U, 0x61U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16le_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
+
+	CHECK_EQ(buff.string_utf16le_lp8(5zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf16le_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x02U, 0x68U, 0x00U, 0x69U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16le_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
+
+	CHECK_EQ(buff.string_utf16le_lp16(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf16le_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x68U, 0x00U, 0x69U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16le_lp24(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16le_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x02U, 0x68U, 0x00U, 0x69U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16le_lp32(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16le_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x68U, 0x00U, 0x69U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16le_lp64(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16le_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{};
+	vec.resize(258zu, 0x00U);
+	vec[0] = 0x80U;
+	vec[1] = 0x01U;
+	for (std::size_t idx{2zu}; idx < vec.size(); idx += 2zu) {
+		vec[idx] = 0x61U;
+	}
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16le_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK_EQ(str->size(), 128zu);
 }
 
 TEST_CASE("bytearray_t - string_utf16be") {
-	/* TODO(aki): Implement & Test */
+	/* Long enough to go through the vectorized path, with an unpaired high surrogate at the end */
+	std::vector<std::uint8_t> vec{};
+	for (std::size_t idx{}; idx < 40zu; ++idx) {
+		vec.insert(vec.end(), { 0xD8U, 0x3DU, 0xDCU, 0x1FU, 0x00U, 0x61U });
+	}
+	vec.insert(vec.end(), { 0xD8U, 0x3DU, 0x00U, 0x61U });
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be(0zu, vec.size())};
+	REQUIRE(str.has_value());
+	CHECK_EQ(str->size(), 120zu);
+	CHECK(str->substr(0zu, 3zu) == u"\U0001F41Fa");
+
+	/* A trailing odd byte is not part of any code unit */
+	const auto odd{buff.string_utf16be(0zu, 7zu)};
+	REQUIRE(odd.has_value());
+	CHECK_EQ(odd->size(), 3zu);
+
+	CHECK_EQ(buff.string_utf16be(2zu, 2zu).error(), strdec_error_t::Invalid);
 }
 
 TEST_CASE("bytearray_t - string_utf16be_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x68U, 0x00U, 0x69U, 0x00U, 0x00U, 0x00U, 0x6AU, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be_zp(0zu, 8zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16be_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x68U, 0x00U, 0x69U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
+
+	CHECK_EQ(buff.string_utf16be_zt(0zu, 4zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf16be_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x68U, 0x00U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16be_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x02U, 0x00U, 0x68U, 0x00U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16be_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x02U, 0x00U, 0x68U, 0x00U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be_lp24(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16be_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x68U, 0x00U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be_lp32(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16be_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x00U, 0x68U, 0x00U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be_lp64(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
 }
 
 TEST_CASE("bytearray_t - string_utf16be_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x68U, 0x00U, 0x69U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf16be_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == u"hi");
+
+	std::vector<std::uint8_t> overlong{ 0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x00U, };
+	bytearray_t overlong_buff{overlong};
+	CHECK_EQ(overlong_buff.string_utf16be_leb128(0zu).error(), strdec_error_t::Malformed);
 }
 
-TEST_CASE("bytearray_t - string_utf16_bom") {
-	/* TODO(aki): Implement & Test */
+TEST_CASE("bytearray_t - string_utf32_bom") {
+	std::vector<std::uint8_t> vec{
+		0xFFU, 0xFEU, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U,
+		0x00U, 0x00U, 0xFEU, 0xFFU, 0x00U, 0x01U, 0xF4U, 0x1FU,
+	};
+	bytearray_t buff{vec};
+
+	const auto le{buff.string_utf32_bom(0zu, 8zu)};
+	REQUIRE(le.has_value());
+	CHECK(*le == U"h");
+
+	const auto be{buff.string_utf32_bom(8zu, 8zu)};
+	REQUIRE(be.has_value());
+	CHECK(*be == U"\U0001F41F");
+
+	CHECK_EQ(buff.string_utf32_bom(4zu, 4zu).error(), strdec_error_t::Invalid);
 }
 
 TEST_CASE("bytearray_t - string_utf32_bom_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0xFFU, 0xFEU, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32_bom_zp(0zu, 12zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32_bom_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0xFEU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32_bom_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32_bom_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0xFFU, 0xFEU, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32_bom_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32_bom_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0xFFU, 0xFEU, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32_bom_lp16(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32_bom_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x02U, 0xFFU, 0xFEU, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32_bom_lp24(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32_bom_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFEU, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32_bom_lp32(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32_bom_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{
+		0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0xFFU, 0xFEU, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U,
+	};
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32_bom_lp64(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32_bom_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0xFFU, 0xFEU, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32_bom_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32le") {
-	/* TODO(aki): Implement & Test */
+	/* "h", U+1F41F, then a surrogate and a code point above U+10FFFF */
+	std::vector<std::uint8_t> vec{
+		0x68U, 0x00U, 0x00U, 0x00U, 0x1FU, 0xF4U, 0x01U, 0x00U,
+		0x00U, 0xD8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x00U,
+	};
+	bytearray_t buff{vec};
+
+	const auto full{buff.string_utf32le(0zu, 16zu)};
+	REQUIRE(full.has_value());
+	CHECK(*full == U"h\U0001F41F");
+	if constexpr (std::endian::native == std::endian::little) {
+		CHECK_EQ(static_cast<const void*>(full->data()), static_cast<const void*>(vec.data()));
+	}
+
+	CHECK_EQ(buff.string_utf32le(8zu, 4zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(buff.string_utf32le(12zu, 4zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(buff.string_utf32le(12zu, 8zu).error(), strdec_error_t::Overrun);
+
+	/* Long enough to go through the vectorized path */
+	std::vector<std::uint8_t> big{};
+	for (std::size_t idx{}; idx < 50zu; ++idx) {
+		big.insert(big.end(), { 0x61U, 0x00U, 0x00U, 0x00U });
+	}
+	big[(37zu * 4zu) + 2zu] = 0x11U;
+	bytearray_t big_buff{big};
+	const auto big_str{big_buff.string_utf32le(0zu, big.size())};
+	REQUIRE(big_str.has_value());
+	CHECK_EQ(big_str->size(), 37zu);
 }
 
 TEST_CASE("bytearray_t - string_utf32le_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x68U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x69U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32le_zp(0zu, 12zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32le_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x68U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x69U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32le_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
+
+	const auto limited{buff.string_utf32le_zt(8zu, 1zu)};
+	REQUIRE(limited.has_value());
+	CHECK(*limited == U"i");
+
+	CHECK_EQ(buff.string_utf32le_zt(8zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf32le_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x01U, 0x68U, 0x00U, 0x00U, 0x00U, 0x02U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32le_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
+
+	CHECK_EQ(buff.string_utf32le_lp8(5zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_utf32le_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x01U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32le_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32le_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x01U, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32le_lp24(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32le_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x01U, 0x00U, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32le_lp32(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32le_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32le_lp64(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32le_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x01U, 0x68U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32le_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32be") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x68U, 0x00U, 0x01U, 0xF4U, 0x1FU, 0x00U, 0x00U, 0xDFU, 0xFFU, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be(0zu, 12zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h\U0001F41F");
+
+	CHECK_EQ(buff.string_utf32be(8zu, 4zu).error(), strdec_error_t::Invalid);
 }
 
 TEST_CASE("bytearray_t - string_utf32be_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be_zp(0zu, 8zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32be_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x68U, 0x00U, 0x00U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32be_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x01U, 0x00U, 0x00U, 0x00U, 0x68U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32be_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x68U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32be_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x68U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be_lp24(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32be_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x68U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be_lp32(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32be_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x68U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be_lp64(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_utf32be_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x01U, 0x00U, 0x00U, 0x00U, 0x68U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_utf32be_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == U"h");
 }
 
 TEST_CASE("bytearray_t - string_shiftjis") {
-	/* TODO(aki): Implement & Test */
+	/* "Aテｱ漢" followed by an invalid lead byte */
+	std::vector<std::uint8_t> vec{ 0x41U, 0x83U, 0x65U, 0xB1U, 0x8AU, 0xBFU, 0x80U, 0x41U, };
+	bytearray_t buff{vec};
+
+	const auto full{buff.string_shiftjis(0zu, 6zu)};
+	REQUIRE(full.has_value());
+	CHECK(*full == L"A\u30C6\uFF71\u6F22");
+
+	/* Stops before the invalid lead byte */
+	const auto prefix{buff.string_shiftjis(0zu, 8zu)};
+	REQUIRE(prefix.has_value());
+	CHECK_EQ(prefix->size(), 4zu);
+
+	/* Stops before a double byte character cut off by the length */
+	const auto cut{buff.string_shiftjis(0zu, 5zu)};
+	REQUIRE(cut.has_value());
+	CHECK_EQ(cut->size(), 3zu);
+
+	CHECK_EQ(buff.string_shiftjis(6zu, 2zu).error(), strdec_error_t::Invalid);
+	CHECK_EQ(buff.string_shiftjis(6zu, 3zu).error(), strdec_error_t::Overrun);
+
+	/* An unmapped double byte character is not valid */
+	std::vector<std::uint8_t> unmapped{ 0x85U, 0x40U, };
+	bytearray_t unmapped_buff{unmapped};
+	CHECK_EQ(unmapped_buff.string_shiftjis(0zu, 2zu).error(), strdec_error_t::Invalid);
+
+	/* Long runs of ASCII go through the vectorized path */
+	std::vector<std::uint8_t> big(100zu, 0x61U);
+	big.insert(big.end(), { 0x83U, 0x65U, });
+	big.insert(big.end(), 50zu, 0x62U);
+	bytearray_t big_buff{big};
+	const auto big_str{big_buff.string_shiftjis(0zu, big.size())};
+	REQUIRE(big_str.has_value());
+	CHECK_EQ(big_str->size(), 151zu);
+	CHECK_EQ((*big_str)[99zu], L'a');
+	CHECK_EQ((*big_str)[100zu], L'\u30C6');
+	CHECK_EQ((*big_str)[150zu], L'b');
 }
 
 TEST_CASE("bytearray_t - string_shiftjis_zp") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x83U, 0x65U, 0x00U, 0x00U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_shiftjis_zp(0zu, 4zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == L"\u30C6");
 }
 
 TEST_CASE("bytearray_t - string_shiftjis_zt") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x83U, 0x65U, 0x00U, 0x41U, 0x42U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_shiftjis_zt(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == L"\u30C6");
+
+	const auto limited{buff.string_shiftjis_zt(3zu, 2zu)};
+	REQUIRE(limited.has_value());
+	CHECK(*limited == L"AB");
+
+	CHECK_EQ(buff.string_shiftjis_zt(3zu).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_shiftjis_lp8") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x83U, 0x65U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_shiftjis_lp8(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == L"\u30C6");
 }
 
 TEST_CASE("bytearray_t - string_shiftjis_lp16") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x02U, 0x83U, 0x65U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_shiftjis_lp16(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == L"\u30C6");
+
+	CHECK_EQ(buff.string_shiftjis_lp16(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_shiftjis_lp24") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x83U, 0x65U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_shiftjis_lp24(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == L"\u30C6");
+
+	CHECK_EQ(buff.string_shiftjis_lp24(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_shiftjis_lp32") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x02U, 0x83U, 0x65U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_shiftjis_lp32(0zu, std::endian::big)};
+	REQUIRE(str.has_value());
+	CHECK(*str == L"\u30C6");
+
+	CHECK_EQ(buff.string_shiftjis_lp32(0zu, std::endian::little).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_shiftjis_lp64") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x83U, 0x65U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_shiftjis_lp64(0zu, std::endian::little)};
+	REQUIRE(str.has_value());
+	CHECK(*str == L"\u30C6");
+
+	CHECK_EQ(buff.string_shiftjis_lp64(0zu, std::endian::big).error(), strdec_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - string_shiftjis_leb128") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{ 0x02U, 0x83U, 0x65U, };
+	bytearray_t buff{vec};
+
+	const auto str{buff.string_shiftjis_leb128(0zu)};
+	REQUIRE(str.has_value());
+	CHECK(*str == L"\u30C6");
+}
+
+/* The plain text all of the decompression tests compress */
+constexpr std::string_view decomp_plain{"Hello, Panko! Hello, Panko! Hello, Panko! Hello, Panko! "};
+
+[[nodiscard]]
+static std::string_view as_text(const bytearray_t& buff) {
+	return {reinterpret_cast<const char*>(buff.data()), buff.length()};
+}
+
+/* Build an LZ77+Huffman block from the non-zero bytes of its code length table and its bit stream */
+[[nodiscard]]
+static std::vector<std::uint8_t> xpress_block(
+	const std::initializer_list<std::pair<std::size_t, std::uint8_t>> lengths, const std::initializer_list<std::uint8_t> stream
+) {
+	std::vector<std::uint8_t> block(256zu, 0x00U);
+	for (const auto& [idx, len] : lengths) {
+		block[idx] = len;
+	}
+	block.insert(block.end(), stream);
+	return block;
 }
 
 #if defined(PANKO_WITH_BROTLI)
 TEST_CASE("bytearray_t - decompress_brotli") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{
+		0x1BU, 0x37U, 0x00U, 0xF8U, 0x9DU, 0x09U, 0x76U, 0xACU, 0x95U, 0x29U, 0x35U, 0xEDU, 0xB4U, 0x04U, 0x41U, 0x82U,
+		0xAAU, 0xB0U, 0xB2U, 0x5EU, 0x63U, 0x73U, 0x7BU, 0x53U, 0x21U, 0x2CU, 0xE1U, 0x54U, 0x3CU, 0x00U, 0x55U, 0x6FU,
+		0x31U,
+	};
+	bytearray_t buff{vec};
+
+	for (auto round{0}; round < 2; ++round) {
+		const auto res{buff.decompress_brotli(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	CHECK_EQ(buff.decompress_brotli(0zu, buff.length() - 4zu).error(), decomp_error_t::Truncated);
+	CHECK_EQ(buff.decompress_brotli(1zu, buff.length()).error(), decomp_error_t::Overrun);
+
+	/* Thousands of tiny metablocks of "abcdefgh", each with Huffman tables that are allocated and freed again */
+	std::vector<std::uint8_t> many{
+		0x21U, 0x3CU, 0x00U, 0x00U, 0x20U, 0x0EU, 0x38U, 0x06U, 0xC4U, 0xF5U, 0xE1U, 0x4BU, 0x38U, 0x40U, 0x39U, 0xDDU,
+		0x0DU,
+	};
+	constexpr std::array<std::uint8_t, 10> metablock{{
+		0x78U, 0x00U, 0x00U, 0x40U, 0x02U, 0x20U, 0x84U, 0x08U, 0x40U, 0x03U,
+	}};
+	constexpr std::size_t metablocks{20000zu};
+	for (std::size_t idx{}; idx < metablocks; ++idx) {
+		many.insert(many.end(), metablock.begin(), metablock.end());
+	}
+	many.push_back(0x03U);
+	bytearray_t many_buff{many};
+
+	const auto res{many_buff.decompress_brotli(0zu, many_buff.length())};
+	REQUIRE(res.has_value());
+	REQUIRE_EQ(res->length(), 16zu * (metablocks + 1zu));
+	std::size_t mismatched{};
+	std::size_t offset{};
+	for (const auto b : *res) {
+		if (b != static_cast<std::byte>('a' + (offset++ % 8zu))) {
+			++mismatched;
+		}
+	}
+	CHECK_EQ(mismatched, 0zu);
 }
 #endif /* PANKO_WITH_BROTLI */
 
 TEST_CASE("bytearray_t - decompress_bz2") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{
+		0x42U, 0x5AU, 0x68U, 0x39U, 0x31U, 0x41U, 0x59U, 0x26U, 0x53U, 0x59U, 0xE2U, 0x66U, 0x89U, 0x2CU, 0x00U, 0x00U,
+		0x09U, 0x97U, 0x00U, 0x60U, 0x04U, 0x00U, 0x40U, 0x40U, 0x00U, 0x22U, 0x0DU, 0xA0U, 0x00U, 0x31U, 0x00U, 0xD3U,
+		0x4DU, 0x01U, 0x55U, 0x03U, 0x41U, 0xEAU, 0x5CU, 0xC1U, 0x06U, 0x45U, 0x14U, 0x43U, 0xA4U, 0x3CU, 0x43U, 0x07U,
+		0xC5U, 0xDCU, 0x91U, 0x4EU, 0x14U, 0x24U, 0x38U, 0x99U, 0xA2U, 0x4BU, 0x00U,
+	};
+	bytearray_t buff{vec};
+
+	for (auto round{0}; round < 2; ++round) {
+		const auto res{buff.decompress_bz2(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	CHECK_EQ(buff.decompress_bz2(0zu, buff.length() - 8zu).error(), decomp_error_t::Truncated);
+	CHECK_EQ(buff.decompress_bz2(1zu, buff.length() - 1zu).error(), decomp_error_t::Invalid);
+	CHECK_EQ(buff.decompress_bz2(1zu, buff.length()).error(), decomp_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - decompress_deflate") {
-	/* TODO(aki): Implement & Test */
+	SUBCASE("zlib") {
+		std::vector<std::uint8_t> vec{
+			0x78U, 0xDAU, 0xF3U, 0x48U, 0xCDU, 0xC9U, 0xC9U, 0xD7U, 0x51U, 0x08U, 0x48U, 0xCCU, 0xCBU, 0xCEU, 0x57U, 0x54U,
+			0xF0U, 0x20U, 0x9AU, 0x07U, 0x00U, 0x06U, 0xD6U, 0x11U, 0xE9U,
+		};
+		bytearray_t buff{vec};
+
+		for (auto round{0}; round < 2; ++round) {
+			const auto res{buff.decompress_deflate(0zu, buff.length())};
+			REQUIRE(res.has_value());
+			CHECK(as_text(*res) == decomp_plain);
+		}
+
+		CHECK_EQ(buff.decompress_deflate(0zu, 10zu).error(), decomp_error_t::Truncated);
+		CHECK_EQ(buff.decompress_deflate(1zu, buff.length()).error(), decomp_error_t::Overrun);
+	}
+
+	SUBCASE("raw") {
+		std::vector<std::uint8_t> vec{
+			0xF3U, 0x48U, 0xCDU, 0xC9U, 0xC9U, 0xD7U, 0x51U, 0x08U, 0x48U, 0xCCU, 0xCBU, 0xCEU, 0x57U, 0x54U, 0xF0U, 0x20U,
+			0x9AU, 0x07U, 0x00U,
+		};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_deflate(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	SUBCASE("gzip") {
+		std::vector<std::uint8_t> vec{
+			0x1FU, 0x8BU, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x03U, 0xF3U, 0x48U, 0xCDU, 0xC9U, 0xC9U, 0xD7U,
+			0x51U, 0x08U, 0x48U, 0xCCU, 0xCBU, 0xCEU, 0x57U, 0x54U, 0xF0U, 0x20U, 0x9AU, 0x07U, 0x00U, 0xCBU, 0x40U, 0xD7U,
+			0x96U, 0x38U, 0x00U, 0x00U, 0x00U,
+		};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_deflate(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+
+		/* A bad CRC in the trailer */
+		vec[29] ^= 0xFFU;
+		CHECK_EQ(buff.decompress_deflate(0zu, buff.length()).error(), decomp_error_t::Invalid);
+	}
+
+	SUBCASE("output growth") {
+		/* 64KiB of 'A' */
+		std::vector<std::uint8_t> vec{
+			0x78U, 0xDAU, 0xEDU, 0xC1U, 0x81U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x20U, 0xB6U, 0xFDU, 0xA5U, 0x16U, 0xA9U,
+			0x0AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+			0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+			0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+			0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+			0x6AU, 0x1EU, 0x87U, 0x03U, 0xD0U,
+		};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_deflate(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		REQUIRE(res->length() == 65536zu);
+		CHECK(std::ranges::all_of(*res, [](const std::byte b) { return b == std::byte{'A'}; }));
+	}
 }
 
 TEST_CASE("bytearray_t - decompress_lz4") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{
+		0x04U, 0x22U, 0x4DU, 0x18U, 0x60U, 0x40U, 0x82U, 0x18U, 0x00U, 0x00U, 0x00U, 0xEFU, 0x48U, 0x65U, 0x6CU, 0x6CU,
+		0x6FU, 0x2CU, 0x20U, 0x50U, 0x61U, 0x6EU, 0x6BU, 0x6FU, 0x21U, 0x20U, 0x0EU, 0x00U, 0x12U, 0x50U, 0x6EU, 0x6BU,
+		0x6FU, 0x21U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U,
+	};
+	bytearray_t buff{vec};
+
+	for (auto round{0}; round < 2; ++round) {
+		const auto res{buff.decompress_lz4(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	CHECK_EQ(buff.decompress_lz4(0zu, buff.length() - 4zu).error(), decomp_error_t::Truncated);
+	CHECK_EQ(buff.decompress_lz4(1zu, buff.length() - 1zu).error(), decomp_error_t::Invalid);
+	CHECK_EQ(buff.decompress_lz4(1zu, buff.length()).error(), decomp_error_t::Overrun);
+
+	/* A frame claiming 200MiB of content for a 2 byte block is turned away once it comes up short */
+	std::vector<std::uint8_t> liar{
+		0x04U, 0x22U, 0x4DU, 0x18U, 0x68U, 0x40U, 0x00U, 0x00U, 0x80U, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0xADU, 0x02U,
+		0x00U, 0x00U, 0x80U, 0x48U, 0x69U, 0x00U, 0x00U, 0x00U, 0x00U,
+	};
+	bytearray_t liar_buff{liar};
+	CHECK_EQ(liar_buff.decompress_lz4(0zu, liar_buff.length()).error(), decomp_error_t::Invalid);
 }
 
 TEST_CASE("bytearray_t - decompress_lz77") {
-	/* TODO(aki): Implement & Test */
+	SUBCASE("literals") {
+		/* [MS-XCA] 2.4.4 example */
+		std::vector<std::uint8_t> vec{
+			0x3FU, 0x00U, 0x00U, 0x00U, 0x61U, 0x62U, 0x63U, 0x64U, 0x65U, 0x66U, 0x67U, 0x68U, 0x69U, 0x6AU, 0x6BU, 0x6CU,
+			0x6DU, 0x6EU, 0x6FU, 0x70U, 0x71U, 0x72U, 0x73U, 0x74U, 0x75U, 0x76U, 0x77U, 0x78U, 0x79U, 0x7AU,
+		};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_lz77(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == "abcdefghijklmnopqrstuvwxyz");
+	}
+
+	SUBCASE("matches") {
+		/* [MS-XCA] 2.4.4 example, "abc" repeated 100 times */
+		std::vector<std::uint8_t> vec{
+			0xFFU, 0xFFU, 0xFFU, 0x1FU, 0x61U, 0x62U, 0x63U, 0x17U, 0x00U, 0x0FU, 0xFFU, 0x26U, 0x01U,
+		};
+		bytearray_t buff{vec};
+
+		for (auto round{0}; round < 2; ++round) {
+			const auto res{buff.decompress_lz77(0zu, buff.length())};
+			REQUIRE(res.has_value());
+			REQUIRE(res->length() == 300zu);
+			for (std::size_t idx{}; idx < res->length(); ++idx) {
+				CHECK(as_text(*res)[idx] == "abc"[idx % 3zu]);
+			}
+		}
+
+		CHECK_EQ(buff.decompress_lz77(0zu, buff.length() - 1zu).error(), decomp_error_t::Truncated);
+		CHECK_EQ(buff.decompress_lz77(1zu, buff.length()).error(), decomp_error_t::Overrun);
+	}
+
+	SUBCASE("shared length nibbles") {
+		std::vector<std::uint8_t> vec{
+			0xFFU, 0xFFU, 0x03U, 0x00U, 0x48U, 0x65U, 0x6CU, 0x6CU, 0x6FU, 0x2CU, 0x20U, 0x50U, 0x61U, 0x6EU, 0x6BU, 0x6FU,
+			0x21U, 0x20U, 0x6FU, 0x00U, 0x0FU, 0x11U,
+		};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_lz77(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	SUBCASE("long match") {
+		/* "xxxxx" followed by 300000 'y', which needs a 32-bit match length */
+		std::vector<std::uint8_t> vec{
+			0xFFU, 0xFFU, 0xFFU, 0x5FU, 0x78U, 0x01U, 0x00U, 0x79U, 0x07U, 0x00U, 0x0FU, 0xFFU, 0x00U, 0x00U, 0xDCU, 0x93U,
+			0x04U, 0x00U,
+		};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_lz77(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		REQUIRE(res->length() == 300005zu);
+		CHECK(as_text(*res).starts_with("xxxxxy"));
+		CHECK(std::ranges::all_of(as_text(*res).substr(5zu), [](const char chr) { return chr == 'y'; }));
+	}
+
+	SUBCASE("bad offset") {
+		std::vector<std::uint8_t> vec{ 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, };
+		bytearray_t buff{vec};
+
+		CHECK_EQ(buff.decompress_lz77(0zu, buff.length()).error(), decomp_error_t::Invalid);
+	}
 }
 
 TEST_CASE("bytearray_t - decompress_lz77huff") {
-	/* TODO(aki): Implement & Test */
+	SUBCASE("single block") {
+		auto vec{xpress_block(
+			{
+				{0x10U, 0x43U}, {0x16U, 0x04U}, {0x24U, 0x04U}, {0x28U, 0x04U}, {0x30U, 0x40U}, {0x32U, 0x40U},
+				{0x35U, 0x40U}, {0x36U, 0x03U}, {0x37U, 0x34U}, {0x80U, 0x04U}, {0x9FU, 0x40U},
+			},
+			{ 0x25U, 0x8BU, 0x9AU, 0x38U, 0x4CU, 0xDCU, 0x70U, 0x3FU, 0x00U, 0x00U, 0x18U, }
+		)};
+		bytearray_t buff{vec};
+
+		for (auto round{0}; round < 2; ++round) {
+			const auto res{buff.decompress_lz77huff(0zu, buff.length())};
+			REQUIRE(res.has_value());
+			CHECK(as_text(*res) == decomp_plain);
+		}
+
+		CHECK_EQ(buff.decompress_lz77huff(0zu, 200zu).error(), decomp_error_t::Truncated);
+		CHECK_EQ(buff.decompress_lz77huff(1zu, buff.length()).error(), decomp_error_t::Overrun);
+	}
+
+	SUBCASE("long codes") {
+		/* Code lengths up to 15 bits, which are too long for the fast lookup table */
+		auto vec{xpress_block(
+			{
+				{0x10U, 0x74U}, {0x16U, 0x08U}, {0x24U, 0x09U}, {0x28U, 0x0AU}, {0x30U, 0xB0U}, {0x32U, 0xC0U},
+				{0x35U, 0xD0U}, {0x36U, 0x05U}, {0x37U, 0x6EU}, {0x40U, 0x21U}, {0x41U, 0x03U}, {0x80U, 0x0FU},
+				{0x9FU, 0xF0U},
+			},
+			{
+				0x7FU, 0xFFU, 0xBDU, 0xF7U, 0xF7U, 0xF7U, 0xDFU, 0x7FU, 0xFFU, 0xFBU, 0xFFU, 0xEFU, 0xFBU, 0x7DU,
+				0xFFU, 0xBFU, 0xFFU, 0xEFU, 0x00U, 0xC0U, 0x18U, 0x00U, 0x00U,
+			}
+		)};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_lz77huff(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	SUBCASE("multiple blocks") {
+		/* 70000 'A' followed by 300 'B', the second block has its own table */
+		auto vec{xpress_block({ {0x20U, 0x10U}, {0x87U, 0x10U}, }, { 0x00U, 0x40U, 0x00U, 0x00U, 0xFFU, 0xFCU, 0xFFU, })};
+		const auto second{xpress_block(
+			{ {0x21U, 0x02U}, {0x80U, 0x02U}, {0x87U, 0x10U}, },
+			{ 0x00U, 0x4CU, 0x00U, 0x00U, 0xFFU, 0x6DU, 0x11U, 0xFFU, 0x28U, 0x01U, }
+		)};
+		vec.insert(vec.end(), second.begin(), second.end());
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_lz77huff(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		REQUIRE(res->length() == 70300zu);
+		CHECK(std::ranges::all_of(as_text(*res).substr(0zu, 70000zu), [](const char chr) { return chr == 'A'; }));
+		CHECK(std::ranges::all_of(as_text(*res).substr(70000zu), [](const char chr) { return chr == 'B'; }));
+	}
+
+	SUBCASE("literal ending a block") {
+		/*
+			'A', a 65534 byte match and then a 'B' as the last byte of the first block, after an odd number of
+			bytes. The padding after it reads as another 'A', which must not be decoded into the same block.
+		*/
+		auto vec{xpress_block({ {0x20U, 0x10U}, {0x21U, 0x02U}, {0x87U, 0x20U}, }, { 0x00U, 0x70U, 0x00U, 0x00U, 0xFFU, 0xFBU, 0xFFU, })};
+		const auto second{xpress_block({ {0x21U, 0x10U}, {0x80U, 0x01U}, }, { 0x00U, 0x40U, 0x00U, 0x00U, })};
+		vec.insert(vec.end(), second.begin(), second.end());
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_lz77huff(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		REQUIRE(res->length() == 65537zu);
+		CHECK(std::ranges::all_of(as_text(*res).substr(0zu, 65535zu), [](const char chr) { return chr == 'A'; }));
+		CHECK_EQ(as_text(*res).substr(65535zu), "BC");
+	}
+
+	SUBCASE("over-subscribed table") {
+		std::vector<std::uint8_t> vec(260zu, 0x11U);
+		bytearray_t buff{vec};
+
+		CHECK_EQ(buff.decompress_lz77huff(0zu, buff.length()).error(), decomp_error_t::Invalid);
+	}
 }
 
 TEST_CASE("bytearray_t - decompress_lzma") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{
+		0x5DU, 0x00U, 0x00U, 0x80U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x24U, 0x19U,
+		0x49U, 0x98U, 0x6FU, 0x16U, 0x02U, 0x88U, 0x31U, 0x08U, 0x31U, 0x9BU, 0xCBU, 0x44U, 0x64U, 0x6BU, 0x66U, 0x86U,
+		0xF1U, 0x93U, 0xFFU, 0xFFU, 0xF8U, 0xA6U, 0xC0U, 0x00U,
+	};
+	bytearray_t buff{vec};
+
+	for (auto round{0}; round < 2; ++round) {
+		const auto res{buff.decompress_lzma(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	CHECK_EQ(buff.decompress_lzma(0zu, buff.length() - 8zu).error(), decomp_error_t::Truncated);
+	CHECK_EQ(buff.decompress_lzma(1zu, buff.length()).error(), decomp_error_t::Overrun);
+
+	/* The same stream with a header claiming 200MiB of output */
+	auto liar{vec};
+	const std::array<std::uint8_t, 8> claimed{{0x00U, 0x00U, 0x80U, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U}};
+	std::ranges::copy(claimed, liar.begin() + 5);
+	bytearray_t liar_buff{liar};
+	CHECK_FALSE(liar_buff.decompress_lzma(0zu, liar_buff.length()).has_value());
 }
 
 TEST_CASE("bytearray_t - decompress_lznt1") {
-	/* TODO(aki): Implement & Test */
+	SUBCASE("single chunk") {
+		std::vector<std::uint8_t> vec{
+			0x11U, 0xB0U, 0x00U, 0x48U, 0x65U, 0x6CU, 0x6CU, 0x6FU, 0x2CU, 0x20U, 0x50U, 0x40U, 0x61U, 0x6EU, 0x6BU, 0x6FU,
+			0x21U, 0x20U, 0x27U, 0xD0U,
+		};
+		bytearray_t buff{vec};
+
+		for (auto round{0}; round < 2; ++round) {
+			const auto res{buff.decompress_lznt1(0zu, buff.length())};
+			REQUIRE(res.has_value());
+			CHECK(as_text(*res) == decomp_plain);
+		}
+
+		CHECK_EQ(buff.decompress_lznt1(0zu, buff.length() - 1zu).error(), decomp_error_t::Truncated);
+		CHECK_EQ(buff.decompress_lznt1(1zu, buff.length()).error(), decomp_error_t::Overrun);
+	}
+
+	SUBCASE("long match") {
+		/* A full chunk of 'A' */
+		std::vector<std::uint8_t> vec{ 0x03U, 0xB0U, 0x02U, 0x41U, 0xFCU, 0x0FU, };
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_lznt1(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		REQUIRE(res->length() == 4096zu);
+		CHECK(std::ranges::all_of(*res, [](const std::byte b) { return b == std::byte{'A'}; }));
+	}
+
+	SUBCASE("multiple chunks") {
+		/* A short compressed chunk is padded out to 4KiB by the uncompressed chunk that follows it */
+		std::vector<std::uint8_t> vec{
+			0x11U, 0xB0U, 0x00U, 0x48U, 0x65U, 0x6CU, 0x6CU, 0x6FU, 0x2CU, 0x20U, 0x50U, 0x40U, 0x61U, 0x6EU, 0x6BU, 0x6FU,
+			0x21U, 0x20U, 0x27U, 0xD0U, 0x02U, 0x30U, 0x61U, 0x62U, 0x63U, 0x00U, 0x00U,
+		};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_lznt1(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		REQUIRE(res->length() == 4099zu);
+		CHECK(as_text(*res).starts_with(decomp_plain));
+		CHECK(std::ranges::all_of(as_text(*res).substr(decomp_plain.length(), 4096zu - decomp_plain.length()), [](const char chr) {
+			return chr == '\0';
+		}));
+		CHECK(as_text(*res).ends_with("abc"));
+	}
+
+	SUBCASE("bad offset") {
+		std::vector<std::uint8_t> vec{ 0x02U, 0xB0U, 0x01U, 0x00U, 0x00U, };
+		bytearray_t buff{vec};
+
+		CHECK_EQ(buff.decompress_lznt1(0zu, buff.length()).error(), decomp_error_t::Invalid);
+	}
 }
 
 #if defined(PANKO_WITH_SNAPPY)
 TEST_CASE("bytearray_t - decompress_snappy") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{
+		0x38U, 0x34U, 0x48U, 0x65U, 0x6CU, 0x6CU, 0x6FU, 0x2CU, 0x20U, 0x50U, 0x61U, 0x6EU, 0x6BU, 0x6FU, 0x21U, 0x20U,
+		0xA6U, 0x0EU, 0x00U,
+	};
+	bytearray_t buff{vec};
+
+	for (auto round{0}; round < 2; ++round) {
+		const auto res{buff.decompress_snappy(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	CHECK_EQ(buff.decompress_snappy(0zu, buff.length() - 3zu).error(), decomp_error_t::Invalid);
+	CHECK_EQ(buff.decompress_snappy(1zu, buff.length()).error(), decomp_error_t::Overrun);
 }
 #endif /* PANKO_WITH_SNAPPY */
 
 TEST_CASE("bytearray_t - decompress_xz") {
-	/* TODO(aki): Implement & Test */
+	std::vector<std::uint8_t> vec{
+		0xFDU, 0x37U, 0x7AU, 0x58U, 0x5AU, 0x00U, 0x00U, 0x01U, 0x69U, 0x22U, 0xDEU, 0x36U, 0x02U, 0x00U, 0x21U, 0x01U,
+		0x16U, 0x00U, 0x00U, 0x00U, 0x74U, 0x2FU, 0xE5U, 0xA3U, 0xE0U, 0x00U, 0x37U, 0x00U, 0x15U, 0x5DU, 0x00U, 0x24U,
+		0x19U, 0x49U, 0x98U, 0x6FU, 0x16U, 0x02U, 0x88U, 0x31U, 0x08U, 0x31U, 0x9BU, 0xCBU, 0x44U, 0x64U, 0x6BU, 0x66U,
+		0x77U, 0x50U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xCBU, 0x40U, 0xD7U, 0x96U, 0x00U, 0x01U, 0x2DU, 0x38U,
+		0x5AU, 0x57U, 0xAEU, 0x28U, 0x90U, 0x42U, 0x99U, 0x0DU, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x59U, 0x5AU,
+	};
+	bytearray_t buff{vec};
+
+	for (auto round{0}; round < 2; ++round) {
+		const auto res{buff.decompress_xz(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		CHECK(as_text(*res) == decomp_plain);
+	}
+
+	CHECK_EQ(buff.decompress_xz(0zu, buff.length() - 8zu).error(), decomp_error_t::Truncated);
+	CHECK_EQ(buff.decompress_xz(1zu, buff.length() - 1zu).error(), decomp_error_t::Invalid);
+	CHECK_EQ(buff.decompress_xz(1zu, buff.length()).error(), decomp_error_t::Overrun);
 }
 
 TEST_CASE("bytearray_t - decompress_zstd") {
-	/* TODO(aki): Implement & Test */
+	SUBCASE("content size") {
+		std::vector<std::uint8_t> vec{
+			0x28U, 0xB5U, 0x2FU, 0xFDU, 0x20U, 0x38U, 0xA5U, 0x00U, 0x00U, 0x70U, 0x48U, 0x65U, 0x6CU, 0x6CU, 0x6FU, 0x2CU,
+			0x20U, 0x50U, 0x61U, 0x6EU, 0x6BU, 0x6FU, 0x21U, 0x20U, 0x01U, 0x00U, 0x03U, 0x9AU, 0x4AU,
+		};
+		bytearray_t buff{vec};
+
+		for (auto round{0}; round < 2; ++round) {
+			const auto res{buff.decompress_zstd(0zu, buff.length())};
+			REQUIRE(res.has_value());
+			CHECK(as_text(*res) == decomp_plain);
+		}
+
+		CHECK_EQ(buff.decompress_zstd(0zu, buff.length() - 4zu).error(), decomp_error_t::Truncated);
+		CHECK_EQ(buff.decompress_zstd(1zu, buff.length() - 1zu).error(), decomp_error_t::Invalid);
+		CHECK_EQ(buff.decompress_zstd(1zu, buff.length()).error(), decomp_error_t::Overrun);
+	}
+
+	SUBCASE("no content size") {
+		/* 64KiB of 'A', streamed without a content size in the frame header */
+		std::vector<std::uint8_t> vec{
+			0x28U, 0xB5U, 0x2FU, 0xFDU, 0x00U, 0x58U, 0x55U, 0x00U, 0x00U, 0x10U, 0x41U, 0x41U, 0x01U, 0x00U, 0xFBU, 0x7FU,
+			0x1DU, 0x60U, 0x01U,
+		};
+		bytearray_t buff{vec};
+
+		const auto res{buff.decompress_zstd(0zu, buff.length())};
+		REQUIRE(res.has_value());
+		REQUIRE(res->length() == 65536zu);
+		CHECK(std::ranges::all_of(*res, [](const std::byte b) { return b == std::byte{'A'}; }));
+	}
+
+	SUBCASE("content size larger than possible") {
+		/* A frame claiming 200MiB of content for a 2 byte raw block */
+		std::vector<std::uint8_t> vec{
+			0x28U, 0xB5U, 0x2FU, 0xFDU, 0xE0U, 0x00U, 0x00U, 0x80U, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x00U, 0x00U,
+			0x48U, 0x69U,
+		};
+		bytearray_t buff{vec};
+		CHECK_EQ(buff.decompress_zstd(0zu, buff.length()).error(), decomp_error_t::Invalid);
+	}
 }
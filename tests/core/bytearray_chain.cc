@@ -0,0 +1,285 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* bytearray_chain.cc - bytearray_chain_t test harness */
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/config.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/bytearray_chain.hh"
+
+using Panko::core::bytearray_t;
+using Panko::core::bytearray_chain_t;
+using Panko::core::error_codes::strdec_error_t;
+
+/* Split `data` into a chain of fragments ending at each of `cuts` */
+[[nodiscard]]
+static bytearray_chain_t split(std::vector<std::uint8_t>& data, const std::vector<std::size_t>& cuts) {
+	bytearray_chain_t chain{};
+	bytearray_t whole{data};
+
+	std::size_t start{};
+	for (const auto cut : cuts) {
+		if (cut != start) {
+			auto fragment{whole.slice(start, cut - 1zu)};
+			chain.append(fragment);
+		}
+		start = cut;
+	}
+	if (start != data.size()) {
+		auto fragment{whole.slice(start, data.size() - 1zu)};
+		chain.append(fragment);
+	}
+
+	return chain;
+}
+
+[[nodiscard]]
+static std::vector<std::uint8_t> iota(const std::size_t len) {
+	std::vector<std::uint8_t> data(len);
+	for (std::size_t idx{}; idx < len; ++idx) {
+		data[idx] = static_cast<std::uint8_t>((idx * 7zu) + 1zu);
+	}
+	return data;
+}
+
+TEST_CASE("bytearray_chain_t - Empty") {
+	bytearray_chain_t chain{};
+
+	CHECK_EQ(chain.length(), 0zu);
+	CHECK_EQ(chain.fragments(), 0zu);
+	CHECK_FALSE(chain.valid());
+	CHECK_THROWS_AS((void)(chain.at<std::uint8_t, std::endian::little>(0zu)), std::out_of_range);
+	CHECK_THROWS_AS((void)(chain.slice(0zu, 0zu)), std::out_of_range);
+
+	const auto str{chain.string<&bytearray_t::string_ascii>(0zu, 1zu)};
+	REQUIRE(!str);
+	CHECK(str.error() == strdec_error_t::Overrun);
+}
+
+TEST_CASE("bytearray_chain_t - append") {
+	std::vector<std::uint8_t> first{0x01U, 0x02U, 0x03U};
+	std::vector<std::uint8_t> second{0x04U, 0x05U};
+	bytearray_t first_buff{first};
+	bytearray_t second_buff{second};
+	bytearray_t empty{};
+
+	bytearray_chain_t chain{};
+	chain.append(first_buff);
+	chain.append(empty);
+	chain.append(second_buff);
+
+	CHECK(chain.valid());
+	CHECK_EQ(chain.length(), 5zu);
+	CHECK_EQ(chain.fragments(), 2zu);
+	/* The fragments are views of what was appended, not copies */
+	CHECK_EQ(chain.fragment(0zu).data(), first_buff.data());
+	CHECK_EQ(chain.fragment(1zu).data(), second_buff.data());
+	CHECK_THROWS_AS((void)(chain.fragment(2zu)), std::out_of_range);
+
+	for (std::size_t idx{}; idx < 5zu; ++idx) {
+		CHECK_EQ((chain.at<std::uint8_t, std::endian::little>(idx)), idx + 1zu);
+	}
+}
+
+TEST_CASE("bytearray_chain_t - Owned fragments") {
+	bytearray_chain_t chain{};
+	{
+		bytearray_t owned{4zu};
+		owned.data()[3] = std::byte{0xAAU};
+		chain.append(owned);
+	}
+
+	/* The chain shares ownership of the backing storage */
+	CHECK_EQ((chain.at<std::uint32_t, std::endian::big>(0zu)), 0x000000AAU);
+}
+
+TEST_CASE("bytearray_chain_t - at<T, endian>(idx)") {
+	auto data{iota(24zu)};
+	bytearray_t whole{data};
+
+	for (const auto& cuts : std::vector<std::vector<std::size_t>>{
+		{}, {1zu}, {3zu, 4zu, 5zu}, {7zu, 9zu}, {1zu, 2zu, 3zu, 4zu, 5zu, 6zu, 7zu, 8zu, 9zu, 10zu, 11zu, 12zu}
+	}) {
+		const auto chain{split(data, cuts)};
+		REQUIRE(chain.length() == data.size());
+
+		for (std::size_t idx{}; idx <= (data.size() - 8zu); ++idx) {
+			CHECK_EQ(
+				(chain.at<std::uint16_t, std::endian::big>(idx)), (whole.at<std::uint16_t, std::endian::big>(idx))
+			);
+			CHECK_EQ(
+				(chain.at<std::uint32_t, std::endian::little>(idx)), (whole.at<std::uint32_t, std::endian::little>(idx))
+			);
+			CHECK_EQ(
+				(chain.at<std::uint64_t, std::endian::big>(idx)), (whole.at<std::uint64_t, std::endian::big>(idx))
+			);
+		}
+
+		CHECK_THROWS_AS((void)(chain.at<std::uint32_t, std::endian::big>(21zu)), std::out_of_range);
+		CHECK_THROWS_AS((void)(chain.at<std::uint8_t, std::endian::big>(24zu)), std::out_of_range);
+	}
+}
+
+TEST_CASE("bytearray_chain_t - next<T, endian>") {
+	std::vector<std::uint8_t> data{
+		0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U, 0x09U,
+	};
+	auto chain{split(data, {1zu, 3zu})};
+
+	CHECK_EQ((chain.next<std::uint16_t, std::endian::big>()), 0x0102U);
+	CHECK_EQ((chain.next<std::uint32_t, std::endian::little>()), 0x06050403U);
+	CHECK_EQ((chain.next<std::uint8_t, std::endian::little>()), 0x07U);
+	CHECK_THROWS_AS((void)(chain.next<std::uint32_t, std::endian::little>()), std::out_of_range);
+	CHECK_EQ((chain.next<std::uint16_t, std::endian::big>()), 0x0809U);
+}
+
+TEST_CASE("bytearray_chain_t - slices") {
+	auto data{iota(16zu)};
+	auto chain{split(data, {4zu, 8zu, 12zu})};
+
+	SUBCASE("Inside one fragment") {
+		auto sub{chain.slice(5zu, 6zu)};
+		CHECK_EQ(sub.length(), 2zu);
+		CHECK_EQ(sub.fragments(), 1zu);
+		CHECK_EQ(sub.fragment(0zu).data(), chain.fragment(1zu).data() + 1);
+		CHECK_EQ((sub.at<std::uint16_t, std::endian::big>(0zu)), (chain.at<std::uint16_t, std::endian::big>(5zu)));
+	}
+
+	SUBCASE("Across fragments") {
+		auto sub{chain.slice(3zu, 12zu)};
+		CHECK_EQ(sub.length(), 10zu);
+		CHECK_EQ(sub.fragments(), 4zu);
+		for (std::size_t idx{}; idx < sub.length(); ++idx) {
+			CHECK_EQ((sub.at<std::uint8_t, std::endian::big>(idx)), data[idx + 3zu]);
+		}
+
+		/* Slices of slices still refer to the same data */
+		auto subsub{sub.slice(1zu, 5zu)};
+		CHECK_EQ(subsub.fragments(), 2zu);
+		CHECK_EQ(subsub.fragment(0zu).data(), chain.fragment(1zu).data());
+		CHECK_EQ((subsub.at<std::uint32_t, std::endian::little>(1zu)), (chain.at<std::uint32_t, std::endian::little>(5zu)));
+	}
+
+	SUBCASE("Whole chain") {
+		auto sub{chain.slice(0zu, 15zu)};
+		CHECK_EQ(sub.length(), 16zu);
+		CHECK_EQ(sub.fragments(), 4zu);
+	}
+
+	SUBCASE("Out of range") {
+		CHECK_THROWS_AS((void)(chain.slice(0zu, 16zu)), std::out_of_range);
+		CHECK_THROWS_AS((void)(chain.slice(16zu, 16zu)), std::out_of_range);
+		CHECK_THROWS_AS((void)(chain.slice(6zu, 5zu)), std::out_of_range);
+	}
+}
+
+TEST_CASE("bytearray_chain_t - contiguous") {
+	auto data{iota(12zu)};
+	auto chain{split(data, {4zu, 6zu})};
+
+	/* Ranges inside one fragment are not copied */
+	const auto inside{chain.contiguous(1zu, 3zu)};
+	CHECK_EQ(inside.data(), chain.fragment(0zu).data() + 1);
+	CHECK_EQ(inside.size(), 3zu);
+
+	const auto across{chain.contiguous(2zu, 8zu)};
+	REQUIRE(across.size() == 8zu);
+	for (std::size_t idx{}; idx < across.size(); ++idx) {
+		CHECK_EQ(std::to_integer<std::uint8_t>(across[idx]), data[idx + 2zu]);
+	}
+
+	CHECK(chain.contiguous(12zu, 0zu).empty());
+	CHECK_THROWS_AS((void)(chain.contiguous(8zu, 5zu)), std::out_of_range);
+}
+
+TEST_CASE("bytearray_chain_t - Strings") {
+	/* "\x05Panko\x00" as a length-prefixed and then null terminated string */
+	std::vector<std::uint8_t> data{
+		0x05U, 'P', 'a', 'n', 'k', 'o',
+		'H', 'e', 'l', 'l', 'o', ',', ' ', 'P', 'a', 'n', 'k', 'o', '!', 0x00U,
+		0x00U, 0x03U, 'a', 'b', 'c',
+	};
+
+	SUBCASE("Inside one fragment") {
+		auto chain{split(data, {6zu})};
+		const auto str{chain.string<&bytearray_t::string_ascii_lp8>(0zu)};
+		REQUIRE(str);
+		CHECK_EQ(*str, "Panko");
+		/* Strings that don't need transcoding are views of the fragment */
+		CHECK_EQ(
+			reinterpret_cast<const void*>(str->data()), reinterpret_cast<const void*>(chain.fragment(0zu).data() + 1)
+		);
+	}
+
+	SUBCASE("Across a fragment boundary") {
+		auto chain{split(data, {3zu, 9zu, 21zu, 23zu})};
+
+		const auto lp8{chain.string<&bytearray_t::string_ascii_lp8>(0zu)};
+		REQUIRE(lp8);
+		CHECK_EQ(*lp8, "Panko");
+
+		const auto lp16{chain.string<&bytearray_t::string_ascii_lp16>(20zu, std::endian::big)};
+		REQUIRE(lp16);
+		CHECK_EQ(*lp16, "abc");
+
+		const auto fixed{chain.string<&bytearray_t::string_ascii>(1zu, 5zu)};
+		REQUIRE(fixed);
+		CHECK_EQ(*fixed, "Panko");
+	}
+
+	SUBCASE("Across many fragments") {
+		std::vector<std::size_t> cuts{};
+		for (std::size_t cut{1zu}; cut < data.size(); ++cut) {
+			cuts.push_back(cut);
+		}
+		auto chain{split(data, cuts)};
+		REQUIRE(chain.fragments() == data.size());
+
+		const auto str{chain.string<&bytearray_t::string_ascii_zt>(6zu, 0zu)};
+		REQUIRE(str);
+		CHECK_EQ(*str, "Hello, Panko!");
+	}
+
+	SUBCASE("Overrun") {
+		auto chain{split(data, {10zu})};
+
+		const auto fixed{chain.string<&bytearray_t::string_ascii>(20zu, 6zu)};
+		REQUIRE(!fixed);
+		CHECK(fixed.error() == strdec_error_t::Overrun);
+
+		const auto past{chain.string<&bytearray_t::string_ascii_lp8>(25zu)};
+		REQUIRE(!past);
+		CHECK(past.error() == strdec_error_t::Overrun);
+	}
+
+	SUBCASE("Outlives a move of the chain") {
+		auto chain{split(data, {3zu})};
+		const auto str{chain.string<&bytearray_t::string_ascii_lp8>(0zu)};
+		auto moved{std::move(chain)};
+
+		REQUIRE(str);
+		CHECK_EQ(*str, "Panko");
+		CHECK_EQ(moved.length(), data.size());
+	}
+}
+
+TEST_CASE("bytearray_chain_t - Transcoded strings") {
+	/* "Panko" in UTF-16LE, split in the middle of a code unit */
+	std::vector<std::uint8_t> data{
+		'P', 0x00U, 'a', 0x00U, 'n', 0x00U, 'k', 0x00U, 'o', 0x00U,
+	};
+	auto chain{split(data, {3zu, 7zu})};
+
+	const auto str{chain.string<&bytearray_t::string_utf16le>(0zu, 10zu)};
+	REQUIRE(str);
+	CHECK(*str == std::u16string_view{u"Panko"});
+}
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* checksum.cc - Checksum and CRC test harness */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/config.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/bytearray_chain.hh"
+#include "panko/core/checksum.hh"
+
+using Panko::core::bytearray_t;
+using Panko::core::bytearray_chain_t;
+namespace checksum = Panko::core::checksum;
+using checksum::crc16_t;
+
+namespace {
+	constexpr std::string_view check_string{"123456789"};
+
+	[[nodiscard]]
+	std::span<const std::byte> as_span(const std::string_view str) noexcept {
+		return std::as_bytes(std::span{str});
+	}
+
+	[[nodiscard]]
+	std::span<const std::byte> as_span(const std::vector<std::uint8_t>& vec) noexcept {
+		return std::as_bytes(std::span{vec});
+	}
+
+	[[nodiscard]]
+	std::vector<std::uint8_t> noise(const std::size_t len, std::uint32_t seed) {
+		std::vector<std::uint8_t> data(len);
+		for (auto& byte : data) {
+			seed ^= seed << 13U;
+			seed ^= seed >> 17U;
+			seed ^= seed << 5U;
+			byte = static_cast<std::uint8_t>(seed >> 24U);
+		}
+		return data;
+	}
+
+	/* Bit at a time reflected CRC-32, with the standard pre and post inversion */
+	[[nodiscard]]
+	std::uint32_t reference_crc32(const std::span<const std::byte> data, const std::uint32_t poly) noexcept {
+		std::uint32_t crc{~0U};
+		for (const auto byte : data) {
+			crc ^= std::to_integer<std::uint32_t>(byte);
+			for (std::size_t bit{}; bit < 8zu; ++bit) {
+				crc = ((crc & 1U) != 0U) ? (crc >> 1U) ^ poly : crc >> 1U;
+			}
+		}
+		return ~crc;
+	}
+
+	/* Word at a time big-endian one's complement sum */
+	[[nodiscard]]
+	std::uint16_t reference_inet_sum(const std::span<const std::byte> data) noexcept {
+		std::uint32_t sum{};
+		for (std::size_t idx{}; idx < data.size(); idx += 2zu) {
+			const auto high{std::to_integer<std::uint32_t>(data[idx])};
+			const auto low{(idx + 1zu) < data.size() ? std::to_integer<std::uint32_t>(data[idx + 1zu]) : 0U};
+			sum += (high << 8U) | low;
+			sum = (sum & 0xFFFFU) + (sum >> 16U);
+		}
+		return static_cast<std::uint16_t>(sum);
+	}
+
+	/* Split `data` into fragments of `size` bytes */
+	[[nodiscard]]
+	bytearray_chain_t split(std::vector<std::uint8_t>& data, const std::size_t size) {
+		bytearray_chain_t chain{};
+		bytearray_t whole{data};
+		for (std::size_t start{}; start < data.size(); start += size) {
+			auto fragment{whole.slice(start, std::min(start + size, data.size()) - 1zu)};
+			chain.append(fragment);
+		}
+		return chain;
+	}
+}
+
+TEST_CASE("Internet checksum") {
+	/* The example from RFC 1071 section 3 */
+	const std::vector<std::uint8_t> rfc1071{0x00U, 0x01U, 0xF2U, 0x03U, 0xF4U, 0xF5U, 0xF6U, 0xF7U};
+	CHECK_EQ(checksum::inet_sum(as_span(rfc1071)), 0xDDF2U);
+	CHECK_EQ(checksum::inet_checksum(as_span(rfc1071)), 0x220DU);
+
+	/* A real IPv4 header, with the checksum in place it sums to all ones */
+	std::vector<std::uint8_t> header{
+		0x45U, 0x00U, 0x00U, 0x73U, 0x00U, 0x00U, 0x40U, 0x00U, 0x40U, 0x11U,
+		0xB8U, 0x61U, 0xC0U, 0xA8U, 0x00U, 0x01U, 0xC0U, 0xA8U, 0x00U, 0xC7U,
+	};
+	CHECK_EQ(checksum::inet_checksum(as_span(header)), 0x0000U);
+	header[10] = 0x00U;
+	header[11] = 0x00U;
+	CHECK_EQ(checksum::inet_checksum(as_span(header)), 0xB861U);
+
+	CHECK_EQ(checksum::inet_sum({}), 0x0000U);
+	CHECK_EQ(checksum::inet_sum(as_span(std::vector<std::uint8_t>{0xABU})), 0xAB00U);
+
+	/* Long enough to run through the vector kernels and their scalar tails */
+	const auto data{noise(4099zu, 0xC0FFEEU)};
+	for (std::size_t len{}; len <= data.size(); len += (len < 128zu) ? 1zu : 61zu) {
+		const auto part{as_span(data).first(len)};
+		CHECK_EQ(checksum::inet_sum(part), reference_inet_sum(part));
+	}
+
+	/* Continuing a sum over an even split is the same as summing all of it */
+	const auto whole{as_span(data)};
+	CHECK_EQ(checksum::inet_sum(whole.subspan(100zu), checksum::inet_sum(whole.first(100zu))), checksum::inet_sum(whole));
+	CHECK_EQ(
+		checksum::inet_add(checksum::inet_sum(whole.first(2048zu)), checksum::inet_sum(whole.subspan(2048zu))),
+		checksum::inet_sum(whole)
+	);
+}
+
+TEST_CASE("CRC-32 and CRC-32C") {
+	CHECK_EQ(checksum::crc32(as_span(check_string)), 0xCBF4'3926U);
+	CHECK_EQ(checksum::crc32c(as_span(check_string)), 0xE306'9283U);
+	CHECK_EQ(checksum::crc32({}), 0x0000'0000U);
+	CHECK_EQ(checksum::crc32c({}), 0x0000'0000U);
+
+	/* Across the folding thresholds and the tails either side of them */
+	const auto data{noise(5000zu, 0xBADF00DU)};
+	for (std::size_t len{}; len <= data.size(); len += (len < 200zu) ? 1zu : 97zu) {
+		const auto part{as_span(data).first(len)};
+		CHECK_EQ(checksum::crc32(part), reference_crc32(part, 0xEDB8'8320U));
+		CHECK_EQ(checksum::crc32c(part), reference_crc32(part, 0x82F6'3B78U));
+	}
+
+	/* Unaligned starts */
+	for (std::size_t start{1zu}; start < 16zu; ++start) {
+		const auto part{as_span(data).subspan(start, 1000zu)};
+		CHECK_EQ(checksum::crc32(part), reference_crc32(part, 0xEDB8'8320U));
+	}
+
+	/* Continuing a CRC */
+	const auto whole{as_span(data)};
+	for (const auto cut : {0zu, 1zu, 63zu, 64zu, 1000zu, 4999zu}) {
+		CHECK_EQ(checksum::crc32(whole.subspan(cut), checksum::crc32(whole.first(cut))), checksum::crc32(whole));
+		CHECK_EQ(checksum::crc32c(whole.subspan(cut), checksum::crc32c(whole.first(cut))), checksum::crc32c(whole));
+	}
+}
+
+TEST_CASE("CRC-16") {
+	CHECK_EQ(checksum::crc16(as_span(check_string), crc16_t::Arc), 0xBB3DU);
+	CHECK_EQ(checksum::crc16(as_span(check_string), crc16_t::CcittFalse), 0x29B1U);
+	CHECK_EQ(checksum::crc16(as_span(check_string), crc16_t::Kermit), 0x2189U);
+	CHECK_EQ(checksum::crc16(as_span(check_string), crc16_t::Modbus), 0x4B37U);
+	CHECK_EQ(checksum::crc16(as_span(check_string), crc16_t::X25), 0x906EU);
+	CHECK_EQ(checksum::crc16(as_span(check_string), crc16_t::XModem), 0x31C3U);
+
+	/* Continuing a CRC, including through the final XOR of X.25 */
+	const auto whole{as_span(check_string)};
+	for (const auto variant : {crc16_t::Arc, crc16_t::CcittFalse, crc16_t::X25}) {
+		const auto first{checksum::crc16(whole.first(4zu), variant)};
+		CHECK_EQ(checksum::crc16(whole.subspan(4zu), variant, first), checksum::crc16(whole, variant));
+	}
+}
+
+TEST_CASE("Adler-32 and Fletcher-16") {
+	CHECK_EQ(checksum::adler32(as_span(std::string_view{"Wikipedia"})), 0x11E6'0398U);
+	CHECK_EQ(checksum::adler32({}), 0x0000'0001U);
+	CHECK_EQ(checksum::fletcher16(as_span(std::string_view{"abcde"})), 0xC8F0U);
+	CHECK_EQ(checksum::fletcher16(as_span(std::string_view{"abcdef"})), 0x2057U);
+
+	/* All ones is the worst case for the deferred reductions */
+	const std::vector<std::uint8_t> ones(20000zu, 0xFFU);
+	std::uint32_t low{1U};
+	std::uint32_t high{};
+	std::uint32_t f_low{};
+	std::uint32_t f_high{};
+	for (const auto byte : ones) {
+		low = (low + byte) % 65521U;
+		high = (high + low) % 65521U;
+		f_low = (f_low + byte) % 255U;
+		f_high = (f_high + f_low) % 255U;
+	}
+	CHECK_EQ(checksum::adler32(as_span(ones)), (high << 16U) | low);
+	CHECK_EQ(checksum::fletcher16(as_span(ones)), (f_high << 8U) | f_low);
+
+	const auto whole{as_span(ones)};
+	CHECK_EQ(checksum::adler32(whole.subspan(7000zu), checksum::adler32(whole.first(7000zu))), checksum::adler32(whole));
+	CHECK_EQ(
+		checksum::fletcher16(whole.subspan(7000zu), checksum::fletcher16(whole.first(7000zu))), checksum::fletcher16(whole)
+	);
+}
+
+TEST_CASE("bytearray_t - Checksum helpers") {
+	std::vector<std::uint8_t> data{'x', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'x'};
+	bytearray_t buff{data};
+
+	CHECK_EQ(buff.checksum_crc32(1zu, 9zu), 0xCBF4'3926U);
+	CHECK_EQ(buff.checksum_crc32c(1zu, 9zu), 0xE306'9283U);
+	CHECK_EQ(buff.checksum_crc16(1zu, 9zu, crc16_t::Modbus), 0x4B37U);
+	CHECK_EQ(buff.checksum_adler32(0zu, 11zu), checksum::adler32(as_span(data)));
+	CHECK_EQ(buff.checksum_fletcher16(0zu, 11zu), checksum::fletcher16(as_span(data)));
+	CHECK_EQ(buff.checksum_inet(1zu, 10zu), checksum::inet_checksum(as_span(data).subspan(1zu)));
+	CHECK_EQ(buff.checksum_crc32(11zu, 0zu), 0x0000'0000U);
+
+	CHECK_THROWS_AS((void)(buff.checksum_crc32(1zu, 11zu)), std::out_of_range);
+	CHECK_THROWS_AS((void)(buff.checksum_inet(12zu, 0zu)), std::out_of_range);
+}
+
+TEST_CASE("bytearray_chain_t - Checksum helpers") {
+	auto data{noise(777zu, 0xFEEDU)};
+	const auto whole{as_span(data)};
+
+	for (const auto fragment : {1zu, 2zu, 3zu, 64zu, 100zu, 777zu}) {
+		const auto chain{split(data, fragment)};
+		for (const auto& [idx, len] : {std::pair{0zu, 777zu}, std::pair{1zu, 700zu}, std::pair{5zu, 3zu}, std::pair{776zu, 1zu}}) {
+			const auto part{whole.subspan(idx, len)};
+			CHECK_EQ(chain.checksum_inet(idx, len), checksum::inet_checksum(part));
+			CHECK_EQ(chain.checksum_inet(idx, len, 0x1234U), checksum::inet_checksum(part, 0x1234U));
+			CHECK_EQ(chain.checksum_crc32(idx, len), checksum::crc32(part));
+			CHECK_EQ(chain.checksum_crc32c(idx, len), checksum::crc32c(part));
+			CHECK_EQ(chain.checksum_crc16(idx, len, crc16_t::X25), checksum::crc16(part, crc16_t::X25));
+			CHECK_EQ(chain.checksum_adler32(idx, len), checksum::adler32(part));
+			CHECK_EQ(chain.checksum_fletcher16(idx, len), checksum::fletcher16(part));
+		}
+
+		CHECK_EQ(chain.checksum_crc16(10zu, 0zu, crc16_t::CcittFalse), 0xFFFFU);
+		CHECK_THROWS_AS((void)(chain.checksum_crc32(700zu, 78zu)), std::out_of_range);
+	}
+}
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* decompress.cc - decompressor_t test harness */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/config.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/decompress.hh"
+
+using Panko::core::bytearray_t;
+using Panko::core::decompress_limits_t;
+using Panko::core::decompressor_t;
+using Panko::core::stream_codec_t;
+using Panko::core::error_codes::decomp_error_t;
+
+constexpr std::string_view plain{"Hello, Panko! Hello, Panko! Hello, Panko! Hello, Panko! "};
+
+/* Feed `data` to the decompressor `fragment` bytes at a time, and collect everything it puts out */
+[[nodiscard]]
+static std::expected<std::string, decomp_error_t> decompress_all(
+	decompressor_t& decomp, const std::span<const std::uint8_t> data, const std::size_t fragment
+) {
+	std::string out{};
+	for (std::size_t offset{}; offset < data.size(); offset += fragment) {
+		const auto chunk{std::as_bytes(data.subspan(offset, std::min(fragment, data.size() - offset)))};
+		const auto res{decomp.feed(chunk)};
+		if (!res) {
+			return std::unexpected(res.error());
+		}
+		out.append(reinterpret_cast<const char*>(res->data()), res->length());
+	}
+	return out;
+}
+
+/* Decompress `data` split at every fragment size from 1 byte to all of it */
+static void check_fragments(const stream_codec_t codec, const std::span<const std::uint8_t> data) {
+	decompressor_t decomp{codec};
+	for (std::size_t fragment{1zu}; fragment <= data.size(); ++fragment) {
+		decomp.reset();
+		const auto res{decompress_all(decomp, data, fragment)};
+		REQUIRE(res.has_value());
+		CHECK(*res == plain);
+		CHECK(decomp.done());
+		CHECK(decomp.finish().has_value());
+		CHECK_EQ(decomp.total_in(), data.size());
+		CHECK_EQ(decomp.total_out(), plain.size());
+	}
+}
+
+#if defined(PANKO_WITH_BROTLI)
+TEST_CASE("decompressor_t - brotli") {
+	const std::vector<std::uint8_t> data{
+		0x1BU, 0x37U, 0x00U, 0xF8U, 0x9DU, 0x09U, 0x76U, 0xACU, 0x95U, 0x29U, 0x35U, 0xEDU, 0xB4U, 0x04U, 0x41U, 0x82U,
+		0xAAU, 0xB0U, 0xB2U, 0x5EU, 0x63U, 0x73U, 0x7BU, 0x53U, 0x21U, 0x2CU, 0xE1U, 0x54U, 0x3CU, 0x00U, 0x55U, 0x6FU,
+		0x31U,
+	};
+
+	check_fragments(stream_codec_t::Brotli, data);
+}
+#endif /* PANKO_WITH_BROTLI */
+
+TEST_CASE("decompressor_t - bz2") {
+	const std::vector<std::uint8_t> data{
+		0x42U, 0x5AU, 0x68U, 0x39U, 0x31U, 0x41U, 0x59U, 0x26U, 0x53U, 0x59U, 0xE2U, 0x66U, 0x89U, 0x2CU, 0x00U, 0x00U,
+		0x09U, 0x97U, 0x00U, 0x60U, 0x04U, 0x00U, 0x40U, 0x40U, 0x00U, 0x22U, 0x0DU, 0xA0U, 0x00U, 0x31U, 0x00U, 0xD3U,
+		0x4DU, 0x01U, 0x55U, 0x03U, 0x41U, 0xEAU, 0x5CU, 0xC1U, 0x06U, 0x45U, 0x14U, 0x43U, 0xA4U, 0x3CU, 0x43U, 0x07U,
+		0xC5U, 0xDCU, 0x91U, 0x4EU, 0x14U, 0x24U, 0x38U, 0x99U, 0xA2U, 0x4BU, 0x00U,
+	};
+
+	check_fragments(stream_codec_t::Bz2, data);
+}
+
+TEST_CASE("decompressor_t - deflate") {
+	SUBCASE("zlib") {
+		const std::vector<std::uint8_t> data{
+			0x78U, 0xDAU, 0xF3U, 0x48U, 0xCDU, 0xC9U, 0xC9U, 0xD7U, 0x51U, 0x08U, 0x48U, 0xCCU, 0xCBU, 0xCEU, 0x57U, 0x54U,
+			0xF0U, 0x20U, 0x9AU, 0x07U, 0x00U, 0x06U, 0xD6U, 0x11U, 0xE9U,
+		};
+
+		check_fragments(stream_codec_t::Deflate, data);
+	}
+
+	SUBCASE("raw") {
+		const std::vector<std::uint8_t> data{
+			0xF3U, 0x48U, 0xCDU, 0xC9U, 0xC9U, 0xD7U, 0x51U, 0x08U, 0x48U, 0xCCU, 0xCBU, 0xCEU, 0x57U, 0x54U, 0xF0U, 0x20U,
+			0x9AU, 0x07U, 0x00U,
+		};
+
+		check_fragments(stream_codec_t::Deflate, data);
+	}
+
+	SUBCASE("gzip") {
+		std::vector<std::uint8_t> data{
+			0x1FU, 0x8BU, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x03U, 0xF3U, 0x48U, 0xCDU, 0xC9U, 0xC9U, 0xD7U,
+			0x51U, 0x08U, 0x48U, 0xCCU, 0xCBU, 0xCEU, 0x57U, 0x54U, 0xF0U, 0x20U, 0x9AU, 0x07U, 0x00U, 0xCBU, 0x40U, 0xD7U,
+			0x96U, 0x38U, 0x00U, 0x00U, 0x00U,
+		};
+
+		check_fragments(stream_codec_t::Deflate, data);
+
+		/* Trailing data after the end of the stream is ignored */
+		decompressor_t decomp{stream_codec_t::Deflate};
+		REQUIRE(decompress_all(decomp, data, data.size()).has_value());
+		const auto trailing{decomp.feed(std::as_bytes(std::span{data}))};
+		REQUIRE(trailing.has_value());
+		CHECK_EQ(trailing->length(), 0zu);
+		CHECK(decomp.finish().has_value());
+
+		/* A bad CRC in the trailer is only found once the trailer arrives */
+		data[29] ^= 0xFFU;
+		decomp.reset();
+		const auto body{decompress_all(decomp, std::span{data}.first(29zu), 29zu)};
+		REQUIRE(body.has_value());
+		CHECK(*body == plain);
+		CHECK_EQ(decomp.feed(std::as_bytes(std::span{data}.subspan(29zu))).error(), decomp_error_t::Invalid);
+		/* The error sticks until the decompressor is reset */
+		CHECK_EQ(decomp.feed(std::as_bytes(std::span{data})).error(), decomp_error_t::Invalid);
+		CHECK_EQ(decomp.finish().error(), decomp_error_t::Invalid);
+	}
+
+	SUBCASE("truncated") {
+		const std::vector<std::uint8_t> data{ 0x78U, };
+
+		decompressor_t decomp{stream_codec_t::Deflate};
+		const auto res{decomp.feed(std::as_bytes(std::span{data}))};
+		REQUIRE(res.has_value());
+		CHECK_EQ(res->length(), 0zu);
+		CHECK_FALSE(decomp.done());
+		CHECK_EQ(decomp.finish().error(), decomp_error_t::Truncated);
+	}
+
+	SUBCASE("bytearray_t fragments") {
+		std::vector<std::uint8_t> vec{
+			0x78U, 0xDAU, 0xF3U, 0x48U, 0xCDU, 0xC9U, 0xC9U, 0xD7U, 0x51U, 0x08U, 0x48U, 0xCCU, 0xCBU, 0xCEU, 0x57U, 0x54U,
+			0xF0U, 0x20U, 0x9AU, 0x07U, 0x00U, 0x06U, 0xD6U, 0x11U, 0xE9U,
+		};
+		bytearray_t buff{vec};
+
+		decompressor_t decomp{stream_codec_t::Deflate};
+		const auto first{decomp.feed(buff.slice(0zu, 11zu))};
+		REQUIRE(first.has_value());
+		const auto second{decomp.feed(buff.slice(12zu, buff.length() - 1zu))};
+		REQUIRE(second.has_value());
+
+		std::string out{reinterpret_cast<const char*>(first->data()), first->length()};
+		out.append(reinterpret_cast<const char*>(second->data()), second->length());
+		CHECK(out == plain);
+		CHECK(decomp.finish().has_value());
+	}
+}
+
+TEST_CASE("decompressor_t - lz4") {
+	const std::vector<std::uint8_t> data{
+		0x04U, 0x22U, 0x4DU, 0x18U, 0x60U, 0x40U, 0x82U, 0x18U, 0x00U, 0x00U, 0x00U, 0xEFU, 0x48U, 0x65U, 0x6CU, 0x6CU,
+		0x6FU, 0x2CU, 0x20U, 0x50U, 0x61U, 0x6EU, 0x6BU, 0x6FU, 0x21U, 0x20U, 0x0EU, 0x00U, 0x12U, 0x50U, 0x6EU, 0x6BU,
+		0x6FU, 0x21U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U,
+	};
+
+	check_fragments(stream_codec_t::Lz4, data);
+
+	/* A second frame just carries on */
+	decompressor_t decomp{stream_codec_t::Lz4};
+	REQUIRE(decompress_all(decomp, data, 5zu).has_value());
+	const auto second{decompress_all(decomp, data, 5zu)};
+	REQUIRE(second.has_value());
+	CHECK(*second == plain);
+	CHECK(decomp.done());
+}
+
+TEST_CASE("decompressor_t - lzma") {
+	const std::vector<std::uint8_t> data{
+		0x5DU, 0x00U, 0x00U, 0x80U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x24U, 0x19U,
+		0x49U, 0x98U, 0x6FU, 0x16U, 0x02U, 0x88U, 0x31U, 0x08U, 0x31U, 0x9BU, 0xCBU, 0x44U, 0x64U, 0x6BU, 0x66U, 0x86U,
+		0xF1U, 0x93U, 0xFFU, 0xFFU, 0xF8U, 0xA6U, 0xC0U, 0x00U,
+	};
+
+	check_fragments(stream_codec_t::Lzma, data);
+}
+
+TEST_CASE("decompressor_t - xz") {
+	const std::vector<std::uint8_t> data{
+		0xFDU, 0x37U, 0x7AU, 0x58U, 0x5AU, 0x00U, 0x00U, 0x01U, 0x69U, 0x22U, 0xDEU, 0x36U, 0x02U, 0x00U, 0x21U, 0x01U,
+		0x16U, 0x00U, 0x00U, 0x00U, 0x74U, 0x2FU, 0xE5U, 0xA3U, 0xE0U, 0x00U, 0x37U, 0x00U, 0x15U, 0x5DU, 0x00U, 0x24U,
+		0x19U, 0x49U, 0x98U, 0x6FU, 0x16U, 0x02U, 0x88U, 0x31U, 0x08U, 0x31U, 0x9BU, 0xCBU, 0x44U, 0x64U, 0x6BU, 0x66U,
+		0x77U, 0x50U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xCBU, 0x40U, 0xD7U, 0x96U, 0x00U, 0x01U, 0x2DU, 0x38U,
+		0x5AU, 0x57U, 0xAEU, 0x28U, 0x90U, 0x42U, 0x99U, 0x0DU, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x59U, 0x5AU,
+	};
+
+	check_fragments(stream_codec_t::Xz, data);
+
+	decompressor_t decomp{stream_codec_t::Xz};
+	REQUIRE(decompress_all(decomp, std::span{data}.first(60zu), 10zu).has_value());
+	CHECK_EQ(decomp.finish().error(), decomp_error_t::Truncated);
+	CHECK_EQ(decomp.feed(std::as_bytes(std::span{data})).error(), decomp_error_t::Invalid);
+}
+
+TEST_CASE("decompressor_t - zstd") {
+	const std::vector<std::uint8_t> data{
+		0x28U, 0xB5U, 0x2FU, 0xFDU, 0x20U, 0x38U, 0xA5U, 0x00U, 0x00U, 0x70U, 0x48U, 0x65U, 0x6CU, 0x6CU, 0x6FU, 0x2CU,
+		0x20U, 0x50U, 0x61U, 0x6EU, 0x6BU, 0x6FU, 0x21U, 0x20U, 0x01U, 0x00U, 0x03U, 0x9AU, 0x4AU,
+	};
+
+	check_fragments(stream_codec_t::Zstd, data);
+}
+
+TEST_CASE("decompressor_t - limits") {
+	/* 64KiB of 'A' */
+	const std::vector<std::uint8_t> data{
+		0x28U, 0xB5U, 0x2FU, 0xFDU, 0x00U, 0x58U, 0x55U, 0x00U, 0x00U, 0x10U, 0x41U, 0x41U, 0x01U, 0x00U, 0xFBU, 0x7FU,
+		0x1DU, 0x60U, 0x01U,
+	};
+
+	SUBCASE("within limits") {
+		decompressor_t decomp{stream_codec_t::Zstd, decompress_limits_t{.max_output = 65536zu, .max_ratio = 4096zu}};
+		const auto res{decompress_all(decomp, data, 4zu)};
+		REQUIRE(res.has_value());
+		CHECK_EQ(res->size(), 65536zu);
+		CHECK(std::ranges::all_of(*res, [](const char chr) { return chr == 'A'; }));
+		CHECK(decomp.finish().has_value());
+	}
+
+	SUBCASE("max_output") {
+		decompressor_t decomp{stream_codec_t::Zstd, decompress_limits_t{.max_output = 65535zu, .max_ratio = 0zu}};
+		CHECK_EQ(decompress_all(decomp, data, data.size()).error(), decomp_error_t::TooLarge);
+		CHECK(decomp.total_out() <= 65536zu);
+		CHECK_EQ(decomp.finish().error(), decomp_error_t::TooLarge);
+
+		/* Resetting clears the error, but the limits still apply */
+		decomp.reset();
+		CHECK_EQ(decompress_all(decomp, data, 4zu).error(), decomp_error_t::TooLarge);
+	}
+
+	SUBCASE("max_ratio") {
+		decompressor_t decomp{stream_codec_t::Zstd, decompress_limits_t{.max_output = 65536zu, .max_ratio = 100zu}};
+		CHECK_EQ(decompress_all(decomp, data, data.size()).error(), decomp_error_t::TooLarge);
+		CHECK(decomp.total_out() <= (data.size() * 100zu) + 1zu);
+	}
+}
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* reader.cc - reader_t test harness */
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdfloat>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/core/bytearray.hh"
+#include "panko/core/endian.hh"
+#include "panko/core/errcodes.hh"
+#include "panko/core/integers.hh"
+#include "panko/core/reader.hh"
+
+using Panko::core::bytearray_t;
+using Panko::core::reader_t;
+using Panko::core::error_codes::read_error_t;
+using Panko::core::integers::uint24_t;
+using Panko::core::integers::int48_t;
+
+constexpr static std::array<std::uint8_t, 16> test_data{{
+	0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U,
+	0xFFU, 0xFEU, 0xFDU, 0xFCU, 0x3FU, 0x80U, 0x00U, 0x00U,
+}};
+
+TEST_CASE("endian - load/store") {
+	std::array<std::byte, 8> buff{};
+
+	Panko::core::store<std::uint32_t, std::endian::big>(buff.data(), 0x11223344U);
+	CHECK_EQ(buff[0], std::byte{0x11U});
+	CHECK_EQ(buff[3], std::byte{0x44U});
+	CHECK_EQ((Panko::core::load<std::uint32_t, std::endian::big>(buff.data())), 0x11223344U);
+	CHECK_EQ((Panko::core::load<std::uint32_t, std::endian::little>(buff.data())), 0x44332211U);
+
+	Panko::core::store<uint24_t, std::endian::little>(buff.data(), uint24_t{0xAABBCCU});
+	CHECK_EQ(buff[0], std::byte{0xCCU});
+	CHECK_EQ(buff[2], std::byte{0xAAU});
+	CHECK_EQ(buff[3], std::byte{0x44U});
+	CHECK_EQ(std::uint32_t(Panko::core::load<uint24_t, std::endian::little>(buff.data())), 0xAABBCCU);
+	CHECK_EQ(std::uint32_t(Panko::core::load<uint24_t, std::endian::big>(buff.data())), 0xCCBBAAU);
+
+	Panko::core::store<int48_t, std::endian::big>(buff.data(), int48_t{-2});
+	CHECK_EQ(std::int64_t(Panko::core::load<int48_t, std::endian::big>(buff.data())), -2);
+	CHECK_EQ(buff[5], std::byte{0xFEU});
+	CHECK_EQ(buff[6], std::byte{0x00U});
+
+	CHECK_EQ(Panko::core::wire_size_v<uint24_t>, 3zu);
+	CHECK_EQ(Panko::core::wire_size_v<int48_t>, 6zu);
+	CHECK_EQ(Panko::core::wire_size_v<std::uint64_t>, 8zu);
+}
+
+TEST_CASE("reader_t - Empty") {
+	reader_t rdr{};
+
+	CHECK_EQ(rdr.length(), 0zu);
+	CHECK_EQ(rdr.remaining(), 0zu);
+	CHECK(rdr.ok());
+	CHECK(rdr.require(0zu));
+
+	const auto res{rdr.next<std::uint8_t, std::endian::little>()};
+	CHECK_FALSE(res.has_value());
+	CHECK_EQ(res.error(), read_error_t::Truncated);
+	CHECK(rdr.truncated());
+}
+
+TEST_CASE("reader_t - From bytearray_t") {
+	std::vector<std::uint8_t> vec{test_data.begin(), test_data.end()};
+	bytearray_t buff{vec};
+	reader_t rdr{buff};
+
+	CHECK_EQ(rdr.length(), 16zu);
+	CHECK_EQ(rdr.offset(), 0zu);
+	CHECK_EQ(rdr.remaining(), 16zu);
+
+	REQUIRE(rdr.require(8zu));
+	CHECK_EQ((rdr.next_unchecked<std::uint16_t, std::endian::big>()), 0x0102U);
+	CHECK_EQ((rdr.next_unchecked<std::uint16_t, std::endian::little>()), 0x0403U);
+	CHECK_EQ(std::uint32_t(rdr.next_unchecked<uint24_t, std::endian::big>()), 0x050607U);
+	CHECK_EQ((rdr.peek_unchecked<std::uint8_t, std::endian::big>()), 0x08U);
+	CHECK_EQ((rdr.next_unchecked<std::uint8_t, std::endian::big>()), 0x08U);
+	CHECK_EQ(rdr.offset(), 8zu);
+	CHECK_EQ(rdr.remaining(), 8zu);
+
+	CHECK_EQ((rdr.next<std::int16_t, std::endian::big>()), std::int16_t{-2});
+	CHECK_EQ((rdr.next<std::uint16_t, std::endian::big>()), 0xFDFCU);
+	CHECK_EQ((rdr.next<std::float32_t, std::endian::big>()), std::float32_t{1.0f});
+	CHECK_EQ(rdr.remaining(), 0zu);
+	CHECK(rdr.ok());
+}
+
+TEST_CASE("reader_t - Sticky truncation") {
+	reader_t rdr{std::as_bytes(std::span{test_data})};
+
+	CHECK_EQ((rdr.next_or<std::uint64_t, std::endian::big>()), 0x0102030405060708U);
+	CHECK_EQ((rdr.next_or<std::uint32_t, std::endian::big>()), 0xFFFEFDFCU);
+	CHECK(rdr.ok());
+
+	CHECK_EQ((rdr.next_or<std::uint64_t, std::endian::big>(0xDEADU)), 0xDEADU);
+	CHECK(rdr.truncated());
+	CHECK_FALSE(static_cast<bool>(rdr));
+	CHECK_EQ(rdr.offset(), 12zu);
+
+	/* Once truncated, everything fails even if it would otherwise fit */
+	CHECK_EQ((rdr.next_or<std::uint8_t, std::endian::big>()), 0x00U);
+	CHECK_FALSE(rdr.require(1zu));
+	CHECK_FALSE(rdr.skip(1zu));
+	CHECK_FALSE((rdr.next<std::uint8_t, std::endian::big>()).has_value());
+	CHECK_EQ(rdr.offset(), 12zu);
+}
+
+TEST_CASE("reader_t - require") {
+	reader_t rdr{std::as_bytes(std::span{test_data})};
+
+	CHECK(rdr.require(16zu));
+	CHECK(rdr.ok());
+	CHECK_FALSE(rdr.require(17zu));
+	CHECK(rdr.truncated());
+}
+
+TEST_CASE("reader_t - peek") {
+	reader_t rdr{std::as_bytes(std::span{test_data})};
+
+	CHECK_EQ((rdr.peek<std::uint32_t, std::endian::big>(12zu)), 0x3F800000U);
+	CHECK_FALSE((rdr.peek<std::uint32_t, std::endian::big>(13zu)).has_value());
+	CHECK_FALSE((rdr.peek<std::uint8_t, std::endian::big>(32zu)).has_value());
+	CHECK_EQ(rdr.offset(), 0zu);
+	CHECK(rdr.ok());
+}
+
+TEST_CASE("reader_t - skip and seek") {
+	reader_t rdr{std::as_bytes(std::span{test_data})};
+
+	CHECK(rdr.skip(4zu));
+	CHECK_EQ((rdr.next<std::uint8_t, std::endian::big>()), 0x05U);
+	CHECK(rdr.seek(1zu));
+	CHECK_EQ((rdr.next<std::uint8_t, std::endian::big>()), 0x02U);
+	CHECK(rdr.seek(16zu));
+	CHECK_EQ(rdr.remaining(), 0zu);
+	CHECK(rdr.ok());
+	CHECK_FALSE(rdr.seek(17zu));
+	CHECK(rdr.truncated());
+}
+
+TEST_CASE("reader_t - bytes and sub") {
+	reader_t rdr{std::as_bytes(std::span{test_data})};
+
+	const auto hdr{rdr.bytes(2zu)};
+	REQUIRE(hdr.has_value());
+	CHECK_EQ(hdr->size(), 2zu);
+	CHECK_EQ((*hdr)[1], std::byte{0x02U});
+
+	auto body{rdr.sub(4zu)};
+	REQUIRE(body.has_value());
+	CHECK_EQ(body->length(), 4zu);
+	CHECK_EQ((body->next<std::uint32_t, std::endian::big>()), 0x03040506U);
+	CHECK_FALSE((body->next<std::uint8_t, std::endian::big>()).has_value());
+	CHECK(body->truncated());
+
+	/* A truncated sub-reader does not poison the parent */
+	CHECK(rdr.ok());
+	CHECK_EQ(rdr.offset(), 6zu);
+	CHECK_EQ(rdr.rest().size(), 10zu);
+
+	CHECK_FALSE(rdr.sub(11zu).has_value());
+	CHECK(rdr.truncated());
+}
+
+TEST_CASE("reader_t - read_error_message") {
+	CHECK_FALSE(Panko::core::error_codes::read_error_message(read_error_t::Truncated).empty());
+	CHECK_FALSE(Panko::core::error_codes::read_error_message(read_error_t::Unspecified).empty());
+	CHECK_FALSE(Panko::core::error_codes::read_error_message(read_error_t::Malformed).empty());
+}
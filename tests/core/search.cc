@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* search.cc - pattern_searcher_t and multi_searcher_t test harness */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/config.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/bytearray_chain.hh"
+#include "panko/core/search.hh"
+
+using Panko::core::bytearray_t;
+using Panko::core::bytearray_chain_t;
+using Panko::core::multi_searcher_t;
+using Panko::core::pattern_searcher_t;
+using Panko::core::search_match_t;
+
+namespace {
+	/* Deterministic filler from a small alphabet, so that partial matches are common */
+	[[nodiscard]]
+	std::vector<std::uint8_t> noise(const std::size_t len, std::uint32_t seed) {
+		std::vector<std::uint8_t> data(len);
+		for (auto& byte : data) {
+			seed ^= seed << 13U;
+			seed ^= seed >> 17U;
+			seed ^= seed << 5U;
+			byte = static_cast<std::uint8_t>('a' + (seed % 4U));
+		}
+		return data;
+	}
+
+	[[nodiscard]]
+	std::span<const std::byte> as_span(const std::vector<std::uint8_t>& vec) noexcept {
+		return std::as_bytes(std::span{vec});
+	}
+
+	[[nodiscard]]
+	std::size_t naive_find(const std::vector<std::uint8_t>& data, const std::string_view pattern, const std::size_t from) {
+		const std::string_view haystack{reinterpret_cast<const char*>(data.data()), data.size()};
+		const auto found{haystack.find(pattern, from)};
+		return found == std::string_view::npos ? pattern_searcher_t::npos : found;
+	}
+
+	/* Every occurrence of every pattern, in the order they end and then by pattern */
+	[[nodiscard]]
+	std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> naive_scan(
+		const std::vector<std::uint8_t>& data, const std::vector<std::string_view>& patterns
+	) {
+		const std::string_view haystack{reinterpret_cast<const char*>(data.data()), data.size()};
+		std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> matches{};
+		for (std::size_t end{}; end < data.size(); ++end) {
+			for (std::size_t idx{}; idx < patterns.size(); ++idx) {
+				const auto len{patterns[idx].size()};
+				if (len <= (end + 1zu) && haystack.substr((end + 1zu) - len, len) == patterns[idx]) {
+					matches.emplace_back(end, idx, (end + 1zu) - len);
+				}
+			}
+		}
+		return matches;
+	}
+
+	/* Split `data` into fragments of `size` bytes */
+	[[nodiscard]]
+	bytearray_chain_t split(std::vector<std::uint8_t>& data, const std::size_t size) {
+		bytearray_chain_t chain{};
+		bytearray_t whole{data};
+		for (std::size_t start{}; start < data.size(); start += size) {
+			auto fragment{whole.slice(start, std::min(start + size, data.size()) - 1zu)};
+			chain.append(fragment);
+		}
+		return chain;
+	}
+}
+
+TEST_CASE("pattern_searcher_t - find") {
+	const std::vector<std::uint8_t> data{'G', 'E', 'T', ' ', '/', 'b', 'i', 'n', '/', 's', 'h', ' ', '/', 'b', 'i', 'n'};
+
+	CHECK_EQ(pattern_searcher_t{"/bin"}.find(as_span(data)), 4zu);
+	CHECK_EQ(pattern_searcher_t{"/bin"}.find(as_span(data), 5zu), 12zu);
+	CHECK_EQ(pattern_searcher_t{"/bin"}.find(as_span(data), 13zu), pattern_searcher_t::npos);
+	CHECK_EQ(pattern_searcher_t{"GET"}.find(as_span(data)), 0zu);
+	CHECK_EQ(pattern_searcher_t{"s"}.find(as_span(data)), 9zu);
+	CHECK_EQ(pattern_searcher_t{"sh"}.find(as_span(data)), 9zu);
+	CHECK_EQ(pattern_searcher_t{"/bin/sh /bin"}.find(as_span(data)), 4zu);
+	CHECK_EQ(pattern_searcher_t{"POST"}.find(as_span(data)), pattern_searcher_t::npos);
+	CHECK_EQ(pattern_searcher_t{"GET /bin/sh /bin!"}.find(as_span(data)), pattern_searcher_t::npos);
+
+	/* An empty pattern is found wherever the search starts */
+	CHECK_EQ(pattern_searcher_t{""}.find(as_span(data), 3zu), 3zu);
+	CHECK_EQ(pattern_searcher_t{""}.find(as_span(data), 16zu), 16zu);
+	CHECK_EQ(pattern_searcher_t{""}.find(as_span(data), 17zu), pattern_searcher_t::npos);
+	CHECK_EQ(pattern_searcher_t{"GET"}.find(as_span(data), 100zu), pattern_searcher_t::npos);
+}
+
+TEST_CASE("pattern_searcher_t - Against a naive search") {
+	/* Long enough to run through the vector kernels and their scalar tails */
+	const auto data{noise(1021zu, 0xC0FFEEU)};
+
+	for (const auto pattern : std::vector<std::string_view>{
+		"a", "ab", "dca", "abcd", "aaaaa", "bdcab", "cabbacd", "abcdabcdabcdabcdabcdabcdabcdabcdabcd",
+	}) {
+		const pattern_searcher_t searcher{pattern};
+		for (std::size_t from{}; from <= data.size(); from += 7zu) {
+			CHECK_EQ(searcher.find(as_span(data), from), naive_find(data, pattern, from));
+		}
+	}
+}
+
+TEST_CASE("pattern_searcher_t - bytearray_t") {
+	std::vector<std::uint8_t> data{'x', 'x', 'e', 'v', 'i', 'l', 'x'};
+	bytearray_t buff{data};
+	auto slice{buff.slice(3zu, 6zu)};
+
+	const pattern_searcher_t searcher{"evil"};
+	CHECK_EQ(searcher.find(buff), 2zu);
+	CHECK_EQ(searcher.find(slice), pattern_searcher_t::npos);
+	CHECK_EQ(pattern_searcher_t{"vil"}.find(slice), 0zu);
+}
+
+TEST_CASE("pattern_searcher_t - bytearray_chain_t") {
+	auto data{noise(300zu, 0x5EEDU)};
+
+	for (const auto fragment : {1zu, 2zu, 3zu, 5zu, 16zu, 64zu, 300zu}) {
+		auto chain{split(data, fragment)};
+		for (const auto pattern : std::vector<std::string_view>{"a", "dc", "abca", "cabbacd", "ddddddddddddd"}) {
+			const pattern_searcher_t searcher{pattern};
+			for (std::size_t from{}; from <= data.size(); from += 11zu) {
+				CHECK_EQ(searcher.find(chain, from), naive_find(data, pattern, from));
+			}
+		}
+	}
+}
+
+TEST_CASE("multi_searcher_t - scan") {
+	const std::vector<std::uint8_t> data{'u', 's', 'h', 'e', 'r', 's'};
+	const multi_searcher_t searcher{"he", "she", "his", "hers"};
+
+	CHECK_EQ(searcher.patterns(), 4zu);
+
+	std::vector<search_match_t> matches{};
+	searcher.scan(as_span(data), [&](const search_match_t& match) {
+		matches.push_back(match);
+	});
+
+	REQUIRE(matches.size() == 3zu);
+	CHECK_EQ(matches[0].pattern, 1zu);
+	CHECK_EQ(matches[0].offset, 1zu);
+	CHECK_EQ(matches[0].length, 3zu);
+	CHECK_EQ(matches[1].pattern, 0zu);
+	CHECK_EQ(matches[1].offset, 2zu);
+	CHECK_EQ(matches[2].pattern, 3zu);
+	CHECK_EQ(matches[2].offset, 2zu);
+	CHECK_EQ(matches[2].length, 4zu);
+
+	/* Stopping early */
+	std::size_t seen{};
+	searcher.scan(as_span(data), [&](const search_match_t&) {
+		++seen;
+		return false;
+	});
+	CHECK_EQ(seen, 1zu);
+
+	const auto first{searcher.find_first(as_span(data))};
+	REQUIRE(first.has_value());
+	CHECK_EQ(first->pattern, 1zu);
+	CHECK_FALSE(searcher.find_first(as_span(std::vector<std::uint8_t>{'n', 'o', 'p', 'e'})).has_value());
+}
+
+TEST_CASE("multi_searcher_t - Against a naive search") {
+	const auto data{noise(2048zu, 0xBADF00DU)};
+
+	for (const auto& patterns : std::vector<std::vector<std::string_view>>{
+		/* Few starting bytes, so the prefilter is used */
+		{"abc", "bcd", "cc", "dddd"},
+		/* Patterns that are prefixes and suffixes of each other, and a duplicate */
+		{"a", "ab", "abab", "bab", "b", "ab"},
+		/* Bytes that never appear in the data */
+		{"xyz", "abx", "\xFF\x80", "dcba"},
+	}) {
+		const multi_searcher_t searcher{std::span<const std::string_view>{patterns}};
+
+		std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> matches{};
+		searcher.scan(as_span(data), [&](const search_match_t& match) {
+			matches.emplace_back(match.offset + match.length - 1zu, match.pattern, match.offset);
+		});
+		/* Matches that end at the same byte are reported longest first, so sort those by pattern */
+		std::sort(matches.begin(), matches.end());
+		CHECK(matches == naive_scan(data, patterns));
+	}
+}
+
+TEST_CASE("multi_searcher_t - Prefilter") {
+	/* The starting bytes are either side of the high bit, and share low nibbles with bytes that aren't */
+	std::vector<std::uint8_t> data(200zu, 0x10U);
+	data[37] = 0x81U;
+	data[38] = 0x01U;
+	data[150] = 0x01U;
+	data[151] = 0x81U;
+	data[199] = 0x91U;
+
+	const std::string_view forward{"\x81\x01"};
+	const std::string_view backward{"\x01\x81"};
+	const std::string_view last{"\x91"};
+	const multi_searcher_t searcher{forward, backward, last};
+
+	std::vector<std::size_t> offsets{};
+	searcher.scan(as_span(data), [&](const search_match_t& match) {
+		offsets.push_back(match.offset);
+	});
+	CHECK(offsets == std::vector<std::size_t>{37zu, 150zu, 199zu});
+}
+
+TEST_CASE("multi_searcher_t - bytearray_t and bytearray_chain_t") {
+	auto data{noise(500zu, 0xFEEDU)};
+	const std::vector<std::string_view> patterns{"abcd", "dcb", "aaa", "cabbacd"};
+	const multi_searcher_t searcher{std::span<const std::string_view>{patterns}};
+
+	std::vector<std::tuple<std::size_t, std::size_t>> expected{};
+	bytearray_t buff{data};
+	searcher.scan(buff, [&](const search_match_t& match) {
+		expected.emplace_back(match.pattern, match.offset);
+	});
+	CHECK_FALSE(expected.empty());
+
+	for (const auto fragment : {1zu, 2zu, 7zu, 100zu, 500zu}) {
+		auto chain{split(data, fragment)};
+		std::vector<std::tuple<std::size_t, std::size_t>> found{};
+		searcher.scan(chain, [&](const search_match_t& match) {
+			found.emplace_back(match.pattern, match.offset);
+		});
+		CHECK(found == expected);
+	}
+}
+
+TEST_CASE("multi_searcher_t - Invalid patterns") {
+	CHECK_THROWS_AS((multi_searcher_t{"abc", ""}), std::invalid_argument);
+}
@@ -1,11 +1,293 @@
 // SPDX-License-Identifier: BSD-3-Clause
 /* strutils.cc - String utilities test harness */
 
+#include <array>
+#include <bit>
+#include <cstddef>
 #include <cstring>
 #include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest.h>
 
 
 #include "panko/core/strutils.hh"
+
+using Panko::core::strutils::utf8_valid_prefix;
+using Panko::core::strutils::utf8_valid;
+using Panko::core::strutils::find_nul;
+using Panko::core::strutils::ascii_valid_prefix;
+using Panko::core::strutils::ascii_valid;
+using Panko::core::strutils::utf16_valid_prefix;
+using Panko::core::strutils::utf32_valid_prefix;
+using Panko::core::strutils::utf16_from_bytes;
+using Panko::core::strutils::utf32_from_bytes;
+using Panko::core::strutils::find_nul16;
+using Panko::core::strutils::find_nul32;
+using Panko::core::strutils::ebcdic_to_latin1;
+using Panko::core::strutils::shiftjis_to_wide;
+
+namespace {
+	[[nodiscard]]
+	std::span<const std::byte> as_span(const std::vector<std::uint8_t>& vec) noexcept {
+		return std::as_bytes(std::span{vec});
+	}
+}
+
+TEST_CASE("strutils - utf8_valid_prefix") {
+	CHECK_EQ(utf8_valid_prefix({}), 0zu);
+	CHECK(utf8_valid(as_span({ 0x41U, 0xC3U, 0xA9U, 0xE2U, 0x82U, 0xACU, 0xF0U, 0x9FU, 0x90U, 0x9FU, })));
+
+	/* Boundary code points */
+	CHECK(utf8_valid(as_span({ 0xC2U, 0x80U, 0xDFU, 0xBFU, })));
+	CHECK(utf8_valid(as_span({ 0xE0U, 0xA0U, 0x80U, 0xEDU, 0x9FU, 0xBFU, 0xEEU, 0x80U, 0x80U, })));
+	CHECK(utf8_valid(as_span({ 0xF0U, 0x90U, 0x80U, 0x80U, 0xF4U, 0x8FU, 0xBFU, 0xBFU, })));
+
+	/* Overlong */
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0xC1U, 0xBFU, })), 1zu);
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0xE0U, 0x9FU, 0xBFU, })), 1zu);
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0xF0U, 0x8FU, 0xBFU, 0xBFU, })), 1zu);
+	/* Surrogates */
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0xEDU, 0xA0U, 0x80U, })), 1zu);
+	/* Above U+10FFFF */
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0xF4U, 0x90U, 0x80U, 0x80U, })), 1zu);
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0xF5U, 0x80U, 0x80U, 0x80U, })), 1zu);
+	/* Stray continuation and truncated sequences */
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0x80U, })), 1zu);
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0xE2U, 0x82U, })), 1zu);
+	CHECK_EQ(utf8_valid_prefix(as_span({ 0x41U, 0xE2U, 0x41U, })), 1zu);
+}
+
+TEST_CASE("strutils - utf8_valid_prefix (long)") {
+	/* Every position of an error relative to the vector block boundaries */
+	for (std::size_t len{1zu}; len < 200zu; ++len) {
+		std::vector<std::uint8_t> vec{};
+		while (vec.size() < len) {
+			vec.insert(vec.end(), { 0x61U, 0xC3U, 0xA9U, 0xE2U, 0x82U, 0xACU, });
+		}
+		vec.resize(len);
+
+		/* A code point cut off by the length is not part of the valid prefix */
+		constexpr std::array<std::size_t, 6> cut_off{{ 0zu, 0zu, 1zu, 0zu, 1zu, 2zu, }};
+		CHECK_EQ(utf8_valid_prefix(as_span(vec)), len - cut_off[len % 6zu]);
+
+		for (std::size_t idx{}; idx < len; idx += 6zu) {
+			auto bad{vec};
+			bad[idx] = 0xFFU;
+			CHECK_EQ(utf8_valid_prefix(as_span(bad)), idx);
+		}
+	}
+}
+
+TEST_CASE("strutils - ascii_valid_prefix") {
+	CHECK_EQ(ascii_valid_prefix({}), 0zu);
+	CHECK(ascii_valid(as_span({ 0x00U, 0x41U, 0x7FU, })));
+	CHECK_FALSE(ascii_valid(as_span({ 0x41U, 0x80U, })));
+
+	for (std::size_t len{1zu}; len < 200zu; ++len) {
+		std::vector<std::uint8_t> vec(len, 0x7FU);
+		CHECK_EQ(ascii_valid_prefix(as_span(vec)), len);
+
+		for (std::size_t idx{}; idx < len; idx += 7zu) {
+			auto bad{vec};
+			bad[idx] = 0x80U;
+			bad[len - 1zu] = 0xFFU;
+			CHECK_EQ(ascii_valid_prefix(as_span(bad)), idx);
+		}
+	}
+}
+
+TEST_CASE("strutils - find_nul") {
+	CHECK_EQ(find_nul({}), 0zu);
+
+	for (std::size_t len{1zu}; len < 200zu; ++len) {
+		std::vector<std::uint8_t> vec(len, 0x61U);
+		CHECK_EQ(find_nul(as_span(vec)), len);
+
+		vec[len / 2zu] = 0x00U;
+		vec[len - 1zu] = 0x00U;
+		CHECK_EQ(find_nul(as_span(vec)), len / 2zu);
+	}
+}
+
+TEST_CASE("strutils - utf16_valid_prefix") {
+	CHECK_EQ(utf16_valid_prefix({}), 0zu);
+
+	for (std::size_t len{1zu}; len < 100zu; ++len) {
+		std::vector<char16_t> vec{};
+		while (vec.size() < len) {
+			vec.insert(vec.end(), { u'a', char16_t{0xD83DU}, char16_t{0xDC1FU}, });
+		}
+		vec.resize(len);
+
+		/* A high surrogate cut off by the length is not part of the valid prefix */
+		CHECK_EQ(utf16_valid_prefix(vec), (len % 3zu) == 2zu ? len - 1zu : len);
+
+		for (std::size_t idx{2zu}; idx < len; idx += 3zu) {
+			auto bad{vec};
+			bad[idx - 1zu] = u'b';
+			CHECK_EQ(utf16_valid_prefix(bad), idx);
+		}
+	}
+}
+
+TEST_CASE("strutils - utf32_valid_prefix") {
+	CHECK_EQ(utf32_valid_prefix({}), 0zu);
+
+	for (std::size_t len{1zu}; len < 60zu; ++len) {
+		std::vector<char32_t> vec(len, U'\U0010FFFF');
+		CHECK_EQ(utf32_valid_prefix(vec), len);
+
+		auto surrogate{vec};
+		surrogate[len / 2zu] = char32_t{0xDFFFU};
+		CHECK_EQ(utf32_valid_prefix(surrogate), len / 2zu);
+
+		auto too_big{vec};
+		too_big[len - 1zu] = char32_t{0x110000U};
+		CHECK_EQ(utf32_valid_prefix(too_big), len - 1zu);
+	}
+}
+
+TEST_CASE("strutils - utf16_from_bytes") {
+	for (std::size_t len{}; len < 50zu; ++len) {
+		std::vector<std::uint8_t> vec{};
+		for (std::size_t idx{}; idx < len; ++idx) {
+			vec.insert(vec.end(), { static_cast<std::uint8_t>(idx), 0xA0U, });
+		}
+
+		std::vector<char16_t> little(len);
+		std::vector<char16_t> big(len);
+		utf16_from_bytes(little, as_span(vec), std::endian::little);
+		utf16_from_bytes(big, as_span(vec), std::endian::big);
+		for (std::size_t idx{}; idx < len; ++idx) {
+			CHECK_EQ(little[idx], static_cast<char16_t>(0xA000U | idx));
+			CHECK_EQ(big[idx], static_cast<char16_t>((idx << 8U) | 0xA0U));
+		}
+	}
+}
+
+TEST_CASE("strutils - utf32_from_bytes") {
+	for (std::size_t len{}; len < 30zu; ++len) {
+		std::vector<std::uint8_t> vec{};
+		for (std::size_t idx{}; idx < len; ++idx) {
+			vec.insert(vec.end(), { static_cast<std::uint8_t>(idx), 0x01U, 0x02U, 0x00U, });
+		}
+
+		std::vector<char32_t> little(len);
+		std::vector<char32_t> big(len);
+		utf32_from_bytes(little, as_span(vec), std::endian::little);
+		utf32_from_bytes(big, as_span(vec), std::endian::big);
+		for (std::size_t idx{}; idx < len; ++idx) {
+			CHECK_EQ(little[idx], static_cast<char32_t>(0x00020100U | idx));
+			CHECK_EQ(big[idx], static_cast<char32_t>((idx << 24U) | 0x00010200U));
+		}
+	}
+}
+
+TEST_CASE("strutils - find_nul16") {
+	CHECK_EQ(find_nul16({}), 0zu);
+
+	for (std::size_t len{1zu}; len < 60zu; ++len) {
+		/* Null bytes that straddle two code units are not a null code unit */
+		std::vector<std::uint8_t> vec(len * 2zu, 0x00U);
+		for (std::size_t idx{}; idx < vec.size(); ++idx) {
+			if ((idx % 4zu) == 0zu || (idx % 4zu) == 3zu) {
+				vec[idx] = 0x61U;
+			}
+		}
+		CHECK_EQ(find_nul16(as_span(vec)), len);
+
+		vec.push_back(0x00U);
+		CHECK_EQ(find_nul16(as_span(vec)), len);
+
+		vec[(len / 2zu) * 2zu] = 0x00U;
+		vec[((len / 2zu) * 2zu) + 1zu] = 0x00U;
+		CHECK_EQ(find_nul16(as_span(vec)), len / 2zu);
+	}
+}
+
+TEST_CASE("strutils - find_nul32") {
+	CHECK_EQ(find_nul32({}), 0zu);
+
+	for (std::size_t len{1zu}; len < 40zu; ++len) {
+		std::vector<std::uint8_t> vec(len * 4zu, 0x00U);
+		for (std::size_t idx{}; idx < vec.size(); idx += 4zu) {
+			vec[idx + (idx / 4zu) % 4zu] = 0x61U;
+		}
+		CHECK_EQ(find_nul32(as_span(vec)), len);
+
+		vec[(len / 2zu) * 4zu + ((len / 2zu) % 4zu)] = 0x00U;
+		CHECK_EQ(find_nul32(as_span(vec)), len / 2zu);
+	}
+}
+
+TEST_CASE("strutils - ebcdic_to_latin1") {
+	std::vector<std::uint8_t> vec(512zu);
+	for (std::size_t idx{}; idx < vec.size(); ++idx) {
+		vec[idx] = static_cast<std::uint8_t>((idx * 7zu) + (idx / 256zu));
+	}
+
+	/* Every length, so that every byte goes through both the vectorized and scalar paths */
+	for (std::size_t len{}; len <= vec.size(); len += 13zu) {
+		std::vector<char> out(len);
+		ebcdic_to_latin1(out, as_span(vec).first(len));
+		for (std::size_t idx{}; idx < len; ++idx) {
+			std::array<char, 1> single{};
+			ebcdic_to_latin1(single, as_span(vec).subspan(idx, 1zu));
+			CHECK_EQ(out[idx], single[0]);
+		}
+	}
+
+	/* CP037 is a permutation of Latin-1 */
+	std::vector<char> out(vec.size());
+	ebcdic_to_latin1(out, as_span(vec));
+	std::array<bool, 256> seen{};
+	for (std::size_t idx{}; idx < 256zu; ++idx) {
+		seen[static_cast<std::uint8_t>(out[idx])] = true;
+	}
+	for (const auto found : seen) {
+		CHECK(found);
+	}
+
+	std::vector<std::uint8_t> hello{ 0xC8U, 0x85U, 0x93U, 0x93U, 0x96U, 0x5AU, };
+	std::array<char, 6> hello_out{};
+	ebcdic_to_latin1(hello_out, as_span(hello));
+	CHECK(std::string_view{hello_out.data(), hello_out.size()} == "Hello!");
+}
+
+TEST_CASE("strutils - shiftjis_to_wide") {
+	std::vector<wchar_t> out(16zu);
+	CHECK_EQ(shiftjis_to_wide(out, {}), 0zu);
+
+	/* Half-width katakana and the first and last JIS X 0208 characters */
+	std::vector<std::uint8_t> vec{ 0xA1U, 0xDFU, 0x81U, 0x40U, 0xEAU, 0xA4U, };
+	REQUIRE(shiftjis_to_wide(out, as_span(vec)) == 4zu);
+	CHECK_EQ(out[0], static_cast<wchar_t>(0xFF61U));
+	CHECK_EQ(out[1], static_cast<wchar_t>(0xFF9FU));
+	CHECK_EQ(out[2], static_cast<wchar_t>(0x3000U));
+	CHECK_EQ(out[3], static_cast<wchar_t>(0x7199U));
+
+	/* Invalid lead and trail bytes */
+	CHECK_EQ(shiftjis_to_wide(out, as_span({ 0x41U, 0x80U, })), 1zu);
+	CHECK_EQ(shiftjis_to_wide(out, as_span({ 0x41U, 0xA0U, })), 1zu);
+	CHECK_EQ(shiftjis_to_wide(out, as_span({ 0x41U, 0xF0U, 0x40U, })), 1zu);
+	CHECK_EQ(shiftjis_to_wide(out, as_span({ 0x41U, 0x81U, 0x7FU, })), 1zu);
+	CHECK_EQ(shiftjis_to_wide(out, as_span({ 0x41U, 0x81U, 0x3FU, })), 1zu);
+	CHECK_EQ(shiftjis_to_wide(out, as_span({ 0x41U, 0x81U, })), 1zu);
+
+	/* ASCII runs of every length around the vector widths */
+	for (std::size_t len{}; len < 100zu; ++len) {
+		std::vector<std::uint8_t> run(len, 0x7EU);
+		run.insert(run.end(), { 0x83U, 0x65U, 0x30U, });
+		std::vector<wchar_t> run_out(run.size());
+		REQUIRE(shiftjis_to_wide(run_out, as_span(run)) == len + 2zu);
+		for (std::size_t idx{}; idx < len; ++idx) {
+			CHECK_EQ(run_out[idx], L'~');
+		}
+		CHECK_EQ(run_out[len], static_cast<wchar_t>(0x30C6U));
+		CHECK_EQ(run_out[len + 1zu], L'0');
+	}
+}
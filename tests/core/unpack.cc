@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* unpack.cc - Bulk packed integer unpacking test harness */
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/config.hh"
+#include "panko/core/bytearray.hh"
+#include "panko/core/endian.hh"
+#include "panko/core/integers.hh"
+#include "panko/core/unpack.hh"
+
+using Panko::core::bytearray_t;
+using Panko::core::unpack;
+using Panko::core::unpack_bits;
+using namespace Panko::core::integers;
+
+namespace {
+	[[nodiscard]]
+	std::vector<std::uint8_t> noise(const std::size_t len, std::uint32_t seed) {
+		std::vector<std::uint8_t> data(len);
+		for (auto& byte : data) {
+			seed ^= seed << 13U;
+			seed ^= seed >> 17U;
+			seed ^= seed << 5U;
+			byte = static_cast<std::uint8_t>(seed >> 24U);
+		}
+		return data;
+	}
+
+	/* Read value `idx` of a packed bit stream one bit at a time */
+	template<std::size_t bits, std::endian endian, typename U>
+	[[nodiscard]]
+	U reference(const std::vector<std::uint8_t>& data, const std::size_t idx) noexcept {
+		std::uint64_t value{};
+		for (std::size_t bit{}; bit < bits; ++bit) {
+			const auto pos{(idx * bits) + bit};
+			if constexpr (endian == std::endian::big) {
+				value = (value << 1U) | ((std::uint64_t{data[pos / 8zu]} >> (7zu - (pos % 8zu))) & 1U);
+			} else {
+				value |= ((std::uint64_t{data[pos / 8zu]} >> (pos % 8zu)) & 1U) << bit;
+			}
+		}
+		if constexpr (std::is_signed_v<U> && bits < (sizeof(U) * 8zu)) {
+			const auto sign{1ULL << (bits - 1zu)};
+			value = (value ^ sign) - sign;
+		}
+		return static_cast<U>(value);
+	}
+
+	/* Unpack every length up to past a few vectors, so the vector kernels and scalar tails are all covered */
+	template<std::size_t bits, std::endian endian, typename U>
+	void check_against_reference() {
+		const auto data{noise(((bits * 100zu) + 7zu) / 8zu, 0xC0FFEEU + bits)};
+		const auto src{std::as_bytes(std::span{data})};
+
+		for (std::size_t count{}; count <= 100zu; ++count) {
+			std::vector<U> dst(count);
+			REQUIRE(unpack_bits<bits, endian>(src, std::span{dst}) == count);
+			for (std::size_t idx{}; idx < count; ++idx) {
+				CHECK_EQ(dst[idx], (reference<bits, endian, U>(data, idx)));
+			}
+		}
+	}
+}
+
+TEST_CASE("unpack - 24-bit") {
+	const std::vector<std::uint8_t> data{0x01U, 0x02U, 0x03U, 0xFFU, 0xFFU, 0xFEU, 0x80U, 0x00U, 0x00U};
+	const auto src{std::as_bytes(std::span{data})};
+
+	std::array<std::uint32_t, 3> be{};
+	CHECK_EQ((unpack<uint24_t, std::endian::big>(src, std::span{be})), 3zu);
+	CHECK_EQ(be[0], 0x01'0203U);
+	CHECK_EQ(be[1], 0xFF'FFFEU);
+	CHECK_EQ(be[2], 0x80'0000U);
+
+	std::array<std::int32_t, 3> be_signed{};
+	CHECK_EQ((unpack<int24_t, std::endian::big>(src, std::span{be_signed})), 3zu);
+	CHECK_EQ(be_signed[0], 0x01'0203);
+	CHECK_EQ(be_signed[1], -2);
+	CHECK_EQ(be_signed[2], -0x80'0000);
+
+	std::array<std::uint32_t, 3> le{};
+	CHECK_EQ((unpack<uint24_t, std::endian::little>(src, std::span{le})), 3zu);
+	CHECK_EQ(le[0], 0x03'0201U);
+	CHECK_EQ(le[1], 0xFE'FFFFU);
+	CHECK_EQ(le[2], 0x00'0080U);
+
+	/* Only as many as there are in the source */
+	std::array<std::uint32_t, 8> more{};
+	CHECK_EQ((unpack<uint24_t, std::endian::big>(src.first(8zu), std::span{more})), 2zu);
+	CHECK_EQ((unpack<uint24_t, std::endian::big>(src.first(2zu), std::span{more})), 0zu);
+}
+
+TEST_CASE("unpack - 12-bit and 20-bit") {
+	/* 0x123 0x456 and 0xABC 0xDEF */
+	const std::vector<std::uint8_t> data{0x12U, 0x34U, 0x56U, 0xABU, 0xCDU, 0xEFU};
+	const auto src{std::as_bytes(std::span{data})};
+
+	std::array<std::uint16_t, 4> be{};
+	CHECK_EQ((unpack_bits<12zu, std::endian::big>(src, std::span{be})), 4zu);
+	CHECK(be == std::array<std::uint16_t, 4>{{0x123U, 0x456U, 0xABCU, 0xDEFU}});
+
+	std::array<std::int16_t, 4> be_signed{};
+	CHECK_EQ((unpack_bits<12zu, std::endian::big>(src, std::span{be_signed})), 4zu);
+	CHECK(be_signed == std::array<std::int16_t, 4>{{0x123, 0x456, -0x544, -0x211}});
+
+	std::array<std::uint16_t, 4> le{};
+	CHECK_EQ((unpack_bits<12zu, std::endian::little>(src, std::span{le})), 4zu);
+	CHECK(le == std::array<std::uint16_t, 4>{{0x412U, 0x563U, 0xDABU, 0xEFCU}});
+
+	std::array<std::uint32_t, 2> be20{};
+	CHECK_EQ((unpack_bits<20zu, std::endian::big>(std::as_bytes(std::span{data}).first(5zu), std::span{be20})), 2zu);
+	CHECK(be20 == std::array<std::uint32_t, 2>{{0x1'2345U, 0x6'ABCDU}});
+}
+
+TEST_CASE("unpack - Against a bit at a time reference") {
+	check_against_reference<12zu, std::endian::big, std::uint16_t>();
+	check_against_reference<12zu, std::endian::little, std::int16_t>();
+	check_against_reference<12zu, std::endian::big, std::int32_t>();
+	check_against_reference<16zu, std::endian::big, std::uint16_t>();
+	check_against_reference<20zu, std::endian::big, std::int32_t>();
+	check_against_reference<20zu, std::endian::little, std::uint32_t>();
+	check_against_reference<24zu, std::endian::big, std::int32_t>();
+	check_against_reference<24zu, std::endian::little, std::uint32_t>();
+	check_against_reference<24zu, std::endian::big, std::int64_t>();
+	check_against_reference<32zu, std::endian::big, std::uint32_t>();
+	check_against_reference<40zu, std::endian::big, std::int64_t>();
+	check_against_reference<40zu, std::endian::little, std::uint64_t>();
+	check_against_reference<44zu, std::endian::big, std::int64_t>();
+	check_against_reference<48zu, std::endian::big, std::uint64_t>();
+	check_against_reference<48zu, std::endian::little, std::int64_t>();
+	check_against_reference<56zu, std::endian::little, std::int64_t>();
+	check_against_reference<64zu, std::endian::big, std::uint64_t>();
+	/* Widths without a vector layout */
+	check_against_reference<10zu, std::endian::big, std::uint16_t>();
+	check_against_reference<14zu, std::endian::little, std::int16_t>();
+	check_against_reference<50zu, std::endian::big, std::int64_t>();
+}
+
+TEST_CASE("unpack - Matches load") {
+	const auto data{noise(6zu * 64zu, 0xBEEFU)};
+	const auto src{std::as_bytes(std::span{data})};
+
+	std::vector<std::int64_t> dst(64zu);
+	REQUIRE((unpack<int48_t, std::endian::little>(src, std::span{dst})) == 64zu);
+	for (std::size_t idx{}; idx < dst.size(); ++idx) {
+		const auto expected{Panko::core::load<int48_t, std::endian::little>(src.data() + (idx * 6zu))};
+		CHECK_EQ(dst[idx], static_cast<std::int64_t>(expected));
+	}
+}
+
+TEST_CASE("bytearray_t - unpack") {
+	std::vector<std::uint8_t> data{0xAAU, 0x00U, 0x00U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0x12U, 0x34U, 0x56U};
+	bytearray_t buff{data};
+
+	std::array<std::int32_t, 3> values{};
+	buff.unpack<int24_t, std::endian::big>(1zu, std::span{values});
+	CHECK(values == std::array<std::int32_t, 3>{{1, -1, 0x12'3456}});
+
+	std::array<std::uint16_t, 2> packed{};
+	buff.unpack_bits<12zu, std::endian::big>(7zu, std::span{packed});
+	CHECK(packed == std::array<std::uint16_t, 2>{{0x123U, 0x456U}});
+
+	CHECK_THROWS_AS((buff.unpack<int24_t, std::endian::big>(2zu, std::span{values})), std::out_of_range);
+	CHECK_THROWS_AS((buff.unpack_bits<12zu, std::endian::big>(11zu, std::span{packed})), std::out_of_range);
+}
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* dispatch.cc - Dissector handoff table tests */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <string_view>
+#include <system_error>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/dissectors/dispatch.hh"
+
+using Panko::capture::linktype_t;
+using Panko::dissectors::dispatch_table_t;
+using Panko::dissectors::dispatch_tables_t;
+using Panko::dissectors::dissector_id_t;
+using Panko::dissectors::no_dissector;
+using Panko::dissectors::pending_dissector;
+using Panko::support::registration_kind_t;
+using Panko::support::registration_t;
+using Panko::support::so_cache_t;
+using Panko::support::so_loader_t;
+
+using namespace std::literals::string_view_literals;
+
+namespace fs = std::filesystem;
+
+namespace {
+	constexpr auto accept_none{[](const dissector_id_t) { return false; }};
+
+	/* A scratch directory holding copies of some of the test dissectors */
+	struct scratch_t final {
+		fs::path dir;
+
+		scratch_t(const std::string_view name, const std::initializer_list<std::string_view> dissectors) :
+			dir{fs::temp_directory_path() / name}
+		{
+			fs::remove_all(dir);
+			fs::create_directories(dir);
+			for (const auto dissector : dissectors) {
+				fs::copy_file(fs::path{PANKO_TEST_SO_DIR} / dissector, dir / dissector);
+			}
+		}
+
+		~scratch_t() noexcept {
+			std::error_code err{};
+			fs::remove_all(dir, err);
+		}
+	};
+}
+
+TEST_CASE("dispatch_table_t - lookup") {
+	dispatch_table_t<std::uint16_t> table{};
+
+	CHECK_EQ(table[0x0800U], no_dissector);
+	CHECK_EQ(table.set(0x0800U, 1U), no_dissector);
+	CHECK_EQ(table.set(0x86DDU, 2U), no_dissector);
+	CHECK_EQ(table.set(0xFFFFU, 3U), no_dissector);
+	CHECK_EQ(table[0x0800U], 1U);
+	CHECK_EQ(table[0x86DDU], 2U);
+	CHECK_EQ(table[0xFFFFU], 3U);
+	CHECK_EQ(table[0x0000U], no_dissector);
+
+	CHECK_EQ(table.set(0x0800U, 4U), 1U);
+	CHECK_EQ(table[0x0800U], 4U);
+	CHECK_EQ(table.remove(0x0800U), 4U);
+	CHECK_EQ(table[0x0800U], no_dissector);
+
+	dispatch_table_t<std::uint8_t> protos{};
+	CHECK_EQ(protos.set(6U, 7U), no_dissector);
+	CHECK_EQ(protos[6U], 7U);
+	CHECK_EQ(protos[17U], no_dissector);
+}
+
+TEST_CASE("dispatch_table_t - linktype") {
+	dispatch_table_t<linktype_t> table{};
+
+	static_cast<void>(table.set(linktype_t::ETHERNET, 1U));
+	static_cast<void>(table.set(linktype_t::PRIVATE_USE_END, 2U));
+	CHECK_EQ(table[linktype_t::ETHERNET], 1U);
+	CHECK_EQ(table[linktype_t::PRIVATE_USE_END], 2U);
+	CHECK_EQ(table[linktype_t::RAW], no_dissector);
+
+	/* Unassigned LINKTYPEs all share a slot that can never be set */
+	const auto unassigned{static_cast<linktype_t>(0xF000U)};
+	CHECK_EQ(table.set(unassigned, 3U), no_dissector);
+	CHECK_EQ(table[unassigned], no_dissector);
+}
+
+TEST_CASE("dispatch_table_t - fallback") {
+	dispatch_table_t<std::uint16_t> table{};
+	static_cast<void>(table.set(53U, 1U));
+
+	CHECK_EQ(table.dispatch(53U, accept_none), 1U);
+	CHECK_EQ(table.dispatch(54U, accept_none), no_dissector);
+
+	table.set_default(9U);
+	CHECK_EQ(table.default_dissector(), 9U);
+	CHECK_EQ(table.dispatch(54U, accept_none), 9U);
+
+	table.add_heuristic(5U);
+	table.add_heuristic(6U);
+	table.add_heuristic(5U);
+	REQUIRE_EQ(table.heuristics().size(), 2zu);
+
+	std::size_t tried{};
+	const auto accept_six{[&tried](const dissector_id_t id) {
+		++tried;
+		return id == 6U;
+	}};
+	CHECK_EQ(table.dispatch(54U, accept_six), 6U);
+	CHECK_EQ(tried, 2zu);
+
+	/* A registered key never runs the heuristics */
+	tried = 0zu;
+	CHECK_EQ(table.dispatch(53U, accept_six), 1U);
+	CHECK_EQ(tried, 0zu);
+
+	table.remove_heuristic(6U);
+	CHECK_EQ(table.dispatch(54U, accept_six), 9U);
+
+	/* Port pairs prefer the lower port */
+	static_cast<void>(table.set(49152U, 2U));
+	CHECK_EQ(table.dispatch(49152U, 53U, accept_none), 1U);
+	CHECK_EQ(table.dispatch(49152U, 54U, accept_none), 2U);
+	CHECK_EQ(table.dispatch(49153U, 54U, accept_none), 9U);
+}
+
+TEST_CASE("dispatch_tables_t - registrations") {
+	dispatch_tables_t tables{};
+
+	const std::array<registration_t, 7> registrations{{
+		{ registration_kind_t::LinkType,  1U        },
+		{ registration_kind_t::EtherType, 0x88B5U   },
+		{ registration_kind_t::IpProto,   253U      },
+		{ registration_kind_t::TcpPort,   8080U     },
+		{ registration_kind_t::UdpPort,   0x10000U  },
+		{ registration_kind_t::Heuristic, static_cast<std::uint32_t>(registration_kind_t::UdpPort) },
+		{ registration_kind_t::Heuristic, static_cast<std::uint32_t>(registration_kind_t::Heuristic) },
+	}};
+	CHECK_EQ(tables.add(4U, registrations), 5zu);
+
+	CHECK_EQ(tables.linktype[linktype_t::ETHERNET], 4U);
+	CHECK_EQ(tables.ethertype[0x88B5U], 4U);
+	CHECK_EQ(tables.ip_proto[253U], 4U);
+	CHECK_EQ(tables.tcp_port[8080U], 4U);
+	CHECK_EQ(tables.udp_port[0x0000U], no_dissector);
+	REQUIRE_EQ(tables.udp_port.heuristics().size(), 1zu);
+	CHECK_EQ(tables.udp_port.heuristics()[0], 4U);
+	CHECK(tables.tcp_port.heuristics().empty());
+
+	CHECK_FALSE(tables.add(4U, registration_t{registration_kind_t::IpProto, 256U}));
+	CHECK_FALSE(tables.add(4U, registration_t{registration_kind_t::LinkType, 0xF000U}));
+}
+
+TEST_CASE("dispatch_tables_t - pending") {
+	dispatch_table_t<std::uint16_t> table{};
+	std::size_t resolved{};
+	table.set_resolver([&resolved](const std::uint16_t key) {
+		++resolved;
+		return (key == 80U) ? dissector_id_t{3U} : no_dissector;
+	});
+	static_cast<void>(table.set(80U, pending_dissector));
+	static_cast<void>(table.set(81U, pending_dissector));
+
+	/* Each pending key is resolved once, whether that finds anything or not */
+	CHECK_EQ(table.dispatch(80U, accept_none), 3U);
+	CHECK_EQ(table.dispatch(80U, accept_none), 3U);
+	CHECK_EQ(table[80U], 3U);
+	CHECK_EQ(table.dispatch(49152U, 81U, accept_none), no_dissector);
+	CHECK_EQ(table.dispatch(81U, accept_none), no_dissector);
+	CHECK_EQ(table[81U], no_dissector);
+	CHECK_EQ(resolved, 2zu);
+}
+
+TEST_CASE("dispatch_tables_t - lazily indexed dissectors") {
+	const scratch_t dir{"panko-dispatch-lazy"sv, {"so_loader_good.so"sv, "so_loader_keyed.so"sv}};
+	const std::array<fs::path, 1> dirs{{dir.dir}};
+
+	/* Learn what the dissectors register, so the next index doesn't load them */
+	so_cache_t cache{};
+	{
+		so_loader_t loader{};
+		CHECK_EQ(loader.index_dirs(dirs, cache), 2zu);
+	}
+
+	so_loader_t loader{};
+	CHECK_EQ(loader.index_dirs(dirs, cache), 2zu);
+	REQUIRE_EQ(loader.size(), 0zu);
+
+	/* The heuristic dissector is loaded up front, the one only registered under ports is left pending */
+	dispatch_tables_t tables{};
+	CHECK_EQ(tables.add(loader), 4zu);
+	CHECK_EQ(loader.size(), 1zu);
+	CHECK_EQ(loader.unloaded(), 1zu);
+	const auto good{loader.find("good"sv)};
+	REQUIRE(good.has_value());
+	CHECK_EQ(tables.udp_port[5683U], *good);
+	REQUIRE_EQ(tables.udp_port.heuristics().size(), 1zu);
+	CHECK_EQ(tables.udp_port.heuristics()[0], *good);
+	CHECK_EQ(tables.udp_port[5684U], pending_dissector);
+	CHECK_EQ(tables.tcp_port[5684U], pending_dissector);
+
+	/* Dispatching on one of its keys loads it, and the other key then finds it without loading again */
+	const auto keyed{tables.udp_port.dispatch(5684U, accept_none)};
+	REQUIRE(keyed != no_dissector);
+	REQUIRE(keyed != pending_dissector);
+	CHECK_EQ(loader.plugin(keyed).name, "keyed"sv);
+	CHECK_EQ(loader.unloaded(), 0zu);
+	CHECK_EQ(tables.udp_port[5684U], keyed);
+	CHECK_EQ(tables.tcp_port.dispatch(49152U, 5684U, accept_none), keyed);
+	CHECK_EQ(loader.size(), 2zu);
+
+	const std::array<std::uint8_t, 4> data{{0x00U, 0x01U, 0x02U, 0x03U}};
+	CHECK_EQ(loader[keyed].dissect(data.data(), data.size(), nullptr), 2zu);
+}
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* engine.cc - Parallel per-flow dissection engine tests */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/dissectors/engine.hh"
+
+using Panko::dissectors::flow_engine_t;
+
+namespace {
+	struct job_t final {
+		std::uint64_t flow;
+		std::uint64_t payload;
+	};
+
+	struct result_t final {
+		std::uint64_t flow;
+		std::uint64_t index;
+		std::size_t worker;
+		std::thread::id thread;
+	};
+
+	/* Counts the jobs of each of its flows, which only works if every job of a flow comes to it */
+	struct worker_t final {
+		std::size_t idx;
+		std::unordered_map<std::uint64_t, std::uint64_t> flows{};
+
+		result_t operator()(job_t& job) {
+			if (job.payload == ~0ULL) {
+				throw std::runtime_error{"bad job"};
+			}
+			/* Some busy work so the workers finish out of order */
+			volatile std::uint64_t spin{job.payload % 97U};
+			while (spin != 0U) {
+				spin = spin - 1U;
+			}
+			return {job.flow, flows[job.flow]++, idx, std::this_thread::get_id()};
+		}
+	};
+
+	[[nodiscard]]
+	std::vector<result_t> run(const std::size_t workers, const std::size_t window, const std::size_t jobs) {
+		flow_engine_t<job_t, worker_t> engine{workers, [](const std::size_t idx) { return worker_t{idx}; }, window};
+		CHECK_EQ(engine.threads(), workers);
+
+		std::vector<result_t> results{};
+		std::uint64_t expected{};
+		const auto sink{[&](const std::uint64_t seq, result_t&& result) {
+			CHECK_EQ(seq, expected++);
+			results.push_back(result);
+		}};
+
+		for (std::uint64_t idx{}; idx < jobs; ++idx) {
+			const auto flow{(idx * 7919U) % 61U};
+			engine.submit(flow, job_t{flow, idx * 31U}, sink);
+			CHECK(engine.in_flight() <= window);
+		}
+		engine.finish(sink);
+		CHECK_EQ(engine.in_flight(), 0zu);
+		return results;
+	}
+}
+
+TEST_CASE("flow_engine_t - inline") {
+	const auto results{run(0zu, 16zu, 1000zu)};
+	REQUIRE_EQ(results.size(), 1000zu);
+	for (const auto& result : results) {
+		CHECK(result.thread == std::this_thread::get_id());
+	}
+}
+
+TEST_CASE("flow_engine_t - matches a single thread") {
+	const auto reference{run(0zu, 64zu, 20000zu)};
+
+	for (const std::size_t workers : {1zu, 2zu, 4zu, 7zu}) {
+		const auto results{run(workers, 64zu, 20000zu)};
+		REQUIRE_EQ(results.size(), reference.size());
+
+		std::unordered_map<std::uint64_t, std::size_t> owners{};
+		bool identical{true};
+		bool owned{true};
+		for (std::size_t idx{}; idx < results.size(); ++idx) {
+			identical = identical && results[idx].flow == reference[idx].flow &&
+				results[idx].index == reference[idx].index;
+			/* Every job of a flow went to the same worker */
+			const auto [owner, inserted]{owners.emplace(results[idx].flow, results[idx].worker)};
+			owned = owned && (inserted || owner->second == results[idx].worker);
+			owned = owned && results[idx].thread != std::this_thread::get_id();
+		}
+		CHECK(identical);
+		CHECK(owned);
+	}
+}
+
+TEST_CASE("flow_engine_t - worker_for") {
+	flow_engine_t<job_t, worker_t> engine{0zu, [](const std::size_t idx) { return worker_t{idx}; }};
+	CHECK_EQ(engine.worker_for(1234U), 0zu);
+
+	flow_engine_t<job_t, worker_t> spread{3zu, [](const std::size_t idx) { return worker_t{idx}; }};
+	std::vector<std::size_t> used(3zu);
+	for (std::uint64_t flow{}; flow < 300U; ++flow) {
+		const auto worker{spread.worker_for(flow)};
+		REQUIRE(worker < 3zu);
+		++used[worker];
+		CHECK_EQ(spread.worker_for(flow), worker);
+	}
+	CHECK(used[0] > 50zu);
+	CHECK(used[1] > 50zu);
+	CHECK(used[2] > 50zu);
+}
+
+TEST_CASE("flow_engine_t - errors are delivered in order") {
+	for (const std::size_t workers : {0zu, 2zu}) {
+		flow_engine_t<job_t, worker_t> engine{workers, [](const std::size_t idx) { return worker_t{idx}; }, 8zu};
+
+		std::size_t delivered{};
+		const auto sink{[&delivered](const std::uint64_t, result_t&&) { ++delivered; }};
+
+		/* The error comes out of whichever call delivers the failed job, after the jobs before it */
+		std::size_t threw{};
+		const auto guard{[&threw](auto&& func) {
+			try {
+				func();
+			} catch (const std::runtime_error&) {
+				++threw;
+			}
+		}};
+		guard([&] { engine.submit(1U, job_t{1U, 1U}, sink); });
+		guard([&] { engine.submit(2U, job_t{2U, ~0ULL}, sink); });
+		guard([&] { engine.submit(3U, job_t{3U, 3U}, sink); });
+		guard([&] { engine.finish(sink); });
+		CHECK_EQ(threw, 1zu);
+
+		/* The engine carries on after the failed job */
+		guard([&] { engine.finish(sink); });
+		CHECK_EQ(threw, 1zu);
+		CHECK_EQ(engine.in_flight(), 0zu);
+		CHECK_EQ(delivered, 2zu);
+	}
+}
+
+TEST_CASE("flow_engine_t - errors with a full window") {
+	/* Fails slowly, so the window has filled up behind it by the time it is delivered */
+	struct slow_worker_t final {
+		std::uint64_t operator()(job_t& job) {
+			if (job.payload == ~0ULL) {
+				std::this_thread::sleep_for(std::chrono::milliseconds{50});
+				throw std::runtime_error{"bad job"};
+			}
+			return job.payload;
+		}
+	};
+
+	/* The failed job is delivered while making room for the next, which must still be run */
+	for (const std::size_t workers : {0zu, 1zu}) {
+		flow_engine_t<job_t, slow_worker_t> engine{workers, [](std::size_t) { return slow_worker_t{}; }, 2zu};
+
+		std::vector<std::uint64_t> delivered{};
+		const auto sink{[&delivered](const std::uint64_t, std::uint64_t&& result) { delivered.push_back(result); }};
+
+		std::size_t threw{};
+		for (const auto payload : {~0ULL, 1ULL, 2ULL, 3ULL}) {
+			try {
+				engine.submit(1U, job_t{1U, payload}, sink);
+			} catch (const std::runtime_error&) {
+				++threw;
+			}
+		}
+		engine.finish(sink);
+		CHECK_EQ(threw, 1zu);
+		CHECK_EQ(delivered, std::vector<std::uint64_t>{1U, 2U, 3U});
+	}
+}
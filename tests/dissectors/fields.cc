@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* fields.cc - Dissector field registration tests */
+
+#include <array>
+#include <string_view>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/core/errcodes.hh"
+#include "panko/dissectors/fields.hh"
+
+using namespace std::literals::string_view_literals;
+
+using Panko::core::error_codes::field_error_message;
+using Panko::dissectors::field_error_t;
+using Panko::dissectors::field_registry_t;
+using Panko::dissectors::field_type_t;
+using Panko::dissectors::is_inline;
+using Panko::dissectors::no_field;
+
+TEST_CASE("field_registry_t - add") {
+	field_registry_t fields{};
+
+	const auto ip{fields.add("ip"sv, "Internet Protocol Version 4"sv, field_type_t::None)};
+	REQUIRE(ip.has_value());
+	const auto src{fields.add("ip.src"sv, "Source Address"sv, field_type_t::IPv4, *ip)};
+	REQUIRE(src.has_value());
+	CHECK_EQ(*ip, 0U);
+	CHECK_EQ(*src, 1U);
+	CHECK_EQ(fields.size(), 2zu);
+
+	CHECK_EQ(fields[*src].name, "ip.src"sv);
+	CHECK_EQ(fields[*src].description, "Source Address"sv);
+	CHECK(fields[*src].type == field_type_t::IPv4);
+	CHECK_EQ(fields[*src].parent, *ip);
+	CHECK_EQ(fields[*ip].parent, no_field);
+
+	/* Registering the same field again gives the same ID */
+	CHECK_EQ(fields.add("ip.src"sv, ""sv, field_type_t::IPv4), *src);
+	CHECK_EQ(fields.size(), 2zu);
+
+	CHECK_EQ(fields.add("ip.src"sv, ""sv, field_type_t::Bytes).error(), field_error_t::TypeMismatch);
+	CHECK_EQ(fields.add(""sv, ""sv, field_type_t::Bytes).error(), field_error_t::InvalidName);
+	CHECK_FALSE(field_error_message(field_error_t::TypeMismatch).empty());
+}
+
+TEST_CASE("field_registry_t - find") {
+	field_registry_t fields{};
+	const auto ttl{fields.add("ip.ttl"sv, "Time to Live"sv, field_type_t::Unsigned)};
+	REQUIRE(ttl.has_value());
+
+	CHECK_EQ(fields.find("ip.ttl"sv), *ttl);
+	CHECK_FALSE(fields.find("ip.tt"sv).has_value());
+}
+
+TEST_CASE("is_inline") {
+	CHECK_FALSE(is_inline(field_type_t::None));
+	CHECK(is_inline(field_type_t::Unsigned));
+	CHECK(is_inline(field_type_t::IPv4));
+	CHECK_FALSE(is_inline(field_type_t::Bytes));
+	CHECK_FALSE(is_inline(field_type_t::IPv6));
+}
+
+TEST_CASE("field_set_t") {
+	Panko::dissectors::field_set_t set{};
+	CHECK(set.empty());
+	CHECK_FALSE(set.contains(0U));
+
+	set.insert(3U);
+	set.insert(200U);
+	set.insert(3U);
+	CHECK_EQ(set.size(), 2zu);
+	CHECK(set.contains(3U));
+	CHECK(set.contains(200U));
+	CHECK_FALSE(set.contains(4U));
+	CHECK_FALSE(set.contains(no_field));
+
+	set.clear();
+	CHECK(set.empty());
+	CHECK_FALSE(set.contains(3U));
+}
+
+TEST_CASE("field_registry_t - with_parents") {
+	field_registry_t fields{};
+	const auto tcp{*fields.add("tcp"sv, ""sv, field_type_t::None)};
+	const auto flags{*fields.add("tcp.flags"sv, ""sv, field_type_t::Unsigned, tcp)};
+	const auto syn{*fields.add("tcp.flags.syn"sv, ""sv, field_type_t::Boolean, flags)};
+	const auto port{*fields.add("tcp.dstport"sv, ""sv, field_type_t::Unsigned, tcp)};
+	const auto udp{*fields.add("udp"sv, ""sv, field_type_t::None)};
+
+	const std::array<Panko::dissectors::field_id_t, 3> wanted{{syn, port, 999U}};
+	const auto set{fields.with_parents(wanted)};
+	CHECK_EQ(set.size(), 4zu);
+	CHECK(set.contains(tcp));
+	CHECK(set.contains(flags));
+	CHECK(set.contains(syn));
+	CHECK(set.contains(port));
+	CHECK_FALSE(set.contains(udp));
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* flow_table.cc - Flow table tests */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/dissectors/flow_table.hh"
+
+using Panko::dissectors::flow_direction_t;
+using Panko::dissectors::flow_key_t;
+using Panko::dissectors::flow_table_t;
+
+namespace {
+	[[nodiscard]]
+	flow_key_t key_for(const std::uint32_t idx) noexcept {
+		return flow_key_t::make(
+			flow_key_t::ipv4(0x0A00'0000U | idx), flow_key_t::ipv4(0xC0A8'0001U),
+			static_cast<std::uint16_t>(1024U + (idx % 50000U)), 443U, 6U
+		).first;
+	}
+}
+
+TEST_CASE("flow_key_t - normalization") {
+	const auto client{flow_key_t::ipv4(0xC0A8'0064U)};
+	const auto server{flow_key_t::ipv4(0x0A00'0001U)};
+
+	const auto [request, request_dir]{flow_key_t::make(client, server, 51000U, 80U, 6U, 10U)};
+	const auto [response, response_dir]{flow_key_t::make(server, client, 80U, 51000U, 6U, 10U)};
+	CHECK(request == response);
+	CHECK_EQ(request.hash(), response.hash());
+	CHECK(request_dir != response_dir);
+	CHECK(response_dir == flow_direction_t::Forward);
+	CHECK_EQ(request.port_lo, 80U);
+	CHECK_EQ(request.addr_lo[10], 0xFFU);
+	CHECK_EQ(request.addr_lo[15], 0x01U);
+
+	/* The same addresses tell the ports apart */
+	const auto [loop, loop_dir]{flow_key_t::make(client, client, 9000U, 8000U, 17U)};
+	CHECK(loop_dir == flow_direction_t::Reverse);
+	CHECK_EQ(loop.port_lo, 8000U);
+
+	/* Everything else is part of the key */
+	CHECK_FALSE(request == flow_key_t::make(client, server, 51000U, 80U, 17U, 10U).first);
+	CHECK_FALSE(request == flow_key_t::make(client, server, 51000U, 80U, 6U, 11U).first);
+	CHECK_FALSE(request == flow_key_t::make(client, server, 51000U, 80U, 6U, 10U, 1U).first);
+	CHECK_FALSE(request == flow_key_t::make(client, server, 51000U, 80U, 6U, 10U, 0U, 7U).first);
+}
+
+TEST_CASE("flow_table_t - basics") {
+	flow_table_t<std::string> table{};
+	CHECK(table.empty());
+	CHECK(table.find(key_for(1U)) == nullptr);
+	CHECK_FALSE(table.erase(key_for(1U)));
+
+	auto [entry, added]{table.try_emplace(key_for(1U))};
+	CHECK(added);
+	entry.value = "first";
+	entry.stats.touch(100, 60U);
+	entry.stats.touch(90, 40U);
+
+	auto [again, added_again]{table.try_emplace(key_for(1U))};
+	CHECK_FALSE(added_again);
+	CHECK_EQ(again.value, "first");
+	CHECK_EQ(again.stats.packets, 2U);
+	CHECK_EQ(again.stats.bytes, 100U);
+	CHECK_EQ(again.stats.first_seen, 100);
+	CHECK_EQ(again.stats.last_seen, 100);
+
+	CHECK_EQ(table.size(), 1zu);
+	CHECK(table.erase(key_for(1U)));
+	CHECK(table.empty());
+	CHECK(table.find(key_for(1U)) == nullptr);
+}
+
+TEST_CASE("flow_table_t - growing") {
+	flow_table_t<std::uint64_t> table{};
+	constexpr std::uint32_t flows{200000U};
+
+	bool saw_migration{false};
+	bool all_found{true};
+	for (std::uint32_t idx{}; idx < flows; ++idx) {
+		auto [entry, added]{table.try_emplace(key_for(idx))};
+		REQUIRE(added);
+		entry.value = idx;
+		saw_migration = saw_migration || table.migrating();
+
+		/* Everything stays findable while the table is part way through growing */
+		if (table.migrating() && (idx % 97U) == 0U) {
+			for (std::uint32_t check{}; check <= idx; check += 1009U) {
+				const auto* const found{table.find(key_for(check))};
+				all_found = all_found && found != nullptr && found->value == check;
+			}
+		}
+	}
+	CHECK(saw_migration);
+	CHECK(all_found);
+	CHECK_EQ(table.size(), flows);
+	CHECK(table.capacity() >= flows);
+
+	std::size_t missing{};
+	for (std::uint32_t idx{}; idx < flows; ++idx) {
+		const auto* const found{table.find(key_for(idx))};
+		missing += (found == nullptr || found->value != idx) ? 1U : 0U;
+	}
+	CHECK_EQ(missing, 0zu);
+
+	std::unordered_set<std::uint64_t> seen{};
+	table.for_each([&seen](const auto& entry) { seen.insert(entry.value); });
+	CHECK_EQ(seen.size(), flows);
+}
+
+TEST_CASE("flow_table_t - churn") {
+	/* Lots of short flows leave tombstones behind, which must not make the table grow without bound */
+	flow_table_t<std::uint64_t> table{1000zu};
+	const auto capacity{table.capacity()};
+	for (std::uint32_t idx{}; idx < 100000U; ++idx) {
+		static_cast<void>(table.try_emplace(key_for(idx)));
+		if (idx >= 500U) {
+			REQUIRE(table.erase(key_for(idx - 500U)));
+		}
+	}
+	CHECK_EQ(table.size(), 500zu);
+	CHECK(table.capacity() <= capacity * 2zu);
+	for (std::uint32_t idx{100000U - 500U}; idx < 100000U; ++idx) {
+		REQUIRE(table.find(key_for(idx)) != nullptr);
+	}
+
+	CHECK_EQ(table.erase_if([](const auto& entry) { return (entry.key.port_lo % 2U) == 0U; }), 250zu);
+	CHECK_EQ(table.size(), 250zu);
+
+	table.clear();
+	CHECK(table.empty());
+	CHECK(table.find(key_for(99999U)) == nullptr);
+}
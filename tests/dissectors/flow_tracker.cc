@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* flow_tracker.cc - Flow tracker tests */
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/dissectors/flow_tracker.hh"
+
+using Panko::dissectors::evict_reason_t;
+using Panko::dissectors::flow_key_t;
+using Panko::dissectors::flow_tracker_config_t;
+using Panko::dissectors::flow_tracker_t;
+
+namespace {
+	constexpr std::int64_t second{1'000'000'000};
+
+	[[nodiscard]]
+	flow_key_t key_for(const std::uint32_t idx, const std::uint8_t proto = 6U) noexcept {
+		return flow_key_t::make(
+			flow_key_t::ipv4(0x0A00'0000U | idx), flow_key_t::ipv4(0xC0A8'0001U),
+			static_cast<std::uint16_t>(1024U + (idx % 50000U)), 443U, proto
+		).first;
+	}
+
+	struct evicted_t final {
+		std::uint32_t flow;
+		evict_reason_t reason;
+		std::uint64_t packets;
+	};
+
+	[[nodiscard]]
+	flow_tracker_config_t config_for(const std::size_t budget = ~0zu) noexcept {
+		flow_tracker_config_t config{};
+		config.wheel_slots = 64zu;
+		config.memory_budget = budget;
+		config.default_timeout = 20 * second;
+		config.tcp_timeout = 100 * second;
+		config.udp_timeout = 30 * second;
+		config.closing_timeout = 5 * second;
+		return config;
+	}
+}
+
+TEST_CASE("flow_tracker_t - idle timeouts by protocol") {
+	std::vector<evicted_t> evicted{};
+	flow_tracker_t<std::uint32_t> tracker{config_for(), [&](auto& entry, const evict_reason_t reason) {
+		evicted.push_back({entry.value.value, reason, entry.stats.packets});
+	}};
+
+	auto [tcp, tcp_added]{tracker.track(key_for(1U, 6U), 0, 100U)};
+	CHECK(tcp_added);
+	tcp.value.value = 1U;
+	tracker.track(key_for(2U, 17U), 0, 100U).first.value.value = 2U;
+	tracker.track(key_for(3U, 1U), 0, 100U).first.value.value = 3U;
+	CHECK_EQ(tracker.size(), 3zu);
+	CHECK_EQ(tracker.memory(), 3zu * tracker.flow_memory);
+
+	auto [again, again_added]{tracker.track(key_for(1U, 6U), second, 50U)};
+	CHECK_FALSE(again_added);
+	CHECK_EQ(again.stats.packets, 2U);
+	CHECK_EQ(again.stats.bytes, 150U);
+
+	tracker.advance(19 * second);
+	CHECK(evicted.empty());
+
+	/* Only the ICMP flow is past its timeout */
+	tracker.advance(21 * second);
+	REQUIRE_EQ(evicted.size(), 1zu);
+	CHECK_EQ(evicted[0].flow, 3U);
+	CHECK(evicted[0].reason == evict_reason_t::Idle);
+	CHECK(tracker.find(key_for(3U, 1U)) == nullptr);
+
+	tracker.advance(31 * second);
+	REQUIRE_EQ(evicted.size(), 2zu);
+	CHECK_EQ(evicted[1].flow, 2U);
+
+	/* The TCP flow saw a packet at 1s, which pushes its timeout back past the span of the wheel */
+	tracker.advance(100 * second);
+	CHECK_EQ(tracker.size(), 1zu);
+	tracker.advance(102 * second);
+	REQUIRE_EQ(evicted.size(), 3zu);
+	CHECK_EQ(evicted[2].flow, 1U);
+	CHECK_EQ(evicted[2].packets, 2U);
+	CHECK_EQ(tracker.size(), 0zu);
+	CHECK_EQ(tracker.memory(), 0zu);
+}
+
+TEST_CASE("flow_tracker_t - timeouts between ticks") {
+	std::vector<evicted_t> evicted{};
+	flow_tracker_t<std::uint32_t> tracker{config_for(), [&](auto& entry, const evict_reason_t reason) {
+		evicted.push_back({entry.value.value, reason, entry.stats.packets});
+	}};
+
+	/* Both time out at 20.5s, which is partway through a tick */
+	tracker.track(key_for(1U, 1U), second / 2, 60U).first.value.value = 1U;
+	tracker.track(key_for(2U, 1U), second / 2, 60U).first.value.value = 2U;
+
+	/* A packet before the timeout lands on the same flow, even in the tick the timeout falls in */
+	auto [flow, added]{tracker.track(key_for(1U, 1U), 20 * second + second / 5, 60U)};
+	CHECK_FALSE(added);
+	CHECK_EQ(flow.stats.packets, 2U);
+	CHECK(evicted.empty());
+
+	tracker.advance(20 * second + 2 * second / 5);
+	CHECK(evicted.empty());
+
+	/* Only once the tick is over is the timeout taken to have passed */
+	tracker.advance(21 * second);
+	REQUIRE_EQ(evicted.size(), 1zu);
+	CHECK_EQ(evicted[0].flow, 2U);
+	CHECK_EQ(tracker.size(), 1zu);
+}
+
+TEST_CASE("flow_tracker_t - activity keeps flows alive") {
+	std::size_t evicted{};
+	flow_tracker_t<std::uint32_t> tracker{config_for(), [&](auto&, evict_reason_t) { ++evicted; }};
+
+	for (std::int64_t time{}; time < 1000 * second; time += 10 * second) {
+		static_cast<void>(tracker.track(key_for(1U, 17U), time, 64U));
+	}
+	CHECK_EQ(evicted, 0zu);
+	const auto* const flow{tracker.find(key_for(1U, 17U))};
+	REQUIRE(flow != nullptr);
+	CHECK_EQ(flow->stats.packets, 100U);
+
+	/* A jump of more than a whole turn of the wheel */
+	tracker.advance(100'000 * second);
+	CHECK_EQ(evicted, 1zu);
+	CHECK_EQ(tracker.size(), 0zu);
+}
+
+TEST_CASE("flow_tracker_t - closing") {
+	std::vector<evicted_t> evicted{};
+	flow_tracker_t<std::uint32_t> tracker{config_for(), [&](auto& entry, const evict_reason_t reason) {
+		evicted.push_back({entry.value.value, reason, entry.stats.packets});
+	}};
+
+	tracker.track(key_for(1U), 0, 60U).first.value.value = 1U;
+	tracker.track(key_for(2U), 0, 60U).first.value.value = 2U;
+
+	/* A FIN or RST */
+	auto [closing, _]{tracker.track(key_for(1U), 2 * second, 60U)};
+	tracker.close(closing);
+	tracker.close(closing);
+
+	/* Stragglers still land on the flow */
+	static_cast<void>(tracker.track(key_for(1U), 4 * second, 60U));
+	tracker.advance(8 * second);
+	CHECK(evicted.empty());
+
+	tracker.advance(10 * second);
+	REQUIRE_EQ(evicted.size(), 1zu);
+	CHECK_EQ(evicted[0].flow, 1U);
+	CHECK(evicted[0].reason == evict_reason_t::Closed);
+	CHECK_EQ(evicted[0].packets, 3U);
+	CHECK(tracker.find(key_for(2U)) != nullptr);
+
+	/* A new flow on the same key starts over */
+	auto [reopened, added]{tracker.track(key_for(1U), 11 * second, 60U)};
+	CHECK(added);
+	CHECK_FALSE(reopened.value.closed);
+	CHECK_EQ(reopened.stats.packets, 1U);
+}
+
+TEST_CASE("flow_tracker_t - memory budget") {
+	using tracker_t = flow_tracker_t<std::uint32_t>;
+	std::vector<evicted_t> evicted{};
+	/* Evictions go down to a sixteenth under the budget, 4 flows worth */
+	const auto budget{64zu * tracker_t::flow_memory};
+	tracker_t tracker{config_for(budget), [&](auto& entry, const evict_reason_t reason) {
+		evicted.push_back({entry.value.value, reason, entry.stats.packets});
+	}};
+
+	for (std::uint32_t idx{}; idx < 64U; ++idx) {
+		tracker.track(key_for(idx), static_cast<std::int64_t>(idx) * second, 60U).first.value.value = idx;
+	}
+	CHECK_EQ(tracker.size(), 64zu);
+	CHECK(evicted.empty());
+
+	/* Flow 0 is the oldest, but seeing it again makes flow 1 the least recently used */
+	static_cast<void>(tracker.track(key_for(0U), 64 * second, 60U));
+	tracker.track(key_for(64U), 65 * second, 60U).first.value.value = 64U;
+	REQUIRE_EQ(evicted.size(), 5zu);
+	for (std::uint32_t idx{}; idx < 5U; ++idx) {
+		CHECK_EQ(evicted[idx].flow, idx + 1U);
+		CHECK(evicted[idx].reason == evict_reason_t::Budget);
+	}
+	CHECK(tracker.find(key_for(0U)) != nullptr);
+	CHECK_EQ(tracker.size(), 60zu);
+	CHECK(tracker.memory() <= budget);
+
+	/* There is room again, so nothing more is evicted for a while */
+	for (std::uint32_t idx{65U}; idx < 69U; ++idx) {
+		static_cast<void>(tracker.track(key_for(idx), 66 * second, 60U));
+	}
+	CHECK_EQ(evicted.size(), 5zu);
+	CHECK_EQ(tracker.memory(), budget);
+
+	/* Charging a flow for its buffers pushes out more of the oldest when the next flow is added */
+	auto* const buffered{tracker.find(key_for(64U))};
+	REQUIRE(buffered != nullptr);
+	tracker.charge(*buffered, static_cast<std::ptrdiff_t>(8zu * tracker.flow_memory));
+	tracker.track(key_for(69U), 67 * second, 60U).first.value.value = 69U;
+	REQUIRE_EQ(evicted.size(), 18zu);
+	CHECK_EQ(evicted[5].flow, 6U);
+	CHECK_EQ(evicted[17].flow, 18U);
+	CHECK(tracker.memory() <= budget);
+
+	/* And releasing it gives the room back */
+	const auto before{tracker.memory()};
+	auto* const released{tracker.find(key_for(64U))};
+	REQUIRE(released != nullptr);
+	tracker.charge(*released, -static_cast<std::ptrdiff_t>(8zu * tracker.flow_memory));
+	CHECK_EQ(tracker.memory(), before - 8zu * tracker.flow_memory);
+	/* Releasing more than was charged only gives back what was */
+	tracker.charge(*released, -1);
+	CHECK_EQ(tracker.memory(), before - 8zu * tracker.flow_memory);
+
+	/* Flows on shorter timeouts go before older flows on longer ones */
+	tracker_t small{config_for(4zu * tracker_t::flow_memory), [&](auto& entry, const evict_reason_t reason) {
+		evicted.push_back({entry.value.value, reason, entry.stats.packets});
+	}};
+	evicted.clear();
+	small.track(key_for(1U), 0, 60U).first.value.value = 1U;
+	small.track(key_for(2U), second, 60U).first.value.value = 2U;
+	small.track(key_for(100U, 17U), 2 * second, 60U).first.value.value = 100U;
+	small.track(key_for(101U, 17U), 3 * second, 60U).first.value.value = 101U;
+	small.track(key_for(3U), 4 * second, 60U).first.value.value = 3U;
+	REQUIRE_EQ(evicted.size(), 2zu);
+	CHECK_EQ(evicted[0].flow, 100U);
+	CHECK_EQ(evicted[1].flow, 101U);
+	CHECK(small.find(key_for(1U)) != nullptr);
+}
+
+TEST_CASE("flow_tracker_t - flush") {
+	std::vector<evicted_t> evicted{};
+	flow_tracker_t<std::uint32_t> tracker{config_for(), [&](auto& entry, const evict_reason_t reason) {
+		evicted.push_back({entry.value.value, reason, entry.stats.packets});
+	}};
+
+	for (std::uint32_t idx{}; idx < 1000U; ++idx) {
+		static_cast<void>(tracker.track(key_for(idx), second, 60U));
+	}
+	tracker.flush();
+	CHECK_EQ(evicted.size(), 1000zu);
+	for (const auto& flow : evicted) {
+		CHECK(flow.reason == evict_reason_t::Flush);
+	}
+	CHECK_EQ(tracker.size(), 0zu);
+	CHECK_EQ(tracker.memory(), 0zu);
+
+	/* Nothing is left on the wheel */
+	tracker.advance(1000 * second);
+	CHECK_EQ(evicted.size(), 1000zu);
+}
+
+TEST_CASE("flow_tracker_t - churn") {
+	std::size_t evicted{};
+	const auto budget{512zu * flow_tracker_t<std::uint32_t>::flow_memory};
+	flow_tracker_t<std::uint32_t> tracker{config_for(budget), [&](auto&, evict_reason_t) { ++evicted; }};
+
+	std::uint32_t state{0x1234'5678U};
+	for (std::int64_t time{}; time < 200'000; ++time) {
+		state = state * 1'664'525U + 1'013'904'223U;
+		const auto flow{(state >> 8U) % 4096U};
+		auto [entry, added]{tracker.track(key_for(flow, (flow & 1U) ? 6U : 17U), time * 10'000'000, 100U)};
+		if ((state & 0xFFU) == 0U) {
+			tracker.close(entry);
+		}
+		CHECK(tracker.memory() <= budget);
+	}
+	CHECK(evicted > 0zu);
+	CHECK_EQ(tracker.memory(), tracker.size() * tracker.flow_memory);
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* heuristics.cc - Heuristic dissector scheduling tests */
+
+#include <array>
+#include <cstdint>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/dissectors/heuristics.hh"
+
+using Panko::dissectors::dissector_id_t;
+using Panko::dissectors::heuristic_scheduler_t;
+using Panko::dissectors::no_dissector;
+
+namespace {
+	constexpr std::array<dissector_id_t, 3> heuristics{{1U, 2U, 3U}};
+}
+
+TEST_CASE("heuristic_scheduler_t - select") {
+	heuristic_scheduler_t scheduler{heuristics};
+	REQUIRE_EQ(scheduler.size(), 3zu);
+	CHECK_EQ(scheduler[0], 1U);
+
+	std::array<std::size_t, 4> tried{};
+	const auto accept{[&tried](const dissector_id_t want) {
+		return [&tried, want](const dissector_id_t id) {
+			++tried[id];
+			return id == want;
+		};
+	}};
+
+	CHECK_EQ(scheduler.select(42U, accept(2U)), 2U);
+	CHECK_EQ(tried[1], 1zu);
+	CHECK_EQ(tried[2], 1zu);
+	CHECK_EQ(tried[3], 0zu);
+	CHECK_EQ(scheduler.stats(1).attempts, 1U);
+	CHECK_EQ(scheduler.stats(1).hits, 1U);
+	CHECK_EQ(scheduler.stats(0).hits, 0U);
+
+	/* The flow remembers its heuristic, so nothing is tried again */
+	tried = {};
+	CHECK_EQ(scheduler.select(42U, accept(3U)), 2U);
+	CHECK_EQ(tried[1] + tried[2] + tried[3], 0zu);
+
+	/* Flows nothing accepts are not cached */
+	CHECK_EQ(scheduler.select(43U, accept(0U)), no_dissector);
+	CHECK_EQ(tried[1] + tried[2] + tried[3], 3zu);
+	CHECK_EQ(scheduler.select(43U, accept(3U)), 3U);
+
+	scheduler.forget(42U);
+	CHECK_EQ(scheduler.select(42U, accept(1U)), 1U);
+
+	scheduler.forget_all();
+	tried = {};
+	CHECK_EQ(scheduler.select(43U, accept(1U)), 1U);
+	CHECK_EQ(tried[1], 1zu);
+}
+
+TEST_CASE("heuristic_scheduler_t - reorder") {
+	heuristic_scheduler_t scheduler{heuristics, 1zu};
+
+	/* Every flow is new and only the last candidate ever accepts */
+	const auto accept_three{[](const dissector_id_t id) { return id == 3U; }};
+	for (std::uint64_t flow{}; flow < 64U; ++flow) {
+		CHECK_EQ(scheduler.select(flow, accept_three), 3U);
+	}
+
+	scheduler.reorder();
+	CHECK_EQ(scheduler[0], 3U);
+	CHECK(scheduler.stats(0).hit_rate() > 0.99);
+	CHECK_EQ(scheduler.stats(2).hits, 0U);
+
+	/* The learned order is used from then on */
+	std::size_t tried{};
+	const auto count_three{[&tried](const dissector_id_t id) {
+		++tried;
+		return id == 3U;
+	}};
+	CHECK_EQ(scheduler.select(1000U, count_three), 3U);
+	CHECK_EQ(tried, 1zu);
+}
+
+TEST_CASE("heuristic_scheduler_t - reorder happens automatically") {
+	heuristic_scheduler_t scheduler{heuristics, 2zu};
+
+	const auto accept_two{[](const dissector_id_t id) { return id == 2U; }};
+	for (std::uint64_t flow{}; flow <= heuristic_scheduler_t::reorder_interval; ++flow) {
+		static_cast<void>(scheduler.select(flow, accept_two));
+	}
+	CHECK_EQ(scheduler[0], 2U);
+
+	/* Rejection costs get sampled along the way */
+	std::uint64_t samples{};
+	for (std::size_t idx{}; idx < scheduler.size(); ++idx) {
+		samples += scheduler.stats(idx).reject_samples;
+	}
+	CHECK(samples > 0U);
+}
+
+TEST_CASE("heuristic_scheduler_t - every candidate is sampled") {
+	/* With a chain length that divides the sample interval, a shared count would only sample the first */
+	constexpr std::array<dissector_id_t, 4> chain{{1U, 2U, 3U, 4U}};
+	heuristic_scheduler_t scheduler{chain, 2zu};
+
+	const auto reject_all{[](dissector_id_t) { return false; }};
+	for (std::uint64_t flow{}; flow < 5000U; ++flow) {
+		CHECK_EQ(scheduler.select(flow, reject_all), no_dissector);
+	}
+
+	for (std::size_t idx{}; idx < scheduler.size(); ++idx) {
+		const auto& stats{scheduler.stats(idx)};
+		CHECK_EQ(stats.attempts, 5000U);
+		CHECK(stats.reject_samples >= 5000U / heuristic_scheduler_t::sample_interval);
+	}
+}
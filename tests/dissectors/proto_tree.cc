@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* proto_tree.cc - Protocol tree tests */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/dissectors/proto_tree.hh"
+
+using Panko::dissectors::arena_t;
+using Panko::dissectors::field_id_t;
+using Panko::dissectors::no_field;
+using Panko::dissectors::proto_node_t;
+using Panko::dissectors::proto_tree_t;
+
+namespace {
+	constexpr field_id_t eth{0U};
+	constexpr field_id_t eth_type{1U};
+	constexpr field_id_t ip{2U};
+	constexpr field_id_t ip_ttl{3U};
+	constexpr field_id_t ip_flag{4U};
+	constexpr field_id_t ip_off{5U};
+
+	constexpr std::array<std::byte, 8> packet{{
+		std::byte{0x08U}, std::byte{0x00U}, std::byte{0x45U}, std::byte{0x00U},
+		std::byte{0x40U}, std::byte{0x11U}, std::byte{0xDEU}, std::byte{0xADU},
+	}};
+}
+
+TEST_CASE("proto_tree_t - build") {
+	arena_t arena{};
+	proto_tree_t tree{arena, packet};
+
+	CHECK_EQ(tree.size(), 0zu);
+	CHECK_EQ(tree.root().field, no_field);
+	CHECK_EQ(tree.root().length, packet.size());
+	CHECK(tree.root().first_child == nullptr);
+
+	auto& eth_node{tree.add(tree.root(), eth, 0U, 2U)};
+	static_cast<void>(tree.add_unsigned(eth_node, eth_type, 0U, 2U, 0x0800U));
+	auto& ip_node{tree.add(tree.root(), ip, 2U, 6U)};
+	static_cast<void>(tree.add_unsigned(ip_node, ip_ttl, 4U, 1U, 64U));
+	static_cast<void>(tree.add_bool(ip_node, ip_flag, 5U, 1U, true));
+	static_cast<void>(tree.add_signed(ip_node, ip_off, 6U, 2U, -3));
+	CHECK_EQ(tree.size(), 6zu);
+
+	std::vector<field_id_t> order{};
+	std::vector<std::size_t> depths{};
+	tree.visit([&](const proto_node_t& node, const std::size_t depth) {
+		order.push_back(node.field);
+		depths.push_back(depth);
+	});
+	CHECK_EQ(order, std::vector<field_id_t>{eth, eth_type, ip, ip_ttl, ip_flag, ip_off});
+	CHECK_EQ(depths, std::vector<std::size_t>{0U, 1U, 0U, 1U, 1U, 1U});
+
+	const auto* const ttl{tree.find(ip_ttl)};
+	REQUIRE(ttl != nullptr);
+	CHECK_EQ(ttl->as_unsigned(), 64U);
+	const auto* const flag{tree.find(ip_flag)};
+	REQUIRE(flag != nullptr);
+	CHECK(flag->as_bool());
+	const auto* const off{tree.find(ip_off)};
+	REQUIRE(off != nullptr);
+	CHECK_EQ(off->as_signed(), -3);
+	CHECK(tree.find(99U) == nullptr);
+
+	/* Values that aren't inline are slices of the packet */
+	const auto bytes{tree.bytes(*tree.find(ip_off))};
+	REQUIRE_EQ(bytes.size(), 2zu);
+	CHECK(bytes.data() == packet.data() + 6);
+	proto_node_t bad{nullptr, nullptr, nullptr, 0U, 7U, 2U, ip};
+	CHECK(tree.bytes(bad).empty());
+}
+
+TEST_CASE("proto_tree_t - float values") {
+	arena_t arena{};
+	proto_tree_t tree{arena, packet};
+	static_cast<void>(tree.add_float(tree.root(), 0U, 0U, 0U, 1.5));
+	CHECK_EQ(tree.root().first_child->as_float(), 1.5);
+}
+
+TEST_CASE("proto_tree_t - arena reuse") {
+	arena_t arena{};
+	for (std::size_t round{}; round < 4zu; ++round) {
+		proto_tree_t tree{arena, packet};
+		for (std::uint32_t idx{}; idx < 1000U; ++idx) {
+			static_cast<void>(tree.add_unsigned(tree.root(), ip_ttl, 4U, 1U, idx));
+		}
+		CHECK_EQ(tree.size(), 1000zu);
+		std::uint64_t sum{};
+		for (const auto& node : tree.root().children()) {
+			sum += node.as_unsigned();
+		}
+		CHECK_EQ(sum, 499500U);
+		arena.reset();
+	}
+
+	/* The whole tree is released at once, and the memory is reused rather than growing */
+	const auto capacity{arena.capacity()};
+	{
+		proto_tree_t tree{arena, packet};
+		for (std::uint32_t idx{}; idx < 1000U; ++idx) {
+			static_cast<void>(tree.add(tree.root(), ip, 0U, 1U));
+		}
+	}
+	CHECK_EQ(arena.capacity(), capacity);
+}
+
+TEST_CASE("proto_tree_t - fields of interest") {
+	arena_t arena{};
+	const Panko::dissectors::field_set_t interest{ip, ip_ttl};
+	proto_tree_t tree{arena, packet, &interest};
+
+	CHECK(tree.building());
+	CHECK(tree.wants(ip_ttl));
+	CHECK_FALSE(tree.wants(eth_type));
+
+	auto& eth_node{tree.add(tree.root(), eth, 0U, 2U)};
+	CHECK_FALSE(tree.kept(eth_node));
+	static_cast<void>(tree.add_unsigned(eth_node, eth_type, 0U, 2U, 0x0800U));
+	auto& ip_node{tree.add(tree.root(), ip, 2U, 6U)};
+	CHECK(tree.kept(ip_node));
+	static_cast<void>(tree.add_unsigned(ip_node, ip_ttl, 4U, 1U, 64U));
+	static_cast<void>(tree.add_bool(ip_node, ip_flag, 5U, 1U, true));
+
+	/* Wanted fields under a skipped one end up on the root */
+	static_cast<void>(tree.add_unsigned(eth_node, ip_ttl, 4U, 1U, 65U));
+
+	CHECK_EQ(tree.size(), 3zu);
+	std::vector<field_id_t> order{};
+	tree.visit([&](const proto_node_t& node, const std::size_t) {
+		order.push_back(node.field);
+	});
+	CHECK_EQ(order, std::vector<field_id_t>{ip, ip_ttl, ip_ttl});
+	CHECK(tree.find(eth) == nullptr);
+	CHECK(tree.find(ip_flag) == nullptr);
+
+	/* An empty set builds nothing at all */
+	const Panko::dissectors::field_set_t nothing{};
+	proto_tree_t empty{arena, packet, &nothing};
+	CHECK_FALSE(empty.building());
+	static_cast<void>(empty.add(empty.root(), ip, 2U, 6U));
+	CHECK_EQ(empty.size(), 0zu);
+	CHECK(empty.root().first_child == nullptr);
+}
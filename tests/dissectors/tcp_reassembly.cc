@@ -0,0 +1,313 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* tcp_reassembly.cc - TCP stream reassembly tests */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/core/bytearray.hh"
+#include "panko/core/bytearray_chain.hh"
+#include "panko/dissectors/tcp_reassembly.hh"
+
+using Panko::core::bytearray_t;
+using Panko::core::bytearray_chain_t;
+using Panko::dissectors::flow_direction_t;
+using Panko::dissectors::tcp_reassembly_config_t;
+using Panko::dissectors::tcp_stream_t;
+using Panko::dissectors::tcp_streams_t;
+
+namespace {
+	/* A capture buffer, the segments are all views into it, so it must outlive them */
+	struct capture_t final {
+		std::string text;
+		std::vector<std::unique_ptr<bytearray_t>> segments{};
+
+		explicit capture_t(const std::string_view data) : text{data} { }
+
+		/* The `len` bytes at `idx` as their own `bytearray_t`, like the payload of a packet */
+		bytearray_t& segment(const std::size_t idx, const std::size_t len) {
+			auto* const data{reinterpret_cast<std::uint8_t*>(text.data() + idx)};
+			segments.push_back(std::make_unique<bytearray_t>(data, len));
+			return *segments.back();
+		}
+	};
+
+	[[nodiscard]]
+	std::string string_of(bytearray_chain_t& chain) {
+		std::string res{};
+		for (std::size_t idx{}; idx < chain.fragments(); ++idx) {
+			const auto& fragment{chain.fragment(idx)};
+			res.append(reinterpret_cast<const char*>(fragment.data()), fragment.length());
+		}
+		return res;
+	}
+
+	/* Take everything ready from `stream` as one string, adding up what was missing before each run */
+	[[nodiscard]]
+	std::string take_all(tcp_stream_t& stream, std::uint64_t* const missing = nullptr) {
+		std::string res{};
+		while (auto data{stream.take()}) {
+			if (missing != nullptr) {
+				*missing += data->missing;
+			}
+			res += string_of(data->data);
+		}
+		return res;
+	}
+}
+
+TEST_CASE("tcp_stream_t - in order") {
+	capture_t capture{"GET / HTTP/1.1\r\nHost: example.com\r\n\r\n"};
+	tcp_stream_t stream{};
+	stream.syn(1000U);
+
+	stream.push(1001U, capture.segment(0U, 16U));
+	stream.push(1017U, capture.segment(16U, 19U));
+	stream.push(1036U, capture.segment(35U, 2U));
+	CHECK_FALSE(stream.finished());
+	CHECK_EQ(stream.next(), 37U);
+	CHECK_EQ(stream.buffered(), 0zu);
+
+	auto data{stream.take()};
+	REQUIRE(data.has_value());
+	CHECK_EQ(data->offset, 0U);
+	CHECK_EQ(data->missing, 0U);
+	CHECK_EQ(data->data.length(), 37zu);
+	CHECK_EQ(data->data.fragments(), 3zu);
+	CHECK_EQ(string_of(data->data), capture.text);
+	CHECK_FALSE(stream.take().has_value());
+
+	/* Nothing was copied, the chain points straight into the capture */
+	CHECK(static_cast<const void*>(data->data.fragment(0zu).data()) == static_cast<const void*>(capture.text.data()));
+	CHECK(
+		static_cast<const void*>(data->data.fragment(1zu).data()) ==
+		static_cast<const void*>(capture.text.data() + 16)
+	);
+	CHECK_EQ(stream.stats().delivered, 37U);
+	CHECK_EQ(stream.stats().duplicate, 0U);
+
+	/* Data taken later starts a new run where the last one left off */
+	capture_t more{"more"};
+	stream.push(1038U, more.segment(0U, 4U));
+	auto next{stream.take()};
+	REQUIRE(next.has_value());
+	CHECK_EQ(next->offset, 37U);
+	CHECK_EQ(string_of(next->data), "more");
+
+	/* A bare FIN */
+	stream.push(1042U, more.segment(0U, 0U), true);
+	CHECK(stream.finished());
+}
+
+TEST_CASE("tcp_stream_t - out of order") {
+	capture_t capture{"0123456789abcdefghij"};
+	tcp_stream_t stream{};
+	stream.syn(0U);
+
+	stream.push(11U, capture.segment(10U, 5U));
+	stream.push(16U, capture.segment(15U, 5U));
+	CHECK_EQ(stream.buffered(), 10zu);
+	CHECK_EQ(stream.segments(), 2zu);
+	CHECK_FALSE(stream.take().has_value());
+
+	stream.push(6U, capture.segment(5U, 5U));
+	CHECK_EQ(stream.segments(), 3zu);
+	CHECK_FALSE(stream.take().has_value());
+
+	/* Filling the hole releases everything */
+	stream.push(1U, capture.segment(0U, 5U));
+	CHECK_EQ(stream.buffered(), 0zu);
+	CHECK_EQ(stream.segments(), 0zu);
+	CHECK_EQ(take_all(stream), capture.text);
+	CHECK_EQ(stream.stats().out_of_order, 3U);
+	CHECK_EQ(stream.stats().delivered, 20U);
+}
+
+TEST_CASE("tcp_stream_t - overlaps and retransmissions") {
+	capture_t capture{"0123456789abcdefghij"};
+	capture_t other{"XXXXXXXXXXXXXXXXXXXX"};
+	tcp_stream_t stream{};
+	stream.syn(0U);
+
+	stream.push(1U, capture.segment(0U, 4U));
+	/* A full retransmission of what was delivered */
+	stream.push(1U, other.segment(0U, 4U));
+	CHECK_EQ(stream.stats().duplicate, 4U);
+
+	/* Buffered out of order, [8, 12) */
+	stream.push(9U, capture.segment(8U, 4U));
+	/* Overlapping it on both sides, [6, 14), only [6, 8) and [12, 14) are new */
+	stream.push(7U, other.segment(6U, 8U));
+	CHECK_EQ(stream.buffered(), 8zu);
+	CHECK_EQ(stream.segments(), 3zu);
+	/* Running into the back of one that is buffered, [13, 16) */
+	stream.push(14U, other.segment(13U, 3U));
+	CHECK_EQ(stream.buffered(), 10zu);
+
+	/* Overlapping what was delivered and all of what is buffered, [2, 18) */
+	stream.push(3U, capture.segment(2U, 16U));
+	CHECK_EQ(stream.buffered(), 0zu);
+
+	/* The first copy of every byte wins */
+	CHECK_EQ(take_all(stream), "012345XX89abXXXXgh");
+	CHECK_EQ(stream.next(), 18U);
+	CHECK_EQ(stream.stats().delivered, 18U);
+	/* 4 retransmitted, 4 of the second and 1 of the third overlapping, and 2 + 10 of the last */
+	CHECK_EQ(stream.stats().duplicate, 4U + 4U + 1U + 12U);
+}
+
+TEST_CASE("tcp_stream_t - sequence number wraparound") {
+	capture_t capture{"0123456789abcdefghij"};
+	tcp_stream_t stream{};
+	stream.syn(0xFFFF'FFF5U);
+
+	stream.push(0x0000'0004U, capture.segment(14U, 6U));
+	stream.push(0xFFFF'FFF6U, capture.segment(0U, 8U));
+	stream.push(0xFFFF'FFFEU, capture.segment(8U, 6U));
+	CHECK_EQ(take_all(stream), capture.text);
+	CHECK_EQ(stream.next(), 20U);
+
+	/* Something from well before the window is old, not a long way ahead */
+	stream.push(0xFFFF'FFF6U, capture.segment(0U, 4U));
+	CHECK_EQ(stream.buffered(), 0zu);
+	CHECK_EQ(stream.stats().duplicate, 4U);
+}
+
+TEST_CASE("tcp_stream_t - picked up mid stream") {
+	capture_t capture{"0123456789"};
+	tcp_stream_t stream{};
+
+	stream.push(5000U, capture.segment(5U, 5U));
+	/* From before where the stream was picked up */
+	stream.push(4995U, capture.segment(0U, 5U));
+	CHECK_EQ(take_all(stream), "56789");
+	CHECK_EQ(stream.stats().duplicate, 5U);
+}
+
+TEST_CASE("tcp_stream_t - buffering limit") {
+	capture_t capture{"0123456789abcdefghij"};
+	tcp_reassembly_config_t config{};
+	config.max_buffered = 8zu;
+	tcp_stream_t stream{config};
+	stream.syn(0U);
+
+	stream.push(5U, capture.segment(4U, 4U));
+	stream.push(9U, capture.segment(8U, 4U));
+	/* This one does not fit, so it is dropped until it comes again */
+	stream.push(13U, capture.segment(12U, 4U));
+	CHECK_EQ(stream.buffered(), 8zu);
+	CHECK_EQ(stream.stats().dropped, 4U);
+
+	/* In order data is never held back by the limit, even when it runs over what is buffered */
+	stream.push(1U, capture.segment(0U, 16U));
+	CHECK_EQ(stream.buffered(), 0zu);
+	CHECK_EQ(take_all(stream), capture.text.substr(0U, 16U));
+	CHECK_EQ(stream.stats().dropped, 4U);
+}
+
+TEST_CASE("tcp_stream_t - deliver what you have") {
+	capture_t capture{"0123456789abcdefghijklmnopqrstuvwxyz"};
+	tcp_reassembly_config_t config{};
+	config.max_buffered = 8zu;
+	config.lossy = true;
+	tcp_stream_t stream{config};
+	stream.syn(0U);
+
+	stream.push(1U, capture.segment(0U, 4U));
+	/* [4, 8) is never captured */
+	stream.push(9U, capture.segment(8U, 4U));
+	stream.push(13U, capture.segment(12U, 4U));
+	CHECK_EQ(stream.buffered(), 8zu);
+	/* Going over the limit skips the hole */
+	stream.push(17U, capture.segment(16U, 4U));
+	CHECK_EQ(stream.buffered(), 0zu);
+	CHECK_EQ(stream.next(), 20U);
+	CHECK_EQ(stream.stats().missing, 4U);
+
+	auto first{stream.take()};
+	REQUIRE(first.has_value());
+	CHECK_EQ(first->offset, 0U);
+	CHECK_EQ(string_of(first->data), "0123");
+	auto second{stream.take()};
+	REQUIRE(second.has_value());
+	CHECK_EQ(second->offset, 8U);
+	CHECK_EQ(second->missing, 4U);
+	CHECK_EQ(string_of(second->data), "89abcdefghij");
+
+	/* The hole being filled late is too late */
+	stream.push(5U, capture.segment(4U, 4U));
+	CHECK_FALSE(stream.take().has_value());
+
+	/* Flushing delivers everything that is held, across every hole */
+	stream.push(25U, capture.segment(24U, 4U));
+	stream.push(33U, capture.segment(32U, 4U));
+	CHECK_EQ(stream.segments(), 2zu);
+	stream.flush();
+	CHECK_EQ(stream.segments(), 0zu);
+	std::uint64_t missing{};
+	CHECK_EQ(take_all(stream, &missing), "opqrwxyz");
+	CHECK_EQ(missing, 8U);
+	CHECK_EQ(stream.stats().missing, 12U);
+}
+
+TEST_CASE("tcp_streams_t - both directions") {
+	capture_t capture{"requestresponse"};
+	tcp_streams_t conversation{};
+	conversation[flow_direction_t::Forward].syn(100U);
+	conversation[flow_direction_t::Reverse].syn(9000U);
+
+	conversation[flow_direction_t::Reverse].push(9001U, capture.segment(7U, 8U));
+	conversation[flow_direction_t::Forward].push(108U, capture.segment(0U, 7U));
+	CHECK_EQ(conversation.buffered(), 7zu);
+	CHECK_EQ(take_all(conversation[flow_direction_t::Reverse]), "response");
+	CHECK_FALSE(conversation[flow_direction_t::Forward].take().has_value());
+}
+
+TEST_CASE("tcp_stream_t - shuffled segments") {
+	std::string text(4096zu, '\0');
+	for (std::size_t idx{}; idx < text.size(); ++idx) {
+		text[idx] = static_cast<char>('a' + (idx % 26zu));
+	}
+	capture_t capture{text};
+
+	/* Segments of varied sizes, some duplicated, in a scrambled order */
+	struct piece_t final {
+		std::size_t offset;
+		std::size_t length;
+	};
+	std::vector<piece_t> pieces{};
+	std::uint32_t state{0xC0FF'EE00U};
+	for (std::size_t offset{}; offset < text.size();) {
+		state = state * 1'664'525U + 1'013'904'223U;
+		const auto length{std::min<std::size_t>(1zu + ((state >> 8U) % 200zu), text.size() - offset)};
+		pieces.push_back({offset, length});
+		if ((state & 3U) == 0U) {
+			pieces.push_back({offset, length});
+		}
+		offset += length;
+	}
+	for (std::size_t idx{pieces.size() - 1zu}; idx > 0zu; --idx) {
+		state = state * 1'664'525U + 1'013'904'223U;
+		std::swap(pieces[idx], pieces[(state >> 8U) % (idx + 1zu)]);
+	}
+
+	tcp_stream_t stream{};
+	stream.syn(0xFFFF'F000U);
+	std::string out{};
+	for (const auto& piece : pieces) {
+		stream.push(
+			static_cast<std::uint32_t>(0xFFFF'F001U + piece.offset), capture.segment(piece.offset, piece.length)
+		);
+		out += take_all(stream);
+	}
+	CHECK_EQ(out, text);
+	CHECK_EQ(stream.buffered(), 0zu);
+	CHECK_EQ(stream.stats().delivered, text.size());
+}
@@ -1,8 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 /* leb128.cc - LEB128 encode/decode test harness */
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <random>
+#include <span>
 #include <limits>
 #include <vector>
 #include <ostream>
@@ -46,8 +49,19 @@ std::uniform_int_distribution<std::uint16_t> uint16_dist{std::numeric_limits<std
 std::uniform_int_distribution<std::uint32_t> uint32_dist{std::numeric_limits<std::uint32_t>::min()};
 std::uniform_int_distribution<std::uint64_t> uint64_dist{std::numeric_limits<std::uint64_t>::min()};
 
-using Panko::support::leb128_encode;
+using Panko::core::bytearray_t;
+using Panko::core::error_codes::read_error_t;
 using Panko::support::leb128_decode;
+using Panko::support::leb128_decode_run;
+using Panko::support::leb128_encode;
+using Panko::support::leb128_max_size_v;
+using Panko::support::leb128_size;
+using Panko::support::quic_varint_decode;
+using Panko::support::quic_varint_encode;
+using Panko::support::quic_varint_max;
+using Panko::support::quic_varint_size;
+using Panko::support::zigzag_decode;
+using Panko::support::zigzag_encode;
 
 constexpr static std::size_t chk_itr{128zu};
 
@@ -402,3 +416,248 @@ TEST_CASE("leb128 - round-trip - uint64_t") {
 		CHECK_EQ(input, dec_val);
 	}
 }
+
+namespace {
+	template<typename T, typename D>
+	void check_buffer_round_trip(D& dist) {
+		std::array<std::byte, leb128_max_size_v<T>> buff{};
+		for (std::size_t i{}; i < (chk_itr * 4zu); ++i) {
+			const auto input{static_cast<T>(dist(rand_dev))};
+			const auto len{leb128_encode<T>(input, std::span{buff})};
+			REQUIRE(len != 0zu);
+			CHECK_EQ(len, leb128_size<T>(input));
+			CHECK_EQ(len, leb128_encode<T>(input).size());
+
+			const auto dec{leb128_decode<T>(std::span<const std::byte>{buff})};
+			REQUIRE(dec.has_value());
+			CHECK_EQ(dec->value, input);
+			CHECK_EQ(dec->length, len);
+		}
+	}
+
+	template<std::size_t len>
+	[[nodiscard]]
+	std::array<std::byte, len> as_bytes(const std::array<std::uint8_t, len>& data) noexcept {
+		std::array<std::byte, len> bytes{};
+		for (std::size_t idx{}; idx < len; ++idx) {
+			bytes[idx] = std::byte{data[idx]};
+		}
+		return bytes;
+	}
+}
+
+TEST_CASE("leb128 - encode into buffer") {
+	std::array<std::byte, 10> buff{};
+
+	CHECK_EQ(leb128_encode<std::int32_t>(-21574836, std::span{buff}), 4zu);
+	CHECK(std::span{buff}.first(4zu)[0] == std::byte{0xCCU});
+	CHECK(std::span{buff}.first(4zu)[3] == std::byte{0x75U});
+
+	CHECK_EQ(leb128_encode<std::uint64_t>(~0ULL, std::span{buff}), 10zu);
+	CHECK(buff[9] == std::byte{0x01U});
+
+	/* Too small a buffer encodes nothing */
+	CHECK_EQ(leb128_encode<std::uint32_t>(300U, std::span{buff}.first(1zu)), 0zu);
+	CHECK_EQ(leb128_encode<std::uint32_t>(300U, std::span{buff}.first(2zu)), 2zu);
+
+	CHECK_EQ(leb128_size<std::uint8_t>(0U), 1zu);
+	CHECK_EQ(leb128_size<std::uint8_t>(0x80U), 2zu);
+	CHECK_EQ(leb128_size<std::int8_t>(-64), 1zu);
+	CHECK_EQ(leb128_size<std::int8_t>(-65), 2zu);
+	CHECK_EQ(leb128_size<std::int64_t>(std::numeric_limits<std::int64_t>::min()), 10zu);
+}
+
+TEST_CASE("leb128 - decode from buffer") {
+	/* Trailing bytes are left alone */
+	const auto values{as_bytes<6>({{0xE5U, 0x8EU, 0x26U, 0xFFU, 0xFFU, 0xFFU}})};
+	const auto uval{leb128_decode<std::uint32_t>(std::span<const std::byte>{values})};
+	REQUIRE(uval.has_value());
+	CHECK_EQ(uval->value, 624485U);
+	CHECK_EQ(uval->length, 3zu);
+
+	const auto sval{leb128_decode<std::int32_t>(std::span<const std::byte>{values}.first(3zu))};
+	REQUIRE(sval.has_value());
+	CHECK_EQ(sval->value, 624485);
+
+	/* -123456 */
+	const auto neg{as_bytes<3>({{0xC0U, 0xBBU, 0x78U}})};
+	CHECK_EQ(leb128_decode<std::int32_t>(std::span<const std::byte>{neg})->value, -123456);
+	CHECK_EQ(leb128_decode<std::int64_t>(std::span<const std::byte>{neg})->value, -123456);
+
+	/* Redundant padding is fine, up to the longest encoding of the type */
+	const auto padded{as_bytes<5>({{0x80U, 0x80U, 0x80U, 0x80U, 0x00U}})};
+	const auto zero{leb128_decode<std::uint32_t>(std::span<const std::byte>{padded})};
+	REQUIRE(zero.has_value());
+	CHECK_EQ(zero->value, 0U);
+	CHECK_EQ(zero->length, 5zu);
+	CHECK_EQ(leb128_decode<std::uint16_t>(std::span<const std::byte>{padded}).error(), read_error_t::Malformed);
+
+	std::vector<std::uint8_t> data{0x00U, 0xE5U, 0x8EU, 0x26U};
+	bytearray_t buff{data};
+	CHECK_EQ(leb128_decode<std::uint32_t>(buff, 1zu)->value, 624485U);
+	CHECK_EQ(leb128_decode<std::uint32_t>(buff, 4zu).error(), read_error_t::Truncated);
+	CHECK_EQ(leb128_decode<std::uint32_t>(buff, 5zu).error(), read_error_t::Truncated);
+}
+
+TEST_CASE("leb128 - decode - malformed") {
+	/* Runs out of bytes */
+	const auto truncated{as_bytes<2>({{0xE5U, 0x8EU}})};
+	CHECK_EQ(leb128_decode<std::uint32_t>(std::span<const std::byte>{truncated}).error(), read_error_t::Truncated);
+	CHECK_EQ(leb128_decode<std::uint32_t>(std::span<const std::byte>{}).error(), read_error_t::Truncated);
+
+	/* Too many bytes */
+	const auto overlong{as_bytes<6>({{0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x8FU, 0x00U}})};
+	CHECK_EQ(leb128_decode<std::uint32_t>(std::span<const std::byte>{overlong}).error(), read_error_t::Malformed);
+
+	/* Too many bits, the 5th byte of a uint32_t only has 4 */
+	const auto max_u32{as_bytes<5>({{0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x0FU}})};
+	CHECK_EQ(leb128_decode<std::uint32_t>(std::span<const std::byte>{max_u32})->value, 0xFFFF'FFFFU);
+	const auto over_u32{as_bytes<5>({{0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x1FU}})};
+	CHECK_EQ(leb128_decode<std::uint32_t>(std::span<const std::byte>{over_u32}).error(), read_error_t::Malformed);
+
+	/* And for signed types those bits must all be copies of the sign bit */
+	const auto min_i8{as_bytes<2>({{0x80U, 0x7FU}})};
+	CHECK_EQ(leb128_decode<std::int8_t>(std::span<const std::byte>{min_i8})->value, std::int8_t{-128});
+	const auto over_i8{as_bytes<2>({{0x80U, 0x3FU}})};
+	CHECK_EQ(leb128_decode<std::int8_t>(std::span<const std::byte>{over_i8}).error(), read_error_t::Malformed);
+	const auto max_i32{as_bytes<5>({{0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x07U}})};
+	CHECK_EQ(leb128_decode<std::int32_t>(std::span<const std::byte>{max_i32})->value, std::numeric_limits<std::int32_t>::max());
+	const auto over_i32{as_bytes<5>({{0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x0FU}})};
+	CHECK_EQ(leb128_decode<std::int32_t>(std::span<const std::byte>{over_i32}).error(), read_error_t::Malformed);
+}
+
+TEST_CASE("leb128 - round-trip - buffers") {
+	check_buffer_round_trip<std::int8_t>(int8_dist);
+	check_buffer_round_trip<std::int16_t>(int16_dist);
+	check_buffer_round_trip<std::int32_t>(int32_dist);
+	check_buffer_round_trip<std::int64_t>(int64_dist);
+	check_buffer_round_trip<std::uint8_t>(uint8_dist);
+	check_buffer_round_trip<std::uint16_t>(uint16_dist);
+	check_buffer_round_trip<std::uint32_t>(uint32_dist);
+	check_buffer_round_trip<std::uint64_t>(uint64_dist);
+}
+
+TEST_CASE("leb128 - decode run") {
+	std::uniform_int_distribution<std::uint32_t> shift_dist{0U, 63U};
+	std::uniform_int_distribution<std::uint32_t> small_dist{0U, 3U};
+
+	/* Mostly single byte values, with the odd longer one so windows are both widened and walked */
+	std::vector<std::uint64_t> values(4096zu);
+	for (auto& value : values) {
+		value = (small_dist(rand_dev) != 0U) ? (uint64_dist(rand_dev) & 0x7FU) : (uint64_dist(rand_dev) >> shift_dist(rand_dev));
+	}
+	values[100] = ~0ULL;
+	values[101] = 0x8000'0000'0000'0000ULL;
+	values[102] = 0xFF'FFFF'FFFF'FFFFULL;
+
+	std::vector<std::byte> enc(values.size() * leb128_max_size_v<std::uint64_t>);
+	std::size_t len{};
+	for (const auto value : values) {
+		len += leb128_encode<std::uint64_t>(value, std::span{enc}.subspan(len));
+	}
+	enc.resize(len);
+
+	std::vector<std::uint64_t> dec(values.size());
+	const auto run{leb128_decode_run(std::span<const std::byte>{enc}, std::span{dec})};
+	CHECK_EQ(run.count, values.size());
+	CHECK_EQ(run.length, len);
+	CHECK(dec == values);
+
+	/* Only as many as fit */
+	std::vector<std::uint64_t> partial(37zu);
+	const auto first{leb128_decode_run(std::span<const std::byte>{enc}, std::span{partial})};
+	CHECK_EQ(first.count, partial.size());
+	CHECK(std::equal(partial.begin(), partial.end(), values.begin()));
+
+	/* Values too large for a uint32_t stop the run there */
+	std::vector<std::uint32_t> narrow(values.size());
+	const auto stop{leb128_decode_run(std::span<const std::byte>{enc}, std::span{narrow})};
+	std::size_t fits{};
+	while (values[fits] <= 0xFFFF'FFFFU) {
+		CHECK_EQ(narrow[fits], values[fits]);
+		++fits;
+	}
+	CHECK_EQ(stop.count, fits);
+	CHECK_EQ(leb128_decode<std::uint32_t>(std::span<const std::byte>{enc}.subspan(stop.length)).error(), read_error_t::Malformed);
+
+	/* Every uint32_t value length, at every offset into a window */
+	std::vector<std::uint32_t> values32{};
+	for (std::size_t idx{}; idx < 2048zu; ++idx) {
+		values32.push_back(static_cast<std::uint32_t>(uint32_dist(rand_dev) >> (idx % 33zu) % 32zu));
+	}
+	std::vector<std::byte> enc32(values32.size() * leb128_max_size_v<std::uint32_t>);
+	len = 0zu;
+	for (const auto value : values32) {
+		len += leb128_encode<std::uint32_t>(value, std::span{enc32}.subspan(len));
+	}
+
+	std::vector<std::uint32_t> dec32(values32.size());
+	for (const auto trim : {0zu, 1zu, 17zu}) {
+		/* Cut off part way through the last value */
+		const auto src{std::span<const std::byte>{enc32}.first(len - trim)};
+		const auto res{leb128_decode_run(src, std::span{dec32})};
+		CHECK_EQ(res.count, (trim == 0zu) ? values32.size() : res.count);
+		for (std::size_t idx{}; idx < res.count; ++idx) {
+			CHECK_EQ(dec32[idx], values32[idx]);
+		}
+		if (trim != 0zu) {
+			CHECK(res.count < values32.size());
+			CHECK_EQ(leb128_decode<std::uint32_t>(src.subspan(res.length)).error(), read_error_t::Truncated);
+		}
+	}
+}
+
+TEST_CASE("zigzag") {
+	CHECK_EQ(zigzag_encode<std::int32_t>(0), 0U);
+	CHECK_EQ(zigzag_encode<std::int32_t>(-1), 1U);
+	CHECK_EQ(zigzag_encode<std::int32_t>(1), 2U);
+	CHECK_EQ(zigzag_encode<std::int32_t>(-2), 3U);
+	CHECK_EQ(zigzag_encode<std::int32_t>(std::numeric_limits<std::int32_t>::max()), 0xFFFF'FFFEU);
+	CHECK_EQ(zigzag_encode<std::int32_t>(std::numeric_limits<std::int32_t>::min()), 0xFFFF'FFFFU);
+	CHECK_EQ(zigzag_encode<std::int8_t>(-64), std::uint8_t{127U});
+
+	for (std::size_t i{}; i < (chk_itr * 4zu); ++i) {
+		const auto input{int64_dist(rand_dev)};
+		CHECK_EQ(zigzag_decode<std::uint64_t>(zigzag_encode<std::int64_t>(input)), input);
+	}
+}
+
+TEST_CASE("quic varint") {
+	/* RFC 9000 Appendix A.1 */
+	const auto eight{as_bytes<8>({{0xC2U, 0x19U, 0x7CU, 0x5EU, 0xFFU, 0x14U, 0xE8U, 0x8CU}})};
+	const auto four{as_bytes<4>({{0x9DU, 0x7FU, 0x3EU, 0x7DU}})};
+	const auto two{as_bytes<2>({{0x7BU, 0xBDU}})};
+	const auto one{as_bytes<1>({{0x25U}})};
+	const auto long_one{as_bytes<2>({{0x40U, 0x25U}})};
+
+	CHECK_EQ(quic_varint_decode(std::span<const std::byte>{eight})->value, 151'288'809'941'952'652ULL);
+	CHECK_EQ(quic_varint_decode(std::span<const std::byte>{four})->value, 494'878'333U);
+	CHECK_EQ(quic_varint_decode(std::span<const std::byte>{two})->value, 15'293U);
+	CHECK_EQ(quic_varint_decode(std::span<const std::byte>{one})->value, 37U);
+
+	/* Longer than needed encodings are allowed, but can be spotted */
+	const auto padded{quic_varint_decode(std::span<const std::byte>{long_one})};
+	REQUIRE(padded.has_value());
+	CHECK_EQ(padded->value, 37U);
+	CHECK_EQ(padded->length, 2zu);
+	CHECK_EQ(quic_varint_size(padded->value), 1zu);
+
+	CHECK_EQ(quic_varint_decode(std::span<const std::byte>{eight}.first(7zu)).error(), read_error_t::Truncated);
+	CHECK_EQ(quic_varint_decode(std::span<const std::byte>{}).error(), read_error_t::Truncated);
+
+	std::vector<std::uint8_t> data{0x00U, 0x7BU, 0xBDU};
+	bytearray_t buff{data};
+	CHECK_EQ(quic_varint_decode(buff, 1zu)->value, 15'293U);
+	CHECK_EQ(quic_varint_decode(buff, 2zu).error(), read_error_t::Truncated);
+
+	std::array<std::byte, 8> enc{};
+	CHECK_EQ(quic_varint_encode(151'288'809'941'952'652ULL, std::span{enc}), 8zu);
+	CHECK(enc == eight);
+	CHECK_EQ(quic_varint_encode(494'878'333U, std::span{enc}), 4zu);
+	CHECK(std::span{enc}.first(4zu)[0] == four[0]);
+	CHECK(std::span{enc}.first(4zu)[3] == four[3]);
+	CHECK_EQ(quic_varint_encode(15'293U, std::span{enc}.first(1zu)), 0zu);
+	CHECK_EQ(quic_varint_encode(quic_varint_max + 1U, std::span{enc}), 0zu);
+	CHECK_EQ(quic_varint_encode(quic_varint_max, std::span{enc}), 8zu);
+	CHECK_EQ(quic_varint_decode(std::span<const std::byte>{enc})->value, quic_varint_max);
+}
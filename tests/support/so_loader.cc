@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* so_loader.cc - Native dissector loader test harness */
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "panko/core/errcodes.hh"
+#include "panko/support/so_loader.hh"
+
+using namespace std::literals::string_view_literals;
+
+using Panko::core::error_codes::so_error_message;
+using Panko::support::registration_kind_t;
+using Panko::support::so_cache_t;
+using Panko::support::so_error_t;
+using Panko::support::so_loader_t;
+
+namespace fs = std::filesystem;
+
+namespace {
+	const fs::path modules{PANKO_TEST_SO_DIR};
+
+	/* A scratch directory holding copies of some of the test dissectors */
+	struct scratch_t final {
+		fs::path dir;
+
+		scratch_t(const std::string_view name, const std::initializer_list<std::string_view> dissectors) :
+			dir{fs::temp_directory_path() / name}
+		{
+			fs::remove_all(dir);
+			fs::create_directories(dir);
+			for (const auto dissector : dissectors) {
+				fs::copy_file(modules / dissector, dir / dissector);
+			}
+		}
+
+		~scratch_t() noexcept {
+			std::error_code err{};
+			fs::remove_all(dir, err);
+		}
+	};
+}
+
+TEST_CASE("so_loader_t - load") {
+	so_loader_t loader{};
+
+	const auto id{loader.load(modules / "so_loader_good.so")};
+	REQUIRE(id.has_value());
+	CHECK_EQ(*id, 0U);
+	CHECK_EQ(loader.size(), 1zu);
+	CHECK_EQ(loader.plugin(*id).name, "good"sv);
+	CHECK_EQ(loader.plugin(*id).description, "so_loader_t test dissector"sv);
+	CHECK_EQ(loader.find("good"sv), *id);
+	CHECK_FALSE(loader.find("bad"sv).has_value());
+
+	/* The dispatch table holds the entry points directly */
+	const std::array<std::uint8_t, 4> data{{0x40U, 0x01U, 0x02U, 0x03U}};
+	CHECK_EQ(loader[*id].dissect(data.data(), data.size(), nullptr), 2zu);
+	CHECK(loader[*id].heuristic(data.data(), data.size()));
+	CHECK_FALSE(loader.dispatch()[*id].heuristic(data.data() + 1zu, data.size() - 1zu));
+
+	const auto registrations{loader.registrations(*id)};
+	REQUIRE_EQ(registrations.size(), 2zu);
+	CHECK(registrations[0].kind == registration_kind_t::UdpPort);
+	CHECK_EQ(registrations[0].value, 5683U);
+}
+
+TEST_CASE("so_loader_t - load failures") {
+	so_loader_t loader{};
+
+	CHECK_EQ(loader.load(modules / "does_not_exist.so").error(), so_error_t::OpenFailed);
+	CHECK_EQ(loader.load(modules / "so_loader_no_entry.so").error(), so_error_t::NoEntryPoint);
+	CHECK_EQ(loader.load(modules / "so_loader_abi.so").error(), so_error_t::AbiMismatch);
+	CHECK_EQ(loader.load(modules / "so_loader_init.so").error(), so_error_t::InitFailed);
+	CHECK_EQ(loader.size(), 0zu);
+
+	CHECK_FALSE(so_error_message(so_error_t::AbiMismatch).empty());
+	CHECK_FALSE(so_error_message(so_error_t::Unspecified).empty());
+}
+
+TEST_CASE("so_loader_t - load_dirs") {
+	const scratch_t first{"panko-so-loader-a"sv, {"so_loader_good.so"sv, "so_loader_abi.so"sv}};
+	const scratch_t second{"panko-so-loader-b"sv, {"so_loader_no_entry.so"sv, "so_loader_other.so"sv}};
+	const std::array<fs::path, 3> dirs{{first.dir, second.dir, first.dir / "missing"}};
+	const auto cache_file{first.dir / "cache"};
+
+	so_cache_t cache{};
+	{
+		so_loader_t loader{};
+		CHECK_EQ(loader.load_dirs(dirs, &cache), 2zu);
+		CHECK(loader.find("good"sv).has_value());
+		CHECK(loader.find("other"sv).has_value());
+
+		/* The ABI mismatch and both good dissectors are worth remembering, but not the non-dissector */
+		CHECK(cache.dirty());
+		CHECK_EQ(cache.manifests().size(), 3zu);
+		CHECK(cache.save(cache_file));
+		CHECK_FALSE(cache.dirty());
+	}
+
+	auto reloaded{so_cache_t::load(cache_file)};
+	CHECK_EQ(reloaded.manifests().size(), 3zu);
+
+	const auto* const abi{reloaded.find(
+		first.dir / "so_loader_abi.so", fs::file_size(first.dir / "so_loader_abi.so"),
+		fs::last_write_time(first.dir / "so_loader_abi.so").time_since_epoch().count()
+	)};
+	REQUIRE(abi != nullptr);
+	CHECK_EQ(abi->abi_version, 99U);
+
+	const auto good_path{first.dir / "so_loader_good.so"};
+	const auto* const good{reloaded.find(
+		good_path, fs::file_size(good_path), fs::last_write_time(good_path).time_since_epoch().count()
+	)};
+	REQUIRE(good != nullptr);
+	CHECK_EQ(good->name, "good"sv);
+	REQUIRE_EQ(good->registrations.size(), 2zu);
+	CHECK(good->registrations[1].kind == registration_kind_t::Heuristic);
+	CHECK_EQ(good->registrations[1].value, 4U);
+
+	/* A changed file does not match its old manifest */
+	CHECK(reloaded.find(good_path, 1U, 0) == nullptr);
+
+	{
+		so_loader_t loader{};
+		/* Nothing has changed, so the cache has nothing new to learn */
+		CHECK_EQ(loader.load_dirs(dirs, &reloaded), 2zu);
+		CHECK_FALSE(reloaded.dirty());
+	}
+
+	/* A corrupt or missing cache is just empty */
+	CHECK(so_cache_t::load(first.dir / "missing").manifests().empty());
+	CHECK(so_cache_t::load(first.dir / "so_loader_good.so").manifests().empty());
+}
+
+TEST_CASE("so_loader_t - resolve") {
+	so_loader_t loader{};
+	CHECK(loader.resolve_all(registration_kind_t::UdpPort, 5683U).empty());
+
+	const auto id{loader.load(modules / "so_loader_good.so")};
+	REQUIRE(id.has_value());
+
+	/* Eagerly loaded dissectors are indexed too */
+	CHECK_EQ(loader.resolve(registration_kind_t::UdpPort, 5683U), *id);
+	CHECK_EQ(loader.resolve(registration_kind_t::Heuristic, 4U), *id);
+	CHECK_FALSE(loader.resolve(registration_kind_t::TcpPort, 5683U).has_value());
+	CHECK_EQ(loader.unloaded(), 0zu);
+}
+
+TEST_CASE("so_loader_t - index_dirs") {
+	const scratch_t dir{"panko-so-loader-lazy"sv, {"so_loader_good.so"sv, "so_loader_other.so"sv, "so_loader_abi.so"sv}};
+	const std::array<fs::path, 1> dirs{{dir.dir}};
+
+	/* The first run has to load everything to learn what it registers */
+	so_cache_t cache{};
+	{
+		so_loader_t loader{};
+		CHECK_EQ(loader.index_dirs(dirs, cache), 2zu);
+		CHECK_EQ(loader.size(), 2zu);
+		CHECK_EQ(loader.unloaded(), 0zu);
+		CHECK_EQ(cache.manifests().size(), 3zu);
+	}
+
+	/* After that, nothing is loaded until it is needed */
+	so_loader_t loader{};
+	CHECK_EQ(loader.index_dirs(dirs, cache), 2zu);
+	CHECK_EQ(loader.size(), 0zu);
+	CHECK_EQ(loader.unloaded(), 2zu);
+	CHECK_EQ(loader.unloaded_registrations().size(), 2zu);
+
+	CHECK(loader.resolve_all(registration_kind_t::TcpPort, 5683U).empty());
+	CHECK_EQ(loader.size(), 0zu);
+
+	const auto heuristics{loader.resolve_all(registration_kind_t::Heuristic, 4U)};
+	REQUIRE_EQ(heuristics.size(), 2zu);
+	CHECK_EQ(loader.size(), 2zu);
+	CHECK_EQ(loader.unloaded(), 0zu);
+	CHECK(loader.unloaded_registrations().empty());
+	CHECK_EQ(loader.plugin(heuristics[0]).name, "good"sv);
+	CHECK_EQ(loader.plugin(heuristics[1]).name, "other"sv);
+
+	/* Both were loaded for the heuristic, so the port resolves without loading anything again */
+	const auto port{loader.resolve_all(registration_kind_t::UdpPort, 5683U)};
+	CHECK_EQ(port.size(), 2zu);
+	CHECK_EQ(loader.size(), 2zu);
+
+	const std::array<std::uint8_t, 2> data{{0x40U, 0x00U}};
+	CHECK_EQ(loader[port[0]].dissect(data.data(), data.size(), nullptr), 1zu);
+}
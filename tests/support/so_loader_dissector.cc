@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* so_loader_dissector.cc - Native dissector for the so_loader_t test harness */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "panko/support/so_loader.hh"
+
+using Panko::support::dissector_abi_version;
+using Panko::support::dissector_descriptor_t;
+using Panko::support::registration_kind_t;
+using Panko::support::registration_t;
+
+#if !defined(TEST_ABI_VERSION)
+#	define TEST_ABI_VERSION dissector_abi_version
+#endif
+
+#if !defined(TEST_NAME)
+#	define TEST_NAME "test"
+#endif
+
+namespace {
+#if defined(TEST_NO_HEURISTIC)
+	constexpr static std::array<registration_t, 2> registrations{{
+		{ registration_kind_t::UdpPort,   5684U },
+		{ registration_kind_t::TcpPort,   5684U },
+	}};
+#else
+	constexpr static std::array<registration_t, 2> registrations{{
+		{ registration_kind_t::UdpPort,   5683U },
+		{ registration_kind_t::Heuristic, static_cast<std::uint32_t>(registration_kind_t::UdpPort) },
+	}};
+#endif
+
+	bool init() {
+#if defined(TEST_INIT_FAILS)
+		return false;
+#else
+		return true;
+#endif
+	}
+
+	std::size_t dissect(const std::uint8_t* const data, const std::size_t len, void* const ctx) {
+		static_cast<void>(data);
+		static_cast<void>(ctx);
+		return len / 2zu;
+	}
+
+	bool heuristic(const std::uint8_t* const data, const std::size_t len) {
+		return len != 0zu && data[0] == 0x40U;
+	}
+
+	constexpr static dissector_descriptor_t descriptor{
+		.abi_version        = TEST_ABI_VERSION,
+		.size               = sizeof(dissector_descriptor_t),
+		.name               = TEST_NAME,
+		.description        = "so_loader_t test dissector",
+		.registrations      = registrations.data(),
+		.registration_count = registrations.size(),
+		.init               = init,
+		.fini               = nullptr,
+		.dissect            = dissect,
+		.heuristic          = heuristic,
+	};
+}
+
+#if !defined(TEST_NO_ENTRY)
+PANKO_DISSECTOR_EXPORT const dissector_descriptor_t* panko_dissector_entry() {
+	return &descriptor;
+}
+#endif